@@ -0,0 +1,641 @@
+/*
+-------------------------------------------------------------------------------
+Name:
+	FMEM | Bench
+
+Description:
+	Benchmark suite for choosing allocator strategies and catching regressions.
+	Compares fmem (fixed, growable, best fit, temporary, virtual, concurrent, thread cache) against malloc, fplMemoryAllocate and fplMemoryAlignedAllocate.
+
+	Every single-threaded allocator runs every lifetime pattern with every size class:
+	- Patterns:
+		bulk: Allocations in batches of 1024, the whole batch is released at once (fmemReset for blocks)
+		scoped: Nested scopes with a depth of 4 and 16 allocations each, released in reverse order (fmemBeginScratchFrom/fmemEndScratch for blocks)
+		longlived: Nothing is released until the end
+	- Size classes:
+		small: 8 to 64 bytes, runs the full operation count
+		medium: 128 to 2048 bytes, runs 1/32 of the operation count
+		large: 4 to 64 KB, runs 1/1024 of the operation count
+	The multi-threaded allocators (malloc, fpl, fplaligned, fmem_concurrent, fmem_threadcache) run the longlived pattern with every size class.
+
+	The last batch or scope of each run stays alive while the resident set size is measured.
+	Reserved is the total size of all blocks for fmem and the growth of the resident set size for the heap allocators.
+	Fragmentation is the part of the reserved memory which is not used by live allocations: 1 - live / reserved.
+
+	Prints one line per run in the form:
+	allocator=<name> pattern=<name> sizes=<name> threads=<count> ops=<count> failed=<count> seconds=<secs> mops=<million ops per second> requested_kb=<kb> live_kb=<kb> reserved_kb=<kb> rss_kb=<kb> fragmentation=<ratio>
+	With format "json" each line is a JSON object with the same keys instead.
+
+	Usage: FMEM_Bench [--help] [ops] [initial block size in kilobytes] [thread count] [filter] [text|json]
+	The filter is matched against "<allocator>/<pattern>/<sizes>", for example "fmem_" or "/scoped/" or "all".
+
+	fplMemoryAllocate maps pages for each allocation, so the live allocations of the fpl allocators are limited to 16384 to stay below the process map limit.
+
+Requirements:
+	- C99
+	- Final Memory
+	- Final Platform Layer
+
+Author:
+	Torsten Spaete
+
+Changelog:
+	## 2026-10-18
+	- Initial version
+	- Added concurrent and thread cache modes
+	- Turned into a benchmark suite comparing fmem with malloc, fplMemoryAllocate and fplMemoryAlignedAllocate
+	- Added lifetime patterns, size classes, resident set size and fragmentation
+	- Added filter and json output
+
+License:
+	Copyright (c) 2017-2020 Torsten Spaete
+	MIT License (See LICENSE file)
+-------------------------------------------------------------------------------
+*/
+
+#define FPL_IMPLEMENTATION
+#define FPL_NO_WINDOW
+#define FPL_NO_VIDEO
+#define FPL_NO_AUDIO
+#include <final_platform_layer.h>
+
+#define FMEM_IMPLEMENTATION
+#include <final_memory.h>
+
+#include <stdlib.h> // atoi, malloc, free
+#include <stdio.h> // fopen, fscanf
+#include <string.h> // strstr, strcmp
+
+#if defined(FPL_PLATFORM_WINDOWS)
+#	include <psapi.h> // K32GetProcessMemoryInfo
+#endif
+
+typedef enum AllocatorKind {
+	AllocatorKind_Malloc,
+	AllocatorKind_FPL,
+	AllocatorKind_FPLAligned,
+	AllocatorKind_FmemFixed,
+	AllocatorKind_FmemGrowable,
+	AllocatorKind_FmemBestFit,
+	AllocatorKind_FmemTemporary,
+	AllocatorKind_FmemVirtual,
+	AllocatorKind_FmemConcurrent,
+	AllocatorKind_FmemThreadCache,
+} AllocatorKind;
+
+typedef struct BenchAllocator {
+	const char *name;
+	AllocatorKind kind;
+	bool singleThreaded;
+	bool multiThreaded;
+} BenchAllocator;
+
+static const BenchAllocator BenchAllocators[] = {
+	{ "malloc", AllocatorKind_Malloc, true, true },
+	{ "fpl", AllocatorKind_FPL, true, true },
+	{ "fplaligned", AllocatorKind_FPLAligned, true, true },
+	{ "fmem_fixed", AllocatorKind_FmemFixed, true, false },
+	{ "fmem_growable", AllocatorKind_FmemGrowable, true, false },
+	{ "fmem_bestfit", AllocatorKind_FmemBestFit, true, false },
+	{ "fmem_temporary", AllocatorKind_FmemTemporary, true, false },
+	{ "fmem_virtual", AllocatorKind_FmemVirtual, true, false },
+	{ "fmem_concurrent", AllocatorKind_FmemConcurrent, false, true },
+	{ "fmem_threadcache", AllocatorKind_FmemThreadCache, false, true },
+};
+
+typedef enum BenchPattern {
+	BenchPattern_Bulk,
+	BenchPattern_Scoped,
+	BenchPattern_LongLived,
+} BenchPattern;
+
+static const char *BenchPatternNames[] = {
+	"bulk",
+	"scoped",
+	"longlived",
+};
+
+typedef struct BenchSizeClass {
+	const char *name;
+	size_t minSize;
+	size_t step;
+	size_t opsDivisor;
+} BenchSizeClass;
+
+// Each size class has 16 sizes from minSize to minSize + 15 * step
+static const BenchSizeClass BenchSizeClasses[] = {
+	{ "small", 8, 8, 1 },
+	{ "medium", 128, 128, 32 },
+	{ "large", FMEM_KILOBYTES(4), FMEM_KILOBYTES(4), 1024 },
+};
+
+#define BENCH_BATCH_SIZE 1024
+#define BENCH_SCOPE_DEPTH 4
+#define BENCH_SCOPE_SIZE 16
+#define BENCH_ALIGNMENT 16
+#define BENCH_FPL_LIVE_LIMIT 16384
+#define MAX_BENCH_THREADS 64
+
+typedef enum BenchFormat {
+	BenchFormat_Text,
+	BenchFormat_JSON,
+} BenchFormat;
+
+typedef struct BenchResult {
+	size_t threads;
+	size_t ops;
+	size_t failed;
+	size_t requestedBytes;
+	size_t liveBytes;
+	size_t reservedBytes;
+	size_t rssBytes;
+	double seconds;
+} BenchResult;
+
+// State for one allocator in one thread, pointers are only tracked for the heap allocators
+typedef struct BenchState {
+	AllocatorKind kind;
+	fmemMemoryBlock root;
+	fmemMemoryBlock temporary;
+	fmemMemoryBlock *block;
+	fmemConcurrentBlock *concurrent;
+	fmemThreadCache cache;
+	fmemScratch scopes[BENCH_SCOPE_DEPTH];
+	size_t scopeStarts[BENCH_SCOPE_DEPTH];
+	void **pointers;
+	size_t pointerCount;
+	size_t pointerCapacity;
+	size_t liveBytes;
+	uint32_t rnd;
+} BenchState;
+
+typedef struct BenchWorker {
+	fplThreadHandle *thread;
+	BenchState state;
+	const BenchSizeClass *sizeClass;
+	size_t opCount;
+	size_t failed;
+	size_t requestedBytes;
+} BenchWorker;
+
+static bool IsHeapAllocator(const AllocatorKind kind) {
+	bool result = kind == AllocatorKind_Malloc || kind == AllocatorKind_FPL || kind == AllocatorKind_FPLAligned;
+	return(result);
+}
+
+static size_t GetResidentSize(void) {
+	size_t result = 0;
+#if defined(FPL_PLATFORM_WINDOWS)
+	PROCESS_MEMORY_COUNTERS counters;
+	if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+		result = counters.WorkingSetSize;
+	}
+#elif defined(FPL_PLATFORM_LINUX)
+	FILE *file = fopen("/proc/self/statm", "r");
+	if (file != fpl_null) {
+		unsigned long totalPages, residentPages;
+		if (fscanf(file, "%lu %lu", &totalPages, &residentPages) == 2) {
+			fplMemoryInfos infos = fplZeroInit;
+			fplGetRunningMemoryInfos(&infos);
+			size_t pageSize = infos.pageSize > 0 ? (size_t)infos.pageSize : 4096;
+			result = (size_t)residentPages * pageSize;
+		}
+		fclose(file);
+	}
+#endif
+	return(result);
+}
+
+static size_t NextSize(const BenchSizeClass *sizeClass, uint32_t *rnd) {
+	*rnd = *rnd * 1664525 + 1013904223;
+	size_t result = sizeClass->minSize + ((*rnd >> 24) & 15) * sizeClass->step;
+	return(result);
+}
+
+static size_t GetOpCount(const BenchSizeClass *sizeClass, const size_t ops) {
+	size_t result = ops / sizeClass->opsDivisor;
+	if (result == 0) {
+		result = 1;
+	}
+	return(result);
+}
+
+static bool InitState(BenchState *state, const AllocatorKind kind, const size_t maxLiveCount, const size_t maxLiveSize, const size_t initialSize, fmemConcurrentBlock *concurrent) {
+	fplClearStruct(state);
+	state->kind = kind;
+	state->rnd = 0x12345678 ^ (uint32_t)(uintptr_t)state;
+	bool result = true;
+	switch (kind) {
+		case AllocatorKind_Malloc:
+		case AllocatorKind_FPL:
+		case AllocatorKind_FPLAligned:
+		{
+			state->pointerCapacity = maxLiveCount;
+			state->pointers = (void **)malloc(sizeof(void *) * maxLiveCount);
+			result = state->pointers != fpl_null;
+		} break;
+
+		case AllocatorKind_FmemFixed:
+		{
+			// Worst case: Every push is padded to the alignment
+			result = fmemInit(&state->root, fmemType_Fixed, maxLiveSize + maxLiveCount * BENCH_ALIGNMENT);
+			state->block = &state->root;
+		} break;
+
+		case AllocatorKind_FmemGrowable:
+		case AllocatorKind_FmemBestFit:
+		{
+			result = fmemInit(&state->root, fmemType_Growable, initialSize);
+			state->block = &state->root;
+		} break;
+
+		case AllocatorKind_FmemTemporary:
+		{
+			result = fmemInit(&state->root, fmemType_Growable, maxLiveSize + maxLiveCount * BENCH_ALIGNMENT) && fmemBeginTemporary(&state->root, &state->temporary);
+			state->block = &state->temporary;
+		} break;
+
+		case AllocatorKind_FmemVirtual:
+		{
+			result = fmemInit(&state->root, fmemType_Virtual, 0);
+			state->block = &state->root;
+		} break;
+
+		case AllocatorKind_FmemConcurrent:
+		case AllocatorKind_FmemThreadCache:
+		{
+			state->concurrent = concurrent;
+			result = fmemThreadCacheInit(&state->cache, concurrent, 0);
+		} break;
+	}
+	if (result && state->block != fpl_null) {
+		fmemSetAlignment(state->block, BENCH_ALIGNMENT);
+	}
+	return(result);
+}
+
+static void ReleaseState(BenchState *state) {
+	if (state->pointers != fpl_null) {
+		free(state->pointers);
+	}
+	if (state->kind == AllocatorKind_FmemTemporary && state->temporary.base != fpl_null) {
+		fmemEndTemporary(&state->temporary);
+	}
+	if (state->root.base != fpl_null) {
+		fmemFree(&state->root);
+	}
+	fplClearStruct(state);
+}
+
+// Touches every page, so the memory shows up in the resident set size
+static void TouchMemory(uint8_t *data, const size_t size) {
+	for (size_t offset = 0; offset < size; offset += 4096) {
+		data[offset] = (uint8_t)offset;
+	}
+	data[size - 1] = (uint8_t)size;
+}
+
+static bool Allocate(BenchState *state, const size_t size) {
+	uint8_t *data = fpl_null;
+	switch (state->kind) {
+		case AllocatorKind_Malloc:
+			data = (uint8_t *)malloc(size);
+			break;
+		case AllocatorKind_FPL:
+			data = (uint8_t *)fplMemoryAllocate(size);
+			break;
+		case AllocatorKind_FPLAligned:
+			data = (uint8_t *)fplMemoryAlignedAllocate(size, BENCH_ALIGNMENT);
+			break;
+		case AllocatorKind_FmemBestFit:
+			data = fmemPush(state->block, size, fmemPushFlags_BestFit);
+			break;
+		case AllocatorKind_FmemConcurrent:
+			data = fmemConcurrentPush(state->concurrent, size, BENCH_ALIGNMENT, fmemPushFlags_None);
+			break;
+		case AllocatorKind_FmemThreadCache:
+			data = fmemThreadCachePush(&state->cache, size, BENCH_ALIGNMENT, fmemPushFlags_None);
+			break;
+		default:
+			data = fmemPush(state->block, size, fmemPushFlags_None);
+			break;
+	}
+	if (data == fpl_null) {
+		return(false);
+	}
+	TouchMemory(data, size);
+	if (state->pointers != fpl_null) {
+		fplAssert(state->pointerCount < state->pointerCapacity);
+		state->pointers[state->pointerCount++] = data;
+	}
+	state->liveBytes += size;
+	return(true);
+}
+
+static void FreePointer(const AllocatorKind kind, void *ptr) {
+	if (kind == AllocatorKind_Malloc) {
+		free(ptr);
+	} else if (kind == AllocatorKind_FPL) {
+		fplMemoryFree(ptr);
+	} else if (kind == AllocatorKind_FPLAligned) {
+		fplMemoryAlignedFree(ptr);
+	}
+}
+
+// Releases all allocations, heap pointers are released in reverse order
+static void ReleaseAll(BenchState *state) {
+	if (state->pointers != fpl_null) {
+		while (state->pointerCount > 0) {
+			FreePointer(state->kind, state->pointers[--state->pointerCount]);
+		}
+	} else if (state->block != fpl_null) {
+		fmemReset(state->block);
+	} else if (state->concurrent != fpl_null) {
+		fmemConcurrentReset(state->concurrent);
+	}
+	state->liveBytes = 0;
+}
+
+static void BeginScope(BenchState *state, const size_t depth) {
+	state->scopeStarts[depth] = state->pointerCount;
+	if (state->block != fpl_null) {
+		state->scopes[depth] = fmemBeginScratchFrom(state->block);
+	}
+}
+
+static void EndScope(BenchState *state, const size_t depth, const size_t scopeBytes) {
+	if (state->pointers != fpl_null) {
+		while (state->pointerCount > state->scopeStarts[depth]) {
+			FreePointer(state->kind, state->pointers[--state->pointerCount]);
+		}
+	} else {
+		fmemEndScratch(&state->scopes[depth]);
+	}
+	state->liveBytes -= scopeBytes;
+}
+
+static size_t GetReservedSize(const BenchState *state) {
+	size_t result = 0;
+	if (state->kind == AllocatorKind_FmemVirtual) {
+		result = state->root.committed;
+	} else if (state->root.base != fpl_null) {
+		result = fmemGetTotalSize((fmemMemoryBlock *)&state->root);
+	}
+	return(result);
+}
+
+static BenchResult RunSingle(const BenchAllocator *allocator, const BenchPattern pattern, const BenchSizeClass *sizeClass, const size_t ops, const size_t initialSize) {
+	BenchResult result = fplZeroInit;
+	result.threads = 1;
+
+	size_t opCount = GetOpCount(sizeClass, ops);
+	size_t maxLiveCount = BENCH_BATCH_SIZE;
+	if (pattern == BenchPattern_Scoped) {
+		maxLiveCount = BENCH_SCOPE_DEPTH * BENCH_SCOPE_SIZE;
+	} else if (pattern == BenchPattern_LongLived) {
+		if (allocator->kind == AllocatorKind_FPL || allocator->kind == AllocatorKind_FPLAligned) {
+			opCount = fplMin(opCount, BENCH_FPL_LIVE_LIMIT);
+		}
+		maxLiveCount = opCount;
+	}
+	maxLiveCount = fplMin(maxLiveCount, opCount);
+	size_t maxSize = sizeClass->minSize + 15 * sizeClass->step;
+	size_t maxLiveSize = maxLiveCount * maxSize;
+
+	size_t rssBefore = GetResidentSize();
+
+	BenchState state;
+	if (!InitState(&state, allocator->kind, maxLiveCount, maxLiveSize, initialSize, fpl_null)) {
+		result.failed = opCount;
+		return(result);
+	}
+
+	size_t scopeBytes[BENCH_SCOPE_DEPTH] = fplZeroInit;
+	size_t scopeDepth = 0;
+	size_t scopeCount = 0;
+	size_t batchCount = 0;
+
+	double start = fplGetTimeInSecondsHP();
+	for (size_t i = 0; i < opCount; ++i) {
+		if (pattern == BenchPattern_Bulk) {
+			if (batchCount == BENCH_BATCH_SIZE) {
+				ReleaseAll(&state);
+				batchCount = 0;
+			}
+			++batchCount;
+		} else if (pattern == BenchPattern_Scoped) {
+			if (scopeCount == BENCH_SCOPE_SIZE) {
+				if (scopeDepth == BENCH_SCOPE_DEPTH) {
+					while (scopeDepth > 0) {
+						--scopeDepth;
+						EndScope(&state, scopeDepth, scopeBytes[scopeDepth]);
+					}
+				}
+				scopeCount = 0;
+			}
+			if (scopeCount == 0) {
+				scopeBytes[scopeDepth] = 0;
+				BeginScope(&state, scopeDepth++);
+			}
+			++scopeCount;
+		}
+		size_t size = NextSize(sizeClass, &state.rnd);
+		result.requestedBytes += size;
+		if (Allocate(&state, size)) {
+			if (pattern == BenchPattern_Scoped) {
+				scopeBytes[scopeDepth - 1] += size;
+			}
+		} else {
+			++result.failed;
+		}
+	}
+	result.seconds = fplGetTimeInSecondsHP() - start;
+	result.ops = opCount;
+
+	// The last batch or scopes are still alive
+	size_t rssAfter = GetResidentSize();
+	result.rssBytes = rssAfter > rssBefore ? rssAfter - rssBefore : 0;
+	result.liveBytes = state.liveBytes;
+	if (IsHeapAllocator(allocator->kind)) {
+		result.reservedBytes = result.rssBytes;
+	} else {
+		result.reservedBytes = GetReservedSize(&state);
+	}
+
+	while (pattern == BenchPattern_Scoped && scopeDepth > 0) {
+		--scopeDepth;
+		EndScope(&state, scopeDepth, scopeBytes[scopeDepth]);
+	}
+	ReleaseAll(&state);
+	ReleaseState(&state);
+	return(result);
+}
+
+static void BenchWorkerProc(const fplThreadHandle *thread, void *data) {
+	(void)thread;
+	BenchWorker *worker = (BenchWorker *)data;
+	BenchState *state = &worker->state;
+	for (size_t i = 0; i < worker->opCount; ++i) {
+		size_t size = NextSize(worker->sizeClass, &state->rnd);
+		worker->requestedBytes += size;
+		if (!Allocate(state, size)) {
+			++worker->failed;
+		}
+	}
+}
+
+static BenchResult RunThreaded(const BenchAllocator *allocator, const BenchSizeClass *sizeClass, const size_t ops, const size_t initialSize, const size_t threadCount) {
+	BenchResult result = fplZeroInit;
+	result.threads = threadCount;
+
+	size_t opCount = GetOpCount(sizeClass, ops);
+	if (allocator->kind == AllocatorKind_FPL || allocator->kind == AllocatorKind_FPLAligned) {
+		opCount = fplMin(opCount, BENCH_FPL_LIVE_LIMIT);
+	}
+	size_t opsPerThread = fplMax(opCount / threadCount, 1);
+	size_t maxSize = sizeClass->minSize + 15 * sizeClass->step;
+
+	size_t rssBefore = GetResidentSize();
+
+	fmemConcurrentBlock concurrent = fplZeroInit;
+	if (!IsHeapAllocator(allocator->kind)) {
+		if (!fmemConcurrentInit(&concurrent, initialSize)) {
+			result.failed = opCount;
+			return(result);
+		}
+	}
+
+	BenchWorker workers[MAX_BENCH_THREADS] = fplZeroInit;
+	for (size_t i = 0; i < threadCount; ++i) {
+		BenchWorker *worker = &workers[i];
+		worker->sizeClass = sizeClass;
+		worker->opCount = opsPerThread;
+		if (!InitState(&worker->state, allocator->kind, opsPerThread, opsPerThread * maxSize, initialSize, &concurrent)) {
+			worker->opCount = 0;
+			worker->failed = opsPerThread;
+		}
+	}
+
+	double start = fplGetTimeInSecondsHP();
+	for (size_t i = 0; i < threadCount; ++i) {
+		workers[i].thread = fplThreadCreate(BenchWorkerProc, &workers[i]);
+	}
+	fplThreadWaitForAll(&workers[0].thread, threadCount, sizeof(BenchWorker), FPL_TIMEOUT_INFINITE);
+	result.seconds = fplGetTimeInSecondsHP() - start;
+
+	size_t rssAfter = GetResidentSize();
+	result.rssBytes = rssAfter > rssBefore ? rssAfter - rssBefore : 0;
+	for (size_t i = 0; i < threadCount; ++i) {
+		BenchWorker *worker = &workers[i];
+		fplThreadTerminate(worker->thread);
+		result.ops += worker->opCount;
+		result.failed += worker->failed;
+		result.requestedBytes += worker->requestedBytes;
+		result.liveBytes += worker->state.liveBytes;
+	}
+	if (IsHeapAllocator(allocator->kind)) {
+		result.reservedBytes = result.rssBytes;
+	} else {
+		result.reservedBytes = fmemConcurrentGetTotalSize(&concurrent);
+	}
+
+	for (size_t i = 0; i < threadCount; ++i) {
+		BenchWorker *worker = &workers[i];
+		if (IsHeapAllocator(allocator->kind)) {
+			ReleaseAll(&worker->state);
+		}
+		ReleaseState(&worker->state);
+	}
+	if (concurrent.head != fmem_null) {
+		fmemConcurrentFree(&concurrent);
+	}
+	return(result);
+}
+
+static void PrintResult(const BenchFormat format, const char *allocatorName, const char *patternName, const char *sizesName, const BenchResult *r) {
+	double mops = r->seconds > 0 ? ((double)r->ops / r->seconds) / 1000000.0 : 0.0;
+	double fragmentation = 0.0;
+	if (r->reservedBytes > 0 && r->liveBytes < r->reservedBytes) {
+		fragmentation = 1.0 - (double)r->liveBytes / (double)r->reservedBytes;
+	}
+	size_t requestedKB = r->requestedBytes / 1024;
+	size_t liveKB = r->liveBytes / 1024;
+	size_t reservedKB = r->reservedBytes / 1024;
+	size_t rssKB = r->rssBytes / 1024;
+	if (format == BenchFormat_JSON) {
+		fplConsoleFormatOut("{\"allocator\":\"%s\",\"pattern\":\"%s\",\"sizes\":\"%s\",\"threads\":%zu,\"ops\":%zu,\"failed\":%zu,\"seconds\":%.3f,\"mops\":%.2f,\"requested_kb\":%zu,\"live_kb\":%zu,\"reserved_kb\":%zu,\"rss_kb\":%zu,\"fragmentation\":%.3f}\n",
+							allocatorName, patternName, sizesName, r->threads, r->ops, r->failed, r->seconds, mops, requestedKB, liveKB, reservedKB, rssKB, fragmentation);
+	} else {
+		fplConsoleFormatOut("allocator=%s pattern=%s sizes=%s threads=%zu ops=%zu failed=%zu seconds=%.3f mops=%.2f requested_kb=%zu live_kb=%zu reserved_kb=%zu rss_kb=%zu fragmentation=%.3f\n",
+							allocatorName, patternName, sizesName, r->threads, r->ops, r->failed, r->seconds, mops, requestedKB, liveKB, reservedKB, rssKB, fragmentation);
+	}
+}
+
+static bool IsFiltered(const char *filter, const char *allocatorName, const char *patternName, const char *sizesName) {
+	if (filter == fpl_null || strcmp(filter, "all") == 0) {
+		return(false);
+	}
+	char name[128];
+	fplFormatString(name, fplArrayCount(name), "%s/%s/%s", allocatorName, patternName, sizesName);
+	bool result = strstr(name, filter) == fpl_null;
+	return(result);
+}
+
+int main(int argc, char **argv) {
+	if (argc > 1 && (strcmp(argv[1], "--help") == 0 || strcmp(argv[1], "-h") == 0)) {
+		fplConsoleOut("Usage: FMEM_Bench [--help] [ops] [initial block size in kilobytes] [thread count] [filter] [text|json]\n");
+		fplConsoleOut("The filter is matched against \"<allocator>/<pattern>/<sizes>\", for example \"fmem_\" or \"/scoped/\" or \"all\".\n");
+		return(0);
+	}
+	size_t ops = argc > 1 ? (size_t)atoi(argv[1]) : 1000000;
+	size_t initialSize = argc > 2 ? (size_t)FMEM_KILOBYTES(atoi(argv[2])) : FMEM_MEGABYTES(1);
+	size_t threadCount = argc > 3 ? (size_t)atoi(argv[3]) : 4;
+	const char *filter = argc > 4 ? argv[4] : fpl_null;
+	BenchFormat format = (argc > 5 && strcmp(argv[5], "json") == 0) ? BenchFormat_JSON : BenchFormat_Text;
+	if (ops == 0) {
+		ops = 1000000;
+	}
+	if (threadCount == 0 || threadCount > MAX_BENCH_THREADS) {
+		threadCount = 4;
+	}
+
+	if (!fplPlatformInit(fplInitFlags_None, fpl_null)) {
+		return -1;
+	}
+
+	for (size_t allocatorIndex = 0; allocatorIndex < fplArrayCount(BenchAllocators); ++allocatorIndex) {
+		const BenchAllocator *allocator = &BenchAllocators[allocatorIndex];
+		if (!allocator->singleThreaded) {
+			continue;
+		}
+		for (size_t patternIndex = 0; patternIndex < fplArrayCount(BenchPatternNames); ++patternIndex) {
+			for (size_t sizeIndex = 0; sizeIndex < fplArrayCount(BenchSizeClasses); ++sizeIndex) {
+				const BenchSizeClass *sizeClass = &BenchSizeClasses[sizeIndex];
+				if (IsFiltered(filter, allocator->name, BenchPatternNames[patternIndex], sizeClass->name)) {
+					continue;
+				}
+				BenchResult r = RunSingle(allocator, (BenchPattern)patternIndex, sizeClass, ops, initialSize);
+				PrintResult(format, allocator->name, BenchPatternNames[patternIndex], sizeClass->name, &r);
+			}
+		}
+	}
+
+	for (size_t allocatorIndex = 0; allocatorIndex < fplArrayCount(BenchAllocators); ++allocatorIndex) {
+		const BenchAllocator *allocator = &BenchAllocators[allocatorIndex];
+		if (!allocator->multiThreaded) {
+			continue;
+		}
+		const char *patternName = BenchPatternNames[BenchPattern_LongLived];
+		for (size_t sizeIndex = 0; sizeIndex < fplArrayCount(BenchSizeClasses); ++sizeIndex) {
+			const BenchSizeClass *sizeClass = &BenchSizeClasses[sizeIndex];
+			if (IsFiltered(filter, allocator->name, patternName, sizeClass->name)) {
+				continue;
+			}
+			BenchResult r = RunThreaded(allocator, sizeClass, ops, initialSize, threadCount);
+			PrintResult(format, allocator->name, patternName, sizeClass->name, &r);
+		}
+	}
+
+	fplPlatformRelease();
+	return(0);
+}
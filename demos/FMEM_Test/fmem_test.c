@@ -13,14 +13,33 @@ Author:
 	Torsten Spaete
 
 Changelog:
+	## 2026-10-18
+	- Added tests for the current block and best fit pushes
+	- Added tests for aligned pushes and array pushes
+	- Added tests for concurrent blocks, thread caches and scratch blocks
+	- Added multi-threaded test for concurrent pushes
+	- Added tests for object pools
+	- Added tests for the frame allocator
+	- Added tests for statistics and reports
+	- Added tests for virtual blocks
+
 	## 2018-06-29
 	- Initial version
 -------------------------------------------------------------------------------
 */
 
+#define FPL_IMPLEMENTATION
+#define FPL_NO_WINDOW
+#define FPL_NO_VIDEO
+#define FPL_NO_AUDIO
+#include <final_platform_layer.h>
+
 #define FMEM_IMPLEMENTATION
 #include <final_memory.h>
 
+#include <string.h> // strstr, strlen, memset
+#include <stdlib.h> // qsort
+
 #define fmemAlwaysAssert(exp) if(!(exp)) {*(int *)0 = 0;}
 
 static void TestTemporary() {
@@ -140,12 +159,698 @@ static void TestGrowMiddle() {
 	fmemFree(&mainBlock);
 }
 
+static size_t CountBlocks(fmemMemoryBlock *block) {
+	size_t result = 0;
+	fmemMemoryBlock *countBlock = block;
+	while (countBlock != fmem_null && countBlock->base != fmem_null) {
+		++result;
+		fmemBlockHeader *hdr = FMEM__GETHEADER(countBlock);
+		countBlock = hdr->next;
+	}
+	return(result);
+}
+
+static void TestCurrentBlock() {
+	fmemMemoryBlock block;
+	fmemAlwaysAssert(fmemInit(&block, fmemType_Growable, FMEM_KILOBYTES(64)));
+	size_t firstSize = block.size;
+
+	// Pushes are bumping the pointer of the first block
+	uint8_t *first = fmemPush(&block, 16, fmemPushFlags_None);
+	uint8_t *second = fmemPush(&block, 16, fmemPushFlags_None);
+	fmemAlwaysAssert(second == first + 16);
+	fmemAlwaysAssert(block.current == fmem_null);
+
+	// Big push adds a block, but the first block has more space left and stays current
+	uint8_t *big = fmemPush(&block, FMEM_MEGABYTES(1), fmemPushFlags_None);
+	fmemAlwaysAssert(big != fmem_null);
+	fmemAlwaysAssert(CountBlocks(&block) == 2);
+	fmemAlwaysAssert(block.current == fmem_null);
+	uint8_t *third = fmemPush(&block, 16, fmemPushFlags_None);
+	fmemAlwaysAssert(third == second + 16);
+
+	// Fill up the first block, the next push does not fit in the rest of the big block either.
+	// So a new current block is added, with at least the size of the first block
+	fmemPush(&block, block.size - block.used, fmemPushFlags_None);
+	uint8_t *fourth = fmemPush(&block, FMEM_KILOBYTES(8), fmemPushFlags_None);
+	fmemAlwaysAssert(CountBlocks(&block) == 3);
+	fmemAlwaysAssert(block.current != fmem_null);
+	fmemAlwaysAssert(block.current->size >= firstSize);
+	fmemAlwaysAssert(fourth == (uint8_t *)block.current->base);
+	uint8_t *fifth = fmemPush(&block, 16, fmemPushFlags_None);
+	fmemAlwaysAssert(fifth == fourth + FMEM_KILOBYTES(8));
+
+	// Reset makes the first block current again and reuses all blocks without allocating
+	fmemMemoryBlock *currentBlock = block.current;
+	fmemReset(&block);
+	fmemAlwaysAssert(block.current == fmem_null);
+	fmemAlwaysAssert(block.used == 0 && currentBlock->used == 0);
+	fmemAlwaysAssert(fmemPush(&block, 16, fmemPushFlags_None) == first);
+	fmemPush(&block, block.size - block.used, fmemPushFlags_None);
+	fmemAlwaysAssert(fmemPush(&block, FMEM_KILOBYTES(8), fmemPushFlags_None) == big);
+	fmemAlwaysAssert(CountBlocks(&block) == 3);
+
+	fmemFree(&block);
+	fmemAlwaysAssert(block.base == fmem_null && block.current == fmem_null);
+}
+
+static void TestBestFit() {
+	fmemMemoryBlock block;
+	fmemAlwaysAssert(fmemInit(&block, fmemType_Growable, FMEM_KILOBYTES(64)));
+	fmemPush(&block, block.size - 1024, fmemPushFlags_None);
+
+	// Second block becomes current, but is filled up except for 512 bytes
+	uint8_t *data = fmemPush(&block, 2048, fmemPushFlags_None);
+	fmemMemoryBlock *secondBlock = block.current;
+	fmemAlwaysAssert(secondBlock != fmem_null && data == (uint8_t *)secondBlock->base);
+	fmemPush(&block, secondBlock->size - secondBlock->used - 512, fmemPushFlags_None);
+
+	// Current block is too small, but best fit finds the 1024 bytes in the first block
+	uint8_t *fit = fmemPush(&block, 768, fmemPushFlags_BestFit);
+	fmemAlwaysAssert(fit == (uint8_t *)block.base + block.size - 1024);
+	fmemAlwaysAssert(CountBlocks(&block) == 2);
+
+	// Without best fit a new block is added
+	fmemAlwaysAssert(fmemPush(&block, 768, fmemPushFlags_None) != fmem_null);
+	fmemAlwaysAssert(CountBlocks(&block) == 3);
+
+	fmemFree(&block);
+}
+
+#define IsAligned(ptr, alignment) ((((uintptr_t)(ptr)) & ((alignment) - 1)) == 0)
+
+typedef struct TestVec4 {
+	double x, y, z, w;
+} TestVec4;
+
+static void TestAligned() {
+	fmemMemoryBlock block;
+	fmemAlwaysAssert(fmemInit(&block, fmemType_Fixed, 1024));
+
+	// Invalid alignments
+	fmemAlwaysAssert(fmemPushAligned(&block, 16, 3, fmemPushFlags_None) == fmem_null);
+	fmemAlwaysAssert(!fmemSetAlignment(&block, 48));
+	fmemAlwaysAssert(block.used == 0);
+
+	// Padding is counted as used
+	uint8_t *a = fmemPush(&block, 1, fmemPushFlags_None);
+	uint8_t *b = fmemPushAligned(&block, 16, 16, fmemPushFlags_None);
+	fmemAlwaysAssert(IsAligned(b, 16) && b > a);
+	uint8_t *c = fmemPushAligned(&block, 3, 32, fmemPushFlags_None);
+	fmemAlwaysAssert(IsAligned(c, 32) && c >= b + 16);
+	uint8_t *d = fmemPushAligned(&block, 8, FMEM_CACHELINE_SIZE, fmemPushFlags_Clear);
+	fmemAlwaysAssert(IsAligned(d, FMEM_CACHELINE_SIZE) && d[0] == 0 && d[7] == 0);
+	fmemAlwaysAssert(block.used == (size_t)(d + 8 - (uint8_t *)block.base));
+
+	// Exact fit including the padding, nothing left afterwards
+	fmemPush(&block, 1, fmemPushFlags_None);
+	uint8_t *top = (uint8_t *)block.base + block.used;
+	size_t padding = (size_t)((FMEM_CACHELINE_SIZE - ((uintptr_t)top & (FMEM_CACHELINE_SIZE - 1))) & (FMEM_CACHELINE_SIZE - 1));
+	size_t rest = block.size - block.used - padding;
+	fmemAlwaysAssert(fmemPushAligned(&block, rest + 1, FMEM_CACHELINE_SIZE, fmemPushFlags_None) == fmem_null);
+	uint8_t *last = fmemPushAligned(&block, rest, FMEM_CACHELINE_SIZE, fmemPushFlags_None);
+	fmemAlwaysAssert(last == top + padding);
+	fmemAlwaysAssert(block.used == block.size);
+	fmemFree(&block);
+
+	// Growable blocks reserve the worst case padding for new blocks
+	fmemMemoryBlock growBlock = FMEM_ZERO_INIT;
+	uint8_t *big = fmemPushAligned(&growBlock, FMEM_KILOBYTES(8), 4096, fmemPushFlags_None);
+	fmemAlwaysAssert(big != fmem_null && IsAligned(big, 4096));
+	fmemFree(&growBlock);
+}
+
+static void TestDefaultAlignment() {
+	fmemMemoryBlock block;
+	fmemAlwaysAssert(fmemInit(&block, fmemType_Growable, FMEM_KILOBYTES(4)));
+	fmemAlwaysAssert(fmemSetAlignment(&block, FMEM_SIMD_ALIGNMENT));
+	for (int i = 0; i < 256; ++i) {
+		uint8_t *data = fmemPush(&block, 1 + (i % 7), fmemPushFlags_None);
+		fmemAlwaysAssert(IsAligned(data, FMEM_SIMD_ALIGNMENT));
+	}
+
+	// Smaller explicit alignments do not undercut the default alignment
+	uint8_t *small = fmemPushAligned(&block, 1, 4, fmemPushFlags_None);
+	fmemAlwaysAssert(IsAligned(small, FMEM_SIMD_ALIGNMENT));
+
+	// Temporary memory inherits the default alignment
+	fmemMemoryBlock temp;
+	fmemAlwaysAssert(fmemBeginTemporary(&block, &temp));
+	fmemAlwaysAssert(temp.alignment == FMEM_SIMD_ALIGNMENT);
+	fmemPush(&temp, 1, fmemPushFlags_None);
+	fmemAlwaysAssert(IsAligned(fmemPush(&temp, 1, fmemPushFlags_None), FMEM_SIMD_ALIGNMENT));
+	fmemEndTemporary(&temp);
+
+	fmemFree(&block);
+}
+
+static void TestArray() {
+	fmemMemoryBlock block;
+	fmemAlwaysAssert(fmemInit(&block, fmemType_Growable, FMEM_KILOBYTES(4)));
+	fmemPush(&block, 1, fmemPushFlags_None);
+
+	TestVec4 *vec = fmemPushStruct(&block, TestVec4, fmemPushFlags_Clear);
+	fmemAlwaysAssert(IsAligned(vec, FMEM_ALIGNOF(TestVec4)) && vec->w == 0.0);
+
+	fmemPush(&block, 1, fmemPushFlags_None);
+	uint64_t *values = fmemPushArray(&block, uint64_t, 100, fmemPushFlags_None);
+	fmemAlwaysAssert(IsAligned(values, FMEM_ALIGNOF(uint64_t)));
+	for (int i = 0; i < 100; ++i) {
+		values[i] = i;
+	}
+
+	// Overflow of the total size and empty arrays
+	fmemAlwaysAssert(fmemPushArray(&block, uint64_t, SIZE_MAX / 4, fmemPushFlags_None) == fmem_null);
+	fmemAlwaysAssert(fmemPushArray(&block, uint64_t, 0, fmemPushFlags_None) == fmem_null);
+
+	fmemFree(&block);
+}
+
+static size_t CountChunks(fmemConcurrentBlock *block) {
+	size_t result = 0;
+	for (fmemConcurrentChunk *chunk = block->head; chunk != fmem_null; chunk = chunk->next) {
+		++result;
+	}
+	return(result);
+}
+
+static void TestConcurrent() {
+	fmemConcurrentBlock block;
+	fmemAlwaysAssert(fmemConcurrentInit(&block, FMEM_KILOBYTES(4)));
+	fmemAlwaysAssert(CountChunks(&block) == 1);
+	fmemAlwaysAssert(fmemConcurrentPush(&block, 16, 3, fmemPushFlags_None) == fmem_null);
+
+	uint8_t *a = fmemConcurrentPush(&block, 10, 0, fmemPushFlags_None);
+	uint8_t *b = fmemConcurrentPush(&block, 10, 16, fmemPushFlags_Clear);
+	fmemAlwaysAssert(a != fmem_null && b >= a + 10 && IsAligned(b, 16) && b[9] == 0);
+
+	// Fill the first chunk, the next push goes into a new chunk
+	fmemAlwaysAssert(fmemConcurrentPush(&block, FMEM_KILOBYTES(4) - 64, 0, fmemPushFlags_None) != fmem_null);
+	fmemAlwaysAssert(fmemConcurrentPush(&block, 100, 0, fmemPushFlags_None) != fmem_null);
+	fmemAlwaysAssert(CountChunks(&block) == 2);
+
+	// Bigger than the chunk size
+	uint8_t *big = fmemConcurrentPush(&block, FMEM_KILOBYTES(16), FMEM_CACHELINE_SIZE, fmemPushFlags_None);
+	fmemAlwaysAssert(big != fmem_null && IsAligned(big, FMEM_CACHELINE_SIZE));
+	fmemAlwaysAssert(CountChunks(&block) == 3);
+
+	// Reset merges all chunks into one
+	size_t totalSize = fmemConcurrentGetTotalSize(&block);
+	fmemConcurrentReset(&block);
+	fmemAlwaysAssert(CountChunks(&block) == 1);
+	fmemAlwaysAssert(fmemConcurrentGetTotalSize(&block) == totalSize);
+	fmemAlwaysAssert(block.head->used == 0 && block.generation == 1);
+
+	fmemConcurrentFree(&block);
+	fmemAlwaysAssert(block.head == fmem_null);
+}
+
+#define CONCURRENT_THREAD_COUNT 4
+#define CONCURRENT_PUSH_COUNT 2000
+
+typedef struct ConcurrentRegion {
+	uint8_t *base;
+	size_t size;
+} ConcurrentRegion;
+
+typedef struct ConcurrentWorker {
+	ConcurrentRegion regions[CONCURRENT_PUSH_COUNT];
+	fmemConcurrentBlock *block;
+	fplThreadHandle *thread;
+	uint8_t pattern;
+} ConcurrentWorker;
+
+static void ConcurrentPushProc(const fplThreadHandle *thread, void *data) {
+	(void)thread;
+	ConcurrentWorker *worker = (ConcurrentWorker *)data;
+	for (size_t i = 0; i < CONCURRENT_PUSH_COUNT; ++i) {
+		// Mostly small pushes, with a push bigger than the chunk size from time to time
+		size_t size = (i % 500 == 0) ? FMEM_KILOBYTES(8) : (1 + ((i * 7 + worker->pattern * 13) % 200));
+		size_t alignment = (i & 1) ? 16 : 0;
+		uint8_t *base = fmemConcurrentPush(worker->block, size, alignment, fmemPushFlags_None);
+		if (base != fmem_null) {
+			FMEM_MEMSET(base, worker->pattern, size);
+		}
+		worker->regions[i].base = base;
+		worker->regions[i].size = size;
+	}
+}
+
+static int CompareRegions(const void *a, const void *b) {
+	const ConcurrentRegion *regionA = (const ConcurrentRegion *)a;
+	const ConcurrentRegion *regionB = (const ConcurrentRegion *)b;
+	if (regionA->base < regionB->base) {
+		return -1;
+	}
+	return (regionA->base > regionB->base) ? 1 : 0;
+}
+
+static void TestConcurrentThreads() {
+	fmemConcurrentBlock block;
+	fmemAlwaysAssert(fmemConcurrentInit(&block, FMEM_KILOBYTES(4)));
+
+	static ConcurrentWorker workers[CONCURRENT_THREAD_COUNT];
+	for (size_t i = 0; i < CONCURRENT_THREAD_COUNT; ++i) {
+		workers[i].block = &block;
+		workers[i].pattern = (uint8_t)(i + 1);
+	}
+	for (size_t i = 0; i < CONCURRENT_THREAD_COUNT; ++i) {
+		workers[i].thread = fplThreadCreate(ConcurrentPushProc, &workers[i]);
+		fmemAlwaysAssert(workers[i].thread != fmem_null);
+	}
+	fplThreadWaitForAll(&workers[0].thread, CONCURRENT_THREAD_COUNT, sizeof(ConcurrentWorker), FPL_TIMEOUT_INFINITE);
+
+	// Every push succeeded, is aligned and still holds the pattern of its thread, so no other thread has written into it
+	static ConcurrentRegion regions[CONCURRENT_THREAD_COUNT * CONCURRENT_PUSH_COUNT];
+	size_t regionCount = 0;
+	size_t pushedSize = 0;
+	for (size_t i = 0; i < CONCURRENT_THREAD_COUNT; ++i) {
+		ConcurrentWorker *worker = &workers[i];
+		fplThreadTerminate(worker->thread);
+		for (size_t j = 0; j < CONCURRENT_PUSH_COUNT; ++j) {
+			ConcurrentRegion *region = &worker->regions[j];
+			fmemAlwaysAssert(region->base != fmem_null);
+			fmemAlwaysAssert(!(j & 1) || IsAligned(region->base, 16));
+			for (size_t k = 0; k < region->size; ++k) {
+				fmemAlwaysAssert(region->base[k] == worker->pattern);
+			}
+			regions[regionCount++] = *region;
+			pushedSize += region->size;
+		}
+	}
+
+	// Regions do not overlap and are inside of the chunks
+	qsort(regions, regionCount, sizeof(regions[0]), CompareRegions);
+	for (size_t i = 0; i + 1 < regionCount; ++i) {
+		fmemAlwaysAssert(regions[i].base + regions[i].size <= regions[i + 1].base);
+	}
+	size_t usedSize = 0;
+	for (fmemConcurrentChunk *chunk = block.head; chunk != fmem_null; chunk = chunk->next) {
+		usedSize += (chunk->used < chunk->size) ? chunk->used : chunk->size;
+	}
+	for (size_t i = 0; i < regionCount; ++i) {
+		bool isInChunk = false;
+		for (fmemConcurrentChunk *chunk = block.head; chunk != fmem_null; chunk = chunk->next) {
+			if (regions[i].base >= chunk->base && regions[i].base + regions[i].size <= chunk->base + chunk->size) {
+				isInChunk = true;
+				break;
+			}
+		}
+		fmemAlwaysAssert(isInChunk);
+	}
+	fmemAlwaysAssert(usedSize >= pushedSize && fmemConcurrentGetTotalSize(&block) >= usedSize);
+
+	fmemConcurrentFree(&block);
+}
+
+static void TestThreadCache() {
+	fmemConcurrentBlock block;
+	fmemAlwaysAssert(fmemConcurrentInit(&block, FMEM_KILOBYTES(64)));
+	fmemThreadCache cache;
+	fmemAlwaysAssert(fmemThreadCacheInit(&cache, &block, FMEM_KILOBYTES(1)));
+
+	// First push takes a range from the owner, the following pushes are served by the range
+	uint8_t *a = fmemThreadCachePush(&cache, 8, 0, fmemPushFlags_None);
+	size_t ownerUsed = block.head->used;
+	uint8_t *b = fmemThreadCachePush(&cache, 24, 8, fmemPushFlags_None);
+	fmemAlwaysAssert(a != fmem_null && b == a + 8);
+	fmemAlwaysAssert(cache.size == FMEM_KILOBYTES(1) && block.head->used == ownerUsed);
+
+	// Big pushes which do not fit bypass the cache
+	uint8_t *big = fmemThreadCachePush(&cache, 1000, 0, fmemPushFlags_None);
+	fmemAlwaysAssert(big != fmem_null && (big < cache.base || big >= cache.base + cache.size));
+	fmemAlwaysAssert(block.head->used > ownerUsed);
+
+	// Range of the cache is dropped after the owner was reset
+	fmemConcurrentReset(&block);
+	uint8_t *c = fmemThreadCachePush(&cache, 8, 0, fmemPushFlags_None);
+	fmemAlwaysAssert(c == block.head->base && cache.generation == block.generation);
+
+	fmemConcurrentFree(&block);
+}
+
+static void TestScratch() {
+	fmemMemoryBlock block;
+	fmemAlwaysAssert(fmemInit(&block, fmemType_Growable, FMEM_KILOBYTES(4)));
+	fmemPush(&block, 100, fmemPushFlags_None);
+
+	// Nested scratch regions on the same block
+	fmemScratch outer = fmemBeginScratchFrom(&block);
+	fmemAlwaysAssert(outer.block == &block);
+	fmemPush(&block, 200, fmemPushFlags_None);
+	fmemScratch inner = fmemBeginScratchFrom(&block);
+	uint8_t *innerData = fmemPush(&block, 300, fmemPushFlags_None);
+	fmemEndScratch(&inner);
+	fmemAlwaysAssert(block.used == 300);
+	fmemAlwaysAssert(fmemPush(&block, 300, fmemPushFlags_None) == innerData);
+
+	// Blocks appended in the scratch region are given back as well
+	fmemPush(&block, block.size - block.used, fmemPushFlags_None);
+	fmemPush(&block, 100, fmemPushFlags_None);
+	fmemAlwaysAssert(CountBlocks(&block) == 2 && block.current != fmem_null);
+	fmemEndScratch(&outer);
+	fmemAlwaysAssert(block.used == 100 && block.current == fmem_null);
+	fmemAlwaysAssert(fmemGetRemainingSize(&block) == fmemGetTotalSize(&block) - 100);
+	fmemFree(&block);
+
+	// Big pushes before the scratch region append blocks which are not current, these keep their data
+	fmemStats stats;
+	fmemAlwaysAssert(fmemInit(&block, fmemType_Growable, FMEM_KILOBYTES(4)));
+	fmemAlwaysAssert(fmemAttachStats(&block, &stats));
+	fmemPush(&block, 100, fmemPushFlags_None);
+	fmemAlwaysAssert(fmemPush(&block, FMEM_KILOBYTES(16), fmemPushFlags_None) != fmem_null);
+	fmemAlwaysAssert(CountBlocks(&block) == 2 && block.current == fmem_null);
+	fmemBlockHeader *firstHeader = FMEM__GETHEADER(&block);
+	fmemMemoryBlock *bigBlock = firstHeader->next;
+	size_t bigUsed = bigBlock->used;
+	size_t usedBefore = stats.usedBytes;
+	fmemScratch big = fmemBeginScratchFrom(&block);
+	fmemPush(&block, block.size - block.used, fmemPushFlags_None);
+	fmemPush(&block, FMEM_KILOBYTES(8), fmemPushFlags_None);
+	fmemAlwaysAssert(CountBlocks(&block) == 3);
+	fmemEndScratch(&big);
+	fmemAlwaysAssert(block.used == 100 && block.current == fmem_null);
+	fmemAlwaysAssert(bigBlock->used == bigUsed);
+	fmemAlwaysAssert(stats.usedBytes == usedBefore);
+	fmemFree(&block);
+
+	// Thread scratch blocks never return the conflicting block
+	fmemScratch first = fmemBeginScratch(fmem_null);
+	fmemAlwaysAssert(first.block != fmem_null);
+	uint8_t *firstData = fmemPush(first.block, 64, fmemPushFlags_None);
+	fmemScratch second = fmemBeginScratch(first.block);
+	fmemAlwaysAssert(second.block != fmem_null && second.block != first.block);
+	fmemScratch third = fmemBeginScratch(second.block);
+	fmemAlwaysAssert(third.block == first.block);
+	fmemPush(third.block, 64, fmemPushFlags_None);
+	fmemEndScratch(&third);
+	fmemEndScratch(&second);
+	fmemAlwaysAssert(fmemPush(first.block, 64, fmemPushFlags_None) == firstData + 64);
+	fmemEndScratch(&first);
+
+	fmemResetThreadScratch();
+	fmemFreeThreadScratch();
+}
+
+typedef struct TestPoolItem {
+	uint32_t id;
+	uint8_t data[20];
+} TestPoolItem;
+
+static size_t CountFreeNodes(fmemPoolNode *node) {
+	size_t result = 0;
+	for (; node != fmem_null; node = node->next) {
+		++result;
+	}
+	return(result);
+}
+
+static void TestPool() {
+	fmemPool pool;
+	fmemAlwaysAssert(!fmemPoolInit(&pool, 0, 0, 16, fmemPoolFlags_None));
+	fmemAlwaysAssert(!fmemPoolInit(&pool, 16, 12, 16, fmemPoolFlags_None));
+
+	// Small objects still need space for the free list
+	fmemAlwaysAssert(fmemPoolInit(&pool, 1, 0, 16, fmemPoolFlags_None));
+	fmemAlwaysAssert(pool.objectSize == sizeof(fmemPoolNode));
+	fmemPoolFree(&pool);
+
+	fmemAlwaysAssert(fmemPoolInit(&pool, sizeof(TestPoolItem), 16, 16, fmemPoolFlags_Poison));
+	fmemAlwaysAssert(pool.objectSize == 32 && pool.alignment == 16);
+
+	TestPoolItem *items[40];
+	for (int i = 0; i < 40; ++i) {
+		items[i] = (TestPoolItem *)fmemPoolPush(&pool, fmemPushFlags_None);
+		fmemAlwaysAssert(items[i] != fmem_null && IsAligned(items[i], 16));
+		// Pushed objects are poisoned as well
+		fmemAlwaysAssert(items[i]->data[0] == FMEM_POOL_POISON_PUSHED);
+		items[i]->id = i;
+	}
+	fmemAlwaysAssert(pool.usedCount == 40 && pool.totalCount == 40);
+
+	// Released objects are reused in reverse order
+	fmemPoolRelease(&pool, items[3]);
+	fmemPoolRelease(&pool, items[7]);
+	fmemAlwaysAssert(items[7]->data[19] == FMEM_POOL_POISON_FREED);
+	fmemAlwaysAssert(pool.usedCount == 38 && CountFreeNodes(pool.freeList) == 2);
+	fmemAlwaysAssert(fmemPoolPush(&pool, fmemPushFlags_None) == items[7]);
+	TestPoolItem *cleared = (TestPoolItem *)fmemPoolPush(&pool, fmemPushFlags_Clear);
+	fmemAlwaysAssert(cleared == items[3] && cleared->id == 0 && cleared->data[19] == 0);
+	fmemAlwaysAssert(pool.totalCount == 40);
+
+	// Bulk reset, the first push starts at the first block again
+	TestPoolItem *first = items[0];
+	fmemPoolReset(&pool);
+	fmemAlwaysAssert(pool.usedCount == 0 && pool.freeList == fmem_null && pool.generation == 1);
+	TestPoolItem *afterReset = (TestPoolItem *)fmemPoolPush(&pool, fmemPushFlags_None);
+	fmemAlwaysAssert((uint8_t *)afterReset >= (uint8_t *)pool.block.base && (uint8_t *)afterReset < (uint8_t *)pool.block.base + pool.block.size);
+	fmemAlwaysAssert((uint8_t *)afterReset <= (uint8_t *)first);
+
+	fmemPoolFree(&pool);
+	fmemAlwaysAssert(pool.block.base == fmem_null);
+}
+
+static void TestPoolCache() {
+	fmemPool pool;
+	fmemAlwaysAssert(fmemPoolInit(&pool, sizeof(TestPoolItem), 0, 64, fmemPoolFlags_Poison));
+	fmemPoolCache cache;
+	fmemAlwaysAssert(!fmemPoolCacheInit(&cache, &pool, 8));
+	fmemPoolFree(&pool);
+
+	fmemAlwaysAssert(fmemPoolInit(&pool, sizeof(TestPoolItem), 0, 64, fmemPoolFlags_Concurrent | fmemPoolFlags_Poison));
+	fmemAlwaysAssert(fmemPoolCacheInit(&cache, &pool, 8));
+
+	// First push takes half of the capacity from the pool
+	TestPoolItem *items[12];
+	items[0] = (TestPoolItem *)fmemPoolCachePush(&cache, fmemPushFlags_None);
+	fmemAlwaysAssert(items[0] != fmem_null && cache.count == 3 && pool.usedCount == 4);
+	for (int i = 1; i < 12; ++i) {
+		items[i] = (TestPoolItem *)fmemPoolCachePush(&cache, fmemPushFlags_None);
+		fmemAlwaysAssert(items[i] != fmem_null);
+	}
+	fmemAlwaysAssert(pool.usedCount == 12 && cache.count == 0);
+
+	// Releasing into a full cache moves half of it back to the pool
+	for (int i = 0; i < 9; ++i) {
+		fmemPoolCacheRelease(&cache, items[i]);
+	}
+	fmemAlwaysAssert(cache.count == 5 && CountFreeNodes(pool.freeList) == 4 && pool.usedCount == 8);
+
+	// Flush gives everything back
+	fmemPoolCacheFlush(&cache);
+	fmemAlwaysAssert(cache.count == 0 && pool.usedCount == 3);
+
+	// Objects of the cache are dropped after the pool was reset
+	fmemPoolCacheRelease(&cache, items[9]);
+	fmemPoolReset(&pool);
+	fmemAlwaysAssert(fmemPoolCachePush(&cache, fmemPushFlags_None) != items[9]);
+	fmemAlwaysAssert(cache.generation == pool.generation);
+	fmemPoolCacheFlush(&cache);
+
+	fmemPoolFree(&pool);
+}
+
+typedef struct TestFenceState {
+	uint64_t waitedFrames[8];
+	size_t waitCount;
+} TestFenceState;
+
+static void TestFenceWait(void *userData, const uint64_t frameIndex) {
+	TestFenceState *state = (TestFenceState *)userData;
+	state->waitedFrames[state->waitCount++] = frameIndex;
+}
+
+static void TestFrameAllocator() {
+	fmemFrameAllocator allocator;
+	fmemAlwaysAssert(!fmemFrameInit(&allocator, 1, fmemType_Growable, FMEM_KILOBYTES(4)));
+	fmemAlwaysAssert(!fmemFrameInit(&allocator, FMEM_MAX_FRAME_COUNT + 1, fmemType_Growable, FMEM_KILOBYTES(4)));
+	fmemAlwaysAssert(fmemFrameInit(&allocator, 3, fmemType_Growable, FMEM_KILOBYTES(4)));
+	TestFenceState fence = FMEM_ZERO_INIT;
+	fmemFrameSetFence(&allocator, TestFenceWait, &fence);
+
+	// No frame started yet
+	fmemAlwaysAssert(fmemFramePush(&allocator, 16, 0, fmemPushFlags_None) == fmem_null);
+
+	uint32_t *values[5];
+	for (uint32_t frame = 0; frame < 5; ++frame) {
+		fmemAlwaysAssert(fmemFrameBegin(&allocator) != fmem_null);
+		values[frame] = (uint32_t *)fmemFramePush(&allocator, sizeof(uint32_t), FMEM_ALIGNOF(uint32_t), fmemPushFlags_None);
+		*values[frame] = frame;
+
+		// Data of previous frames lives until the frame is reclaimed
+		for (uint32_t age = 1; age < 3 && age <= frame; ++age) {
+			fmemAlwaysAssert(*values[frame - age] == frame - age);
+			fmemMemoryBlock *oldBlock = fmemFrameGetBlock(&allocator, age);
+			fmemAlwaysAssert((uint8_t *)values[frame - age] >= (uint8_t *)oldBlock->base);
+		}
+		fmemAlwaysAssert(fmemFrameGetBlock(&allocator, 3) == fmem_null);
+	}
+	fmemAlwaysAssert(fmemFrameGetBlock(&allocator, 2) != fmem_null);
+
+	// Frames 1 and 2 were reclaimed by frames 4 and 5, after waiting for the fence
+	fmemAlwaysAssert(fence.waitCount == 2);
+	fmemAlwaysAssert(fence.waitedFrames[0] == 1 && fence.waitedFrames[1] == 2);
+	fmemAlwaysAssert(values[3] == values[0]);
+	fmemAlwaysAssert(allocator.frameIndex == 5);
+
+	fmemFrameFree(&allocator);
+	fmemAlwaysAssert(allocator.frameCount == 0);
+}
+
+static void TestStats() {
+	fmemMemoryBlock block;
+	fmemAlwaysAssert(fmemInit(&block, fmemType_Growable, FMEM_KILOBYTES(4)));
+	fmemPush(&block, 100, fmemPushFlags_None);
+
+	// Attaching counts the memory in use
+	fmemStats stats;
+	fmemAlwaysAssert(fmemAttachStats(&block, &stats));
+	fmemAlwaysAssert(stats.usedBytes == 100 && stats.peakBytes == 100);
+	fmemAlwaysAssert(fmemSetTagName(&stats, 1, "audio"));
+	fmemAlwaysAssert(!fmemSetTagName(&stats, FMEM_MAX_TAG_COUNT, "invalid"));
+
+	// Tagged push with padding
+	fmemAlwaysAssert(fmemPushTagged(&block, 50, 64, 1, fmemPushFlags_None) != fmem_null);
+	fmemAlwaysAssert(fmemPushTagged(&block, 50, 0, FMEM_MAX_TAG_COUNT, fmemPushFlags_None) == fmem_null);
+	fmemAlwaysAssert(stats.tags[1].bytes == 50 && stats.tags[1].pushCount == 1);
+	fmemAlwaysAssert(stats.usedBytes == block.used && stats.paddingBytes == block.used - 150);
+	size_t usedBefore = stats.usedBytes;
+
+	// Temporary memory counts what was pushed into it, not the reserved size
+	fmemMemoryBlock temp;
+	fmemAlwaysAssert(fmemBeginTemporary(&block, &temp));
+	fmemPush(&temp, 1000, fmemPushFlags_None);
+	fmemAlwaysAssert(stats.usedBytes == usedBefore + 1000);
+	fmemEndTemporary(&temp);
+	fmemAlwaysAssert(stats.usedBytes == usedBefore && stats.peakBytes == usedBefore + 1000);
+
+	// Scratch regions including appended blocks
+	fmemScratch scratch = fmemBeginScratchFrom(&block);
+	fmemPush(&block, FMEM_KILOBYTES(16), fmemPushFlags_None);
+	fmemAlwaysAssert(stats.peakBytes == usedBefore + FMEM_KILOBYTES(16));
+	fmemEndScratch(&scratch);
+	fmemAlwaysAssert(stats.usedBytes == usedBefore);
+
+	// Failed pushes
+	fmemMemoryBlock fixedBlock;
+	fmemStats fixedStats;
+	fmemAlwaysAssert(fmemInit(&fixedBlock, fmemType_Fixed, 64));
+	fmemAttachStats(&fixedBlock, &fixedStats);
+	fmemAlwaysAssert(fmemPush(&fixedBlock, 128, fmemPushFlags_None) == fmem_null);
+	fmemAlwaysAssert(fixedStats.failedPushCount == 1 && fixedStats.pushCount == 0);
+	fmemFree(&fixedBlock);
+
+	// Text report
+	char report[2048];
+	size_t len = fmemFormatStats(&block, fmemStatsFormat_Text, report, sizeof(report));
+	fmemAlwaysAssert(len == strlen(report));
+	fmemAlwaysAssert(strstr(report, "Block[1]") != fmem_null);
+	fmemAlwaysAssert(strstr(report, "Tag[1] audio: bytes=50") != fmem_null);
+
+	// JSON report, the required length is returned even when the buffer is too small
+	size_t jsonLen = fmemFormatStats(&block, fmemStatsFormat_JSON, fmem_null, 0);
+	fmemAlwaysAssert(jsonLen > 0 && jsonLen < sizeof(report));
+	fmemAlwaysAssert(fmemFormatStats(&block, fmemStatsFormat_JSON, report, sizeof(report)) == jsonLen);
+	fmemAlwaysAssert(strlen(report) == jsonLen && report[0] == '{' && report[jsonLen - 1] == '}');
+	fmemAlwaysAssert(strstr(report, "\"name\":\"audio\",\"bytes\":50") != fmem_null);
+	char small[16];
+	fmemAlwaysAssert(fmemFormatStats(&block, fmemStatsFormat_JSON, small, sizeof(small)) == jsonLen);
+	fmemAlwaysAssert(strlen(small) == sizeof(small) - 1);
+
+	// Tag names of any length are written completely and escaped in JSON
+	char longName[400];
+	memset(longName, 'n', sizeof(longName) - 1);
+	longName[0] = '"';
+	longName[1] = '\\';
+	longName[sizeof(longName) - 1] = 0;
+	fmemAlwaysAssert(fmemSetTagName(&stats, 1, longName));
+	char longReport[2048];
+	size_t longLen = fmemFormatStats(&block, fmemStatsFormat_JSON, longReport, sizeof(longReport));
+	fmemAlwaysAssert(longLen == jsonLen + (sizeof(longName) - 1) - strlen("audio") + 2);
+	fmemAlwaysAssert(strlen(longReport) == longLen && longReport[longLen - 1] == '}');
+	fmemAlwaysAssert(strstr(longReport, "\"name\":\"\\\"\\\\nnn") != fmem_null);
+	fmemAlwaysAssert(strstr(longReport, "nnn\",\"bytes\":50") != fmem_null);
+	fmemSetTagName(&stats, 1, "audio");
+
+	// Reset clears the usage, but keeps the peaks
+	fmemReset(&block);
+	fmemAlwaysAssert(stats.usedBytes == 0 && stats.tags[1].bytes == 0 && stats.tags[1].peakBytes == 50);
+	fmemAlwaysAssert(stats.resetCount == 1);
+
+	fmemFree(&block);
+}
+
+static void TestVirtual() {
+	fmemMemoryBlock block;
+	fmemAlwaysAssert(fmemInit(&block, fmemType_Virtual, FMEM_GIGABYTES(1)));
+	fmemAlwaysAssert(block.size == FMEM_GIGABYTES(1) && block.committed == 0);
+
+	// Pages are committed on demand
+	uint8_t *first = fmemPush(&block, 100, fmemPushFlags_Clear);
+	fmemAlwaysAssert(first == (uint8_t *)block.base && block.committed == FMEM_VIRTUAL_COMMIT_SIZE);
+
+	// Big arrays stay contiguous
+	size_t count = FMEM_MEGABYTES(8) / sizeof(uint32_t);
+	uint32_t *values = fmemPushArray(&block, uint32_t, count, fmemPushFlags_None);
+	fmemAlwaysAssert((uint8_t *)values >= first + 100 && (uint8_t *)values < first + 104);
+	for (size_t i = 0; i < count; ++i) {
+		values[i] = (uint32_t)i;
+	}
+	uint8_t *next = fmemPush(&block, 16, fmemPushFlags_None);
+	fmemAlwaysAssert(next == (uint8_t *)(values + count));
+	fmemAlwaysAssert(block.committed >= block.used && block.committed < block.used + FMEM_VIRTUAL_COMMIT_SIZE);
+	fmemAlwaysAssert(fmemGetTotalSize(&block) == FMEM_GIGABYTES(1));
+
+	// Temporary memory commits in the source block
+	fmemMemoryBlock temp;
+	fmemAlwaysAssert(fmemBeginTemporary(&block, &temp));
+	uint8_t *tempData = fmemPush(&temp, FMEM_MEGABYTES(1), fmemPushFlags_Clear);
+	fmemAlwaysAssert(tempData != fmem_null && tempData[FMEM_MEGABYTES(1) - 1] == 0);
+	fmemEndTemporary(&temp);
+	size_t committedAfterTemp = block.committed;
+	fmemAlwaysAssert(committedAfterTemp >= block.used + FMEM_MEGABYTES(1));
+
+	// Unused tail is given back to the system
+	fmemAlwaysAssert(fmemDecommit(&block));
+	fmemAlwaysAssert(block.committed < committedAfterTemp && block.committed >= block.used);
+	fmemAlwaysAssert(values[count - 1] == (uint32_t)(count - 1));
+
+	// Decommitted pages are zero again after reset
+	fmemReset(&block);
+	fmemAlwaysAssert(fmemDecommit(&block) && block.committed == 0);
+	uint32_t *again = (uint32_t *)fmemPush(&block, 64, fmemPushFlags_None);
+	fmemAlwaysAssert(again == (uint32_t *)first && again[0] == 0);
+
+	// Reserved range is the limit
+	fmemAlwaysAssert(fmemPush(&block, FMEM_GIGABYTES(1), fmemPushFlags_None) == fmem_null);
+	fmemAlwaysAssert(!fmemDecommit(fmem_null));
+
+	fmemFree(&block);
+	fmemAlwaysAssert(block.base == fmem_null);
+}
+
 int main(int argc, char **args) {
+	fmemAlwaysAssert(fplPlatformInit(fplInitFlags_None, fpl_null));
 	TestGrowable(false, false);
 	TestGrowable(true, false);
 	TestGrowable(true, true);
 	TestFixed();
 	TestTemporary();
 	TestGrowMiddle();
+	TestCurrentBlock();
+	TestBestFit();
+	TestAligned();
+	TestDefaultAlignment();
+	TestArray();
+	TestConcurrent();
+	TestConcurrentThreads();
+	TestThreadCache();
+	TestScratch();
+	TestPool();
+	TestPoolCache();
+	TestFrameAllocator();
+	TestStats();
+	TestVirtual();
+	fplPlatformRelease();
 	return 0;
 }
\ No newline at end of file
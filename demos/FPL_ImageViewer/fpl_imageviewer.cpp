@@ -25,6 +25,7 @@ Changelog:
 	## v0.5.5
 	- Reflect api changes in FPL 0.9.4
 	- Fixed broken legacy opengl rendering
+	- Search pictures with fplWalkDirectory in multiple threads on a background thread
 
 	## v0.5.4
 	- Reflect api changes in FPL 0.9.3
@@ -339,6 +340,20 @@ typedef struct PictureLoadThread {
 	volatile bool shutdown;
 } PictureLoadThread;
 
+typedef struct PictureScan {
+	char rootPath[FPL_MAX_PATH_LENGTH];
+	char startFilePath[FPL_MAX_PATH_LENGTH];
+	PictureFile* files;
+	size_t fileCapacity;
+	size_t fileCount;
+	size_t folderCount;
+	fplMutexHandle mutex;
+	fplThreadHandle* thread;
+	volatile int32_t isDone;
+	volatile bool canceled;
+	bool recursive;
+} PictureScan;
+
 #define MAX_LOAD_THREAD_COUNT 64
 #define MAX_VIEW_PICTURE_COUNT MAX_LOAD_THREAD_COUNT * 4
 #define MAX_LOAD_QUEUE_COUNT MAX_VIEW_PICTURE_COUNT * 2
@@ -453,6 +468,8 @@ typedef struct ViewerState {
 	PictureLoadThread loadThreads[MAX_LOAD_THREAD_COUNT];
 	size_t loadThreadCount;
 
+	PictureScan scan;
+
 	ViewerParameters params;
 	PictureViewFlags viewFlags;
 
@@ -551,39 +568,124 @@ static void ClearPictureFiles(ViewerState* state) {
 	state->folderCount = 0;
 }
 
-static void AddPictureFile(ViewerState* state, const char* filePath) {
-	fplAssert(state->pictureFileCount <= state->pictureFileCapacity);
-	if (state->pictureFileCapacity == 0) {
-		state->pictureFileCapacity = 1;
-		state->pictureFiles = (PictureFile*)malloc(sizeof(PictureFile) * state->pictureFileCapacity);
-	} else if (state->pictureFileCount == state->pictureFileCapacity) {
-		state->pictureFileCapacity *= 2;
-		state->pictureFiles = (PictureFile*)realloc(state->pictureFiles, sizeof(PictureFile) * state->pictureFileCapacity);
+static void AddPictureFile(PictureScan* scan, const char* filePath) {
+	fplAssert(scan->fileCount <= scan->fileCapacity);
+	if (scan->fileCapacity == 0) {
+		scan->fileCapacity = 1;
+		scan->files = (PictureFile*)malloc(sizeof(PictureFile) * scan->fileCapacity);
+	} else if (scan->fileCount == scan->fileCapacity) {
+		scan->fileCapacity *= 2;
+		scan->files = (PictureFile*)realloc(scan->files, sizeof(PictureFile) * scan->fileCapacity);
 	}
-	PictureFile* pictureFile = &state->pictureFiles[state->pictureFileCount++];
+	PictureFile* pictureFile = &scan->files[scan->fileCount++];
 	fplCopyString(filePath, pictureFile->filePath, fplArrayCount(pictureFile->filePath));
 }
 
-static void AddPicturesFromPath(ViewerState* state, const char* path, const bool recursive) {
-	fplFileEntry entry;
-	size_t addedPics = 0;
-	for (bool hasEntry = fplListDirBegin(path, "*", &entry); hasEntry; hasEntry = fplListDirNext(&entry)) {
-		if (!hasEntry) {
-			break;
-		}
-		char fullPath[FPL_MAX_PATH_LENGTH];
-		fplPathCombine(fullPath, fplArrayCount(fullPath), 2, path, entry.name);
-		if (entry.type == fplFileEntryType_File) {
-			if (IsPictureFile(fullPath)) {
-				AddPictureFile(state, fullPath);
-				++addedPics;
+static bool AddPictureFileCallback(const fplWalkDirectoryEntry* entry, void* userData) {
+	PictureScan* scan = (PictureScan*)userData;
+	if (IsPictureFile(entry->name)) {
+		fplMutexLock(&scan->mutex);
+		AddPictureFile(scan, entry->fullPath);
+		fplMutexUnlock(&scan->mutex);
+	}
+	// Stops the walk, when a new path was loaded in the meantime
+	return(!scan->canceled);
+}
+
+static size_t GetFolderLength(const char* filePath) {
+	size_t result = fplExtractFileName(filePath) - filePath;
+	return(result);
+}
+
+// Sorts by folder first, so all pictures of one folder are next to each other
+static int ComparePictureFiles(const void* a, const void* b) {
+	const char* pathA = ((const PictureFile*)a)->filePath;
+	const char* pathB = ((const PictureFile*)b)->filePath;
+	size_t folderLenA = GetFolderLength(pathA);
+	size_t folderLenB = GetFolderLength(pathB);
+	int result = strncmp(pathA, pathB, fplMin(folderLenA, folderLenB));
+	if (result == 0) {
+		result = (folderLenA < folderLenB) ? -1 : ((folderLenA > folderLenB) ? 1 : 0);
+	}
+	if (result == 0) {
+		result = strcmp(pathA + folderLenA, pathB + folderLenB);
+	}
+	return(result);
+}
+
+static void AddPicturesFromPath(PictureScan* scan) {
+	fplWalkDirectorySettings settings;
+	fplSetDefaultWalkDirectorySettings(&settings);
+	settings.callback = AddPictureFileCallback;
+	settings.userData = scan;
+	settings.flags = fplWalkDirectoryFlags_SkipDirectories;
+	if (scan->recursive) {
+		settings.flags |= fplWalkDirectoryFlags_Recursive;
+	}
+	fplWalkDirectory(scan->rootPath, &settings, fpl_null);
+	if (scan->canceled) {
+		return;
+	}
+
+	// The pictures are found in any order, so we sort them and count the folders
+	PictureFile* addedFiles = scan->files;
+	size_t addedCount = scan->fileCount;
+	if (addedCount > 0) {
+		qsort(addedFiles, addedCount, sizeof(PictureFile), ComparePictureFiles);
+		++scan->folderCount;
+		for (size_t i = 1; i < addedCount; ++i) {
+			const char* prevPath = addedFiles[i - 1].filePath;
+			const char* curPath = addedFiles[i].filePath;
+			size_t prevFolderLen = GetFolderLength(prevPath);
+			if (prevFolderLen != GetFolderLength(curPath) || strncmp(prevPath, curPath, prevFolderLen) != 0) {
+				++scan->folderCount;
 			}
-		} else if (recursive && entry.type == fplFileEntryType_Directory) {
-			AddPicturesFromPath(state, fullPath, true);
 		}
 	}
-	if (addedPics > 0) {
-		++state->folderCount;
+}
+
+static void ScanPicturesThreadProc(const fplThreadHandle* thread, void* data) {
+	(void)thread;
+	PictureScan* scan = (PictureScan*)data;
+	AddPicturesFromPath(scan);
+	fplAtomicStoreS32(&scan->isDone, 1);
+}
+
+static void StopPictureScan(PictureScan* scan) {
+	if (scan->thread != fpl_null) {
+		scan->canceled = true;
+		fplThreadWaitForOne(scan->thread, FPL_TIMEOUT_INFINITE);
+		fplMutexDestroy(&scan->mutex);
+		scan->thread = fpl_null;
+	}
+	if (scan->files != fpl_null) {
+		free(scan->files);
+		scan->files = fpl_null;
+	}
+	scan->fileCount = 0;
+	scan->fileCapacity = 0;
+	scan->folderCount = 0;
+	fplAtomicStoreS32(&scan->isDone, 0);
+}
+
+static void StartPictureScan(PictureScan* scan, const char* rootPath, const char* startFilePath, const bool recursive) {
+	StopPictureScan(scan);
+	fplCopyString(rootPath, scan->rootPath, fplArrayCount(scan->rootPath));
+	if (startFilePath != fpl_null) {
+		fplCopyString(startFilePath, scan->startFilePath, fplArrayCount(scan->startFilePath));
+	} else {
+		scan->startFilePath[0] = 0;
+	}
+	scan->recursive = recursive;
+	scan->canceled = false;
+	fplAtomicStoreS32(&scan->isDone, 0);
+	fplMutexInit(&scan->mutex);
+	scan->thread = fplThreadCreate(ScanPicturesThreadProc, scan);
+	if (scan->thread == fpl_null) {
+		// No thread available, so we search on the calling thread instead
+		AddPicturesFromPath(scan);
+		fplMutexDestroy(&scan->mutex);
+		fplAtomicStoreS32(&scan->isDone, 1);
 	}
 }
 
@@ -919,6 +1021,8 @@ static void UpdateWindowTitle(ViewerState* state) {
 		const char* filterName = state->filters[state->activeFilter].name;
 		const char* picFilename = fplExtractFileName(state->pictureFiles[state->activeFileIndex].filePath);
 		fplFormatString(titleBuffer, fplArrayCount(titleBuffer), "%s v%s - %s [%d / %zu] {%s}", VER_PRODUCTNAME_STR, VER_PRODUCTVERSION_STR, picFilename, (state->activeFileIndex + 1), state->pictureFileCount, filterName);
+	} else if (state->scan.thread != fpl_null) {
+		fplFormatString(titleBuffer, fplArrayCount(titleBuffer), "%s v%s - Searching pictures in '%s'", VER_PRODUCTNAME_STR, VER_PRODUCTVERSION_STR, state->scan.rootPath);
 	} else {
 		fplFormatString(titleBuffer, fplArrayCount(titleBuffer), "%s v%s - No pictures found", VER_PRODUCTNAME_STR, VER_PRODUCTVERSION_STR);
 	}
@@ -1099,6 +1203,7 @@ static void CheckGLError(const char* stmt, const char* fname, int line) {
 	} while (0)
 
 static void Kill(ViewerState* state) {
+	StopPictureScan(&state->scan);
 	ShutdownQueue(&state->loadQueue);
 	ShutdownLoadThreads(state);
 	ClearPictureFiles(state);
@@ -1106,10 +1211,14 @@ static void Kill(ViewerState* state) {
 }
 
 static void Clear(ViewerState* state) {
+	StopPictureScan(&state->scan);
 	ShutdownQueue(&state->loadQueue);
 	StopLoadingInThreads(state);
 	ClearPictureFiles(state);
 	ClearViewPictures(state);
+	state->activeFileIndex = -1;
+	state->viewPictureIndex = -1;
+	state->doPictureReload = false;
 }
 
 static bool FindPictureIndexByPath(ViewerState* state, const char* path, size_t* outIndex) {
@@ -1122,28 +1231,66 @@ static bool FindPictureIndexByPath(ViewerState* state, const char* path, size_t*
 	return(false);
 }
 
-static bool LoadPicturesPath(ViewerState* state, const char* path, const bool recursive, size_t* startIndex) {
+// Starts searching the pictures on the scan thread, the results are published in PublishPictureScan()
+static bool LoadPicturesPath(ViewerState* state, const char* path, const bool recursive) {
 	bool result = false;
 	Clear(state);
 	flogWrite("Loading pictures from path '%s'", path);
 	if (fplDirectoryExists(path)) {
 		fplCopyString(path, state->rootPath, fplArrayCount(state->rootPath));
-		AddPicturesFromPath(state, state->rootPath, recursive);
-		result = state->pictureFileCount > 0;
-		*startIndex = 0;
+		StartPictureScan(&state->scan, state->rootPath, fpl_null, recursive);
+		result = true;
 	} else if (fplFileExists(path)) {
 		if (IsPictureFile(path)) {
 			fplExtractFilePath(path, state->rootPath, fplArrayCount(state->rootPath));
-			AddPicturesFromPath(state, state->rootPath, recursive);
-			if (!FindPictureIndexByPath(state, path, startIndex)) {
-				startIndex = 0;
-			}
+			StartPictureScan(&state->scan, state->rootPath, path, recursive);
 			result = true;
 		}
 	}
+	UpdateWindowTitle(state);
 	return(result);
 }
 
+static void PublishPictureScan(ViewerState* state) {
+	PictureScan* scan = &state->scan;
+	if (!fplAtomicLoadS32(&scan->isDone)) {
+		return;
+	}
+	if (scan->thread != fpl_null) {
+		fplThreadWaitForOne(scan->thread, FPL_TIMEOUT_INFINITE);
+		fplMutexDestroy(&scan->mutex);
+		scan->thread = fpl_null;
+	}
+	fplAtomicStoreS32(&scan->isDone, 0);
+
+	// Take over the found pictures from the scan
+	fplAssert(state->pictureFileCount == 0);
+	ClearPictureFiles(state);
+	fplCopyString(scan->rootPath, state->rootPath, fplArrayCount(state->rootPath));
+	state->pictureFiles = scan->files;
+	state->pictureFileCapacity = scan->fileCapacity;
+	state->pictureFileCount = scan->fileCount;
+	state->folderCount = scan->folderCount;
+	scan->files = fpl_null;
+	scan->fileCapacity = 0;
+	scan->fileCount = 0;
+	scan->folderCount = 0;
+	flogWrite("Found %zu pictures in %zu folders", state->pictureFileCount, state->folderCount);
+
+	if (state->pictureFileCount > 0) {
+		size_t startIndex = 0;
+		if (fplGetStringLength(scan->startFilePath) > 0) {
+			if (!FindPictureIndexByPath(state, scan->startFilePath, &startIndex)) {
+				startIndex = 0;
+			}
+		}
+		state->activeFileIndex = (int)startIndex;
+		ChangeViewPicture(state, 0, true);
+	} else {
+		UpdateWindowTitle(state);
+	}
+}
+
 static bool Init(ViewerState* state) {
 	// Query GL version
 	state->features.openGLMajor = 1;
@@ -1289,11 +1436,7 @@ static bool Init(ViewerState* state) {
 
 	// Load initial pictures from parameters
 	if (fplGetStringLength(state->params.path) > 0) {
-		size_t startPicIndex = 0;
-		if (LoadPicturesPath(state, state->params.path, state->params.recursive, &startPicIndex)) {
-			state->activeFileIndex = (int)startPicIndex;
-			ChangeViewPicture(state, 0, true);
-		}
+		LoadPicturesPath(state, state->params.path, state->params.recursive);
 	}
 
 	state->viewFlags = PictureViewFlags_KeepAspectRatio;
@@ -1491,6 +1634,9 @@ static void DrawTexturedRectangle(ViewerState* state, const GLuint textureId, co
 }
 
 static void UpdateAndRender(ViewerState* state, const float deltaTime) {
+	// Show the pictures, when the scan thread has finished searching them
+	PublishPictureScan(state);
+
 	// Discard textures on the left/right side when the fileIndex is out of bounds
 	if (state->viewPictureIndex != -1) {
 		ViewPicture* currentPic = &state->viewPictures[state->viewPictureIndex];
@@ -1898,14 +2044,10 @@ int main(int argc, char** argv) {
 						case fplEventType_Window:
 						{
 							if (ev.window.type == fplWindowEventType_DroppedFiles) {
-								size_t startPicIndex = 0;
 								for (size_t fileIndex = 0; fileIndex < ev.window.dropFiles.fileCount; ++fileIndex) {
 									const char* filePath = ev.window.dropFiles.files[fileIndex];
 									// @TODO(final): LoadPicturesPath clears the picture files always, so we basically can only load one folder at a time
-									if (LoadPicturesPath(state, filePath, false, &startPicIndex)) {
-										state->activeFileIndex = (int)startPicIndex;
-										ChangeViewPicture(state, 0, true);
-									}
+									LoadPicturesPath(state, filePath, false);
 								}
 							}
 						} break;
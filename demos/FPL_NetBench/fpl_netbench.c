@@ -0,0 +1,173 @@
+/*
+-------------------------------------------------------------------------------
+Name:
+	FPL-Demo | NetBench
+
+Description:
+	Measures UDP packets per second over loopback.
+	Compares single datagram calls (fplSocketSendTo/fplSocketReceiveFrom) against batched calls (fplSocketSendPackets/fplSocketReceivePackets).
+	Prints one line per mode in the form: mode=<name> size=<bytes> sent=<count> received=<count> seconds=<secs> pps=<packets per second>
+
+	Usage: FPL_NetBench [seconds per mode] [payload size]
+
+Requirements:
+	- C99
+	- Final Platform Layer
+
+Author:
+	Torsten Spaete
+
+Changelog:
+	## 2026-10-18
+	- Initial version
+
+License:
+	Copyright (c) 2017-2020 Torsten Spaete
+	MIT License (See LICENSE file)
+-------------------------------------------------------------------------------
+*/
+
+#define FPL_IMPLEMENTATION
+#define FPL_NO_WINDOW
+#define FPL_NO_VIDEO
+#define FPL_NO_AUDIO
+#include <final_platform_layer.h>
+
+#include <stdlib.h> // atoi
+
+#define BATCH_COUNT 64
+#define MAX_PAYLOAD_SIZE 1400
+
+typedef enum BenchMode {
+	BenchMode_Single = 0,
+	BenchMode_Batched,
+} BenchMode;
+
+static const char *BenchModeNames[] = {
+	"single",
+	"batched",
+};
+
+typedef struct BenchResult {
+	uint64_t sent;
+	uint64_t received;
+	double seconds;
+} BenchResult;
+
+static uint8_t sendBuffers[BATCH_COUNT][MAX_PAYLOAD_SIZE];
+static uint8_t recvBuffers[BATCH_COUNT][MAX_PAYLOAD_SIZE];
+
+static uint64_t ReceiveAll(fplSocketHandle *receiver, const BenchMode mode) {
+	uint64_t result = 0;
+	if (mode == BenchMode_Batched) {
+		fplSocketPacket packets[BATCH_COUNT];
+		for (;;) {
+			for (size_t i = 0; i < BATCH_COUNT; ++i) {
+				packets[i].data = recvBuffers[i];
+				packets[i].size = MAX_PAYLOAD_SIZE;
+			}
+			size_t count = fplSocketReceivePackets(receiver, packets, BATCH_COUNT);
+			result += count;
+			if (count < BATCH_COUNT) {
+				break;
+			}
+		}
+	} else {
+		size_t received;
+		while (fplSocketReceiveFrom(receiver, recvBuffers[0], MAX_PAYLOAD_SIZE, fpl_null, &received) == fplSocketResult_Success) {
+			++result;
+		}
+	}
+	return(result);
+}
+
+static BenchResult RunBench(fplSocketHandle *sender, fplSocketHandle *receiver, fplSocketPoller *poller, const fplSocketAddress *target, const BenchMode mode, const size_t payloadSize, const double seconds) {
+	BenchResult result = fplZeroInit;
+	fplSocketPacket packets[BATCH_COUNT];
+	for (size_t i = 0; i < BATCH_COUNT; ++i) {
+		packets[i].data = sendBuffers[i];
+		packets[i].size = payloadSize;
+		packets[i].address = *target;
+	}
+	double startTime = fplGetTimeInMillisecondsHP();
+	double endTime = startTime + seconds * 1000.0;
+	double now = startTime;
+	while (now < endTime) {
+		size_t sent = 0;
+		if (mode == BenchMode_Batched) {
+			sent = fplSocketSendPackets(sender, packets, BATCH_COUNT);
+		} else {
+			for (size_t i = 0; i < BATCH_COUNT; ++i) {
+				if (fplSocketSendTo(sender, sendBuffers[i], payloadSize, target) != fplSocketResult_Success) {
+					break;
+				}
+				++sent;
+			}
+		}
+		result.sent += sent;
+
+		fplSocketEvent ev;
+		if (fplSocketPollerWait(poller, &ev, 1, 10) > 0) {
+			result.received += ReceiveAll(receiver, mode);
+		}
+		now = fplGetTimeInMillisecondsHP();
+	}
+	// Drain the rest
+	while (fplSocketPollerWait(poller, &(fplSocketEvent){0}, 1, 10) > 0) {
+		uint64_t count = ReceiveAll(receiver, mode);
+		if (count == 0) {
+			break;
+		}
+		result.received += count;
+	}
+	result.seconds = (now - startTime) / 1000.0;
+	return(result);
+}
+
+int main(int argc, char **argv) {
+	double secondsPerMode = argc > 1 ? (double)atoi(argv[1]) : 2.0;
+	size_t payloadSize = argc > 2 ? (size_t)atoi(argv[2]) : 64;
+	if (secondsPerMode <= 0) {
+		secondsPerMode = 2.0;
+	}
+	payloadSize = fplMax(fplMin(payloadSize, MAX_PAYLOAD_SIZE), 1);
+
+	if (!fplPlatformInit(fplInitFlags_Network, fpl_null)) {
+		return -1;
+	}
+
+	int result = -1;
+	fplSocketHandle sender = fplZeroInit;
+	fplSocketHandle receiver = fplZeroInit;
+	fplSocketPoller poller = fplZeroInit;
+	do {
+		fplSocketAddress loopback;
+		fplSocketAddressFromString("127.0.0.1", 0, &loopback);
+		if (!fplSocketCreate(fplSocketType_UDP, &sender) || !fplSocketBind(&sender, &loopback)) {
+			break;
+		}
+		if (!fplSocketCreate(fplSocketType_UDP, &receiver) || !fplSocketBind(&receiver, &loopback)) {
+			break;
+		}
+		fplSocketAddress target;
+		if (!fplSocketGetLocalAddress(&receiver, &target)) {
+			break;
+		}
+		if (!fplSocketPollerCreate(1, &poller) || !fplSocketPollerAdd(&poller, &receiver, fplSocketPollFlags_Read, fpl_null)) {
+			break;
+		}
+		for (size_t modeIndex = 0; modeIndex < fplArrayCount(BenchModeNames); ++modeIndex) {
+			BenchMode mode = (BenchMode)modeIndex;
+			BenchResult r = RunBench(&sender, &receiver, &poller, &target, mode, payloadSize, secondsPerMode);
+			double pps = r.seconds > 0 ? (double)r.received / r.seconds : 0.0;
+			fplConsoleFormatOut("mode=%s size=%zu sent=%llu received=%llu seconds=%.3f pps=%.0f\n", BenchModeNames[modeIndex], payloadSize, (unsigned long long)r.sent, (unsigned long long)r.received, r.seconds, pps);
+		}
+		result = 0;
+	} while (0);
+
+	fplSocketPollerDestroy(&poller);
+	fplSocketClose(&receiver);
+	fplSocketClose(&sender);
+	fplPlatformRelease();
+	return(result);
+}
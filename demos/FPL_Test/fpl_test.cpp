@@ -14,6 +14,14 @@ Author:
 	Torsten Spaete
 
 Changelog:
+	## 2026-10-18
+	- Added event coalescing tests (fpl_test_events.cpp)
+	- Added shared memory and shared ring buffer tests
+	- Added UDP/TCP loopback socket tests
+	- Added directory walk tests
+	- Added file watcher tests
+	- Added hashing tests
+
 	## 2019-06-17
 	- Reflect api changes in FPL 0.9.4
 
@@ -895,6 +903,304 @@ static void TestThreading() {
 	}
 }
 
+struct SharedRingThreadData {
+	fplSharedRingBuffer *ring;
+	uint32_t totalSize;
+};
+
+static void SharedRingWriterThreadProc(const fplThreadHandle* context, void* data) {
+	SharedRingThreadData* d = (SharedRingThreadData*)data;
+	uint8_t chunk[1000];
+	uint32_t written = 0;
+	uint32_t chunkSize = 1;
+	while (written < d->totalSize) {
+		uint32_t size = fplMin(chunkSize, d->totalSize - written);
+		for (uint32_t i = 0; i < size; ++i) {
+			chunk[i] = (uint8_t)((written + i) & 0xFF);
+		}
+		bool r = fplSharedRingBufferWrite(d->ring, chunk, size, FPL_TIMEOUT_INFINITE);
+		ftIsTrue(r);
+		written += size;
+		chunkSize = (chunkSize % (fplArrayCount(chunk) - 7)) + 7;
+	}
+}
+
+static void TestSharedMemory() {
+	if (!fplPlatformInit(fplInitFlags_None, fpl_null)) {
+		return;
+	}
+
+	// Removes names left behind by a previous run which was aborted before closing its regions
+	fplSharedMemoryRemove("fpl_test_region");
+	fplSharedMemoryRemove("fpl_test_ring");
+	fplSharedMemoryRemove("fpl_test_ring_threads");
+
+	ftMsg("Test shared memory regions\n");
+	{
+		fplSharedMemoryHandle owner = {};
+		ftIsTrue(fplSharedMemoryCreate("fpl_test_region", 4096, &owner));
+		ftIsTrue(owner.isValid);
+		ftIsFalse(fplSharedMemoryCreate("fpl_test_region", 4096, &owner));
+		fplSharedMemoryHandle other = {};
+		ftIsTrue(fplSharedMemoryOpen("fpl_test_region", &other));
+		ftAssert(other.size >= 4096);
+		((uint32_t *)owner.base)[10] = 1337;
+		ftAssertU32Equals(1337, ((uint32_t *)other.base)[10]);
+		fplSharedMemoryClose(&other);
+		fplSharedMemoryClose(&owner);
+		ftIsFalse(owner.isValid);
+		ftIsFalse(fplSharedMemoryOpen("fpl_test_region", &other));
+	}
+
+	ftMsg("Test shared memory remove\n");
+	{
+		ftIsFalse(fplSharedMemoryRemove("fpl_test_region"));
+		ftIsFalse(fplSharedMemoryRemove("fpl/test"));
+		fplSharedMemoryHandle owner = {};
+		ftIsTrue(fplSharedMemoryCreate("fpl_test_region", 4096, &owner));
+#if defined(FPL_SUBPLATFORM_POSIX)
+		// The name is gone, but the mapping stays usable
+		ftIsTrue(fplSharedMemoryRemove("fpl_test_region"));
+		fplSharedMemoryHandle other = {};
+		ftIsFalse(fplSharedMemoryOpen("fpl_test_region", &other));
+		((uint32_t *)owner.base)[0] = 42;
+		ftAssertU32Equals(42, ((uint32_t *)owner.base)[0]);
+		ftIsFalse(fplSharedMemoryRemove("fpl_test_region"));
+#else
+		ftIsFalse(fplSharedMemoryRemove("fpl_test_region"));
+#endif
+		fplSharedMemoryClose(&owner);
+	}
+
+	ftMsg("Test shared ring buffer without waiting\n");
+	{
+		fplSharedRingBuffer ring = {};
+		ftIsFalse(fplSharedRingBufferCreate("fpl_test_ring", 1000, &ring));
+		ftIsTrue(fplSharedRingBufferCreate("fpl_test_ring", 16, &ring));
+		ftAssertSizeEquals(16, fplSharedRingBufferGetWritableSize(&ring));
+		uint8_t buffer[16] = {};
+		ftAssertSizeEquals(0, fplSharedRingBufferRead(&ring, buffer, sizeof(buffer), 0));
+		const uint8_t source[12] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+		ftIsTrue(fplSharedRingBufferWrite(&ring, source, 12, 0));
+		ftIsFalse(fplSharedRingBufferWrite(&ring, source, 12, 0));
+		ftAssertSizeEquals(12, fplSharedRingBufferGetReadableSize(&ring));
+		ftAssertSizeEquals(8, fplSharedRingBufferRead(&ring, buffer, 8, 0));
+		ftAssertU32Equals(8, buffer[7]);
+		// Wraps around the end
+		ftIsTrue(fplSharedRingBufferWrite(&ring, source, 12, 0));
+		ftAssertSizeEquals(16, fplSharedRingBufferRead(&ring, buffer, sizeof(buffer), 0));
+		ftAssertU32Equals(9, buffer[0]);
+		ftAssertU32Equals(12, buffer[3]);
+		ftAssertU32Equals(1, buffer[4]);
+		ftAssertU32Equals(12, buffer[15]);
+
+		fplSharedRingBuffer reader = {};
+		ftIsTrue(fplSharedRingBufferOpen("fpl_test_ring", &reader));
+		ftAssertSizeEquals(16, reader.capacity);
+		fplSharedRingBufferClose(&reader);
+		fplSharedRingBufferClose(&ring);
+	}
+
+	ftMsg("Test shared ring buffer with 1 writer and 1 reader thread\n");
+	{
+		fplSharedRingBuffer writer = {};
+		ftIsTrue(fplSharedRingBufferCreate("fpl_test_ring_threads", 4096, &writer));
+		fplSharedRingBuffer reader = {};
+		ftIsTrue(fplSharedRingBufferOpen("fpl_test_ring_threads", &reader));
+
+		SharedRingThreadData threadData = {};
+		threadData.ring = &writer;
+		threadData.totalSize = 1024 * 1024;
+		fplThreadHandle* thread = fplThreadCreate(SharedRingWriterThreadProc, &threadData);
+
+		uint8_t buffer[777];
+		uint32_t readTotal = 0;
+		bool isValid = true;
+		while (readTotal < threadData.totalSize) {
+			size_t readBytes = fplSharedRingBufferRead(&reader, buffer, sizeof(buffer), 5000);
+			ftAssert(readBytes > 0);
+			if (readBytes == 0) {
+				break;
+			}
+			for (size_t i = 0; i < readBytes; ++i) {
+				if (buffer[i] != (uint8_t)((readTotal + i) & 0xFF)) {
+					isValid = false;
+				}
+			}
+			readTotal += (uint32_t)readBytes;
+		}
+		ftIsTrue(isValid);
+		ftAssertU32Equals(threadData.totalSize, readTotal);
+
+		fplThreadWaitForOne(thread, FPL_TIMEOUT_INFINITE);
+		fplThreadTerminate(thread);
+		fplSharedRingBufferClose(&reader);
+		fplSharedRingBufferClose(&writer);
+	}
+
+	fplPlatformRelease();
+}
+
+static void TestNetwork() {
+	if (!fplPlatformInit(fplInitFlags_Network, fpl_null)) {
+		return;
+	}
+
+	ftMsg("Test socket addresses\n");
+	{
+		fplSocketAddress address = {};
+		ftIsTrue(fplSocketAddressFromString("127.0.0.1", 8080, &address));
+		ftAssertU32Equals(127, address.ip[0]);
+		ftAssertU32Equals(1, address.ip[3]);
+		ftAssertU32Equals(8080, address.port);
+		ftIsFalse(fplSocketAddressFromString("256.0.0.1", 0, &address));
+		ftIsFalse(fplSocketAddressFromString("1.2.3", 0, &address));
+		ftIsFalse(fplSocketAddressFromString("1.2.3.4.5", 0, &address));
+		char buffer[32];
+		ftIsTrue(fplSocketAddressFromString("10.0.200.1", 27015, &address));
+		fplSocketAddressToString(&address, buffer, fplArrayCount(buffer));
+		ftAssertStringEquals("10.0.200.1:27015", buffer);
+	}
+
+	fplSocketAddress loopback = {};
+	fplSocketAddressFromString("127.0.0.1", 0, &loopback);
+
+	ftMsg("Test UDP packets over loopback\n");
+	{
+		fplSocketHandle sender = {};
+		fplSocketHandle receiver = {};
+		ftIsTrue(fplSocketCreate(fplSocketType_UDP, &sender));
+		ftIsTrue(fplSocketCreate(fplSocketType_UDP, &receiver));
+		ftIsTrue(fplSocketBind(&sender, &loopback));
+		ftIsTrue(fplSocketBind(&receiver, &loopback));
+		fplSocketAddress senderAddress = {};
+		fplSocketAddress receiverAddress = {};
+		ftIsTrue(fplSocketGetLocalAddress(&sender, &senderAddress));
+		ftIsTrue(fplSocketGetLocalAddress(&receiver, &receiverAddress));
+		ftAssert(receiverAddress.port > 0);
+
+		uint8_t buffer[16];
+		size_t received = 0;
+		ftExpects(fplSocketResult_WouldBlock, fplSocketReceiveFrom(&receiver, buffer, sizeof(buffer), fpl_null, &received));
+
+		const uint32_t packetCount = 100;
+		uint32_t sendData[packetCount];
+		fplSocketPacket sendPackets[packetCount] = {};
+		for (uint32_t i = 0; i < packetCount; ++i) {
+			sendData[i] = i * 3;
+			sendPackets[i].data = &sendData[i];
+			sendPackets[i].size = sizeof(uint32_t);
+			sendPackets[i].address = receiverAddress;
+		}
+		ftAssertSizeEquals(packetCount, fplSocketSendPackets(&sender, sendPackets, packetCount));
+
+		fplSocketPoller poller = {};
+		ftIsTrue(fplSocketPollerCreate(4, &poller));
+		ftIsTrue(fplSocketPollerAdd(&poller, &receiver, fplSocketPollFlags_Read, &receiver));
+		ftIsFalse(fplSocketPollerAdd(&poller, &receiver, fplSocketPollFlags_Read, &receiver));
+
+		uint32_t recvData[packetCount] = {};
+		fplSocketPacket recvPackets[packetCount] = {};
+		uint32_t recvCount = 0;
+		while (recvCount < packetCount) {
+			fplSocketEvent ev;
+			size_t eventCount = fplSocketPollerWait(&poller, &ev, 1, 1000);
+			ftAssertSizeEquals(1, eventCount);
+			if (eventCount == 0) {
+				break;
+			}
+			ftIsTrue(ev.userData == &receiver);
+			ftIsTrue((ev.flags & fplSocketPollFlags_Read) == fplSocketPollFlags_Read);
+			for (uint32_t i = recvCount; i < packetCount; ++i) {
+				recvPackets[i].data = &recvData[i];
+				recvPackets[i].size = sizeof(uint32_t);
+			}
+			recvCount += (uint32_t)fplSocketReceivePackets(&receiver, recvPackets + recvCount, packetCount - recvCount);
+		}
+		ftAssertU32Equals(packetCount, recvCount);
+		for (uint32_t i = 0; i < recvCount; ++i) {
+			ftAssertSizeEquals(sizeof(uint32_t), recvPackets[i].size);
+			ftAssertU32Equals(i * 3, recvData[i]);
+			ftAssertU32Equals(senderAddress.port, recvPackets[i].address.port);
+		}
+		fplSocketEvent drainedEvent;
+		ftAssertSizeEquals(0, fplSocketPollerWait(&poller, &drainedEvent, 1, 0));
+
+		ftIsTrue(fplSocketPollerRemove(&poller, &receiver));
+		ftIsFalse(fplSocketPollerRemove(&poller, &receiver));
+		fplSocketPollerDestroy(&poller);
+		fplSocketClose(&receiver);
+		fplSocketClose(&sender);
+	}
+
+	ftMsg("Test TCP connection over loopback\n");
+	{
+		fplSocketHandle listener = {};
+		ftIsTrue(fplSocketCreate(fplSocketType_TCP, &listener));
+		ftIsTrue(fplSocketBind(&listener, &loopback));
+		ftIsTrue(fplSocketListen(&listener, 4));
+		fplSocketAddress listenAddress = {};
+		ftIsTrue(fplSocketGetLocalAddress(&listener, &listenAddress));
+
+		fplSocketHandle accepted = {};
+		ftExpects(fplSocketResult_WouldBlock, fplSocketAccept(&listener, &accepted, fpl_null));
+
+		fplSocketHandle client = {};
+		ftIsTrue(fplSocketCreate(fplSocketType_TCP, &client));
+		fplSocketResult connectResult = fplSocketConnect(&client, &listenAddress);
+		ftIsTrue(connectResult == fplSocketResult_Success || connectResult == fplSocketResult_WouldBlock);
+
+		fplSocketPoller poller = {};
+		ftIsTrue(fplSocketPollerCreate(4, &poller));
+		ftIsTrue(fplSocketPollerAdd(&poller, &listener, fplSocketPollFlags_Read, &listener));
+		ftIsTrue(fplSocketPollerAdd(&poller, &client, fplSocketPollFlags_Write, &client));
+
+		bool isConnected = false;
+		bool isAccepted = false;
+		for (int iteration = 0; iteration < 10 && !(isConnected && isAccepted); ++iteration) {
+			fplSocketEvent events[4];
+			size_t eventCount = fplSocketPollerWait(&poller, events, fplArrayCount(events), 1000);
+			for (size_t i = 0; i < eventCount; ++i) {
+				if (events[i].userData == &listener) {
+					ftExpects(fplSocketResult_Success, fplSocketAccept(&listener, &accepted, fpl_null));
+					isAccepted = true;
+					fplSocketPollerRemove(&poller, &listener);
+				} else if (events[i].userData == &client) {
+					ftIsTrue((events[i].flags & fplSocketPollFlags_Write) == fplSocketPollFlags_Write);
+					isConnected = true;
+					fplSocketPollerRemove(&poller, &client);
+				}
+			}
+		}
+		ftIsTrue(isAccepted);
+		ftIsTrue(isConnected);
+
+		const char message[] = "Hello FPL";
+		size_t sent = 0;
+		ftExpects(fplSocketResult_Success, fplSocketSend(&client, message, sizeof(message), &sent));
+		ftAssertSizeEquals(sizeof(message), sent);
+
+		ftIsTrue(fplSocketPollerAdd(&poller, &accepted, fplSocketPollFlags_Read, &accepted));
+		fplSocketEvent ev;
+		ftAssertSizeEquals(1, fplSocketPollerWait(&poller, &ev, 1, 1000));
+		char buffer[64] = {};
+		size_t received = 0;
+		ftExpects(fplSocketResult_Success, fplSocketReceive(&accepted, buffer, sizeof(buffer), &received));
+		ftAssertSizeEquals(sizeof(message), received);
+		ftAssertStringEquals(message, buffer);
+
+		fplSocketClose(&client);
+		ftAssertSizeEquals(1, fplSocketPollerWait(&poller, &ev, 1, 1000));
+		ftExpects(fplSocketResult_Closed, fplSocketReceive(&accepted, buffer, sizeof(buffer), &received));
+
+		fplSocketPollerDestroy(&poller);
+		fplSocketClose(&accepted);
+		fplSocketClose(&listener);
+	}
+
+	fplPlatformRelease();
+}
+
 static void TestFiles() {
 #if defined(FPL_PLATFORM_WINDOWS)
 	const char* testNotExistingFile = "C:\\Windows\\i_am_not_existing.lib";
@@ -1675,6 +1981,397 @@ static void TestInlining() {
 	NoInlineTest();
 }
 
+struct WalkDirectoryTestData {
+	volatile uint32_t count;
+	volatile uint32_t hiddenCount;
+	size_t lastSize;
+};
+
+static bool WalkDirectoryTestCallback(const fplWalkDirectoryEntry *entry, void *userData) {
+	WalkDirectoryTestData *data = (WalkDirectoryTestData *)userData;
+	fplAtomicIncrementU32(&data->count);
+	if (entry->attributes & fplFileAttributeFlags_Hidden) {
+		fplAtomicIncrementU32(&data->hiddenCount);
+	}
+	data->lastSize = entry->size;
+	return(true);
+}
+
+static bool WalkDirectoryStopCallback(const fplWalkDirectoryEntry *entry, void *userData) {
+	WalkDirectoryTestData *data = (WalkDirectoryTestData *)userData;
+	fplAtomicIncrementU32(&data->count);
+	return(false);
+}
+
+static size_t RunWalkDirectoryTest(const char *rootPath, const char *filter, const fplWalkDirectoryFlags flags, const uint32_t maxDepth, WalkDirectoryTestData *data) {
+	fplClearStruct(data);
+	fplWalkDirectorySettings settings;
+	fplSetDefaultWalkDirectorySettings(&settings);
+	settings.callback = WalkDirectoryTestCallback;
+	settings.userData = data;
+	settings.filter = filter;
+	settings.flags = flags;
+	settings.maxDepth = maxDepth;
+	settings.threadCount = 4;
+	size_t entryCount = 0;
+	ftIsTrue(fplWalkDirectory(rootPath, &settings, &entryCount));
+	ftAssertSizeEquals(entryCount, data->count);
+	return(entryCount);
+}
+
+static void TestWalkDirectory() {
+	if (!fplPlatformInit(fplInitFlags_None, fpl_null)) {
+		return;
+	}
+
+	char exeFilePath[FPL_MAX_PATH_LENGTH] = {};
+	fplGetExecutableFilePath(exeFilePath, fplArrayCount(exeFilePath));
+	char exePath[FPL_MAX_PATH_LENGTH] = {};
+	fplExtractFilePath(exeFilePath, exePath, fplArrayCount(exePath));
+
+	// Directory tree with 5 files and 3 directories
+	const char *dirNames[] = { "sub1", "sub1/sub2", "sub3" };
+	const char *fileNames[] = { "a.txt", "b.png", ".hidden", "sub1/c.txt", "sub1/sub2/d.png" };
+	char rootPath[FPL_MAX_PATH_LENGTH];
+	fplPathCombine(rootPath, fplArrayCount(rootPath), 2, exePath, "fpl_test_walk");
+	char path[FPL_MAX_PATH_LENGTH];
+
+	ftMsg("Create directory tree in '%s'\n", rootPath);
+	{
+		ftIsTrue(fplDirectoriesCreate(rootPath));
+		for (size_t i = 0; i < fplArrayCount(dirNames); ++i) {
+			fplPathCombine(path, fplArrayCount(path), 2, rootPath, dirNames[i]);
+			ftIsTrue(fplDirectoriesCreate(path));
+		}
+		for (size_t i = 0; i < fplArrayCount(fileNames); ++i) {
+			fplPathCombine(path, fplArrayCount(path), 2, rootPath, fileNames[i]);
+			fplFileHandle file;
+			ftIsTrue(fplCreateBinaryFile(path, &file));
+			char content[] = "Hello";
+			fplWriteFileBlock32(&file, content, 5);
+			fplCloseFile(&file);
+		}
+	}
+
+	ftMsg("Test walk directory\n");
+	{
+		WalkDirectoryTestData data;
+		ftAssertSizeEquals(8, RunWalkDirectoryTest(rootPath, fpl_null, fplWalkDirectoryFlags_Recursive, 0, &data));
+		ftAssertU32Equals(1, data.hiddenCount);
+		ftAssertSizeEquals(5, RunWalkDirectoryTest(rootPath, fpl_null, fplWalkDirectoryFlags_None, 0, &data));
+		ftAssertSizeEquals(7, RunWalkDirectoryTest(rootPath, "*", fplWalkDirectoryFlags_Recursive | fplWalkDirectoryFlags_SkipHidden, 0, &data));
+		ftAssertU32Equals(0, data.hiddenCount);
+		ftAssertSizeEquals(7, RunWalkDirectoryTest(rootPath, fpl_null, fplWalkDirectoryFlags_Recursive, 2, &data));
+		ftAssertSizeEquals(2, RunWalkDirectoryTest(rootPath, "*.png", fplWalkDirectoryFlags_Recursive, 0, &data));
+		ftAssertSizeEquals(5, RunWalkDirectoryTest(rootPath, fpl_null, fplWalkDirectoryFlags_Recursive | fplWalkDirectoryFlags_SkipDirectories, 0, &data));
+		ftAssertSizeEquals(3, RunWalkDirectoryTest(rootPath, fpl_null, fplWalkDirectoryFlags_Recursive | fplWalkDirectoryFlags_SkipFiles, 0, &data));
+		ftAssertSizeEquals(1, RunWalkDirectoryTest(rootPath, "d.png", fplWalkDirectoryFlags_Recursive | fplWalkDirectoryFlags_QuerySize, 0, &data));
+		ftAssertSizeEquals(5, data.lastSize);
+	}
+
+	ftMsg("Test stop walking directory\n");
+	{
+		WalkDirectoryTestData data = {};
+		fplWalkDirectorySettings settings;
+		fplSetDefaultWalkDirectorySettings(&settings);
+		settings.callback = WalkDirectoryStopCallback;
+		settings.userData = &data;
+		settings.threadCount = 1;
+		size_t entryCount = 0;
+		ftIsTrue(fplWalkDirectory(rootPath, &settings, &entryCount));
+		ftAssertSizeEquals(1, entryCount);
+		ftAssertU32Equals(1, data.count);
+		fplPathCombine(path, fplArrayCount(path), 2, rootPath, "i_am_not_existing");
+		ftIsFalse(fplWalkDirectory(path, &settings, &entryCount));
+	}
+
+	for (size_t i = 0; i < fplArrayCount(fileNames); ++i) {
+		fplPathCombine(path, fplArrayCount(path), 2, rootPath, fileNames[i]);
+		fplFileDelete(path);
+	}
+	for (size_t i = fplArrayCount(dirNames); i > 0; --i) {
+		fplPathCombine(path, fplArrayCount(path), 2, rootPath, dirNames[i - 1]);
+		fplDirectoryRemove(path);
+	}
+	ftIsTrue(fplDirectoryRemove(rootPath));
+
+	fplPlatformRelease();
+}
+
+struct FileWatchTestData {
+	uint32_t createdCount;
+	uint32_t modifiedCount;
+	uint32_t deletedCount;
+	void *lastUserData;
+	char lastPath[FPL_MAX_PATH_LENGTH];
+};
+
+static void FileWatchTestCallback(const fplFileWatchEvent *event, void *userData) {
+	FileWatchTestData *data = (FileWatchTestData *)userData;
+	switch (event->type) {
+		case fplFileWatchEventType_Created:
+			++data->createdCount;
+			break;
+		case fplFileWatchEventType_Modified:
+			++data->modifiedCount;
+			break;
+		case fplFileWatchEventType_Deleted:
+			++data->deletedCount;
+			break;
+		default:
+			break;
+	}
+	data->lastUserData = event->userData;
+	fplCopyString(event->path, data->lastPath, fplArrayCount(data->lastPath));
+}
+
+static void WriteFileWatchTestFile(const char *filePath, const char *content) {
+	fplFileHandle file;
+	ftIsTrue(fplCreateBinaryFile(filePath, &file));
+	fplWriteFileBlock32(&file, (void *)content, (uint32_t)fplGetStringLength(content));
+	fplCloseFile(&file);
+}
+
+static void TestFileWatcher() {
+	if (!fplPlatformInit(fplInitFlags_None, fpl_null)) {
+		return;
+	}
+
+	char exeFilePath[FPL_MAX_PATH_LENGTH] = {};
+	fplGetExecutableFilePath(exeFilePath, fplArrayCount(exeFilePath));
+	char exePath[FPL_MAX_PATH_LENGTH] = {};
+	fplExtractFilePath(exeFilePath, exePath, fplArrayCount(exePath));
+	char rootPath[FPL_MAX_PATH_LENGTH];
+	fplPathCombine(rootPath, fplArrayCount(rootPath), 2, exePath, "fpl_test_watch");
+	char subPath[FPL_MAX_PATH_LENGTH];
+	fplPathCombine(subPath, fplArrayCount(subPath), 2, rootPath, "sub");
+	char filePath[FPL_MAX_PATH_LENGTH];
+	fplPathCombine(filePath, fplArrayCount(filePath), 2, rootPath, "asset.xml");
+	char subFilePath[FPL_MAX_PATH_LENGTH];
+	fplPathCombine(subFilePath, fplArrayCount(subFilePath), 2, subPath, "level.xml");
+	char tempFilePath[FPL_MAX_PATH_LENGTH];
+	fplPathCombine(tempFilePath, fplArrayCount(tempFilePath), 2, rootPath, "temp.tmp");
+	ftIsTrue(fplDirectoriesCreate(rootPath));
+	WriteFileWatchTestFile(filePath, "Hello");
+
+	FileWatchTestData data = {};
+	fplFileWatcherSettings settings;
+	fplSetDefaultFileWatcherSettings(&settings);
+	settings.callback = FileWatchTestCallback;
+	settings.userData = &data;
+	settings.debounceTime = 20;
+	fplFileWatcher watcher = {};
+	int fileWatchTag = 1;
+	int rootWatchTag = 2;
+
+	ftMsg("Test file watcher\n");
+	if (fplFileWatcherCreate(&settings, &watcher)) {
+		ftIsTrue(fplFileWatcherAdd(&watcher, filePath, fplFileWatchFlags_None, &fileWatchTag));
+		ftIsTrue(fplFileWatcherAdd(&watcher, rootPath, fplFileWatchFlags_Recursive, &rootWatchTag));
+		ftIsFalse(fplFileWatcherAdd(&watcher, tempFilePath, fplFileWatchFlags_None, fpl_null));
+
+		// Nothing has changed
+		ftAssertSizeEquals(0, fplFileWatcherUpdate(&watcher, 0));
+
+		// Modify the watched file, reported for both watches but only once per watch
+		WriteFileWatchTestFile(filePath, "Hello World");
+		WriteFileWatchTestFile(filePath, "Hello World!");
+		ftAssertSizeEquals(2, fplFileWatcherUpdate(&watcher, 1000));
+		ftAssertU32Equals(2, data.modifiedCount);
+		ftAssertStringEquals(filePath, data.lastPath);
+
+		// Temporary file is created and deleted before the debounce time
+		fplClearStruct(&data);
+		WriteFileWatchTestFile(tempFilePath, "Temp");
+		fplFileDelete(tempFilePath);
+		ftAssertSizeEquals(0, fplFileWatcherUpdate(&watcher, 100));
+
+		// New sub-directory with a file inside
+		fplClearStruct(&data);
+		ftIsTrue(fplDirectoriesCreate(subPath));
+		fplFileWatcherUpdate(&watcher, 100);
+		WriteFileWatchTestFile(subFilePath, "Level");
+		fplFileWatcherUpdate(&watcher, 100);
+		ftAssertU32Equals(2, data.createdCount);
+		ftAssert(data.lastUserData == &rootWatchTag);
+		ftAssertStringEquals(subFilePath, data.lastPath);
+
+		// Delete everything
+		fplClearStruct(&data);
+		fplFileDelete(subFilePath);
+		fplDirectoryRemove(subPath);
+		fplFileDelete(filePath);
+		size_t deleteCount = 0;
+		while (deleteCount < 4 && fplFileWatcherUpdate(&watcher, 100) > 0) {
+			deleteCount = data.deletedCount;
+		}
+		ftAssertU32Equals(4, data.deletedCount);
+
+		fplFileWatcherDestroy(&watcher);
+		ftIsFalse(watcher.isValid);
+	}
+	fplDirectoryRemove(rootPath);
+
+	ftMsg("Test file watcher with a bare file name\n");
+	{
+		const char *relativeFileName = "fpl_test_watch.tmp";
+		char expectedPath[FPL_MAX_PATH_LENGTH];
+		fplPathCombine(expectedPath, fplArrayCount(expectedPath), 2, ".", relativeFileName);
+		WriteFileWatchTestFile(relativeFileName, "Hello");
+		fplClearStruct(&data);
+		if (fplFileWatcherCreate(&settings, &watcher)) {
+			ftIsTrue(fplFileWatcherAdd(&watcher, relativeFileName, fplFileWatchFlags_None, &fileWatchTag));
+			WriteFileWatchTestFile(relativeFileName, "Hello World");
+			ftAssertSizeEquals(1, fplFileWatcherUpdate(&watcher, 1000));
+			ftAssertU32Equals(1, data.modifiedCount);
+			ftAssert(data.lastUserData == &fileWatchTag);
+			ftAssertStringEquals(expectedPath, data.lastPath);
+			fplFileWatcherDestroy(&watcher);
+		}
+		fplFileDelete(relativeFileName);
+	}
+
+	fplPlatformRelease();
+}
+
+static void TestHashing() {
+	if (!fplPlatformInit(fplInitFlags_None, fpl_null)) {
+		return;
+	}
+
+	ftMsg("Test hash reference values\n");
+	{
+		fplHashValue value;
+		ftIsTrue(fplComputeHash(fplHashType_CRC32C, "123456789", 9, &value));
+		ftAssertU32Equals(0xE3069283, value.u32);
+		ftAssertU32Equals(0, value.u128[1]);
+		ftIsTrue(fplComputeHash(fplHashType_CRC32C, fpl_null, 0, &value));
+		ftAssertU32Equals(0, value.u32);
+
+		ftIsTrue(fplComputeHash(fplHashType_XXH64, fpl_null, 0, &value));
+		ftAssertU64Equals(0xEF46DB3751D8E999ULL, value.u64);
+		ftIsTrue(fplComputeHash(fplHashType_XXH64, "abc", 3, &value));
+		ftAssertU64Equals(0x44BC2CF5AD770999ULL, value.u64);
+
+		const char fox[] = "The quick brown fox jumps over the lazy dog";
+		ftIsTrue(fplComputeHash(fplHashType_Murmur3_128, fox, fplGetStringLength(fox), &value));
+		ftAssertU64Equals(0xE34BBC7BBC071B6CULL, value.u128[0]);
+		ftAssertU64Equals(0x7A433CA9C49A9347ULL, value.u128[1]);
+
+		ftIsFalse(fplComputeHash(fplHashType_None, fox, 3, &value));
+	}
+
+	// Pseudo random data, with an odd size to hit all tail cases
+	const size_t dataSize = 100003;
+	uint8_t *data = (uint8_t *)fplMemoryAllocate(dataSize);
+	uint32_t rnd = 0x12345678;
+	for (size_t i = 0; i < dataSize; ++i) {
+		rnd = rnd * 1664525 + 1013904223;
+		data[i] = (uint8_t)(rnd >> 24);
+	}
+
+	const fplHashType hashTypes[] = { fplHashType_CRC32C, fplHashType_XXH64, fplHashType_Murmur3_128 };
+
+	ftMsg("Test hash streaming with different chunk sizes\n");
+	{
+		const size_t chunkSizes[] = { 1, 3, 7, 16, 31, 33, 4096 };
+		for (size_t typeIndex = 0; typeIndex < fplArrayCount(hashTypes); ++typeIndex) {
+			fplHashType type = hashTypes[typeIndex];
+			fplHashValue expected;
+			ftIsTrue(fplComputeHash(type, data, dataSize, &expected));
+			for (size_t chunkIndex = 0; chunkIndex < fplArrayCount(chunkSizes); ++chunkIndex) {
+				fplHashState state;
+				ftIsTrue(fplHashBegin(&state, type, 0));
+				size_t offset = 0;
+				while (offset < dataSize) {
+					size_t count = fplMin(chunkSizes[chunkIndex], dataSize - offset);
+					fplHashUpdate(&state, data + offset, count);
+					offset += count;
+				}
+				fplHashValue actual;
+				ftIsTrue(fplHashEnd(&state, &actual));
+				ftAssertU64Equals(expected.u128[0], actual.u128[0]);
+				ftAssertU64Equals(expected.u128[1], actual.u128[1]);
+			}
+		}
+
+		// CRC32C seed continues a previous CRC
+		fplHashValue first, second, all;
+		ftIsTrue(fplComputeHash(fplHashType_CRC32C, data, 1000, &first));
+		fplHashState state;
+		ftIsTrue(fplHashBegin(&state, fplHashType_CRC32C, first.u32));
+		fplHashUpdate(&state, data + 1000, 2000);
+		ftIsTrue(fplHashEnd(&state, &second));
+		ftIsTrue(fplComputeHash(fplHashType_CRC32C, data, 3000, &all));
+		ftAssertU32Equals(all.u32, second.u32);
+	}
+
+	ftMsg("Test CRC32C portable against accelerated implementation\n");
+	{
+		fplHashState portable;
+		fplHashValue value;
+		ftIsTrue(fplHashBegin(&portable, fplHashType_CRC32C, 0));
+		portable.isAccelerated = false;
+		fplHashUpdate(&portable, "123456789", 9);
+		ftIsTrue(fplHashEnd(&portable, &value));
+		ftAssertU32Equals(0xE3069283, value.u32);
+
+		// Random offsets and sizes, small sizes for the tails and big sizes for the unrolled loops
+		for (int i = 0; i < 200; ++i) {
+			rnd = rnd * 1664525 + 1013904223;
+			size_t offset = (rnd >> 8) % 64;
+			rnd = rnd * 1664525 + 1013904223;
+			size_t size = (i & 1) ? ((rnd >> 8) % 64) : ((rnd >> 8) % (dataSize - 64));
+			fplHashState accelerated;
+			ftIsTrue(fplHashBegin(&accelerated, fplHashType_CRC32C, 0));
+			ftIsTrue(fplHashBegin(&portable, fplHashType_CRC32C, 0));
+			portable.isAccelerated = false;
+			fplHashUpdate(&accelerated, data + offset, size);
+			fplHashUpdate(&portable, data + offset, size);
+			fplHashValue expected, actual;
+			ftIsTrue(fplHashEnd(&accelerated, &expected));
+			ftIsTrue(fplHashEnd(&portable, &actual));
+			ftAssertU32Equals(expected.u32, actual.u32);
+		}
+	}
+
+	ftMsg("Test file hash\n");
+	{
+		char exeFilePath[FPL_MAX_PATH_LENGTH] = {};
+		fplGetExecutableFilePath(exeFilePath, fplArrayCount(exeFilePath));
+		char exePath[FPL_MAX_PATH_LENGTH] = {};
+		fplExtractFilePath(exeFilePath, exePath, fplArrayCount(exePath));
+		char filePath[FPL_MAX_PATH_LENGTH];
+		fplPathCombine(filePath, fplArrayCount(filePath), 2, exePath, "fpl_test_hash.bin");
+
+		fplFileHandle file;
+		ftIsTrue(fplCreateBinaryFile(filePath, &file));
+		fplWriteFileBlock(&file, data, dataSize);
+		fplCloseFile(&file);
+
+		for (size_t typeIndex = 0; typeIndex < fplArrayCount(hashTypes); ++typeIndex) {
+			fplHashType type = hashTypes[typeIndex];
+			fplHashValue expected, actual;
+			ftIsTrue(fplComputeHash(type, data, dataSize, &expected));
+			ftIsTrue(fplComputeFileHash(type, filePath, &actual));
+			ftAssertU64Equals(expected.u128[0], actual.u128[0]);
+			ftAssertU64Equals(expected.u128[1], actual.u128[1]);
+		}
+
+		ftIsTrue(fplFileDelete(filePath));
+
+		fplHashValue missing;
+		ftIsFalse(fplComputeFileHash(fplHashType_CRC32C, filePath, &missing));
+	}
+
+	fplMemoryFree(data);
+
+	fplPlatformRelease();
+}
+
+// Implemented in fpl_test_events.cpp
+extern void TestEventCoalescing();
+
 int main(int argc, char* args[]) {
 	TestColdInit();
 	TestInit();
@@ -1687,8 +2384,14 @@ int main(int argc, char* args[]) {
 	TestAtomics();
 	TestPaths();
 	TestFiles();
+	TestWalkDirectory();
+	TestFileWatcher();
+	TestHashing();
 	TestStrings();
 	TestThreading();
+	TestSharedMemory();
+	TestNetwork();
+	TestEventCoalescing();
 	TestInlining();
 	return 0;
 }
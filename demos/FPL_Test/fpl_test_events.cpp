@@ -0,0 +1,126 @@
+/*
+-------------------------------------------------------------------------------
+Name:
+	FPL-Demo | Test | Events
+
+Description:
+	Tests for the internal event queue, which requires the window system to be compiled in.
+	The platform is compiled privately here, so it does not collide with the one from fpl_test.cpp.
+	No window is created, the internal events are pushed and polled directly.
+
+Author:
+	Torsten Spaete
+
+License:
+	Copyright (c) 2017-2020 Torsten Spaete
+	MIT License (See LICENSE file)
+-------------------------------------------------------------------------------
+*/
+
+#define FPL_IMPLEMENTATION
+#define FPL_API_AS_PRIVATE
+#define FPL_NO_AUDIO
+#define FPL_NO_VIDEO
+#include <final_platform_layer.h>
+
+// The test functions are implemented in fpl_test.cpp
+#undef FT_IMPLEMENTATION
+#include "final_test.h"
+
+static bool InitEventPlatform(const bool isEventCoalescing) {
+	fplSettings settings = fplMakeDefaultSettings();
+	settings.window.isEventCoalescing = isEventCoalescing;
+	return fplPlatformInit(fplInitFlags_None, &settings);
+}
+
+void TestEventCoalescing() {
+	ftMsg("Test coalescing of consecutive mouse moves\n");
+	if (InitEventPlatform(true)) {
+		fpl__PushMouseMoveEvent(10, 20, 1, 2);
+		fpl__PushMouseMoveEvent(13, 24, 3, 4);
+		fpl__PushMouseMoveEvent(8, 30, -5, 6);
+		fplEvent ev;
+		ftIsTrue(fpl__PollInternalEvent(&ev));
+		ftAssert(ev.type == fplEventType_Mouse && ev.mouse.type == fplMouseEventType_Move);
+		ftAssertS32Equals(8, ev.mouse.mouseX);
+		ftAssertS32Equals(30, ev.mouse.mouseY);
+		ftAssertS32Equals(-1, ev.mouse.deltaX);
+		ftAssertS32Equals(12, ev.mouse.deltaY);
+		ftIsTrue(ev.timestamp > 0.0);
+		ftIsFalse(fpl__PollInternalEvent(&ev));
+		fplPlatformRelease();
+	}
+
+	ftMsg("Test coalescing keeps only the last resize\n");
+	if (InitEventPlatform(true)) {
+		fpl__PushWindowSizeEvent(fplWindowEventType_Resized, 100, 200);
+		fpl__PushWindowSizeEvent(fplWindowEventType_Resized, 300, 400);
+		fpl__PushWindowSizeEvent(fplWindowEventType_Resized, 640, 480);
+		fplEvent ev;
+		ftIsTrue(fpl__PollInternalEvent(&ev));
+		ftAssert(ev.type == fplEventType_Window && ev.window.type == fplWindowEventType_Resized);
+		ftAssertU32Equals(640, ev.window.size.width);
+		ftAssertU32Equals(480, ev.window.size.height);
+		ftIsFalse(fpl__PollInternalEvent(&ev));
+		fplPlatformRelease();
+	}
+
+	ftMsg("Test coalescing does not merge across other event types\n");
+	if (InitEventPlatform(true)) {
+		fpl__PushMouseMoveEvent(1, 1, 1, 1);
+		fpl__PushMouseButtonEvent(1, 1, fplMouseButtonType_Left, fplButtonState_Press);
+		fpl__PushMouseMoveEvent(2, 2, 1, 1);
+		fpl__PushWindowSizeEvent(fplWindowEventType_Resized, 100, 100);
+		fpl__PushKeyboardButtonEvent(0, fplKey_A, fplKeyboardModifierFlags_None, fplButtonState_Press);
+		fpl__PushWindowSizeEvent(fplWindowEventType_Resized, 200, 200);
+		fplEvent ev;
+		ftIsTrue(fpl__PollInternalEvent(&ev));
+		ftAssert(ev.type == fplEventType_Mouse && ev.mouse.type == fplMouseEventType_Move);
+		ftAssertS32Equals(1, ev.mouse.deltaX);
+		ftIsTrue(fpl__PollInternalEvent(&ev));
+		ftAssert(ev.type == fplEventType_Mouse && ev.mouse.type == fplMouseEventType_Button);
+		ftIsTrue(fpl__PollInternalEvent(&ev));
+		ftAssert(ev.type == fplEventType_Mouse && ev.mouse.type == fplMouseEventType_Move);
+		ftAssertS32Equals(2, ev.mouse.mouseX);
+		ftAssertS32Equals(1, ev.mouse.deltaX);
+		ftIsTrue(fpl__PollInternalEvent(&ev));
+		ftAssert(ev.type == fplEventType_Window && ev.window.type == fplWindowEventType_Resized);
+		ftAssertU32Equals(100, ev.window.size.width);
+		ftIsTrue(fpl__PollInternalEvent(&ev));
+		ftAssert(ev.type == fplEventType_Keyboard);
+		ftIsTrue(fpl__PollInternalEvent(&ev));
+		ftAssert(ev.type == fplEventType_Window && ev.window.type == fplWindowEventType_Resized);
+		ftAssertU32Equals(200, ev.window.size.width);
+		ftIsFalse(fpl__PollInternalEvent(&ev));
+		fplPlatformRelease();
+	}
+
+	ftMsg("Test coalescing does not merge into an already polled event\n");
+	if (InitEventPlatform(true)) {
+		fpl__PushMouseMoveEvent(5, 5, 5, 5);
+		fplEvent ev;
+		ftIsTrue(fpl__PollInternalEvent(&ev));
+		ftAssertS32Equals(5, ev.mouse.deltaX);
+		fpl__PushMouseMoveEvent(7, 8, 2, 3);
+		ftIsTrue(fpl__PollInternalEvent(&ev));
+		ftAssert(ev.type == fplEventType_Mouse && ev.mouse.type == fplMouseEventType_Move);
+		ftAssertS32Equals(7, ev.mouse.mouseX);
+		ftAssertS32Equals(2, ev.mouse.deltaX);
+		ftAssertS32Equals(3, ev.mouse.deltaY);
+		ftIsFalse(fpl__PollInternalEvent(&ev));
+		fplPlatformRelease();
+	}
+
+	ftMsg("Test no coalescing when disabled\n");
+	if (InitEventPlatform(false)) {
+		fpl__PushMouseMoveEvent(1, 1, 1, 1);
+		fpl__PushMouseMoveEvent(2, 2, 1, 1);
+		fplEvent ev;
+		ftIsTrue(fpl__PollInternalEvent(&ev));
+		ftAssertS32Equals(1, ev.mouse.mouseX);
+		ftIsTrue(fpl__PollInternalEvent(&ev));
+		ftAssertS32Equals(2, ev.mouse.mouseX);
+		ftIsFalse(fpl__PollInternalEvent(&ev));
+		fplPlatformRelease();
+	}
+}
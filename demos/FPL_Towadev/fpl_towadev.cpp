@@ -18,6 +18,9 @@ Author:
 	Torsten Spaete
 
 Changelog:
+	## 2026-10-18
+	- Reload towers/creeps/waves data automatically when changed, using fplFileWatcher
+
 	## 2019-04-27
 	- Use Vec2Normalize instead of dividing by length
 
@@ -400,23 +403,6 @@ namespace utils {
 		return(result);
 	}
 
-	static FileInfo LoadFileInfo(const char *filePath) {
-		FileInfo result = {};
-		fplFileHandle file;
-		if (fplOpenBinaryFile(filePath, &file)) {
-			result.size = fplGetFileSizeFromHandle32(&file);
-			fplFileTimeStamps timestamps = {};
-			fplGetFileTimestampsFromHandle(&file, &timestamps);
-			result.modifyDate = timestamps.lastModifyTime;
-			fplCloseFile(&file);
-		}
-		return(result);
-	}
-
-	static bool IsEqualFileInfo(const FileInfo &a, const FileInfo &b) {
-		bool result = (a.size == b.size) && (a.modifyDate == b.modifyDate);
-		return(result);
-	}
 }
 
 namespace render {
@@ -906,7 +892,6 @@ namespace level {
 		char filePath[FPL_MAX_PATH_LENGTH];
 		fplPathCombine(filePath, fplArrayCount(filePath), 3, assets.dataPath, "levels", filename);
 		FileContents fileData = utils::LoadEntireFile(filePath, memory);
-		assets.creepsFileInfo = fileData.info;
 		if (fileData.data != nullptr) {
 			fxmlContext ctx = {};
 			if (fxmlInitFromMemory(fileData.data, fileData.info.size, &ctx)) {
@@ -1007,7 +992,6 @@ namespace level {
 		char filePath[FPL_MAX_PATH_LENGTH];
 		fplPathCombine(filePath, fplArrayCount(filePath), 3, assets.dataPath, "levels", filename);
 		FileContents fileData = utils::LoadEntireFile(filePath, memory);
-		assets.towersFileInfo = fileData.info;
 		if (fileData.data != nullptr) {
 			fxmlContext ctx = {};
 			if (fxmlInitFromMemory(fileData.data, fileData.info.size, &ctx)) {
@@ -1087,7 +1071,6 @@ namespace level {
 		char filePath[FPL_MAX_PATH_LENGTH];
 		fplPathCombine(filePath, fplArrayCount(filePath), 3, assets.dataPath, "levels", filename);
 		FileContents fileData = utils::LoadEntireFile(filePath, memory);
-		assets.wavesFileInfo = fileData.info;
 		if (fileData.data != nullptr) {
 			fxmlContext ctx = {};
 			if (fxmlInitFromMemory(fileData.data, fileData.info.size, &ctx)) {
@@ -1659,8 +1642,20 @@ namespace game {
 		}
 	}
 
+	static void LevelsDataChanged(const fplFileWatchEvent *event, void *userData) {
+		GameState *state = (GameState *)userData;
+		const char *filename = fplExtractFileName(event->path);
+		if (event->type != fplFileWatchEventType_Deleted) {
+			if (fplIsStringEqual(filename, TowersDataFilename) || fplIsStringEqual(filename, CreepsDataFilename) || fplIsStringEqual(filename, WavesDataFilename)) {
+				gamelog::Info("Data file '%s' has changed", event->path);
+				state->assets.isReloadRequested = true;
+			}
+		}
+	}
+
 	static void ReleaseGame(GameState &state) {
 		gamelog::Verbose("Release Game");
+		fplFileWatcherDestroy(&state.assets.levelsWatcher);
 		level::ClearLevel(state);
 		ReleaseAssets(state.assets);
 	}
@@ -1687,6 +1682,17 @@ namespace game {
 		fplPathCombine(state.assets.dataPath, fplArrayCount(state.assets.dataPath), 2, state.assets.dataPath, "data");
 		gamelog::Info("Using assets path: %s", state.assets.dataPath);
 
+		// Watch the level data files for changes, instead of polling them
+		fplFileWatcherSettings watcherSettings;
+		fplSetDefaultFileWatcherSettings(&watcherSettings);
+		watcherSettings.callback = LevelsDataChanged;
+		watcherSettings.userData = &state;
+		if (fplFileWatcherCreate(&watcherSettings, &state.assets.levelsWatcher)) {
+			char levelsDataPath[1024];
+			fplPathCombine(levelsDataPath, fplArrayCount(levelsDataPath), 2, state.assets.dataPath, "levels");
+			fplFileWatcherAdd(&state.assets.levelsWatcher, levelsDataPath, fplFileWatchFlags_None, nullptr);
+		}
+
 		size_t levelMemorySize = FMEM_MEGABYTES(32);
 		uint8_t *levelMemory = fmemPush(gameMemory.memory, levelMemorySize, fmemPushFlags_None);
 		if (!fmemInitFromSource(&state.level.levelMem, levelMemory, levelMemorySize)) {
@@ -1910,19 +1916,11 @@ extern void GameUpdate(GameMemory &gameMemory, const Input &input) {
 	GameState *state = gameMemory.game;
 	assert(state != nullptr);
 
-	if (WasPressed(input.keyboard.debugReload)) {
-		char filePathBuffer[FPL_MAX_PATH_LENGTH];
-		fplPathCombine(filePathBuffer, fplArrayCount(filePathBuffer), 3, state->assets.dataPath, "levels", TowersDataFilename);
-		FileInfo towersFileContents = utils::LoadFileInfo(filePathBuffer);
-		fplPathCombine(filePathBuffer, fplArrayCount(filePathBuffer), 3, state->assets.dataPath, "levels", CreepsDataFilename);
-		FileInfo creepsFileContents = utils::LoadFileInfo(filePathBuffer);
-		fplPathCombine(filePathBuffer, fplArrayCount(filePathBuffer), 3, state->assets.dataPath, "levels", WavesDataFilename);
-		FileInfo wavesFileContents = utils::LoadFileInfo(filePathBuffer);
-
-		//utils::IsEqualFileInfo(towersFileContents, state->assets.towersFileInfo)
-		//utils::IsEqualFileInfo(creepsFileContents, state->assets.creepsFileInfo)
-		//utils::IsEqualFileInfo(wavesFileContents, state->assets.wavesFileInfo)
-
+	if (state->assets.levelsWatcher.isValid) {
+		fplFileWatcherUpdate(&state->assets.levelsWatcher, 0);
+	}
+	if (WasPressed(input.keyboard.debugReload) || state->assets.isReloadRequested) {
+		state->assets.isReloadRequested = false;
 		fmemMemoryBlock tempMem = {};
 		if (fmemBeginTemporary(&state->transientMem, &tempMem)) {
 			level::LoadCreepDefinitions(state->assets, CreepsDataFilename, true, &tempMem);
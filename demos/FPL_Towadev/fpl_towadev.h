@@ -454,9 +454,8 @@ struct Assets {
 	size_t towerDefinitionCount;
 	size_t creepDefinitionCount;
 	size_t waveDefinitionCount;
-	FileInfo towersFileInfo;
-	FileInfo wavesFileInfo;
-	FileInfo creepsFileInfo;
+	fplFileWatcher levelsWatcher;
+	bool isReloadRequested;
 	TextureAsset radiantTexture;
 	TextureAsset entitiesTilesetTexture;
 	TextureAsset wayTilesetTexture;
@@ -0,0 +1,780 @@
+/*
+-------------------------------------------------------------------------------
+Name:
+	FXML | Bench
+
+Description:
+	Throughput benchmark and corpus harness for telling whether parser changes speed up level loads.
+	Generates corpora with fxmlWriter and loads real files, then runs every parse mode on every corpus.
+
+	- Corpora:
+		deep: Chains of 1000 nested elements
+		wide: Thousands of siblings with a attribute and a short text
+		attributes: Elements with 16 attributes each
+		text: Paragraphs with 4 KB of text each
+		entities: Attributes and texts full of escaped characters
+		tmx: Tiled map with csv layers and object groups, like the levels of FPL_Towadev
+		file:<path>: Real files, the levels of FPL_Towadev and FXML_Test by default
+	- Modes:
+		copy: fxmlParse with fxmlParseMode_Copy
+		view: fxmlParse with fxmlParseMode_View
+		insitu: fxmlParse with fxmlParseMode_InSitu, the source is copied before each parse (not timed)
+		parallel: fxmlParseParallel with the given thread count
+		stream: All events of a fxmlReader, the source is copied before each read (not timed)
+		binary: fxmlLoadBinary of a saved tree, the saved blob is copied before each load (not timed)
+
+	Each run repeats the mode until the minimum amount of source data is processed.
+	MB/s is always based on the size of the XML source, so the binary mode is comparable to the parse modes.
+	All parser memory goes through FXML_MALLOC/FXML_FREE, allocations are counted per parse and peak is the most memory alive at once.
+
+	Prints one line per run in the form:
+	corpus=<name> mode=<name> bytes=<source size> iterations=<count> failed=<count> seconds=<secs> mbs=<megabytes per second> allocations=<per parse> peak_kb=<kb>
+	With format "json" each line is a JSON object with the same keys instead.
+
+	Usage: FXML_Bench [corpus size in kilobytes] [minimum kilobytes per run] [thread count] [filter] [text|json] [files...]
+	The filter is matched against "<corpus>/<mode>", for example "tmx" or "/view" or "all".
+
+	Fuzzing:
+	Build with FXML_BENCH_FUZZ defined and -fsanitize=fuzzer to get the LLVMFuzzerTestOneInput entry point.
+	Every input is parsed in all modes, the trees of all modes must be equal and must survive the binary cache.
+	"FXML_Bench corpus <directory> [corpus size in kilobytes]" writes the generated corpora as seed files.
+	"FXML_Bench fuzz <files...>" runs the same checks on the given files, for reproducing crashes without a fuzzer.
+
+Requirements:
+	- C99
+	- Final XML
+	- Final Platform Layer
+
+Author:
+	Torsten Spaete
+
+Changelog:
+	## 2026-10-18
+	- Initial version
+
+License:
+	Copyright (c) 2017-2020 Torsten Spaete
+	MIT License (See LICENSE file)
+-------------------------------------------------------------------------------
+*/
+
+#define FPL_IMPLEMENTATION
+#define FPL_NO_WINDOW
+#define FPL_NO_VIDEO
+#define FPL_NO_AUDIO
+#include <final_platform_layer.h>
+
+#include <stdlib.h> // atoi, malloc, free, abort
+#include <stdio.h> // fopen, fread, fwrite
+#include <string.h> // strstr, strcmp, memcpy
+
+// Every allocation of the parser is tracked
+static void *BenchMalloc(size_t size);
+static void BenchFree(void *ptr);
+
+#define FXML_MALLOC BenchMalloc
+#define FXML_FREE BenchFree
+#define FXML_READER_MAX_DEPTH 1024
+#define FXML_WRITER_MAX_DEPTH 1024
+#define FXML_IMPLEMENTATION
+#include <final_xml.h>
+
+#define BENCH_DEEP_DEPTH 1000
+#define BENCH_MAX_CORPORA 16
+#define BENCH_ALLOCATION_HEADER_SIZE 16
+
+typedef enum BenchMode {
+	BenchMode_Copy,
+	BenchMode_View,
+	BenchMode_InSitu,
+	BenchMode_Parallel,
+	BenchMode_Stream,
+	BenchMode_Binary,
+} BenchMode;
+
+static const char *BenchModeNames[] = {
+	"copy",
+	"view",
+	"insitu",
+	"parallel",
+	"stream",
+	"binary",
+};
+
+typedef enum BenchFormat {
+	BenchFormat_Text,
+	BenchFormat_JSON,
+} BenchFormat;
+
+typedef struct BenchAllocations {
+	volatile size_t count;
+	volatile size_t liveBytes;
+	volatile size_t peakBytes;
+} BenchAllocations;
+
+typedef struct BenchCorpus {
+	char name[256];
+	char *data;
+	size_t size;
+} BenchCorpus;
+
+// Buffers for one corpus, none of them are tracked
+typedef struct BenchState {
+	const BenchCorpus *corpus;
+	char *copy;
+	void *binary;
+	void *binaryCopy;
+	size_t binarySize;
+	uint64_t sourceHash;
+	size_t threadCount;
+	fxmlContext ctx;
+	fxmlTag root;
+} BenchState;
+
+typedef struct BenchResult {
+	size_t bytes;
+	size_t iterations;
+	size_t failed;
+	size_t allocations;
+	size_t peakBytes;
+	double seconds;
+} BenchResult;
+
+static BenchAllocations globalAllocations;
+
+static void *BenchMalloc(size_t size) {
+	uint8_t *base = (uint8_t *)malloc(size + BENCH_ALLOCATION_HEADER_SIZE);
+	if (base == fpl_null) {
+		return fpl_null;
+	}
+	*(size_t *)base = size;
+	fplAtomicIncrementSize(&globalAllocations.count);
+	size_t live = fplAtomicAddAndFetchSize(&globalAllocations.liveBytes, size);
+	size_t peak = fplAtomicLoadSize(&globalAllocations.peakBytes);
+	while (live > peak) {
+		size_t prev = fplAtomicCompareAndSwapSize(&globalAllocations.peakBytes, peak, live);
+		if (prev == peak) {
+			break;
+		}
+		peak = prev;
+	}
+	return(base + BENCH_ALLOCATION_HEADER_SIZE);
+}
+
+static void BenchFree(void *ptr) {
+	if (ptr == fpl_null) {
+		return;
+	}
+	uint8_t *base = (uint8_t *)ptr - BENCH_ALLOCATION_HEADER_SIZE;
+	size_t size = *(size_t *)base;
+	fplAtomicAddAndFetchSize(&globalAllocations.liveBytes, (size_t)0 - size);
+	free(base);
+}
+
+//
+// Corpus generation
+//
+static void SetCorpus(BenchCorpus *corpus, const char *name, fxmlWriter *writer) {
+	fplCopyString(name, corpus->name, fplArrayCount(corpus->name));
+	corpus->size = writer->used;
+	corpus->data = (char *)malloc(corpus->size);
+	memcpy(corpus->data, writer->buffer, corpus->size);
+	fxmlWriterFree(writer);
+}
+
+static void GenerateDeep(BenchCorpus *corpus, const size_t targetSize) {
+	fxmlWriter writer;
+	fxmlWriterInit(&writer, fpl_null);
+	fxmlWriteDeclaration(&writer);
+	fxmlWriteStartElement(&writer, "deep");
+	while (writer.used < targetSize) {
+		for (int level = 0; level < BENCH_DEEP_DEPTH; ++level) {
+			fxmlWriteStartElement(&writer, "node");
+		}
+		fxmlWriteText(&writer, "leaf");
+		for (int level = 0; level < BENCH_DEEP_DEPTH; ++level) {
+			fxmlWriteEndElement(&writer);
+		}
+	}
+	fxmlWriteEndElement(&writer);
+	SetCorpus(corpus, "deep", &writer);
+}
+
+static void GenerateWide(BenchCorpus *corpus, const size_t targetSize) {
+	fxmlWriter writer;
+	fxmlWriterInit(&writer, "\t");
+	fxmlWriteDeclaration(&writer);
+	fxmlWriteStartElement(&writer, "wide");
+	char id[32];
+	for (int index = 0; writer.used < targetSize; ++index) {
+		fplFormatString(id, fplArrayCount(id), "%d", index);
+		fxmlWriteStartElement(&writer, "item");
+		fxmlWriteAttribute(&writer, "id", id);
+		fxmlWriteText(&writer, "value");
+		fxmlWriteEndElement(&writer);
+	}
+	fxmlWriteEndElement(&writer);
+	SetCorpus(corpus, "wide", &writer);
+}
+
+static void GenerateAttributes(BenchCorpus *corpus, const size_t targetSize) {
+	static const char *names[] = {
+		"id", "name", "type", "x", "y", "width", "height", "rotation",
+		"visible", "opacity", "offsetx", "offsety", "gid", "class", "locked", "tint",
+	};
+	fxmlWriter writer;
+	fxmlWriterInit(&writer, "\t");
+	fxmlWriteDeclaration(&writer);
+	fxmlWriteStartElement(&writer, "attributes");
+	char value[32];
+	for (int index = 0; writer.used < targetSize; ++index) {
+		fxmlWriteStartElement(&writer, "object");
+		for (size_t nameIndex = 0; nameIndex < fplArrayCount(names); ++nameIndex) {
+			fplFormatString(value, fplArrayCount(value), "%d", index * 16 + (int)nameIndex);
+			fxmlWriteAttribute(&writer, names[nameIndex], value);
+		}
+		fxmlWriteEndElement(&writer);
+	}
+	fxmlWriteEndElement(&writer);
+	SetCorpus(corpus, "attributes", &writer);
+}
+
+static void GenerateText(BenchCorpus *corpus, const size_t targetSize) {
+	static const char sentence[] = "The quick brown fox jumps over the lazy dog, while the tower defends the way against the next wave. ";
+	char paragraph[4096];
+	size_t sentenceLen = fplArrayCount(sentence) - 1;
+	size_t paragraphLen = 0;
+	while (paragraphLen + sentenceLen < fplArrayCount(paragraph)) {
+		memcpy(paragraph + paragraphLen, sentence, sentenceLen);
+		paragraphLen += sentenceLen;
+	}
+	paragraph[paragraphLen] = 0;
+	fxmlWriter writer;
+	fxmlWriterInit(&writer, "\t");
+	fxmlWriteDeclaration(&writer);
+	fxmlWriteStartElement(&writer, "text");
+	while (writer.used < targetSize) {
+		fxmlWriteStartElement(&writer, "paragraph");
+		fxmlWriteText(&writer, paragraph);
+		fxmlWriteEndElement(&writer);
+	}
+	fxmlWriteEndElement(&writer);
+	SetCorpus(corpus, "text", &writer);
+}
+
+static void GenerateEntities(BenchCorpus *corpus, const size_t targetSize) {
+	fxmlWriter writer;
+	fxmlWriterInit(&writer, "\t");
+	fxmlWriteDeclaration(&writer);
+	fxmlWriteStartElement(&writer, "entities");
+	while (writer.used < targetSize) {
+		fxmlWriteStartElement(&writer, "entry");
+		fxmlWriteAttribute(&writer, "name", "Tom & \"Jerry\" <3>");
+		fxmlWriteAttribute(&writer, "condition", "a<b && b>c");
+		fxmlWriteText(&writer, "if (a < b && c > d) { return \"<&>\"; } 'single' & \"double\" quotes");
+		fxmlWriteEndElement(&writer);
+	}
+	fxmlWriteEndElement(&writer);
+	SetCorpus(corpus, "entities", &writer);
+}
+
+static void GenerateTmx(BenchCorpus *corpus, const size_t targetSize) {
+	const int mapSize = 128;
+	char value[64];
+	char row[16 * 128 + 2];
+	fxmlWriter writer;
+	fxmlWriterInit(&writer, " ");
+	fxmlWriteDeclaration(&writer);
+	fxmlWriteStartElement(&writer, "map");
+	fxmlWriteAttribute(&writer, "version", "1.0");
+	fxmlWriteAttribute(&writer, "orientation", "orthogonal");
+	fxmlWriteAttribute(&writer, "width", "128");
+	fxmlWriteAttribute(&writer, "height", "128");
+	fxmlWriteAttribute(&writer, "tilewidth", "64");
+	fxmlWriteAttribute(&writer, "tileheight", "64");
+	fxmlWriteStartElement(&writer, "tileset");
+	fxmlWriteAttribute(&writer, "firstgid", "1");
+	fxmlWriteAttribute(&writer, "name", "ground");
+	fxmlWriteStartElement(&writer, "image");
+	fxmlWriteAttribute(&writer, "source", "ground_tileset.png");
+	fxmlWriteEndElement(&writer);
+	fxmlWriteEndElement(&writer);
+	for (int layerIndex = 0; writer.used < targetSize; ++layerIndex) {
+		fplFormatString(value, fplArrayCount(value), "layer%d", layerIndex);
+		fxmlWriteStartElement(&writer, "layer");
+		fxmlWriteAttribute(&writer, "name", value);
+		fxmlWriteAttribute(&writer, "width", "128");
+		fxmlWriteAttribute(&writer, "height", "128");
+		fxmlWriteStartElement(&writer, "data");
+		fxmlWriteAttribute(&writer, "encoding", "csv");
+		for (int y = 0; y < mapSize; ++y) {
+			size_t rowLen = 0;
+			row[rowLen++] = '\n';
+			for (int x = 0; x < mapSize; ++x) {
+				fplFormatString(row + rowLen, fplArrayCount(row) - rowLen, "%d,", 1 + (x * 7 + y * 13 + layerIndex) % 48);
+				rowLen += strlen(row + rowLen);
+			}
+			row[rowLen] = 0;
+			fxmlWriteText(&writer, row);
+		}
+		fxmlWriteEndElement(&writer);
+		fxmlWriteEndElement(&writer);
+
+		fxmlWriteStartElement(&writer, "objectgroup");
+		fplFormatString(value, fplArrayCount(value), "objects%d", layerIndex);
+		fxmlWriteAttribute(&writer, "name", value);
+		for (int objectIndex = 0; objectIndex < 256; ++objectIndex) {
+			fxmlWriteStartElement(&writer, "object");
+			fplFormatString(value, fplArrayCount(value), "%d", layerIndex * 256 + objectIndex);
+			fxmlWriteAttribute(&writer, "id", value);
+			fxmlWriteAttribute(&writer, "type", (objectIndex % 8) == 0 ? "spawn" : "waypoint");
+			fplFormatString(value, fplArrayCount(value), "%d", (objectIndex % 128) * 64);
+			fxmlWriteAttribute(&writer, "x", value);
+			fplFormatString(value, fplArrayCount(value), "%d", (objectIndex / 2) * 64);
+			fxmlWriteAttribute(&writer, "y", value);
+			fxmlWriteAttribute(&writer, "width", "64");
+			fxmlWriteAttribute(&writer, "height", "64");
+			fxmlWriteStartElement(&writer, "properties");
+			fxmlWriteStartElement(&writer, "property");
+			fxmlWriteAttribute(&writer, "name", "wave");
+			fplFormatString(value, fplArrayCount(value), "%d", objectIndex % 10);
+			fxmlWriteAttribute(&writer, "value", value);
+			fxmlWriteEndElement(&writer);
+			fxmlWriteEndElement(&writer);
+			fxmlWriteEndElement(&writer);
+		}
+		fxmlWriteEndElement(&writer);
+	}
+	fxmlWriteEndElement(&writer);
+	SetCorpus(corpus, "tmx", &writer);
+}
+
+static bool LoadCorpusFile(BenchCorpus *corpus, const char *filePath) {
+	FILE *file = fopen(filePath, "rb");
+	if (file == fpl_null) {
+		return false;
+	}
+	fseek(file, 0, SEEK_END);
+	long size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	bool result = false;
+	if (size > 0) {
+		corpus->data = (char *)malloc((size_t)size);
+		corpus->size = fread(corpus->data, 1, (size_t)size, file);
+		result = corpus->size == (size_t)size;
+		if (!result) {
+			free(corpus->data);
+			corpus->data = fpl_null;
+		}
+	}
+	fclose(file);
+	if (result) {
+		fplFormatString(corpus->name, fplArrayCount(corpus->name), "file:%s", filePath);
+	}
+	return(result);
+}
+
+// Real levels, relative to the demos directory or to the working directory of a demo
+static const char *BenchDefaultFiles[] = {
+	"FPL_Towadev/data/levels/level1.tmx",
+	"FPL_Towadev/data/levels/towers.xml",
+	"FXML_Test/level1.tmx",
+};
+
+static const char *BenchDefaultFilePrefixes[] = {
+	"",
+	"../",
+	"demos/",
+	"../../demos/",
+};
+
+static size_t GenerateCorpora(BenchCorpus *corpora, const size_t targetSize) {
+	size_t count = 0;
+	GenerateDeep(&corpora[count++], targetSize);
+	GenerateWide(&corpora[count++], targetSize);
+	GenerateAttributes(&corpora[count++], targetSize);
+	GenerateText(&corpora[count++], targetSize);
+	GenerateEntities(&corpora[count++], targetSize);
+	GenerateTmx(&corpora[count++], targetSize);
+	return(count);
+}
+
+static size_t LoadDefaultFiles(BenchCorpus *corpora, const size_t maxCount) {
+	size_t count = 0;
+	char filePath[1024];
+	for (size_t fileIndex = 0; fileIndex < fplArrayCount(BenchDefaultFiles); ++fileIndex) {
+		for (size_t prefixIndex = 0; prefixIndex < fplArrayCount(BenchDefaultFilePrefixes) && count < maxCount; ++prefixIndex) {
+			fplFormatString(filePath, fplArrayCount(filePath), "%s%s", BenchDefaultFilePrefixes[prefixIndex], BenchDefaultFiles[fileIndex]);
+			if (LoadCorpusFile(&corpora[count], filePath)) {
+				++count;
+				break;
+			}
+		}
+	}
+	return(count);
+}
+
+//
+// Modes
+//
+static void PrepareState(BenchState *state, const BenchCorpus *corpus, const size_t threadCount) {
+	fplClearStruct(state);
+	state->corpus = corpus;
+	state->threadCount = threadCount;
+	state->copy = (char *)malloc(corpus->size);
+	state->sourceHash = fxmlComputeSourceHash(corpus->data, corpus->size);
+	fxmlContext ctx;
+	fxmlTag root = FXML_ZERO_INIT;
+	if (fxmlInitFromMemory(corpus->data, corpus->size, &ctx) && fxmlParse(&ctx, &root)) {
+		state->binarySize = fxmlSaveBinary(&ctx, &root, state->sourceHash, fpl_null, 0);
+		state->binary = malloc(state->binarySize);
+		state->binaryCopy = malloc(state->binarySize);
+		fxmlSaveBinary(&ctx, &root, state->sourceHash, state->binary, state->binarySize);
+	}
+	fxmlFree(&ctx);
+}
+
+static void ReleaseState(BenchState *state) {
+	free(state->binaryCopy);
+	free(state->binary);
+	free(state->copy);
+	fplClearStruct(state);
+}
+
+// Everything which is not part of the measured load, like restoring the data changed by the last iteration
+static void BeforeIteration(const BenchMode mode, BenchState *state) {
+	if (mode == BenchMode_InSitu || mode == BenchMode_Stream) {
+		memcpy(state->copy, state->corpus->data, state->corpus->size);
+	} else if (mode == BenchMode_Binary && state->binary != fpl_null) {
+		memcpy(state->binaryCopy, state->binary, state->binarySize);
+	}
+}
+
+static bool RunIteration(const BenchMode mode, BenchState *state) {
+	const BenchCorpus *corpus = state->corpus;
+	fplClearStruct(&state->root);
+	switch (mode) {
+		case BenchMode_Copy:
+		case BenchMode_View:
+		{
+			if (!fxmlInitFromMemory(corpus->data, corpus->size, &state->ctx)) {
+				return false;
+			}
+			state->ctx.mode = mode == BenchMode_View ? fxmlParseMode_View : fxmlParseMode_Copy;
+			return fxmlParse(&state->ctx, &state->root);
+		}
+		case BenchMode_InSitu:
+		{
+			if (!fxmlInitInSitu(state->copy, corpus->size, &state->ctx)) {
+				return false;
+			}
+			return fxmlParse(&state->ctx, &state->root);
+		}
+		case BenchMode_Parallel:
+		{
+			if (!fxmlInitFromMemory(corpus->data, corpus->size, &state->ctx)) {
+				return false;
+			}
+			return fxmlParseParallel(&state->ctx, &state->root, state->threadCount);
+		}
+		case BenchMode_Stream:
+		{
+			fxmlReader reader;
+			if (!fxmlReaderInitFromMemory(&reader, state->copy, corpus->size)) {
+				return false;
+			}
+			fxmlEvent event;
+			while (fxmlNextEvent(&reader, &event)) {
+			}
+			return !reader.isError;
+		}
+		case BenchMode_Binary:
+		{
+			if (state->binary == fpl_null) {
+				return false;
+			}
+			fxmlTag *root = fxmlLoadBinary(state->binaryCopy, state->binarySize, state->sourceHash, &state->ctx);
+			return(root != fpl_null);
+		}
+		default:
+			return false;
+	}
+}
+
+static void AfterIteration(const BenchMode mode, BenchState *state) {
+	if (mode != BenchMode_Stream) {
+		fxmlFree(&state->ctx);
+	}
+}
+
+static BenchResult RunMode(const BenchMode mode, BenchState *state, const size_t minBytes) {
+	BenchResult result = fplZeroInit;
+	result.bytes = state->corpus->size;
+	size_t iterations = (minBytes + result.bytes - 1) / result.bytes;
+	if (iterations < 3) {
+		iterations = 3;
+	}
+
+	size_t startCount = fplAtomicLoadSize(&globalAllocations.count);
+	size_t startLive = fplAtomicLoadSize(&globalAllocations.liveBytes);
+	fplAtomicStoreSize(&globalAllocations.peakBytes, startLive);
+
+	for (size_t iteration = 0; iteration < iterations; ++iteration) {
+		BeforeIteration(mode, state);
+		double start = fplGetTimeInSecondsHP();
+		bool success = RunIteration(mode, state);
+		result.seconds += fplGetTimeInSecondsHP() - start;
+		if (!success) {
+			++result.failed;
+		}
+		AfterIteration(mode, state);
+	}
+
+	result.iterations = iterations;
+	result.allocations = (fplAtomicLoadSize(&globalAllocations.count) - startCount) / iterations;
+	result.peakBytes = fplAtomicLoadSize(&globalAllocations.peakBytes) - startLive;
+	return(result);
+}
+
+static void PrintResult(const BenchFormat format, const char *corpusName, const char *modeName, const BenchResult *r) {
+	double mbs = r->seconds > 0.0 ? ((double)r->bytes * (double)r->iterations / (1024.0 * 1024.0)) / r->seconds : 0.0;
+	size_t peakKB = r->peakBytes / 1024;
+	if (format == BenchFormat_JSON) {
+		fplConsoleFormatOut("{\"corpus\":\"%s\",\"mode\":\"%s\",\"bytes\":%zu,\"iterations\":%zu,\"failed\":%zu,\"seconds\":%.3f,\"mbs\":%.2f,\"allocations\":%zu,\"peak_kb\":%zu}\n",
+							corpusName, modeName, r->bytes, r->iterations, r->failed, r->seconds, mbs, r->allocations, peakKB);
+	} else {
+		fplConsoleFormatOut("corpus=%s mode=%s bytes=%zu iterations=%zu failed=%zu seconds=%.3f mbs=%.2f allocations=%zu peak_kb=%zu\n",
+							corpusName, modeName, r->bytes, r->iterations, r->failed, r->seconds, mbs, r->allocations, peakKB);
+	}
+}
+
+static bool IsFiltered(const char *filter, const char *corpusName, const char *modeName) {
+	if (filter == fpl_null || strcmp(filter, "all") == 0) {
+		return(false);
+	}
+	char name[512];
+	fplFormatString(name, fplArrayCount(name), "%s/%s", corpusName, modeName);
+	bool result = strstr(name, filter) == fpl_null;
+	return(result);
+}
+
+//
+// Fuzzing
+//
+static bool IsSameTree(const fxmlTag *a, const fxmlTag *b) {
+	if (a->type != b->type || a->nameLen != b->nameLen || a->valueLen != b->valueLen) {
+		return false;
+	}
+	if (a->nameLen > 0 && memcmp(a->name, b->name, a->nameLen) != 0) {
+		return false;
+	}
+	if (a->valueLen > 0 && memcmp(a->value, b->value, a->valueLen) != 0) {
+		return false;
+	}
+	const fxmlTag *tagA = a->firstAttribute;
+	const fxmlTag *tagB = b->firstAttribute;
+	for (; tagA != fpl_null && tagB != fpl_null; tagA = tagA->nextSibling, tagB = tagB->nextSibling) {
+		if (!IsSameTree(tagA, tagB)) {
+			return false;
+		}
+	}
+	if (tagA != tagB) {
+		return false;
+	}
+	tagA = a->firstChild;
+	tagB = b->firstChild;
+	for (; tagA != fpl_null && tagB != fpl_null; tagA = tagA->nextSibling, tagB = tagB->nextSibling) {
+		if (tagB->parent != b || !IsSameTree(tagA, tagB)) {
+			return false;
+		}
+	}
+	return(tagA == tagB);
+}
+
+static void FuzzCheck(const bool condition, const char *message) {
+	if (!condition) {
+		fplConsoleFormatError("Fuzz check failed: %s\n", message);
+		abort();
+	}
+}
+
+// Parses the input in all modes, all modes must agree on the result and build the same tree
+static void FuzzOne(const uint8_t *data, const size_t size) {
+	if (size == 0) {
+		return;
+	}
+	char *copy = (char *)malloc(size);
+
+	fxmlContext copyCtx;
+	fxmlTag copyRoot = FXML_ZERO_INIT;
+	fxmlInitFromMemory(data, size, &copyCtx);
+	bool copyResult = fxmlParse(&copyCtx, &copyRoot);
+
+	fxmlContext viewCtx;
+	fxmlTag viewRoot = FXML_ZERO_INIT;
+	fxmlInitFromMemory(data, size, &viewCtx);
+	viewCtx.mode = fxmlParseMode_View;
+	bool viewResult = fxmlParse(&viewCtx, &viewRoot);
+	FuzzCheck(viewResult == copyResult, "view and copy results differ");
+	FuzzCheck(!copyResult || IsSameTree(&copyRoot, &viewRoot), "view and copy trees differ");
+	fxmlFree(&viewCtx);
+
+	memcpy(copy, data, size);
+	fxmlContext inSituCtx;
+	fxmlTag inSituRoot = FXML_ZERO_INIT;
+	fxmlInitInSitu(copy, size, &inSituCtx);
+	bool inSituResult = fxmlParse(&inSituCtx, &inSituRoot);
+	FuzzCheck(inSituResult == copyResult, "in situ and copy results differ");
+	FuzzCheck(!copyResult || IsSameTree(&copyRoot, &inSituRoot), "in situ and copy trees differ");
+	fxmlFree(&inSituCtx);
+
+	// Jobs are parsed on the calling thread, the fuzzer does not need any threads
+	fxmlParallelJob jobs[4];
+	fxmlContext parallelCtx;
+	fxmlTag parallelRoot = FXML_ZERO_INIT;
+	fxmlInitFromMemory(data, size, &parallelCtx);
+	size_t jobCount = fxmlPrepareParallel(&parallelCtx, &parallelRoot, jobs, fplArrayCount(jobs));
+	if (jobCount > 0) {
+		for (size_t jobIndex = 0; jobIndex < jobCount; ++jobIndex) {
+			fxmlParseParallelJob(&jobs[jobIndex]);
+		}
+		bool parallelResult = fxmlFinishParallel(&parallelCtx, &parallelRoot, jobs, jobCount);
+		FuzzCheck(parallelResult == copyResult, "parallel and copy results differ");
+		FuzzCheck(!copyResult || IsSameTree(&copyRoot, &parallelRoot), "parallel and copy trees differ");
+	}
+	fxmlFree(&parallelCtx);
+
+	if (copyResult) {
+		uint64_t sourceHash = fxmlComputeSourceHash(data, size);
+		size_t binarySize = fxmlSaveBinary(&copyCtx, &copyRoot, sourceHash, fpl_null, 0);
+		FuzzCheck(binarySize > 0, "binary size is zero");
+		void *binary = malloc(binarySize);
+		FuzzCheck(fxmlSaveBinary(&copyCtx, &copyRoot, sourceHash, binary, binarySize) == binarySize, "binary save failed");
+		fxmlContext binaryCtx;
+		fxmlTag *binaryRoot = fxmlLoadBinary(binary, binarySize, sourceHash, &binaryCtx);
+		FuzzCheck(binaryRoot != fpl_null && IsSameTree(&copyRoot, binaryRoot), "binary and copy trees differ");
+		fxmlFree(&binaryCtx);
+		free(binary);
+	}
+	fxmlFree(&copyCtx);
+
+	// The reader only has to terminate, it accepts documents the tree parser rejects
+	memcpy(copy, data, size);
+	fxmlReader reader;
+	fxmlReaderInitFromMemory(&reader, copy, size);
+	fxmlEvent event;
+	size_t eventCount = 0;
+	while (fxmlNextEvent(&reader, &event)) {
+		++eventCount;
+		FuzzCheck(eventCount <= size * 2, "reader does not terminate");
+	}
+
+	free(copy);
+}
+
+#if defined(FXML_BENCH_FUZZ)
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+	FuzzOne(data, size);
+	return 0;
+}
+#else
+static int WriteCorpus(const char *directory, const size_t targetSize) {
+	BenchCorpus corpora[BENCH_MAX_CORPORA];
+	size_t corpusCount = GenerateCorpora(corpora, targetSize);
+	corpusCount += LoadDefaultFiles(corpora + corpusCount, fplArrayCount(corpora) - corpusCount);
+	int result = 0;
+	char filePath[1024];
+	for (size_t corpusIndex = 0; corpusIndex < corpusCount; ++corpusIndex) {
+		fplFormatString(filePath, fplArrayCount(filePath), "%s/seed%02zu.xml", directory, corpusIndex);
+		FILE *file = fopen(filePath, "wb");
+		if (file == fpl_null || fwrite(corpora[corpusIndex].data, 1, corpora[corpusIndex].size, file) != corpora[corpusIndex].size) {
+			fplConsoleFormatError("Failed writing '%s'\n", filePath);
+			result = -1;
+		} else {
+			fplConsoleFormatOut("Written '%s' (%s, %zu bytes)\n", filePath, corpora[corpusIndex].name, corpora[corpusIndex].size);
+		}
+		if (file != fpl_null) {
+			fclose(file);
+		}
+		free(corpora[corpusIndex].data);
+	}
+	return(result);
+}
+
+static int FuzzFiles(const int fileCount, char **filePaths) {
+	int result = 0;
+	for (int fileIndex = 0; fileIndex < fileCount; ++fileIndex) {
+		BenchCorpus corpus = fplZeroInit;
+		if (!LoadCorpusFile(&corpus, filePaths[fileIndex])) {
+			fplConsoleFormatError("Failed loading '%s'\n", filePaths[fileIndex]);
+			result = -1;
+			continue;
+		}
+		FuzzOne((const uint8_t *)corpus.data, corpus.size);
+		fplConsoleFormatOut("Passed '%s'\n", filePaths[fileIndex]);
+		free(corpus.data);
+	}
+	return(result);
+}
+
+int main(int argc, char **argv) {
+	if (argc > 2 && strcmp(argv[1], "corpus") == 0) {
+		size_t targetSize = argc > 3 ? (size_t)atoi(argv[3]) * 1024 : 64 * 1024;
+		return WriteCorpus(argv[2], targetSize > 0 ? targetSize : 64 * 1024);
+	}
+	if (argc > 1 && strcmp(argv[1], "fuzz") == 0) {
+		return FuzzFiles(argc - 2, argv + 2);
+	}
+
+	size_t targetSize = argc > 1 ? (size_t)atoi(argv[1]) * 1024 : 0;
+	size_t minBytes = argc > 2 ? (size_t)atoi(argv[2]) * 1024 : 0;
+	size_t threadCount = argc > 3 ? (size_t)atoi(argv[3]) : 0;
+	const char *filter = argc > 4 ? argv[4] : fpl_null;
+	BenchFormat format = (argc > 5 && strcmp(argv[5], "json") == 0) ? BenchFormat_JSON : BenchFormat_Text;
+	if (targetSize == 0) {
+		targetSize = 4 * 1024 * 1024;
+	}
+	if (minBytes == 0) {
+		minBytes = 64 * 1024 * 1024;
+	}
+
+	if (!fplPlatformInit(fplInitFlags_None, fpl_null)) {
+		return -1;
+	}
+	if (threadCount == 0) {
+		threadCount = fplGetProcessorCoreCount();
+	}
+
+	BenchCorpus corpora[BENCH_MAX_CORPORA];
+	size_t corpusCount = GenerateCorpora(corpora, targetSize);
+	if (argc > 6) {
+		for (int fileIndex = 6; fileIndex < argc && corpusCount < fplArrayCount(corpora); ++fileIndex) {
+			if (LoadCorpusFile(&corpora[corpusCount], argv[fileIndex])) {
+				++corpusCount;
+			} else {
+				fplConsoleFormatError("Failed loading '%s'\n", argv[fileIndex]);
+			}
+		}
+	} else {
+		corpusCount += LoadDefaultFiles(corpora + corpusCount, fplArrayCount(corpora) - corpusCount);
+	}
+
+	for (size_t corpusIndex = 0; corpusIndex < corpusCount; ++corpusIndex) {
+		const BenchCorpus *corpus = &corpora[corpusIndex];
+		BenchState state;
+		PrepareState(&state, corpus, threadCount);
+		for (size_t modeIndex = 0; modeIndex < fplArrayCount(BenchModeNames); ++modeIndex) {
+			if (IsFiltered(filter, corpus->name, BenchModeNames[modeIndex])) {
+				continue;
+			}
+			BenchResult r = RunMode((BenchMode)modeIndex, &state, minBytes);
+			PrintResult(format, corpus->name, BenchModeNames[modeIndex], &r);
+		}
+		ReleaseState(&state);
+		free(corpora[corpusIndex].data);
+	}
+
+	fplPlatformRelease();
+	return(0);
+}
+#endif // FXML_BENCH_FUZZ
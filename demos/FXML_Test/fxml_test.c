@@ -13,6 +13,18 @@ Author:
 	Torsten Spaete
 
 Changelog:
+	## 2026-10-18
+	- Added tests for caller provided allocators and large documents
+	- Added tests for scanning across vector boundaries
+	- Added tests for the view and in situ parse modes
+	- Added tests for the streaming reader
+	- Added tests for atoms and hashed lookup
+	- Added tests for the binary cache
+	- Added tests for parallel parsing
+	- Added tests for the writer
+	- Added tests for queries
+	- Replaced fopen_s with fopen
+
 	## 2018-06-29
 	- Initial version
 
@@ -26,6 +38,7 @@ License:
 #include <assert.h>
 #include <stdio.h>
 #include <assert.h>
+#include <stdlib.h>
 
 #if 0
 #define _CRTDBG_MAP_ALLOC
@@ -145,6 +158,9 @@ static void UnitTests() {
 	assert(fxmlTestSuccess("<r><a/><b/></r>"));
 	assert(fxmlTestSuccess("<x>&quot;</x>"));
 	assert(fxmlTestSuccess("<surname>&#352;umbera</surname>"));
+	assert(fxmlTestSuccess("<x:a><x:b/></x:a>"));
+	assert(fxmlTestSuccess("<x>&abcdefghijklmnopqrstuvwxyz;</x>"));
+	assert(!fxmlTestSuccess("<x:a></x:b>"));
 }
 
 static void ManualTest() {
@@ -182,11 +198,937 @@ static void ManualTest() {
 
 
 
+typedef struct TestArena {
+	uint8_t *base;
+	size_t size;
+	size_t used;
+	size_t allocCount;
+} TestArena;
+
+static void *TestArenaAllocate(void *userData, const size_t size, const size_t alignment) {
+	TestArena *arena = (TestArena *)userData;
+	uintptr_t address = (uintptr_t)(arena->base + arena->used);
+	size_t padding = (alignment - (address & (alignment - 1))) & (alignment - 1);
+	if (arena->used + padding + size > arena->size) {
+		return fxml_null;
+	}
+	void *result = arena->base + arena->used + padding;
+	arena->used += padding + size;
+	++arena->allocCount;
+	return(result);
+}
+
+static void AllocatorTest() {
+	const char xml[] = "<root a=\"1\"><child b=\"&amp;2\">text</child><child/></root>";
+
+	uint8_t buffer[4096];
+	TestArena arena = { buffer, sizeof(buffer), 0, 0 };
+	fxmlContext ctx = FXML_ZERO_INIT;
+	assert(!fxmlInitWithAllocator(xml, strlen(xml), fxml_null, fxml_null, &ctx));
+	assert(fxmlInitWithAllocator(xml, strlen(xml), TestArenaAllocate, &arena, &ctx));
+	fxmlTag root = FXML_ZERO_INIT;
+	assert(fxmlParse(&ctx, &root));
+	assert(ctx.firstMem == fxml_null);
+	assert(arena.allocCount > 0);
+	fxmlTag *rootTag = fxmlFindTagByName(&root, "root");
+	assert(rootTag != fxml_null);
+	assert(strcmp(fxmlGetAttributeValue(rootTag, "a"), "1") == 0);
+	fxmlTag *childTag = fxmlFindTagByName(rootTag, "child");
+	assert(childTag != fxml_null);
+	assert(((uintptr_t)childTag % sizeof(void *)) == 0);
+	assert((uint8_t *)childTag >= buffer && (uint8_t *)childTag < buffer + sizeof(buffer));
+	assert(strcmp(fxmlGetAttributeValue(childTag, "b"), "&2") == 0);
+	assert(strcmp(childTag->value, "text") == 0);
+	fxmlFree(&ctx);
+
+	// Out of memory is a parse error
+	TestArena smallArena = { buffer, sizeof(fxmlTag) * 2, 0, 0 };
+	fxmlContext smallCtx = FXML_ZERO_INIT;
+	assert(fxmlInitWithAllocator(xml, strlen(xml), TestArenaAllocate, &smallArena, &smallCtx));
+	fxmlTag smallRoot = FXML_ZERO_INIT;
+	assert(!fxmlParse(&smallCtx, &smallRoot));
+	fxmlFree(&smallCtx);
+}
+
+static void LargeDocumentTest() {
+	const size_t itemCount = 100000;
+	const char itemXml[] = "<item name=\"tile\" id=\"42\">1,2,3,4</item>";
+	size_t itemLen = strlen(itemXml);
+	size_t xmlLen = strlen("<root>") + itemLen * itemCount + strlen("</root>");
+	char *xml = (char *)malloc(xmlLen + 1);
+	assert(xml != fxml_null);
+	char *p = xml;
+	memcpy(p, "<root>", 6);
+	p += 6;
+	for (size_t i = 0; i < itemCount; ++i) {
+		memcpy(p, itemXml, itemLen);
+		p += itemLen;
+	}
+	memcpy(p, "</root>", 7);
+	p += 7;
+	*p = 0;
+
+	fxmlContext ctx = FXML_ZERO_INIT;
+	assert(fxmlInitFromMemory(xml, xmlLen, &ctx));
+	fxmlTag root = FXML_ZERO_INIT;
+	assert(fxmlParse(&ctx, &root));
+
+	fxmlTag *rootTag = fxmlFindTagByName(&root, "root");
+	assert(rootTag != fxml_null);
+	size_t count = 0;
+	for (fxmlTag *item = rootTag->firstChild; item != fxml_null; item = item->nextSibling) {
+		assert(((uintptr_t)item % sizeof(void *)) == 0);
+		++count;
+	}
+	assert(count == itemCount);
+	assert(strcmp(fxmlGetAttributeValue(rootTag->lastChild, "id"), "42") == 0);
+	assert(strcmp(rootTag->lastChild->value, "1,2,3,4") == 0);
+
+	// Blocks are growing geometrically, so there are only a few of them
+	size_t blockCount = 0;
+	for (fxmlMemory *mem = ctx.firstMem; mem != fxml_null; mem = mem->next) {
+		++blockCount;
+	}
+	assert(blockCount < 24);
+
+	fxmlFree(&ctx);
+	assert(ctx.firstMem == fxml_null && ctx.lastMem == fxml_null);
+	free(xml);
+}
+
+// Text, names, whitespaces and entities with every length and offset around the 16/32 byte vector widths
+static void ScanTest() {
+	char xml[4096];
+	char expected[256];
+	char name[96];
+	for (size_t len = 0; len < 80; ++len) {
+		for (size_t pos = 0; pos <= len; ++pos) {
+			// Inner text with a entity at pos
+			size_t e = 0;
+			for (size_t i = 0; i < len; ++i) {
+				if (i == pos) {
+					expected[e++] = '&';
+				}
+				expected[e++] = (char)('a' + (i % 26));
+			}
+			if (pos == len) {
+				expected[e++] = '&';
+			}
+			expected[e] = 0;
+
+			char text[512];
+			size_t t = 0;
+			for (size_t i = 0; i < e; ++i) {
+				if (expected[i] == '&') {
+					memcpy(text + t, "&amp;", 5);
+					t += 5;
+				} else {
+					text[t++] = expected[i];
+				}
+			}
+			text[t] = 0;
+
+			// Element name and whitespaces with the length
+			for (size_t i = 0; i < len + 1; ++i) {
+				name[i] = (i == 0) ? 'n' : (char)((i % 3 == 0) ? '_' : ((i % 3 == 1) ? 'X' : '7'));
+			}
+			name[len + 1] = 0;
+			char spaces[96];
+			for (size_t i = 0; i < pos; ++i) {
+				spaces[i] = (i & 1) ? '\t' : ' ';
+			}
+			spaces[pos] = 0;
+
+			snprintf(xml, sizeof(xml), "<%s%sv=\"%s\"><!--%s-%s--><c>%s</c></%s>", name, pos > 0 ? spaces : " ", text, text, text, text, name);
+			size_t xmlLen = strlen(xml);
+
+			fxmlContext ctx = FXML_ZERO_INIT;
+			assert(fxmlInitFromMemory(xml, xmlLen, &ctx));
+			fxmlTag root = FXML_ZERO_INIT;
+			assert(fxmlParse(&ctx, &root));
+			fxmlTag *tag = fxmlFindTagByName(&root, name);
+			assert(tag != fxml_null);
+			assert(strcmp(fxmlGetAttributeValue(tag, "v"), expected) == 0);
+			assert(strcmp(fxmlGetTagValue(tag, "c"), expected) == 0);
+			assert(tag->firstChild->type == fxmlTagType_Comment);
+			fxmlFree(&ctx);
+		}
+	}
+
+	// Unterminated comment and attribute at the end of the stream
+	assert(!fxmlTestSuccess("<a><!-- this comment is never closed and longer than a vector"));
+	assert(!fxmlTestSuccess("<a b=\"this attribute is never closed and longer than a vector"));
+}
+
+static bool IsEqualView(const char *str, const size_t len, const char *expected) {
+	bool result = str != fxml_null && strlen(expected) == len && memcmp(str, expected, len) == 0;
+	return(result);
+}
+
+static void CheckModeResult(const fxmlContext *ctx, fxmlTag *root, const char *source, const size_t sourceLen) {
+	fxmlTag *mapTag = fxmlFindTagByName(root, "map");
+	assert(mapTag != fxml_null);
+	assert(IsEqualView(mapTag->name, mapTag->nameLen, "map"));
+
+	fxmlString version = fxmlGetAttributeValueString(mapTag, "version");
+	assert(IsEqualView(version.start, version.len, "1.2"));
+	fxmlString title = fxmlGetAttributeValueString(mapTag, "title");
+	assert(IsEqualView(title.start, title.len, "Tom & Jerry"));
+
+	fxmlTag *dataTag = fxmlFindTagByName(mapTag, "data");
+	assert(dataTag != fxml_null);
+	assert(IsEqualView(dataTag->value, dataTag->valueLen, "1,2,3,4"));
+	fxmlString dataValue = fxmlGetTagValueString(mapTag, "data");
+	assert(IsEqualView(dataValue.start, dataValue.len, "1,2,3,4"));
+	fxmlString textValue = fxmlGetTagValueString(mapTag, "text");
+	assert(IsEqualView(textValue.start, textValue.len, "<a>"));
+	fxmlString missing = fxmlGetAttributeValueString(mapTag, "missing");
+	assert(missing.start == fxml_null && missing.len == 0);
+
+	const char *sourceEnd = source + sourceLen;
+	bool dataIsView = dataTag->value >= source && dataTag->value < sourceEnd;
+	bool titleIsView = title.start >= source && title.start < sourceEnd;
+	switch (ctx->mode) {
+		case fxmlParseMode_Copy:
+			assert(!dataIsView && !titleIsView);
+			assert(strcmp(dataTag->value, "1,2,3,4") == 0);
+			break;
+		case fxmlParseMode_View:
+			// Only values with entities are copied
+			assert(dataIsView && !titleIsView);
+			assert(strcmp(title.start, "Tom & Jerry") == 0);
+			break;
+		case fxmlParseMode_InSitu:
+			// Everything is zero terminated in the source
+			assert(dataIsView && titleIsView);
+			assert(strcmp(dataTag->value, "1,2,3,4") == 0);
+			assert(strcmp(title.start, "Tom & Jerry") == 0);
+			assert(strcmp(mapTag->name, "map") == 0);
+			assert(strcmp(fxmlGetAttributeValue(mapTag, "version"), "1.2") == 0);
+			break;
+		default:
+			assert(!"Unsupported mode");
+	}
+}
+
+static void ParseModeTest() {
+	const char xml[] =
+		"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+		"<!-- comment -->\n"
+		"<map version=\"1.2\" title=\"Tom &amp; Jerry\">\n"
+		"  <data encoding=\"csv\">1,2,3,4</data>\n"
+		"  <text>&lt;a&gt;</text>\n"
+		"  <empty/>\n"
+		"</map>\n";
+	size_t xmlLen = strlen(xml);
+
+	fxmlParseMode modes[] = { fxmlParseMode_Copy, fxmlParseMode_View };
+	for (size_t i = 0; i < 2; ++i) {
+		fxmlContext ctx = FXML_ZERO_INIT;
+		assert(fxmlInitFromMemory(xml, xmlLen, &ctx));
+		ctx.mode = modes[i];
+		fxmlTag root = FXML_ZERO_INIT;
+		assert(fxmlParse(&ctx, &root));
+		CheckModeResult(&ctx, &root, xml, xmlLen);
+		fxmlFree(&ctx);
+	}
+
+	char mutableXml[sizeof(xml)];
+	memcpy(mutableXml, xml, sizeof(xml));
+	fxmlContext ctx = FXML_ZERO_INIT;
+	assert(fxmlInitInSitu(mutableXml, xmlLen, &ctx));
+	assert(ctx.mode == fxmlParseMode_InSitu);
+	fxmlTag root = FXML_ZERO_INIT;
+	assert(fxmlParse(&ctx, &root));
+	CheckModeResult(&ctx, &root, mutableXml, xmlLen);
+
+	// Only the 11 tags and the atoms are allocated, no strings
+	size_t usedMemory = 0;
+	for (fxmlMemory *mem = ctx.firstMem; mem != fxml_null; mem = mem->next) {
+		usedMemory += mem->used;
+	}
+	assert(usedMemory == sizeof(fxmlTag) * 11 + sizeof(fxmlAtom) * ctx.atomCount + sizeof(fxmlAtom *) * ctx.atomSlotCount);
+	fxmlFree(&ctx);
+
+	// Text at the very end has no byte left for the terminator and is copied instead, even when parsing fails
+	const char unclosed[] = "<a>text";
+	char *exactXml = (char *)malloc(sizeof(unclosed) - 1);
+	memcpy(exactXml, unclosed, sizeof(unclosed) - 1);
+	assert(fxmlInitInSitu(exactXml, sizeof(unclosed) - 1, &ctx));
+	FXML_MEMSET(&root, 0, sizeof(root));
+	assert(!fxmlParse(&ctx, &root));
+	fxmlTag *textTag = fxmlFindTagByName(&root, "a");
+	assert(textTag != fxml_null && textTag->value != fxml_null);
+	assert(strcmp(textTag->value, "text") == 0);
+	assert(textTag->value < exactXml || textTag->value >= exactXml + sizeof(unclosed) - 1);
+	fxmlFree(&ctx);
+	free(exactXml);
+}
+
+typedef struct TestChunkSource {
+	const char *data;
+	size_t size;
+	size_t pos;
+	size_t chunkSize;
+} TestChunkSource;
+
+static size_t TestChunkRead(void *userData, void *buffer, const size_t maxSize) {
+	TestChunkSource *source = (TestChunkSource *)userData;
+	size_t count = source->size - source->pos;
+	if (count > source->chunkSize) {
+		count = source->chunkSize;
+	}
+	if (count > maxSize) {
+		count = maxSize;
+	}
+	memcpy(buffer, source->data + source->pos, count);
+	source->pos += count;
+	return(count);
+}
+
+// Writes all events into a single line, partial texts are joined together
+static bool StreamEventsToString(fxmlReader *reader, char *out, const size_t outSize) {
+	size_t len = 0;
+	bool wasPartial = false;
+	fxmlEvent event;
+	out[0] = 0;
+	while (fxmlNextEvent(reader, &event)) {
+		char line[256];
+		switch (event.type) {
+			case fxmlEventType_StartElement:
+				snprintf(line, sizeof(line), "<%.*s@%u>", (int)event.name.len, event.name.start, event.depth);
+				break;
+			case fxmlEventType_Attribute:
+				snprintf(line, sizeof(line), "[%.*s=%.*s@%u]", (int)event.name.len, event.name.start, (int)event.value.len, event.value.start, event.depth);
+				break;
+			case fxmlEventType_Text:
+				if (wasPartial) {
+					snprintf(line, sizeof(line), "%.*s", (int)event.value.len, event.value.start);
+				} else {
+					snprintf(line, sizeof(line), "{%.*s", (int)event.value.len, event.value.start);
+				}
+				break;
+			case fxmlEventType_EndElement:
+				snprintf(line, sizeof(line), "</%.*s@%u>", (int)event.name.len, event.name.start, event.depth);
+				break;
+			default:
+				assert(!"Unsupported event");
+		}
+		if (wasPartial && event.type != fxmlEventType_Text) {
+			assert(!"Partial text must be continued by text");
+		}
+		size_t lineLen = strlen(line);
+		assert(len + lineLen + 2 < outSize);
+		memcpy(out + len, line, lineLen);
+		len += lineLen;
+		if (event.type == fxmlEventType_Text && !event.isPartial) {
+			out[len++] = '}';
+		}
+		out[len] = 0;
+		wasPartial = event.isPartial;
+	}
+	return(!reader->isError);
+}
+
+static void StreamTest() {
+	const char xml[] =
+		"\xEF\xBB\xBF<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+		"<!-- comment with <tags> -->\n"
+		"<map version=\"1.2\" title=\"Tom &amp; Jerry\" op=\"a>b\">\n"
+		"  <data encoding=\"csv\">1,2,3,4</data>\n"
+		"  <text>&lt;a&gt; and &#65;</text>\n"
+		"  <empty/>\n"
+		"  <skip><a><b x=\"1\">deep</b></a><c/></skip>\n"
+		"  <x:ns x:id=\"7\" />\n"
+		"</map>\n";
+	const char expected[] =
+		"<map@0>[version=1.2@0][title=Tom & Jerry@0][op=a>b@0]"
+		"<data@1>[encoding=csv@1]{1,2,3,4}</data@1>"
+		"<text@1>{<a> and A}</text@1>"
+		"<empty@1></empty@1>"
+		"<skip@1><a@2><b@3>[x=1@3]{deep}</b@3></a@2><c@2></c@2></skip@1>"
+		"<x:ns@1>[x:id=7@1]</x:ns@1>"
+		"</map@0>";
+	size_t xmlLen = strlen(xml);
+	char events[1024];
+
+	// From memory
+	{
+		char mutableXml[sizeof(xml)];
+		memcpy(mutableXml, xml, sizeof(xml));
+		fxmlReader reader;
+		assert(fxmlReaderInitFromMemory(&reader, mutableXml, xmlLen));
+		assert(StreamEventsToString(&reader, events, sizeof(events)));
+		assert(strcmp(events, expected) == 0);
+	}
+
+	// Chunks of any size must result in the same events
+	for (size_t chunkSize = 1; chunkSize <= 7; ++chunkSize) {
+		char buffer[64];
+		TestChunkSource source = { xml, xmlLen, 0, chunkSize };
+		fxmlReader reader;
+		assert(fxmlReaderInit(&reader, buffer, sizeof(buffer), TestChunkRead, &source));
+		assert(StreamEventsToString(&reader, events, sizeof(events)));
+		assert(strcmp(events, expected) == 0);
+	}
+
+	// Text larger than the buffer is split into partial texts, but never inside of a entity
+	{
+		char text[200];
+		char big[256];
+		for (size_t i = 0; i < 20; ++i) {
+			memcpy(text + i * 7, "ab&amp;", 7);
+		}
+		text[140] = 0;
+		snprintf(big, sizeof(big), "<r>%s</r>", text);
+		char expectedBig[256];
+		size_t expectedLen = 0;
+		expectedBig[expectedLen++] = '<';
+		memcpy(expectedBig + expectedLen, "r@0>{", 5);
+		expectedLen += 5;
+		for (size_t i = 0; i < 140;) {
+			if (strncmp(text + i, "&amp;", 5) == 0) {
+				expectedBig[expectedLen++] = '&';
+				i += 5;
+			} else {
+				expectedBig[expectedLen++] = text[i++];
+			}
+		}
+		memcpy(expectedBig + expectedLen, "}</r@0>", 8);
+
+		for (size_t chunkSize = 1; chunkSize <= 19; chunkSize += 6) {
+			char buffer[16];
+			TestChunkSource source = { big, strlen(big), 0, chunkSize };
+			fxmlReader reader;
+			assert(fxmlReaderInit(&reader, buffer, sizeof(buffer), TestChunkRead, &source));
+			assert(StreamEventsToString(&reader, events, sizeof(events)));
+			assert(strcmp(events, expectedBig) == 0);
+		}
+	}
+
+	// Skipping
+	{
+		char mutableXml[sizeof(xml)];
+		memcpy(mutableXml, xml, sizeof(xml));
+		fxmlReader reader;
+		assert(fxmlReaderInitFromMemory(&reader, mutableXml, xmlLen));
+		fxmlEvent event;
+		size_t elementCount = 0;
+		while (fxmlNextEvent(&reader, &event)) {
+			if (event.type == fxmlEventType_StartElement) {
+				++elementCount;
+				if (event.depth == 1) {
+					assert(fxmlSkipElement(&reader));
+					assert(reader.depth == 1);
+				}
+			}
+		}
+		assert(!reader.isError);
+		assert(elementCount == 6);
+	}
+
+	// Malformed documents
+	const char *failures[] = {
+		"<a><b></a>",
+		"<a><b></b>",
+		"<a x=\"1></a>",
+		"<a x=1></a>",
+		"<a>&amp</a>",
+		"<!- x --><a/>",
+		"<a><!-- x </a>",
+		// Names with the same hash
+		"<costarring>x</liquid>",
+	};
+	for (size_t i = 0; i < FXML_ARRAYCOUNT(failures); ++i) {
+		char buffer[64];
+		TestChunkSource source = { failures[i], strlen(failures[i]), 0, 3 };
+		fxmlReader reader;
+		assert(fxmlReaderInit(&reader, buffer, sizeof(buffer), TestChunkRead, &source));
+		assert(!StreamEventsToString(&reader, events, sizeof(events)));
+		assert(reader.isError);
+	}
+
+	// Tags must fit into the buffer
+	{
+		const char longTag[] = "<a first=\"0123456789\" second=\"0123456789\"/>";
+		char buffer[32];
+		TestChunkSource source = { longTag, strlen(longTag), 0, 8 };
+		fxmlReader reader;
+		assert(fxmlReaderInit(&reader, buffer, sizeof(buffer), TestChunkRead, &source));
+		fxmlEvent event;
+		assert(!fxmlNextEvent(&reader, &event));
+		assert(reader.isError);
+	}
+}
+
+static void AtomTest() {
+	const char xml[] =
+		"<map width=\"10\" height=\"20\">"
+		"<object x=\"1\" y=\"2\"/><item x=\"3\"/><object x=\"4\" name=\"last\"/>"
+		"</map>";
+	fxmlParseMode modes[] = { fxmlParseMode_Copy, fxmlParseMode_View };
+	for (size_t i = 0; i < 2; ++i) {
+		fxmlContext ctx = FXML_ZERO_INIT;
+		assert(fxmlInitFromMemory(xml, strlen(xml), &ctx));
+		ctx.mode = modes[i];
+		fxmlTag root = FXML_ZERO_INIT;
+		assert(fxmlParse(&ctx, &root));
+
+		// map, width, height, object, x, y, item, name
+		assert(ctx.atomCount == 8);
+		const fxmlAtom *objectAtom = fxmlFindAtom(&ctx, "object");
+		const fxmlAtom *xAtom = fxmlFindAtom(&ctx, "x");
+		assert(objectAtom != fxml_null && objectAtom->id == 4 && objectAtom->len == 6);
+		assert(xAtom != fxml_null && xAtom->id == 5);
+		assert(fxmlFindAtom(&ctx, "obj") == fxml_null);
+		assert(fxmlFindAtom(&ctx, "objects") == fxml_null);
+
+		fxmlTag *mapTag = fxmlFindTagByName(&root, "map");
+		assert(mapTag != fxml_null && mapTag->atom == fxmlFindAtom(&ctx, "map"));
+		fxmlTag *firstObject = fxmlFindTagByAtom(mapTag, objectAtom);
+		assert(firstObject == fxmlFindTagByName(mapTag, "object"));
+		assert(firstObject == mapTag->firstChild);
+		assert(mapTag->lastChild->atom == objectAtom);
+		assert(strncmp(fxmlGetAttributeValueByAtom(firstObject, xAtom), "1", fxmlFindAttributeByAtom(firstObject, xAtom)->valueLen) == 0);
+		assert(fxmlGetAttributeValueByAtom(mapTag, xAtom) == fxml_null);
+		assert(fxmlFindAttributeByAtom(firstObject, xAtom) == fxmlFindAttributeByName(firstObject, "x"));
+		if (ctx.mode == fxmlParseMode_Copy) {
+			// Names are copied once
+			assert(firstObject->name == mapTag->lastChild->name);
+		}
+		fxmlFree(&ctx);
+		assert(fxmlFindAtom(&ctx, "object") == fxml_null);
+	}
+
+	// Hashed index for many children and attributes
+	char wide[8192];
+	size_t len = 0;
+	len += snprintf(wide + len, sizeof(wide) - len, "<root");
+	for (int i = 0; i < 100; ++i) {
+		len += snprintf(wide + len, sizeof(wide) - len, " a%d=\"%d\"", i, i);
+	}
+	len += snprintf(wide + len, sizeof(wide) - len, ">");
+	for (int i = 0; i < 100; ++i) {
+		len += snprintf(wide + len, sizeof(wide) - len, "<c%d v=\"%d\"/>", i % 90, i);
+	}
+	len += snprintf(wide + len, sizeof(wide) - len, "</root>");
+	assert(len < sizeof(wide));
+
+	fxmlContext ctx = FXML_ZERO_INIT;
+	assert(fxmlInitFromMemory(wide, len, &ctx));
+	fxmlTag root = FXML_ZERO_INIT;
+	assert(fxmlParse(&ctx, &root));
+	fxmlTag *rootTag = fxmlFindTagByName(&root, "root");
+	assert(rootTag != fxml_null);
+	assert(fxmlBuildIndex(&ctx, &root, 8));
+	assert(rootTag->index != fxml_null && rootTag->index->children != fxml_null && rootTag->index->attributes != fxml_null);
+	assert(root.index == fxml_null);
+	assert(rootTag->firstChild->index == fxml_null);
+	for (int i = 0; i < 100; ++i) {
+		char name[16];
+		char value[16];
+		snprintf(name, sizeof(name), "a%d", i);
+		snprintf(value, sizeof(value), "%d", i);
+		assert(strcmp(fxmlGetAttributeValue(rootTag, name), value) == 0);
+		assert(strcmp(fxmlGetAttributeValueByAtom(rootTag, fxmlFindAtom(&ctx, name)), value) == 0);
+
+		// Duplicate names find the first child
+		snprintf(name, sizeof(name), "c%d", i % 90);
+		snprintf(value, sizeof(value), "%d", i % 90);
+		fxmlTag *child = fxmlFindTagByName(rootTag, name);
+		assert(child != fxml_null && child == fxmlFindTagByAtom(rootTag, fxmlFindAtom(&ctx, name)));
+		assert(strcmp(fxmlGetAttributeValue(child, "v"), value) == 0);
+	}
+	assert(fxmlFindTagByName(rootTag, "c90") == fxml_null);
+	assert(fxmlFindAttributeByName(rootTag, "a100") == fxml_null);
+	assert(fxmlFindTagByAtom(rootTag, fxmlFindAtom(&ctx, "v")) == fxml_null);
+	fxmlFree(&ctx);
+}
+
+static void CheckSameTree(const fxmlTag *a, const fxmlTag *b) {
+	assert(a->type == b->type);
+	assert(a->nameLen == b->nameLen && a->valueLen == b->valueLen);
+	assert((a->name == fxml_null) == (b->name == fxml_null));
+	assert((a->value == fxml_null) == (b->value == fxml_null));
+	if (a->name != fxml_null) {
+		assert(memcmp(a->name, b->name, a->nameLen) == 0 && b->name[b->nameLen] == 0);
+	}
+	if (a->value != fxml_null) {
+		assert(memcmp(a->value, b->value, a->valueLen) == 0 && b->value[b->valueLen] == 0);
+	}
+	assert((a->atom == fxml_null) == (b->atom == fxml_null));
+	if (a->atom != fxml_null) {
+		assert(a->atom->id == b->atom->id && a->atom->hash == b->atom->hash);
+		assert(b->name == b->atom->name);
+	}
+	const fxmlTag *attrA = a->firstAttribute;
+	const fxmlTag *attrB = b->firstAttribute;
+	while (attrA != fxml_null && attrB != fxml_null) {
+		CheckSameTree(attrA, attrB);
+		attrA = attrA->nextSibling;
+		attrB = attrB->nextSibling;
+	}
+	assert(attrA == fxml_null && attrB == fxml_null);
+	const fxmlTag *childA = a->firstChild;
+	const fxmlTag *childB = b->firstChild;
+	while (childA != fxml_null && childB != fxml_null) {
+		assert(childB->parent == b);
+		CheckSameTree(childA, childB);
+		if (childB->nextSibling != fxml_null) {
+			assert(childB->nextSibling->prevSibling == childB);
+		} else {
+			assert(b->lastChild == childB);
+		}
+		childA = childA->nextSibling;
+		childB = childB->nextSibling;
+	}
+	assert(childA == fxml_null && childB == fxml_null);
+}
+
+static void BinaryTest() {
+	const char xml[] =
+		"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+		"<!-- comment -->\n"
+		"<map version=\"1.2\" title=\"Tom &amp; Jerry\">\n"
+		"  <data encoding=\"csv\">1,2,3,4</data>\n"
+		"  <text>&lt;a&gt;</text>\n"
+		"  <empty/>\n"
+		"  <data encoding=\"base64\">AAAA</data>\n"
+		"</map>\n";
+	size_t xmlLen = strlen(xml);
+	uint64_t sourceHash = fxmlComputeSourceHash(xml, xmlLen);
+	assert(sourceHash != fxmlComputeSourceHash(xml, xmlLen - 1));
+
+	fxmlContext ctx = FXML_ZERO_INIT;
+	assert(fxmlInitFromMemory(xml, xmlLen, &ctx));
+	ctx.mode = fxmlParseMode_View;
+	fxmlTag root = FXML_ZERO_INIT;
+	assert(fxmlParse(&ctx, &root));
+
+	size_t binarySize = fxmlSaveBinary(&ctx, &root, sourceHash, fxml_null, 0);
+	assert(binarySize > 0);
+	uint8_t *binary = (uint8_t *)malloc(binarySize);
+	assert(fxmlSaveBinary(&ctx, &root, sourceHash, binary, binarySize - 1) == binarySize);
+	assert(fxmlSaveBinary(&ctx, &root, sourceHash, binary, binarySize) == binarySize);
+	uint8_t *saved = (uint8_t *)malloc(binarySize);
+	memcpy(saved, binary, binarySize);
+
+	fxmlContext binCtx = FXML_ZERO_INIT;
+	fxmlTag *binRoot = fxmlLoadBinary(binary, binarySize, sourceHash, &binCtx);
+	assert(binRoot != fxml_null);
+	CheckSameTree(&root, binRoot);
+	assert(binCtx.atomCount == ctx.atomCount);
+	const fxmlAtom *dataAtom = fxmlFindAtom(&binCtx, "data");
+	assert(dataAtom != fxml_null);
+	fxmlTag *mapTag = fxmlFindTagByName(binRoot, "map");
+	assert(mapTag != fxml_null);
+	assert(fxmlFindTagByAtom(mapTag, dataAtom) == mapTag->firstChild);
+	assert(mapTag->lastChild->atom == dataAtom);
+	assert(strcmp(fxmlGetAttributeValue(mapTag, "title"), "Tom & Jerry") == 0);
+	assert(strcmp(fxmlGetTagValue(mapTag, "text"), "<a>") == 0);
+
+	// Loading again at the same address does nothing, at another address the pointers are rebased
+	assert(fxmlLoadBinary(binary, binarySize, sourceHash, &binCtx) == binRoot);
+
+	// The index is allocated in the context memory
+	assert(fxmlBuildIndex(&binCtx, binRoot, 1));
+	assert(fxmlFindTagByName(mapTag, "empty") != fxml_null);
+	fxmlFree(&binCtx);
+
+	uint8_t *moved = (uint8_t *)malloc(binarySize);
+	memcpy(moved, binary, binarySize);
+	memset(binary, 0xCD, binarySize);
+	fxmlTag *movedRoot = fxmlLoadBinary(moved, binarySize, sourceHash, &binCtx);
+	assert(movedRoot == (fxmlTag *)(moved + ((uint8_t *)binRoot - binary)));
+	CheckSameTree(&root, movedRoot);
+
+	// Invalid caches
+	memcpy(binary, saved, binarySize);
+	assert(fxmlLoadBinary(binary, binarySize, sourceHash + 1, &binCtx) == fxml_null);
+	assert(fxmlLoadBinary(binary, binarySize - 8, sourceHash, &binCtx) == fxml_null);
+	assert(fxmlLoadBinary(binary, 16, sourceHash, &binCtx) == fxml_null);
+	binary[0] ^= 0xFF;
+	assert(fxmlLoadBinary(binary, binarySize, sourceHash, &binCtx) == fxml_null);
+
+	// A invalid pointer at the end leaves the binary untouched
+	memcpy(binary, saved, binarySize);
+	fxml__BinaryHeader *header = (fxml__BinaryHeader *)binary;
+	uint64_t invalidPointer = header->totalSize;
+	memcpy(binary + header->slotOffset + (header->slotCount - 1) * sizeof(fxmlAtom *), &invalidPointer, sizeof(invalidPointer));
+	memcpy(moved, binary, binarySize);
+	assert(fxmlLoadBinary(binary, binarySize, sourceHash, &binCtx) == fxml_null);
+	assert(memcmp(binary, moved, binarySize) == 0);
+
+	// Counts which overflow the range checks
+	memcpy(binary, saved, binarySize);
+	header->tagCount = (UINT64_MAX / sizeof(fxmlTag)) + 2;
+	assert(fxmlLoadBinary(binary, binarySize, sourceHash, &binCtx) == fxml_null);
+	memcpy(binary, saved, binarySize);
+	header->stringOffset = UINT64_MAX - 1;
+	assert(fxmlLoadBinary(binary, binarySize, sourceHash, &binCtx) == fxml_null);
+
+	free(moved);
+	free(saved);
+	free(binary);
+	fxmlFree(&ctx);
+}
+
+static void ParseParallelSerially(const char *xml, const size_t xmlLen, const size_t maxJobs, fxmlContext *ctx, fxmlTag *root, size_t *outJobCount, bool *outResult) {
+	fxmlParallelJob jobs[16];
+	assert(maxJobs <= FXML_ARRAYCOUNT(jobs));
+	assert(fxmlInitFromMemory(xml, xmlLen, ctx));
+	size_t jobCount = fxmlPrepareParallel(ctx, root, jobs, maxJobs);
+	*outJobCount = jobCount;
+	if (jobCount == 0) {
+		*outResult = false;
+		return;
+	}
+	// Parse in reverse, the order of the jobs must not matter
+	for (size_t i = jobCount; i > 0; --i) {
+		fxmlParseParallelJob(&jobs[i - 1]);
+	}
+	*outResult = fxmlFinishParallel(ctx, root, jobs, jobCount);
+}
+
+static void ParallelTest() {
+	char xml[16 * 1024];
+	size_t len = 0;
+	len += snprintf(xml + len, sizeof(xml) - len, "\xEF\xBB\xBF<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<!-- <map> -->\n<map width=\"64\" title=\"a &gt; b\">Map text\n");
+	for (int i = 0; i < 40; ++i) {
+		switch (i % 4) {
+			case 0:
+				len += snprintf(xml + len, sizeof(xml) - len, "  <layer name=\"layer%d\" op=\"a>b\"><data encoding=\"csv\">%d,%d,%d</data></layer>\n", i, i, i + 1, i + 2);
+				break;
+			case 1:
+				len += snprintf(xml + len, sizeof(xml) - len, "  <!-- comment %d </layer> -->\n  <objectgroup><object id=\"%d\"/><object id=\"%d\"><properties><property name=\"p\" value=\"&amp;\"/></properties></object></objectgroup>\n", i, i, i + 1);
+				break;
+			case 2:
+				len += snprintf(xml + len, sizeof(xml) - len, "  <empty%d/>\n", i);
+				break;
+			default:
+				len += snprintf(xml + len, sizeof(xml) - len, "  <x:text>&lt;%d&gt;</x:text>\n", i);
+				break;
+		}
+	}
+	len += snprintf(xml + len, sizeof(xml) - len, "</map>\n<!-- end -->\n");
+	assert(len < sizeof(xml));
+
+	fxmlContext serialCtx = FXML_ZERO_INIT;
+	assert(fxmlInitFromMemory(xml, len, &serialCtx));
+	fxmlTag serialRoot = FXML_ZERO_INIT;
+	assert(fxmlParse(&serialCtx, &serialRoot));
+
+	for (size_t maxJobs = 1; maxJobs <= 16; ++maxJobs) {
+		fxmlContext ctx = FXML_ZERO_INIT;
+		fxmlTag root = FXML_ZERO_INIT;
+		size_t jobCount;
+		bool result;
+		ParseParallelSerially(xml, len, maxJobs, &ctx, &root, &jobCount, &result);
+		assert(result);
+		assert(jobCount >= 1 && jobCount <= maxJobs);
+		if (maxJobs >= 4) {
+			assert(jobCount > 1);
+		}
+		CheckSameTree(&serialRoot, &root);
+		assert(ctx.atomCount == serialCtx.atomCount);
+		fxmlTag *mapTag = fxmlFindTagByName(&root, "map");
+		assert(strcmp(mapTag->value, "Map text\n  ") == 0);
+		assert(fxmlFindTagByAtom(mapTag, fxmlFindAtom(&ctx, "objectgroup")) == fxmlFindTagByName(mapTag, "objectgroup"));
+		fxmlFree(&ctx);
+	}
+	fxmlFree(&serialCtx);
+
+	// Documents that can not be split are parsed entirely in the head
+	const char *unsplittable[] = {
+		"<map/>",
+		"<map>text only</map>",
+		"<map><a/></map>",
+	};
+	for (size_t i = 0; i < FXML_ARRAYCOUNT(unsplittable); ++i) {
+		fxmlContext ctx = FXML_ZERO_INIT;
+		fxmlTag root = FXML_ZERO_INIT;
+		size_t jobCount;
+		bool result;
+		ParseParallelSerially(unsplittable[i], strlen(unsplittable[i]), 4, &ctx, &root, &jobCount, &result);
+		assert(result && jobCount == 1);
+		assert(fxmlFindTagByName(&root, "map") != fxml_null);
+		fxmlFree(&ctx);
+	}
+
+	// Errors inside of jobs or in the rest
+	const char *failures[] = {
+		"<map><a></b><c/></map>",
+		"<map><a><c/></map>",
+		"<map><a/><b/></map><map/>",
+		"<map><a/><b/></mop>",
+		"<map><a/><b/>",
+	};
+	for (size_t i = 0; i < FXML_ARRAYCOUNT(failures); ++i) {
+		fxmlContext ctx = FXML_ZERO_INIT;
+		fxmlTag root = FXML_ZERO_INIT;
+		size_t jobCount;
+		bool result;
+		ParseParallelSerially(failures[i], strlen(failures[i]), 2, &ctx, &root, &jobCount, &result);
+		assert(!result);
+		fxmlFree(&ctx);
+	}
+}
+
+typedef struct TestWriteTarget {
+	char data[4096];
+	size_t size;
+	size_t callCount;
+} TestWriteTarget;
+
+static size_t TestWrite(void *userData, const void *data, const size_t size) {
+	TestWriteTarget *target = (TestWriteTarget *)userData;
+	assert(target->size + size < sizeof(target->data));
+	memcpy(target->data + target->size, data, size);
+	target->size += size;
+	target->data[target->size] = 0;
+	++target->callCount;
+	return(size);
+}
+
+static void WriteTestDocument(fxmlWriter *writer) {
+	assert(fxmlWriteDeclaration(writer));
+	assert(fxmlWriteStartElement(writer, "map"));
+	assert(fxmlWriteAttribute(writer, "title", "Tom & \"Jerry\" <3>"));
+	assert(fxmlWriteAttribute(writer, "width", "64"));
+	assert(fxmlWriteComment(writer, " layers "));
+	assert(fxmlWriteStartElement(writer, "layer"));
+	assert(fxmlWriteStartElement(writer, "data"));
+	assert(fxmlWriteAttribute(writer, "encoding", "csv"));
+	assert(fxmlWriteText(writer, "1,2,3,4"));
+	assert(fxmlWriteEndElement(writer));
+	assert(fxmlWriteStartElement(writer, "empty"));
+	assert(fxmlWriteEndElement(writer));
+	assert(fxmlWriteEndElement(writer));
+	assert(fxmlWriteStartElement(writer, "text"));
+	assert(fxmlWriteText(writer, "a < b & c"));
+	assert(fxmlWriteStartElement(writer, "b"));
+	assert(fxmlWriteEndElement(writer));
+	assert(fxmlWriteEndElement(writer));
+	assert(fxmlWriteEndElement(writer));
+	assert(writer->depth == 0);
+}
+
+static void WriterTest() {
+	const char expectedCompact[] =
+		"<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+		"<map title=\"Tom &amp; &quot;Jerry&quot; &lt;3&gt;\" width=\"64\"><!-- layers -->"
+		"<layer><data encoding=\"csv\">1,2,3,4</data><empty/></layer>"
+		"<text>a &lt; b &amp; c<b/></text></map>";
+	const char expectedPretty[] =
+		"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+		"<map title=\"Tom &amp; &quot;Jerry&quot; &lt;3&gt;\" width=\"64\">\n"
+		"  <!-- layers -->\n"
+		"  <layer>\n"
+		"    <data encoding=\"csv\">1,2,3,4</data>\n"
+		"    <empty/>\n"
+		"  </layer>\n"
+		"  <text>a &lt; b &amp; c<b/></text>\n"
+		"</map>";
+
+	// Growing buffer
+	fxmlWriter writer;
+	assert(fxmlWriterInit(&writer, fxml_null));
+	WriteTestDocument(&writer);
+	assert(writer.used == strlen(expectedCompact));
+	assert(memcmp(writer.buffer, expectedCompact, writer.used) == 0);
+	fxmlWriterFree(&writer);
+
+	assert(fxmlWriterInit(&writer, "  "));
+	WriteTestDocument(&writer);
+	assert(writer.used == strlen(expectedPretty));
+	assert(memcmp(writer.buffer, expectedPretty, writer.used) == 0);
+
+	// Written documents parse to the same tree
+	{
+		fxmlContext ctx = FXML_ZERO_INIT;
+		assert(fxmlInitFromMemory(writer.buffer, writer.used, &ctx));
+		fxmlTag root = FXML_ZERO_INIT;
+		assert(fxmlParse(&ctx, &root));
+		fxmlTag *mapTag = fxmlFindTagByName(&root, "map");
+		assert(strcmp(fxmlGetAttributeValue(mapTag, "title"), "Tom & \"Jerry\" <3>") == 0);
+		assert(strcmp(fxmlGetTagValue(mapTag, "text"), "a < b & c") == 0);
+		fxmlFree(&ctx);
+	}
+	fxmlWriterFree(&writer);
+
+	// Small buffer with callback, large blocks are written directly
+	for (size_t bufferSize = 1; bufferSize <= 64; bufferSize *= 4) {
+		char buffer[64];
+		TestWriteTarget target = FXML_ZERO_INIT;
+		assert(fxmlWriterInitWithCallback(&writer, buffer, bufferSize, TestWrite, &target, "  "));
+		WriteTestDocument(&writer);
+		assert(fxmlWriterFlush(&writer));
+		assert(writer.used == 0 && writer.flushedSize == strlen(expectedPretty));
+		assert(strcmp(target.data, expectedPretty) == 0);
+		fxmlWriterFree(&writer);
+	}
+
+	// Parsed tags, a canonical document is written unchanged
+	{
+		const char canonical[] =
+			"<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+			"<map version=\"1.2\" title=\"Tom &amp; Jerry\"><!-- comment -->"
+			"<layer name=\"ground\"><data encoding=\"csv\">1,2,3,4</data></layer>"
+			"<objectgroup><object id=\"1\" name=\"&lt;spawn&gt;\"/><object id=\"2\"/></objectgroup>"
+			"<text>&lt;a&gt; &amp; b<c/></text></map>";
+		fxmlParseMode modes[] = { fxmlParseMode_Copy, fxmlParseMode_View };
+		for (size_t i = 0; i < 2; ++i) {
+			fxmlContext ctx = FXML_ZERO_INIT;
+			assert(fxmlInitFromMemory(canonical, strlen(canonical), &ctx));
+			ctx.mode = modes[i];
+			fxmlTag root = FXML_ZERO_INIT;
+			assert(fxmlParse(&ctx, &root));
+			assert(fxmlWriterInit(&writer, fxml_null));
+			assert(fxmlWriteTag(&writer, &root));
+			assert(writer.used == strlen(canonical));
+			assert(memcmp(writer.buffer, canonical, writer.used) == 0);
+			fxmlWriterFree(&writer);
+
+			// Single subtree inside of a new element
+			assert(fxmlWriterInit(&writer, "\t"));
+			assert(fxmlWriteStartElement(&writer, "layers"));
+			assert(fxmlWriteTag(&writer, fxmlFindTagByName(fxmlFindTagByName(&root, "map"), "layer")));
+			assert(fxmlWriteEndElement(&writer));
+			const char expectedLayer[] = "<layers>\n\t<layer name=\"ground\">\n\t\t<data encoding=\"csv\">1,2,3,4</data>\n\t</layer>\n</layers>";
+			assert(writer.used == strlen(expectedLayer));
+			assert(memcmp(writer.buffer, expectedLayer, writer.used) == 0);
+			fxmlWriterFree(&writer);
+			fxmlFree(&ctx);
+		}
+	}
+
+	// Invalid usage
+	assert(fxmlWriterInit(&writer, fxml_null));
+	assert(fxmlWriteStartElement(&writer, "a"));
+	assert(fxmlWriteText(&writer, "text"));
+	assert(!fxmlWriteAttribute(&writer, "late", "1"));
+	assert(writer.isError);
+	fxmlWriterFree(&writer);
+
+	assert(fxmlWriterInit(&writer, fxml_null));
+	assert(!fxmlWriteEndElement(&writer));
+	fxmlWriterFree(&writer);
+
+	assert(fxmlWriterInit(&writer, fxml_null));
+	assert(fxmlWriteStartElement(&writer, "a"));
+	assert(!fxmlWriteComment(&writer, "a -- b"));
+	fxmlWriterFree(&writer);
+
+	assert(fxmlWriterInit(&writer, fxml_null));
+	assert(!fxmlWriteText(&writer, "outside"));
+	fxmlWriterFree(&writer);
+}
+
 static void FileTest(const char *filePath) {
 	fxmlContext ctx = FXML_ZERO_INIT;
 	FILE *f = fxml_null;
-	bool r = fopen_s(&f, filePath, "rb") == 0;
-	assert(r);
+	f = fopen(filePath, "rb");
+	assert(f != fxml_null);
 	fseek(f, 0, SEEK_END);
 	size_t size = ftell(f);
 	fseek(f, 0, SEEK_SET);
@@ -203,9 +1145,97 @@ static void FileTest(const char *filePath) {
 	free(mem);
 }
 
+static void QueryTest() {
+	const char xml[] =
+		"<map version=\"1.2\">"
+		"<layer name=\"sky\"><data>sky</data></layer>"
+		"<!-- comment -->"
+		"<layer name=\"ground\"><data encoding=\"csv\">1,2,3</data></layer>"
+		"<group><layer name=\"ground\"><data>nested</data></layer></group>"
+		"<objectgroup name=\"objects\">"
+		"<object id=\"1\" type=\"spawn\" name=\"player\"/>"
+		"<object id=\"2\" type=\"enemy\"/>"
+		"<object id=\"3\" type=\"spawn\" name=\"boss\"><object id=\"4\" type=\"spawn\"/></object>"
+		"</objectgroup>"
+		"</map>";
+
+	// Invalid queries
+	fxmlQuery query;
+	assert(!fxmlQueryCompile(&query, ""));
+	assert(!fxmlQueryCompile(&query, "map/"));
+	assert(!fxmlQueryCompile(&query, "map/@name/layer"));
+	assert(!fxmlQueryCompile(&query, "map//@name"));
+	assert(!fxmlQueryCompile(&query, "map[@name='x]"));
+	assert(!fxmlQueryCompile(&query, "map[0]"));
+	assert(!fxmlQueryCompile(&query, "map[name]"));
+	assert(!query.isValid);
+
+	fxmlParseMode modes[] = { fxmlParseMode_Copy, fxmlParseMode_View };
+	for (size_t i = 0; i < 4; ++i) {
+		fxmlContext ctx = FXML_ZERO_INIT;
+		assert(fxmlInitFromMemory(xml, strlen(xml), &ctx));
+		ctx.mode = modes[i % 2];
+		fxmlTag root = FXML_ZERO_INIT;
+		assert(fxmlParse(&ctx, &root));
+		if (i >= 2) {
+			assert(fxmlBuildIndex(&ctx, &root, 1));
+		}
+
+		// Child steps with predicates
+		assert(fxmlQueryCompile(&query, "map/layer[@name='ground']/data"));
+		fxmlTag *data = fxmlQueryFirst(&query, &root);
+		assert(data != fxml_null && data->valueLen == 5 && strncmp(data->value, "1,2,3", 5) == 0);
+		fxmlTag *mapTag = fxmlFindTagByName(&root, "map");
+		assert(fxmlQueryCompile(&query, "layer[@name!='ground']/data"));
+		data = fxmlQueryFirst(&query, mapTag);
+		assert(data != fxml_null && strncmp(data->value, "sky", 3) == 0);
+		assert(fxmlQueryCompile(&query, "/map/layer[2]/data"));
+		assert(fxmlQueryFirst(&query, data) == fxmlQueryFirst(&query, &root));
+		assert(strncmp(fxmlQueryFirst(&query, data)->value, "1,2,3", 5) == 0);
+		assert(fxmlQueryCompile(&query, "map/layer[@name='ground'][2]"));
+		assert(fxmlQueryFirst(&query, &root) == fxml_null);
+		assert(fxmlQueryCompile(&query, "map/layer[@missing]"));
+		assert(fxmlQueryFirst(&query, &root) == fxml_null);
+		assert(fxmlQueryCompile(&query, "map/*"));
+		assert(fxmlQueryAll(&query, &root, fxml_null, 0) == 4);
+
+		// Descendant steps in document order without duplicates
+		fxmlTag *tags[8];
+		assert(fxmlQueryCompile(&query, "//layer[@name='ground']/data"));
+		assert(fxmlQueryAll(&query, &root, tags, 8) == 2);
+		assert(strncmp(tags[0]->value, "1,2,3", 5) == 0 && strncmp(tags[1]->value, "nested", 6) == 0);
+		assert(fxmlQueryCompile(&query, "map//object//object"));
+		assert(fxmlQueryAll(&query, &root, tags, 8) == 1);
+		assert(fxmlQueryCompile(&query, "//*//object[@type='spawn']"));
+		assert(fxmlQueryAll(&query, &root, tags, 8) == 3);
+		assert(strncmp(fxmlGetAttributeValue(tags[2], "id"), "4", 1) == 0);
+		assert(fxmlQueryCompile(&query, "map//object[1]"));
+		assert(fxmlQueryAll(&query, &root, tags, 1) == 2);
+		assert(strncmp(fxmlGetAttributeValue(tags[0], "id"), "1", 1) == 0);
+
+		// Attribute steps
+		assert(fxmlQueryCompile(&query, "//object[@type='spawn']/@name"));
+		assert(fxmlQueryAll(&query, &root, tags, 8) == 2);
+		assert(tags[0]->type == fxmlTagType_Attribute && strncmp(tags[0]->value, "player", 6) == 0);
+		assert(strncmp(tags[1]->value, "boss", 4) == 0);
+
+		fxmlFree(&ctx);
+	}
+}
+
 int main(int argc, char **argv) {
 	UnitTests();
 	ManualTest();
+	AllocatorTest();
+	LargeDocumentTest();
+	ScanTest();
+	ParseModeTest();
+	StreamTest();
+	AtomTest();
+	BinaryTest();
+	ParallelTest();
+	WriterTest();
+	QueryTest();
 
 #if 0
 	if (argc == 2) {
@@ -32,12 +32,15 @@ if (fmemInit(&myMem, fmemFlags_Growable, FMEM_MEGABYTES(16))) {
 	uint8_t *bigData = fmemPushSize(&myMem, FMEM_MEGABYTES(64), fmemFlags_None);
 	...
 
-	// Uses the first memory block
+	// Uses the first memory block, because the second block has less space left
 	uint8_t *anotherBlock = fmemPushSize(&myMem, FMEM_MEGABYTES(5), fmemFlags_None);
 
-	// Does not fit in the first block, therefore uses the second block
+	// Does not fit in the first block, therefore adds a third block which is used from now on
 	uint8_t *anotherBiggerBlock = fmemPushSize(&myMem, FMEM_MEGABYTES(9), fmemFlags_None);
 
+	// Searches all blocks for the one with the most space left, instead of using the current block
+	uint8_t *bestFitBlock = fmemPushSize(&myMem, FMEM_MEGABYTES(1), fmemPushFlags_BestFit);
+
 	// Releases all memory blocks
 	fmemRelease(&myMem);
 }
@@ -89,6 +92,30 @@ if (fmemInit(&myMem, fmemFlags_Fixed, FMEM_MEGABYTES(16))) {
 	fmemRelease(&myMem);
 }
 
+-------------------------------------------------------------------------------
+	Usage virtual memory
+-------------------------------------------------------------------------------
+
+#define FMEM_IMPLEMENTATION
+#include <final_mem.h>
+
+// Reserves 64 GB of address space, but no memory is committed yet
+fmemMemoryBlock myMem;
+if (fmemInit(&myMem, fmemType_Virtual, FMEM_GIGABYTES(64))) {
+	// Commits the pages in steps of FMEM_VIRTUAL_COMMIT_SIZE when needed
+	Entity *entities = fmemPushArray(&myMem, Entity, 1000, fmemFlags_None);
+
+	// Always directly after the previous push, there are no blocks
+	Entity *moreEntities = fmemPushArray(&myMem, Entity, 100000, fmemFlags_None);
+
+	// Gives all committed pages after the used size back to the system
+	fmemReset(&myMem);
+	fmemDecommit(&myMem);
+
+	// Releases the address range
+	fmemFree(&myMem);
+}
+
 -------------------------------------------------------------------------------
 	Usage temporary memory
 -------------------------------------------------------------------------------
@@ -117,6 +144,172 @@ if (fmemInit(&myMem, fmemFlags_Growable, FMEM_MEGABYTES(16))) {
 	fmemRelease(&myMem);
 }
 
+-------------------------------------------------------------------------------
+	Usage aligned memory
+-------------------------------------------------------------------------------
+
+#define FMEM_IMPLEMENTATION
+#include <final_mem.h>
+
+fmemMemoryBlock myMem;
+if (fmemInit(&myMem, fmemFlags_Growable, FMEM_MEGABYTES(16))) {
+	// Address is aligned to 64 bytes, the padding before it is counted as used
+	uint8_t *lineData = fmemPushAligned(&myMem, 256, FMEM_CACHELINE_SIZE, fmemFlags_None);
+
+	// Structs and arrays are aligned by the alignment of its type
+	MyStruct *myStruct = fmemPushStruct(&myMem, MyStruct, fmemFlags_None);
+	float *values = fmemPushArray(&myMem, float, 1024, fmemFlags_None);
+
+	// Same for C++ callers
+	MyStruct *items = fmemPushArrayT<MyStruct>(&myMem, 32);
+
+	// All pushes are aligned to at least 32 bytes from now on
+	fmemSetAlignment(&myMem, FMEM_SIMD_ALIGNMENT);
+	float *simdData = (float *)fmemPushSize(&myMem, sizeof(float) * 8, fmemFlags_None);
+
+	fmemRelease(&myMem);
+}
+
+-------------------------------------------------------------------------------
+	Usage concurrent memory
+-------------------------------------------------------------------------------
+
+#define FMEM_IMPLEMENTATION
+#include <final_mem.h>
+
+// Shared by all threads
+fmemConcurrentBlock sharedMem;
+if (fmemConcurrentInit(&sharedMem, FMEM_MEGABYTES(4))) {
+	// Any thread: Atomic bump in the newest chunk, a new chunk is added when it is full
+	uint8_t *data = fmemConcurrentPush(&sharedMem, 128, 0, fmemFlags_None);
+
+	// Worker thread: Takes ranges of 64 KB from the shared block, pushes into the range are not atomic
+	fmemThreadCache cache;
+	fmemThreadCacheInit(&cache, &sharedMem, FMEM_KILOBYTES(64));
+	Job *job = (Job *)fmemThreadCachePush(&cache, sizeof(Job), FMEM_ALIGNOF(Job), fmemFlags_None);
+
+	// Frame boundary, after all workers are finished: Merges all chunks into one
+	fmemConcurrentReset(&sharedMem);
+
+	fmemConcurrentFree(&sharedMem);
+}
+
+-------------------------------------------------------------------------------
+	Usage scratch memory
+-------------------------------------------------------------------------------
+
+#define FMEM_IMPLEMENTATION
+#include <final_mem.h>
+
+void BuildPath(fmemMemoryBlock *resultMem) {
+	// Uses a scratch block of the calling thread which is not the result block
+	fmemScratch scratch = fmemBeginScratch(resultMem);
+	char *tempPath = (char *)fmemPushSize(scratch.block, 1024, fmemFlags_None);
+
+	// Scratch regions can be nested, when they are ended in reverse order
+	fmemScratch inner = fmemBeginScratchFrom(scratch.block);
+	...
+	fmemEndScratch(&inner);
+
+	char *path = (char *)fmemPushSize(resultMem, 256, fmemFlags_None);
+	...
+
+	// Everything pushed into the scratch block since the begin is given back
+	fmemEndScratch(&scratch);
+}
+
+// Frame boundary
+fmemResetThreadScratch();
+
+// Thread exit
+fmemFreeThreadScratch();
+
+-------------------------------------------------------------------------------
+	Usage object pool
+-------------------------------------------------------------------------------
+
+#define FMEM_IMPLEMENTATION
+#include <final_mem.h>
+
+// Blocks for 256 bullets each, released objects are filled with 0xDD to find writes after release
+fmemPool bulletPool;
+if (fmemPoolInit(&bulletPool, sizeof(Bullet), FMEM_ALIGNOF(Bullet), 256, fmemPoolFlags_Poison)) {
+	Bullet *bullet = (Bullet *)fmemPoolPush(&bulletPool, fmemPushFlags_Clear);
+	...
+	// Object is reused by the next push
+	fmemPoolRelease(&bulletPool, bullet);
+
+	// Gives all objects back at once, for example when a level is unloaded
+	fmemPoolReset(&bulletPool);
+
+	// Releases all blocks at once
+	fmemPoolFree(&bulletPool);
+}
+
+// ........................
+
+// Pool shared by multiple threads, each thread uses its own cache
+fmemPool packetPool;
+fmemPoolInit(&packetPool, sizeof(PacketList), 0, 1024, fmemPoolFlags_Concurrent);
+
+// Worker thread: Takes the pool lock only for every 32 objects
+fmemPoolCache cache;
+fmemPoolCacheInit(&cache, &packetPool, 64);
+PacketList *packet = (PacketList *)fmemPoolCachePush(&cache, fmemPushFlags_None);
+fmemPoolCacheRelease(&cache, packet);
+fmemPoolCacheFlush(&cache);
+
+-------------------------------------------------------------------------------
+	Usage frame memory
+-------------------------------------------------------------------------------
+
+#define FMEM_IMPLEMENTATION
+#include <final_mem.h>
+
+static void WaitForRenderThread(void *userData, const uint64_t frameIndex) {
+	// Block until the render thread has finished the given frame
+}
+
+// Allocations live for two frames, so the render thread can lag one frame behind the simulation
+fmemFrameAllocator frameMem;
+if (fmemFrameInit(&frameMem, 2, fmemType_Growable, FMEM_MEGABYTES(8))) {
+	fmemFrameSetFence(&frameMem, WaitForRenderThread, renderThread);
+	while (running) {
+		// Waits for the frame two frames ago and reuses its memory
+		fmemFrameBegin(&frameMem);
+
+		RenderCommand *commands = (RenderCommand *)fmemFramePush(&frameMem, sizeof(RenderCommand) * count, 0, fmemPushFlags_None);
+
+		// Interpolation state of the last frame is still valid
+		fmemMemoryBlock *lastFrame = fmemFrameGetBlock(&frameMem, 1);
+		...
+	}
+	fmemFrameFree(&frameMem);
+}
+
+-------------------------------------------------------------------------------
+	Usage statistics
+-------------------------------------------------------------------------------
+
+#define FMEM_IMPLEMENTATION
+#include <final_mem.h>
+
+enum { Tag_Untagged = 0, Tag_Audio, Tag_Textures };
+
+fmemStats gameStats;
+fmemAttachStats(&gameMemoryBlock, &gameStats);
+fmemSetTagName(&gameStats, Tag_Audio, "audio");
+fmemSetTagName(&gameStats, Tag_Textures, "textures");
+
+uint8_t *samples = fmemPushTagged(&gameMemoryBlock, sampleSize, 16, Tag_Audio, fmemPushFlags_None);
+
+// Peak usage across all temporaries and scratch regions
+size_t peak = gameStats.peakBytes;
+
+// Report with usage and fragmentation for each block and the bytes for each tag, as text or JSON
+char report[4096];
+fmemFormatStats(&gameMemoryBlock, fmemStatsFormat_JSON, report, sizeof(report));
+
 -------------------------------------------------------------------------------
 	License
 -------------------------------------------------------------------------------
@@ -148,7 +341,7 @@ SOFTWARE.
 
 /*!
 	\file final_memory.h
-	\version v0.3.0 alpha
+	\version v0.3.1 alpha
 	\author Torsten Spaete
 	\brief Final Memory (FMEM) - A open source C99 single file header memory library.
 */
@@ -157,6 +350,30 @@ SOFTWARE.
 	\page page_changelog Changelog
 	\tableofcontents
 
+	## v0.3.1 alpha:
+	- New: Added push flag fmemPushFlags_BestFit
+	- New: Implemented fmemPushAligned
+	- New: Added field alignment to fmemMemoryBlock and function fmemSetAlignment() for a default alignment of all pushes
+	- New: Added function fmemPushArrayAligned() and macro fmemPushArray()
+	- New: Added C++ templates fmemPushStructT<T>() and fmemPushArrayT<T>()
+	- New: Added constants FMEM_CACHELINE_SIZE and FMEM_SIMD_ALIGNMENT and macro FMEM_ALIGNOF()
+	- Changed: fmemPushStruct() aligns the struct by its type alignment
+	- New: Added type fmemConcurrentBlock with lock-free pushes from multiple threads
+	- New: Added type fmemThreadCache for pushes without atomics into a range of a fmemConcurrentBlock
+	- New: Added type fmemScratch and functions fmemBeginScratchFrom()/fmemEndScratch() for nested scratch regions
+	- New: Added per-thread scratch blocks with fmemBeginScratch(), fmemResetThreadScratch() and fmemFreeThreadScratch()
+	- New: Added type fmemPool for fixed-size objects with a free list, bulk reset and debug poisoning
+	- New: Added type fmemPoolCache for thread-local caches of a fmemPool
+	- New: Added type fmemFrameAllocator for N-buffered frame memory with a fence callback
+	- New: Added optional statistics with fmemAttachStats(), tagged pushes with fmemPushTagged() and reports with fmemFormatStats()
+	- New: Added type fmemType_Virtual for contiguous memory in a reserved address range and function fmemDecommit()
+	- Changed: fmemPush is bumping the pointer of the current block only, instead of searching for the best fitting block
+	- Changed: Growable blocks are growing by at least the size of the current block
+	- Changed: fmemReset resets all appended blocks as well
+	- Fixed: fmemFree was not releasing any memory
+	- Fixed: Appended blocks was reporting a bigger size than allocated, because of a missing parenthesis in FMEM__BLOCK_META_SIZE
+	- Fixed: fmemBeginTemporary was using the remaining size of all blocks, instead of the current block only
+
 	## v0.3.0 alpha:
 	- New: Added macro fmemPushStruct()
 	- New: Added function fmemCreate()
@@ -181,10 +398,8 @@ SOFTWARE.
 	\tableofcontents
 
 	- Removal of single memory blocks
-	- Array allocation and pushing
 	- Memory partitions
 		- Separated but linked, not able to free linked block
-		- Just partitions of fixed size blocks
 
 */
 
@@ -215,6 +430,15 @@ SOFTWARE.
 #	define FMEM_ZERO_INIT {}
 #endif
 
+//
+// Defines required for POSIX (mmap, madvise)
+//
+#if !defined(_WIN32)
+#	if !defined(_DEFAULT_SOURCE)
+#		define _DEFAULT_SOURCE 1
+#	endif
+#endif
+
 // Includes
 #include <stdint.h> // int32_t, etc.
 #include <stdbool.h> // bool
@@ -225,6 +449,11 @@ SOFTWARE.
 #	include <string.h>
 #	define FMEM_MEMSET(dst, val, size) memset(dst, val, size)
 #endif
+#ifndef FMEM_VSNPRINTF
+#	include <stdio.h>
+#	include <stdarg.h>
+#	define FMEM_VSNPRINTF vsnprintf
+#endif
 #ifndef FMEM_MALLOC
 #	include <malloc.h>
 #	define FMEM_MALLOC(size) malloc(size)
@@ -248,11 +477,103 @@ SOFTWARE.
 //! Returns the number of bytes for the given terabytes
 #define FMEM_TERABYTES(value) ((FMEM_GIGABYTES(value) * 1024ull))
 
+//! Size of a cache line in bytes, use this alignment to avoid false sharing between threads
+#define FMEM_CACHELINE_SIZE 64
+//! Alignment in bytes required for SIMD (AVX) loads and stores
+#define FMEM_SIMD_ALIGNMENT 32
+
+#if defined(FMEM_IS_CPP) && ((__cplusplus >= 201103L) || (defined(_MSC_VER) && (_MSC_VER >= 1900)))
+	//! Returns the alignment in bytes for the given type (C++11)
+#	define FMEM_ALIGNOF(type) alignof(type)
+#elif defined(FMEM_IS_CPP)
+template<typename T>
+struct fmem__AlignOf {
+	struct Helper {
+		char c;
+		T member;
+	};
+	enum { value = offsetof(Helper, member) };
+};
+	//! Returns the alignment in bytes for the given type (C++98)
+#	define FMEM_ALIGNOF(type) ((size_t)fmem__AlignOf<type>::value)
+#else
+	//! Returns the alignment in bytes for the given type (C99)
+#	define FMEM_ALIGNOF(type) offsetof(struct { char c; type member; }, member)
+#endif
+
+// Thread local storage
+#if defined(FMEM_IS_CPP) && (__cplusplus >= 201103L)
+#	define FMEM_THREAD_LOCAL thread_local
+#elif defined(_MSC_VER)
+#	define FMEM_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+#	define FMEM_THREAD_LOCAL __thread
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+#	define FMEM_THREAD_LOCAL _Thread_local
+#else
+#	error "Thread local storage is not supported for this compiler!"
+#endif
+
+//! Default size in bytes for a chunk of a concurrent block
+#ifndef FMEM_CONCURRENT_CHUNK_SIZE
+#	define FMEM_CONCURRENT_CHUNK_SIZE FMEM_MEGABYTES(1)
+#endif
+//! Default size in bytes a thread cache takes from its concurrent block at once
+#ifndef FMEM_THREAD_CACHE_SIZE
+#	define FMEM_THREAD_CACHE_SIZE FMEM_KILOBYTES(64)
+#endif
+//! Number of scratch blocks per thread
+#ifndef FMEM_SCRATCH_COUNT
+#	define FMEM_SCRATCH_COUNT 2
+#endif
+//! Initial size in bytes for a scratch block of a thread
+#ifndef FMEM_SCRATCH_BLOCK_SIZE
+#	define FMEM_SCRATCH_BLOCK_SIZE FMEM_KILOBYTES(256)
+#endif
+//! Byte pattern for objects given back to a pool with fmemPoolFlags_Poison
+#ifndef FMEM_POOL_POISON_FREED
+#	define FMEM_POOL_POISON_FREED 0xDD
+#endif
+//! Byte pattern for objects taken from a pool with fmemPoolFlags_Poison
+#ifndef FMEM_POOL_POISON_PUSHED
+#	define FMEM_POOL_POISON_PUSHED 0xCD
+#endif
+//! Number of spins waiting for the lock of a concurrent pool, before the thread yields its time slice
+#ifndef FMEM_POOL_SPIN_COUNT
+#	define FMEM_POOL_SPIN_COUNT 64
+#endif
+//! Maximum number of frames in a frame allocator
+#ifndef FMEM_MAX_FRAME_COUNT
+#	define FMEM_MAX_FRAME_COUNT 4
+#endif
+//! Default size in bytes of the reserved address range for virtual blocks
+#ifndef FMEM_VIRTUAL_RESERVE_SIZE
+#	if UINTPTR_MAX > 0xFFFFFFFFu
+#		define FMEM_VIRTUAL_RESERVE_SIZE FMEM_GIGABYTES(64)
+#	else
+#		define FMEM_VIRTUAL_RESERVE_SIZE FMEM_MEGABYTES(512)
+#	endif
+#endif
+//! Granularity in bytes for committing and reserving virtual memory, must be a multiple of the page size
+#ifndef FMEM_VIRTUAL_COMMIT_SIZE
+#	define FMEM_VIRTUAL_COMMIT_SIZE FMEM_KILOBYTES(64)
+#endif
+//! Maximum number of allocation tags for statistics
+#ifndef FMEM_MAX_TAG_COUNT
+#	define FMEM_MAX_TAG_COUNT 32
+#endif
+//! Maximum number of blocks listed in a statistics report
+#ifndef FMEM_MAX_REPORT_BLOCK_COUNT
+#	define FMEM_MAX_REPORT_BLOCK_COUNT 256
+#endif
+
 typedef enum fmemPushFlags {
 	//! No push flags
 	fmemPushFlags_None = 0,
 	//! Clear region to zero
 	fmemPushFlags_Clear = 1 << 0,
+	//! Search all blocks for the one with the most space left, instead of using the current block only
+	fmemPushFlags_BestFit = 1 << 1,
 } fmemPushFlags;
 
 typedef enum fmemType {
@@ -262,6 +583,8 @@ typedef enum fmemType {
 	fmemType_Fixed,
 	//! Temporary memory
 	fmemType_Temporary,
+	//! Contiguous memory in a reserved address range, pages are committed on demand
+	fmemType_Virtual,
 } fmemType;
 
 typedef enum fmemSizeFlags {
@@ -287,34 +610,197 @@ typedef struct fmemMemoryBlock {
 	void *base;
 	//! Pointer to a temporary memory block
 	struct fmemMemoryBlock *temporary;
+	//! Appended block which serves the pushes, null means this block (First block only)
+	struct fmemMemoryBlock *current;
 	//! Total size in bytes
 	size_t size;
-	//! Used size in bytes
+	//! Used size in bytes, including the padding for aligned pushes
 	size_t used;
+	//! Default alignment in bytes for all pushes, zero means unaligned
+	size_t alignment;
+	//! Optional statistics, null means no instrumentation (First block only)
+	struct fmemStats *stats;
+	//! Committed size in bytes, starting at the base (Virtual only)
+	size_t committed;
 	//! Type
 	fmemType type;
 } fmemMemoryBlock;
 
+typedef struct fmemTagStats {
+	//! Name of the tag, must be a static string
+	const char *name;
+	//! Bytes pushed with this tag since the last reset
+	size_t bytes;
+	//! Highest number of bytes pushed with this tag between two resets
+	size_t peakBytes;
+	//! Number of pushes with this tag since the last reset
+	size_t pushCount;
+} fmemTagStats;
+
+typedef struct fmemStats {
+	//! Statistics for each tag, tag zero is used for all untagged pushes
+	fmemTagStats tags[FMEM_MAX_TAG_COUNT];
+	//! Bytes currently in use including padding, temporaries and scratch regions count what was actually pushed
+	size_t usedBytes;
+	//! Highest number of used bytes since the stats was attached (High-water mark)
+	size_t peakBytes;
+	//! Bytes lost to alignment padding since the last reset
+	size_t paddingBytes;
+	//! Number of pushes since the stats was attached
+	size_t pushCount;
+	//! Number of failed pushes since the stats was attached
+	size_t failedPushCount;
+	//! Number of resets since the stats was attached
+	size_t resetCount;
+} fmemStats;
+
+typedef enum fmemStatsFormat {
+	//! Human readable text
+	fmemStatsFormat_Text = 0,
+	//! JSON object
+	fmemStatsFormat_JSON,
+} fmemStatsFormat;
+
+typedef struct fmemConcurrentChunk {
+	//! Previous chunk
+	struct fmemConcurrentChunk *next;
+	//! Base memory pointer
+	uint8_t *base;
+	//! Total size in bytes
+	size_t size;
+	//! Used size in bytes, is greater than the total size when a push did not fit (Atomic)
+	volatile size_t used;
+} fmemConcurrentChunk;
+
+typedef struct fmemConcurrentBlock {
+	//! Newest chunk which serves the pushes (Atomic)
+	fmemConcurrentChunk *volatile head;
+	//! Minimum size in bytes for new chunks
+	size_t chunkSize;
+	//! Incremented on every reset, so thread caches can drop their stale memory
+	size_t generation;
+} fmemConcurrentBlock;
+
+typedef struct fmemThreadCache {
+	//! Concurrent block the memory is taken from
+	fmemConcurrentBlock *owner;
+	//! Base memory pointer of the current range
+	uint8_t *base;
+	//! Size in bytes of the current range
+	size_t size;
+	//! Used size in bytes of the current range
+	size_t used;
+	//! Size in bytes taken from the owner for each new range
+	size_t rangeSize;
+	//! Generation of the owner when the current range was taken
+	size_t generation;
+} fmemThreadCache;
+
+typedef struct fmemScratch {
+	//! Block the scratch memory is pushed to, null when the scratch could not be started
+	fmemMemoryBlock *block;
+	//! Current block at the time the scratch was started
+	fmemMemoryBlock *current;
+	//! Used size in bytes of the current block at the time the scratch was started
+	size_t used;
+	//! Last block in the chain at the time the scratch was started, null when the block was not allocated yet
+	fmemMemoryBlock *tail;
+	//! Used size in bytes of the tail block at the time the scratch was started
+	size_t tailUsed;
+} fmemScratch;
+
+typedef enum fmemPoolFlags {
+	//! No pool flags
+	fmemPoolFlags_None = 0,
+	//! Pool is used by multiple threads, all pool functions takes a spin lock
+	fmemPoolFlags_Concurrent = 1 << 0,
+	//! Fills pushed and released objects with a byte pattern and asserts on double releases and writes after release
+	fmemPoolFlags_Poison = 1 << 1,
+} fmemPoolFlags;
+
+typedef struct fmemPoolNode {
+	//! Next free object
+	struct fmemPoolNode *next;
+} fmemPoolNode;
+
+typedef struct fmemPool {
+	//! Block the objects are pushed from
+	fmemMemoryBlock block;
+	//! Free objects, linked through the first bytes of each object
+	fmemPoolNode *freeList;
+	//! Size in bytes for one object, rounded up to the alignment and a pointer size
+	size_t objectSize;
+	//! Alignment in bytes for all objects
+	size_t alignment;
+	//! Number of objects currently in use
+	size_t usedCount;
+	//! Number of objects pushed from the block since the last reset
+	size_t totalCount;
+	//! Incremented on every reset, so pool caches can drop their stale objects
+	size_t generation;
+	//! Spin lock for fmemPoolFlags_Concurrent (Atomic)
+	volatile size_t lock;
+	//! Flags
+	fmemPoolFlags flags;
+} fmemPool;
+
+typedef struct fmemPoolCache {
+	//! Pool the objects are taken from
+	fmemPool *pool;
+	//! Free objects owned by this cache
+	fmemPoolNode *freeList;
+	//! Number of free objects owned by this cache
+	size_t count;
+	//! Maximum number of free objects, half of it is moved from or to the pool at once
+	size_t capacity;
+	//! Generation of the pool when the objects were taken
+	size_t generation;
+} fmemPoolCache;
+
+//! Blocks until all consumers (render or upload threads) are finished with the given frame index
+typedef void (fmem_frame_fence_wait_callback)(void *userData, const uint64_t frameIndex);
+
+typedef struct fmemFrameAllocator {
+	//! One block for each frame in flight
+	fmemMemoryBlock frames[FMEM_MAX_FRAME_COUNT];
+	//! Frame index which used the block last, a frame index of zero means unused
+	uint64_t frameIndices[FMEM_MAX_FRAME_COUNT];
+	//! Optional fence callback, called before the memory of a frame is reused
+	fmem_frame_fence_wait_callback *waitFence;
+	//! User data for the fence callback
+	void *fenceUserData;
+	//! Index of the current frame, starting with one
+	uint64_t frameIndex;
+	//! Number of frames, which is the number of frames an allocation lives
+	uint32_t frameCount;
+} fmemFrameAllocator;
+
 //! Creates a memory block and allocates memory when size is greater than zero
 fmem_api fmemMemoryBlock fmemCreate(const fmemType type, const size_t size);
-//! Initializes the given block or allocates memory when size is greater than zero
+//! Initializes the given block or allocates memory when size is greater than zero. For virtual blocks the size is the reserved address range, zero means FMEM_VIRTUAL_RESERVE_SIZE
 fmem_api bool fmemInit(fmemMemoryBlock *block, const fmemType type, const size_t size);
 //! Initializes the given block to a fixed size block from existing source memory
 fmem_api bool fmemInitFromSource(fmemMemoryBlock *block, void *sourceMemory, const size_t sourceSize);
 //! Release this and all appended memory blocks
 fmem_api void fmemFree(fmemMemoryBlock *block);
-//! Gets memory from the block by the given size
+//! Sets the default alignment for all pushes, which must be a power of two or zero
+fmem_api bool fmemSetAlignment(fmemMemoryBlock *block, const size_t alignment);
+//! Gets memory from the block by the given size, aligned by the default alignment of the block
 fmem_api uint8_t *fmemPush(fmemMemoryBlock *block, const size_t size, const fmemPushFlags flags);
-//! Gets memory from the block by the given size and ensure address alignment
+//! Gets memory from the block by the given size and ensure address alignment, which must be a power of two or zero for the default alignment
 fmem_api uint8_t *fmemPushAligned(fmemMemoryBlock *block, const size_t size, const size_t alignment, const fmemPushFlags flags);
+//! Gets memory for an array of count elements with the given alignment, returns null when the total size overflows
+fmem_api uint8_t *fmemPushArrayAligned(fmemMemoryBlock *block, const size_t elementSize, const size_t count, const size_t alignment, const fmemPushFlags flags);
 //! Gets memory for a new block with the given size
 fmem_api bool fmemPushBlock(fmemMemoryBlock *src, fmemMemoryBlock *dst, const size_t size, const fmemPushFlags flags);
 //! Returns the remaining size of all blocks starting by the given block
 fmem_api size_t fmemGetRemainingSize(fmemMemoryBlock *block);
 //! Returns the total size of all blocks starting by the given block
 fmem_api size_t fmemGetTotalSize(fmemMemoryBlock *block);
-//! Resets the given block usage to zero without freeing any memory
+//! Resets the usage of the given block and all appended blocks to zero without freeing any memory
 fmem_api void fmemReset(fmemMemoryBlock *block);
+//! Gives the committed pages after the used size of a virtual block back to the system, the address range stays reserved
+fmem_api bool fmemDecommit(fmemMemoryBlock *block);
 //! Initializes a temporary block with the remaining size of the source block
 fmem_api bool fmemBeginTemporary(fmemMemoryBlock *source, fmemMemoryBlock *temporary);
 //! Gives the memory back to source block from the temporary block
@@ -322,32 +808,307 @@ fmem_api void fmemEndTemporary(fmemMemoryBlock *temporary);
 //! Returns the block header pointer for the given block
 fmem_api fmemBlockHeader *fmemGetHeader(fmemMemoryBlock *block);
 
+//! Attaches the statistics to the block and clears them, null detaches the statistics. The stats must outlive the block
+fmem_api bool fmemAttachStats(fmemMemoryBlock *block, fmemStats *stats);
+//! Sets the name for the given tag, the name must be a static string
+fmem_api bool fmemSetTagName(fmemStats *stats, const uint32_t tag, const char *name);
+//! Gets memory from the block like fmemPushAligned() and accounts the size to the given tag
+fmem_api uint8_t *fmemPushTagged(fmemMemoryBlock *block, const size_t size, const size_t alignment, const uint32_t tag, const fmemPushFlags flags);
+//! Writes a report with the statistics and the usage and fragmentation of each block into the buffer. Returns the required length without the null terminator, like snprintf()
+fmem_api size_t fmemFormatStats(fmemMemoryBlock *block, const fmemStatsFormat format, char *buffer, const size_t maxBufferLen);
+
+//! Initializes the given concurrent block and allocates the first chunk, zero chunk size means FMEM_CONCURRENT_CHUNK_SIZE
+fmem_api bool fmemConcurrentInit(fmemConcurrentBlock *block, const size_t chunkSize);
+//! Releases all chunks of the given concurrent block (Not thread-safe)
+fmem_api void fmemConcurrentFree(fmemConcurrentBlock *block);
+//! Gets memory from the concurrent block by the given size and alignment, can be called from any thread at the same time
+fmem_api uint8_t *fmemConcurrentPush(fmemConcurrentBlock *block, const size_t size, const size_t alignment, const fmemPushFlags flags);
+//! Resets the concurrent block and merges all chunks into one chunk (Not thread-safe, no push must be in flight)
+fmem_api void fmemConcurrentReset(fmemConcurrentBlock *block);
+//! Returns the total size of all chunks of the concurrent block (Not thread-safe)
+fmem_api size_t fmemConcurrentGetTotalSize(fmemConcurrentBlock *block);
+//! Initializes a thread cache which takes ranges of the given size from the concurrent block, zero range size means FMEM_THREAD_CACHE_SIZE
+fmem_api bool fmemThreadCacheInit(fmemThreadCache *cache, fmemConcurrentBlock *owner, const size_t rangeSize);
+//! Gets memory from the thread cache without any atomics, the cache must be used by one thread only
+fmem_api uint8_t *fmemThreadCachePush(fmemThreadCache *cache, const size_t size, const size_t alignment, const fmemPushFlags flags);
+
+//! Starts a scratch region on the given block. Scratch regions can be nested and must be ended in the reverse order
+fmem_api fmemScratch fmemBeginScratchFrom(fmemMemoryBlock *block);
+//! Starts a scratch region on a scratch block of the calling thread which is not the conflicting block
+fmem_api fmemScratch fmemBeginScratch(const fmemMemoryBlock *conflict);
+//! Gives all memory pushed since the start of the scratch region back to its block
+fmem_api void fmemEndScratch(fmemScratch *scratch);
+//! Resets all scratch blocks of the calling thread, usually called at frame boundaries
+fmem_api void fmemResetThreadScratch(void);
+//! Releases all scratch blocks of the calling thread, must be called before the thread exits
+fmem_api void fmemFreeThreadScratch(void);
+
+//! Initializes a pool for objects of the given size and alignment, where objects per block defines the size of each block
+fmem_api bool fmemPoolInit(fmemPool *pool, const size_t objectSize, const size_t alignment, const size_t objectsPerBlock, const fmemPoolFlags flags);
+//! Releases all memory of the pool at once
+fmem_api void fmemPoolFree(fmemPool *pool);
+//! Gets a object from the free list or pushes a new one from the block
+fmem_api void *fmemPoolPush(fmemPool *pool, const fmemPushFlags flags);
+//! Gives the object back to the pool
+fmem_api void fmemPoolRelease(fmemPool *pool, void *object);
+//! Gives all objects back to the pool at once without freeing any memory
+fmem_api void fmemPoolReset(fmemPool *pool);
+//! Initializes a cache of free objects for a single thread, zero capacity means 64 objects (Requires fmemPoolFlags_Concurrent)
+fmem_api bool fmemPoolCacheInit(fmemPoolCache *cache, fmemPool *pool, const size_t capacity);
+//! Gets a object from the cache, refills the cache from the pool when it is empty
+fmem_api void *fmemPoolCachePush(fmemPoolCache *cache, const fmemPushFlags flags);
+//! Gives the object back to the cache, moves half of the cache to the pool when it is full
+fmem_api void fmemPoolCacheRelease(fmemPoolCache *cache, void *object);
+//! Moves all objects of the cache back to the pool, must be called before the thread exits
+fmem_api void fmemPoolCacheFlush(fmemPoolCache *cache);
+
+//! Initializes a frame allocator with the given number of frames (2 - FMEM_MAX_FRAME_COUNT) and the initial size for each frame block
+fmem_api bool fmemFrameInit(fmemFrameAllocator *allocator, const uint32_t frameCount, const fmemType type, const size_t frameSize);
+//! Releases the memory of all frames
+fmem_api void fmemFrameFree(fmemFrameAllocator *allocator);
+//! Sets the fence callback, which is called before the memory of a frame is reused
+fmem_api void fmemFrameSetFence(fmemFrameAllocator *allocator, fmem_frame_fence_wait_callback *waitFence, void *userData);
+//! Starts the next frame and reclaims the memory of the frame which was started frame count frames ago, returns the block for the new frame
+fmem_api fmemMemoryBlock *fmemFrameBegin(fmemFrameAllocator *allocator);
+//! Returns the block of the current frame or a previous frame, where age zero is the current frame. Returns null when the frame was already reclaimed
+fmem_api fmemMemoryBlock *fmemFrameGetBlock(fmemFrameAllocator *allocator, const uint32_t age);
+//! Gets memory from the current frame, which lives until the frame is reclaimed frame count frames later
+fmem_api uint8_t *fmemFramePush(fmemFrameAllocator *allocator, const size_t size, const size_t alignment, const fmemPushFlags flags);
+
 //! Gets memory for a struct from the block and return a pointer to the struct
-#define fmemPushStruct(block, type, flags) (type *)fmemPush(block, sizeof(type), flags)
+#define fmemPushStruct(block, type, flags) (type *)fmemPushAligned(block, sizeof(type), FMEM_ALIGNOF(type), flags)
+//! Gets memory for an array of count elements of the given type and return a pointer to the first element
+#define fmemPushArray(block, type, count, flags) (type *)fmemPushArrayAligned(block, sizeof(type), count, FMEM_ALIGNOF(type), flags)
+
+#if defined(FMEM_IS_CPP)
+//! Gets memory for a single T from the block and return a typed pointer (C++)
+template<typename T>
+inline T *fmemPushStructT(fmemMemoryBlock *block, const fmemPushFlags flags = fmemPushFlags_None) {
+	T *result = (T *)fmemPushAligned(block, sizeof(T), FMEM_ALIGNOF(T), flags);
+	return(result);
+}
+
+//! Gets memory for an array of count T elements from the block and return a typed pointer (C++)
+template<typename T>
+inline T *fmemPushArrayT(fmemMemoryBlock *block, const size_t count, const fmemPushFlags flags = fmemPushFlags_None) {
+	T *result = (T *)fmemPushArrayAligned(block, sizeof(T), count, FMEM_ALIGNOF(T), flags);
+	return(result);
+}
+#endif
 
 #endif // FMEM_H
 
 #if defined(FMEM_IMPLEMENTATION) && !defined(FMEM_IMPLEMENTED)
 #define FMEM_IMPLEMENTED
 
+// Virtual memory
+#if defined(_WIN32)
+#	include <windows.h>
+#else
+#	include <sys/mman.h>
+#	include <sched.h>
+#endif
+
 //! Default spacing after the header
 #define FMEM__HEADER_SPACING sizeof(uintptr_t)
 //! Default block size = Page size
 #define FMEM__MIN_BLOCKSIZE 4096
 //! Size of the meta data for the block (Header+Spacing+Block+Spacing)
-#define FMEM__BLOCK_META_SIZE sizeof(fmemBlockHeader) + FMEM__HEADER_SPACING + sizeof(fmemMemoryBlock) + FMEM__HEADER_SPACING
+#define FMEM__BLOCK_META_SIZE (sizeof(fmemBlockHeader) + FMEM__HEADER_SPACING + sizeof(fmemMemoryBlock) + FMEM__HEADER_SPACING)
 //! Offset to block from the header
-#define FMEM__OFFSET_TO_BLOCK sizeof(fmemBlockHeader) + FMEM__HEADER_SPACING
+#define FMEM__OFFSET_TO_BLOCK (sizeof(fmemBlockHeader) + FMEM__HEADER_SPACING)
 //! Returns the header from the given block
 #define FMEM__GETHEADER(block) (fmemBlockHeader *)((uint8_t *)(block)->base - (FMEM__BLOCK_META_SIZE))
 //! Returns the header from the given block
 #define FMEM__GETBLOCK(header) (fmemMemoryBlock *)((uint8_t *)(header) + FMEM__OFFSET_TO_BLOCK)
 
+// Atomics
+#if defined(_MSC_VER)
+#	include <intrin.h>
+static size_t fmem__AtomicFetchAddSize(volatile size_t *value, const size_t addend) {
+#	if defined(_WIN64)
+	size_t result = (size_t)_InterlockedExchangeAdd64((volatile __int64 *)value, (__int64)addend);
+#	else
+	size_t result = (size_t)_InterlockedExchangeAdd((volatile long *)value, (long)addend);
+#	endif
+	return(result);
+}
+static bool fmem__AtomicCompareAndSwapSize(volatile size_t *value, const size_t expected, const size_t desired) {
+#	if defined(_WIN64)
+	bool result = _InterlockedCompareExchange64((volatile __int64 *)value, (__int64)desired, (__int64)expected) == (__int64)expected;
+#	else
+	bool result = _InterlockedCompareExchange((volatile long *)value, (long)desired, (long)expected) == (long)expected;
+#	endif
+	return(result);
+}
+static bool fmem__AtomicCompareAndSwapPtr(void *volatile *value, void *expected, void *desired) {
+	bool result = _InterlockedCompareExchangePointer(value, desired, expected) == expected;
+	return(result);
+}
+static size_t fmem__AtomicLoadSize(volatile size_t *value) {
+	size_t result = *value;
+	_ReadWriteBarrier();
+	return(result);
+}
+static void *fmem__AtomicLoadPtr(void *volatile *value) {
+	void *result = *value;
+	_ReadWriteBarrier();
+	return(result);
+}
+static void fmem__AtomicStoreSize(volatile size_t *value, const size_t newValue) {
+	_ReadWriteBarrier();
+	*value = newValue;
+}
+static void fmem__SpinPause(void) {
+#	if defined(_M_IX86) || defined(_M_X64)
+	_mm_pause();
+#	elif defined(_M_ARM) || defined(_M_ARM64)
+	__yield();
+#	endif
+}
+#elif defined(__GNUC__) || defined(__clang__)
+static size_t fmem__AtomicFetchAddSize(volatile size_t *value, const size_t addend) {
+	size_t result = __atomic_fetch_add(value, addend, __ATOMIC_ACQ_REL);
+	return(result);
+}
+static bool fmem__AtomicCompareAndSwapSize(volatile size_t *value, size_t expected, const size_t desired) {
+	bool result = __atomic_compare_exchange_n(value, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+	return(result);
+}
+static bool fmem__AtomicCompareAndSwapPtr(void *volatile *value, void *expected, void *desired) {
+	bool result = __atomic_compare_exchange_n(value, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+	return(result);
+}
+static size_t fmem__AtomicLoadSize(volatile size_t *value) {
+	size_t result = __atomic_load_n(value, __ATOMIC_ACQUIRE);
+	return(result);
+}
+static void *fmem__AtomicLoadPtr(void *volatile *value) {
+	void *result = __atomic_load_n(value, __ATOMIC_ACQUIRE);
+	return(result);
+}
+static void fmem__AtomicStoreSize(volatile size_t *value, const size_t newValue) {
+	__atomic_store_n(value, newValue, __ATOMIC_RELEASE);
+}
+static void fmem__SpinPause(void) {
+#	if defined(__i386__) || defined(__x86_64__)
+	__builtin_ia32_pause();
+#	elif defined(__aarch64__) || defined(__arm__)
+	__asm__ __volatile__("yield");
+#	endif
+}
+#else
+#	error "Atomics are not supported for this compiler!"
+#endif
+
+static void fmem__YieldThread(void) {
+#if defined(_WIN32)
+	SwitchToThread();
+#else
+	sched_yield();
+#endif
+}
+
 static size_t fmem__GetSpaceAvailableFor(const fmemMemoryBlock *block, const size_t size) {
 	size_t result = ((block->size > 0) && (block->used <= block->size)) ? ((block->size - block->used) - size) : 0;
 	return(result);
 }
 
+static bool fmem__IsPowerOfTwo(const size_t value) {
+	bool result = (value > 0) && ((value & (value - 1)) == 0);
+	return(result);
+}
+
+static size_t fmem__GetAlignmentPadding(const fmemMemoryBlock *block, const size_t alignment) {
+	size_t result = 0;
+	if (alignment > 1) {
+		uintptr_t address = (uintptr_t)((uint8_t *)block->base + block->used);
+		uintptr_t mask = (uintptr_t)alignment - 1;
+		result = (size_t)(((uintptr_t)alignment - (address & mask)) & mask);
+	}
+	return(result);
+}
+
+#if defined(_WIN32)
+static void *fmem__VirtualReserve(const size_t size) {
+	void *result = VirtualAlloc(fmem_null, size, MEM_RESERVE, PAGE_NOACCESS);
+	return(result);
+}
+static bool fmem__VirtualCommit(void *base, const size_t size) {
+	bool result = VirtualAlloc(base, size, MEM_COMMIT, PAGE_READWRITE) != fmem_null;
+	return(result);
+}
+static bool fmem__VirtualDecommit(void *base, const size_t size) {
+	bool result = VirtualFree(base, size, MEM_DECOMMIT) == TRUE;
+	return(result);
+}
+static void fmem__VirtualRelease(void *base, const size_t size) {
+	VirtualFree(base, 0, MEM_RELEASE);
+}
+#else
+static void *fmem__VirtualReserve(const size_t size) {
+	int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#	if defined(MAP_NORESERVE)
+	flags |= MAP_NORESERVE;
+#	endif
+	void *result = mmap(fmem_null, size, PROT_NONE, flags, -1, 0);
+	if (result == MAP_FAILED) {
+		return fmem_null;
+	}
+	return(result);
+}
+static bool fmem__VirtualCommit(void *base, const size_t size) {
+	bool result = mprotect(base, size, PROT_READ | PROT_WRITE) == 0;
+	return(result);
+}
+static bool fmem__VirtualDecommit(void *base, const size_t size) {
+	// Drop the pages first, so they are zero when they are committed again
+	if (madvise(base, size, MADV_DONTNEED) != 0) {
+		return(false);
+	}
+	bool result = mprotect(base, size, PROT_NONE) == 0;
+	return(result);
+}
+static void fmem__VirtualRelease(void *base, const size_t size) {
+	munmap(base, size);
+}
+#endif
+
+static size_t fmem__AlignVirtualSize(const size_t size) {
+	size_t result = (size + (FMEM_VIRTUAL_COMMIT_SIZE - 1)) & ~((size_t)FMEM_VIRTUAL_COMMIT_SIZE - 1);
+	return(result);
+}
+
+static bool fmem__CommitFor(fmemMemoryBlock *block, const size_t newUsed) {
+	// Temporary memory of a virtual block commits in its source block
+	fmemMemoryBlock *virtualBlock = block;
+	size_t offset = 0;
+	if (block->type == fmemType_Temporary && block->source != fmem_null) {
+		fmemMemoryBlock *sourceBlock = (fmemMemoryBlock *)block->source;
+		if (sourceBlock->type == fmemType_Virtual) {
+			virtualBlock = sourceBlock;
+			offset = (size_t)((uint8_t *)block->base - (uint8_t *)sourceBlock->base);
+		}
+	}
+	if (virtualBlock->type != fmemType_Virtual) {
+		return(true);
+	}
+	size_t requiredSize = offset + newUsed;
+	if (requiredSize <= virtualBlock->committed) {
+		return(true);
+	}
+	size_t commitSize = fmem__AlignVirtualSize(requiredSize);
+	if (commitSize > virtualBlock->size) {
+		commitSize = virtualBlock->size;
+	}
+	uint8_t *commitBase = (uint8_t *)virtualBlock->base + virtualBlock->committed;
+	if (!fmem__VirtualCommit(commitBase, commitSize - virtualBlock->committed)) {
+		return(false);
+	}
+	virtualBlock->committed = commitSize;
+	return(true);
+}
+
 static size_t fmem__ComputeBlockSize(size_t size) {
 	FMEM_ASSERT(size >= FMEM__BLOCK_META_SIZE);
 	size_t count = (size / FMEM__MIN_BLOCKSIZE) + 1;
@@ -444,6 +1205,17 @@ fmem_api bool fmemInit(fmemMemoryBlock *block, const fmemType type, const size_t
 	}
 	FMEM_MEMSET(block, 0, sizeof(*block));
 	block->type = type;
+	if (type == fmemType_Virtual) {
+		// Only the address range is reserved, pages are committed by the pushes
+		size_t reserveSize = fmem__AlignVirtualSize(size > 0 ? size : FMEM_VIRTUAL_RESERVE_SIZE);
+		void *base = fmem__VirtualReserve(reserveSize);
+		if (base == fmem_null) {
+			return(false);
+		}
+		block->base = base;
+		block->size = reserveSize;
+		return(true);
+	}
 	if (size > 0) {
 		size_t blockSize;
 		size_t metaSize = FMEM__BLOCK_META_SIZE;
@@ -480,7 +1252,14 @@ fmem_api bool fmemInitFromSource(fmemMemoryBlock *block, void *sourceMemory, con
 fmem_api void fmemFree(fmemMemoryBlock *block) {
 	if ((block != fmem_null) &&
 		(block->temporary == fmem_null) &&
-		(block->source != fmem_null)) {
+		(block->source == fmem_null)) {
+		if (block->type == fmemType_Virtual) {
+			if (block->base != fmem_null) {
+				fmem__VirtualRelease(block->base, block->size);
+			}
+			FMEM_MEMSET(block, 0, sizeof(*block));
+			return;
+		}
 		fmemMemoryBlock *freeBlock = block;
 		while (freeBlock != fmem_null) {
 			if (freeBlock->base == fmem_null || freeBlock->size == 0 || freeBlock->source != fmem_null) {
@@ -495,14 +1274,28 @@ fmem_api void fmemFree(fmemMemoryBlock *block) {
 	}
 }
 
-fmem_api uint8_t *fmemPush(fmemMemoryBlock *block, const size_t size, const fmemPushFlags flags) {
-	if (block == fmem_null || size == 0) {
-		return fmem_null;
-	}
-	if (block->temporary != fmem_null) {
-		return fmem_null;
+static bool fmem__IsFitting(const fmemMemoryBlock *block, const size_t size, const size_t alignment) {
+	if ((block->base == fmem_null) || (block->used > block->size)) {
+		return(false);
 	}
+	size_t padding = fmem__GetAlignmentPadding(block, alignment);
+	size_t remaining = block->size - block->used;
+	bool result = (remaining >= padding) && ((remaining - padding) >= size);
+	return(result);
+}
+
+static size_t fmem__GetSpaceAfterPush(const fmemMemoryBlock *block, const size_t size, const size_t alignment) {
+	FMEM_ASSERT(fmem__IsFitting(block, size, alignment));
+	size_t result = fmem__GetSpaceAvailableFor(block, size) - fmem__GetAlignmentPadding(block, alignment);
+	return(result);
+}
 
+static fmemMemoryBlock *fmem__GetCurrentBlock(fmemMemoryBlock *block) {
+	fmemMemoryBlock *result = (block->current != fmem_null) ? block->current : block;
+	return(result);
+}
+
+static fmemMemoryBlock *fmem__FindBestFitBlock(fmemMemoryBlock *block, const size_t size, const size_t alignment) {
 	// Find best fitting block (Most space available after append)
 	fmemMemoryBlock *bestBlock = fmem_null;
 	fmemMemoryBlock *searchBlock = block;
@@ -510,99 +1303,227 @@ fmem_api uint8_t *fmemPush(fmemMemoryBlock *block, const size_t size, const fmem
 		if (searchBlock->base == fmem_null || searchBlock->size == 0) {
 			break;
 		}
-		if ((searchBlock->used + size) <= searchBlock->size) {
-			if (bestBlock == fmem_null || (fmem__GetSpaceAvailableFor(searchBlock, size) > fmem__GetSpaceAvailableFor(bestBlock, size))) {
+		if (fmem__IsFitting(searchBlock, size, alignment)) {
+			if (bestBlock == fmem_null || (fmem__GetSpaceAfterPush(searchBlock, size, alignment) > fmem__GetSpaceAfterPush(bestBlock, size, alignment))) {
 				bestBlock = searchBlock;
 			}
 		}
-		fmemBlockHeader *header = FMEM__GETHEADER(searchBlock);
 		if (searchBlock->type != fmemType_Growable) {
 			break;
 		}
+		fmemBlockHeader *header = FMEM__GETHEADER(searchBlock);
 		searchBlock = header->next;
 	}
+	return(bestBlock);
+}
 
-	// Stupid compiler, i dont care about crosses initialization for labels
-	fmemMemoryBlock *newBlock;
-	fmemMemoryBlock *tailBlock;
-	fmemBlockHeader *newHeader;
-	fmemBlockHeader *tailHeader;
-	size_t blockSize;
-
-	// @NOTE(final): Do not initialize, because i want all code paths below to set a result
-	uint8_t *result;
+static void fmem__StatsFailedPush(fmemMemoryBlock *block) {
+	if (block->stats != fmem_null) {
+		++block->stats->failedPushCount;
+	}
+}
 
-	if (bestBlock != fmem_null) {
-		result = (uint8_t *)bestBlock->base + bestBlock->used;
-		bestBlock->used += size;
-		goto done;
-	} else {
-		if (block->type != fmemType_Growable) {
-			result = fmem_null;
-			goto done;
-		}
+static void fmem__StatsPush(fmemMemoryBlock *block, const size_t size, const size_t padding, const uint32_t tag) {
+	fmemStats *stats = block->stats;
+	if (stats == fmem_null) {
+		return;
+	}
+	FMEM_ASSERT(tag < FMEM_MAX_TAG_COUNT);
+	stats->usedBytes += size + padding;
+	stats->paddingBytes += padding;
+	++stats->pushCount;
+	if (stats->usedBytes > stats->peakBytes) {
+		stats->peakBytes = stats->usedBytes;
 	}
+	fmemTagStats *tagStats = &stats->tags[tag];
+	tagStats->bytes += size;
+	++tagStats->pushCount;
+	if (tagStats->bytes > tagStats->peakBytes) {
+		tagStats->peakBytes = tagStats->bytes;
+	}
+}
 
-	// Find tail block to append on
-	tailBlock = fmem_null;
-	if (block->base != fmem_null) {
-		tailBlock = block;
-		while (tailBlock != fmem_null) {
-			fmemBlockHeader *thisHeader = FMEM__GETHEADER(tailBlock);
-			if (thisHeader->next == fmem_null) {
-				break;
-			}
-			tailBlock = thisHeader->next;
-		}
+static void fmem__StatsRelease(fmemStats *stats, const size_t bytes) {
+	if (stats == fmem_null) {
+		return;
 	}
+	FMEM_ASSERT(bytes <= stats->usedBytes);
+	stats->usedBytes -= (bytes < stats->usedBytes) ? bytes : stats->usedBytes;
+}
 
-	// Allocate new block
-	blockSize = fmem__ComputeBlockSize(size + FMEM__BLOCK_META_SIZE);
-	newHeader = fmem__AllocateBlock(blockSize);
-	if (newHeader == fmem_null) {
-		result = fmem_null;
-		goto done;
-	}
-
-	if (tailBlock == fmem_null) {
-		// No tail found -> Setup block argument
-		block->size = blockSize - FMEM__BLOCK_META_SIZE;
-		block->base = (uint8_t *)newHeader + FMEM__BLOCK_META_SIZE;
-		block->used = size;
-		block->source = fmem_null;
-		result = (uint8_t *)block->base;
-		goto done;
-	}
-
-	// Setup next block
-	newBlock = FMEM__GETBLOCK(newHeader);
-	newBlock->base = (uint8_t *)newHeader + FMEM__BLOCK_META_SIZE;
-	newBlock->size = blockSize - FMEM__BLOCK_META_SIZE;
-	newBlock->type = tailBlock->type;
-	newBlock->source = fmem_null;
-	newBlock->used = size;
-
-	// Append next block to tail
-	newHeader->prev = tailBlock;
-	tailHeader = FMEM__GETHEADER(tailBlock);
-	tailHeader->next = newBlock;
-
-	result = (uint8_t *)newBlock->base;
-done:
-	if (result != fmem_null) {
-		if (flags & fmemPushFlags_Clear) {
-			FMEM_MEMSET(result, 0, size);
+static size_t fmem__GetUsedFrom(fmemMemoryBlock *block) {
+	size_t result = 0;
+	fmemMemoryBlock *usedBlock = block;
+	while (usedBlock != fmem_null && usedBlock->base != fmem_null) {
+		result += usedBlock->used;
+		if (usedBlock->type != fmemType_Growable) {
+			break;
 		}
+		fmemBlockHeader *header = FMEM__GETHEADER(usedBlock);
+		usedBlock = header->next;
 	}
 	return(result);
 }
 
-fmem_api uint8_t *fmemPushAligned(fmemMemoryBlock *block, const size_t size, const size_t alignment, const fmemPushFlags flags) {
-	uint8_t *result = fmem_null;
+static uint8_t *fmem__PushInternal(fmemMemoryBlock *block, const size_t size, const size_t alignment, const fmemPushFlags flags, size_t *outPadding);
+
+static uint8_t *fmem__Push(fmemMemoryBlock *block, const size_t size, const size_t alignment, const uint32_t tag, const fmemPushFlags flags) {
+	size_t padding = 0;
+	uint8_t *result = fmem__PushInternal(block, size, alignment, flags, &padding);
+	if (result != fmem_null) {
+		fmem__StatsPush(block, size, padding, tag);
+	} else {
+		fmem__StatsFailedPush(block);
+	}
 	return(result);
 }
 
-fmem_api bool fmemPushBlock(fmemMemoryBlock *src, fmemMemoryBlock *dst, const size_t size, const fmemPushFlags flags) {
+static uint8_t *fmem__PushInternal(fmemMemoryBlock *block, const size_t size, const size_t alignment, const fmemPushFlags flags, size_t *outPadding) {
+	FMEM_ASSERT(block != fmem_null && size > 0);
+	FMEM_ASSERT(alignment == 0 || fmem__IsPowerOfTwo(alignment));
+	if (block->temporary != fmem_null) {
+		return fmem_null;
+	}
+
+	fmemMemoryBlock *currentBlock = fmem__GetCurrentBlock(block);
+	fmemMemoryBlock *targetBlock = fmem_null;
+	if (flags & fmemPushFlags_BestFit) {
+		targetBlock = fmem__FindBestFitBlock(block, size, alignment);
+	} else if (fmem__IsFitting(currentBlock, size, alignment)) {
+		targetBlock = currentBlock;
+	}
+
+	if (targetBlock == fmem_null) {
+		if (block->type != fmemType_Growable) {
+			return fmem_null;
+		}
+
+		// @NOTE(final): Blocks after the current block are either empty after a reset or was too big to become current.
+		// The current block only moves forward, so each block is visited once between resets.
+		fmemMemoryBlock *tailBlock = fmem_null;
+		if (block->base != fmem_null) {
+			tailBlock = currentBlock;
+			for (;;) {
+				fmemBlockHeader *tailHeader = FMEM__GETHEADER(tailBlock);
+				if (tailHeader->next == fmem_null) {
+					break;
+				}
+				tailBlock = tailHeader->next;
+				if (fmem__IsFitting(tailBlock, size, alignment)) {
+					targetBlock = tailBlock;
+					block->current = targetBlock;
+					break;
+				}
+			}
+		}
+
+		if (targetBlock == fmem_null) {
+			// Grow by at least the size of the current block, so the number of blocks stays small
+			// The worst case padding is reserved as well, because the address of the new block is not known yet
+			size_t alignedSize = (alignment > 1) ? (size + alignment - 1) : size;
+			if (alignedSize < size) {
+				return fmem_null;
+			}
+			size_t minSize = (alignedSize > currentBlock->size) ? alignedSize : currentBlock->size;
+			size_t blockSize = fmem__ComputeBlockSize(minSize + FMEM__BLOCK_META_SIZE);
+			fmemBlockHeader *newHeader = fmem__AllocateBlock(blockSize);
+			if (newHeader == fmem_null) {
+				return fmem_null;
+			}
+			if (tailBlock == fmem_null) {
+				// No tail found -> Setup block argument
+				block->size = blockSize - FMEM__BLOCK_META_SIZE;
+				block->base = (uint8_t *)newHeader + FMEM__BLOCK_META_SIZE;
+				block->used = 0;
+				block->source = fmem_null;
+				block->current = fmem_null;
+				targetBlock = block;
+			} else {
+				// Setup next block
+				fmemMemoryBlock *newBlock = FMEM__GETBLOCK(newHeader);
+				newBlock->base = (uint8_t *)newHeader + FMEM__BLOCK_META_SIZE;
+				newBlock->size = blockSize - FMEM__BLOCK_META_SIZE;
+				newBlock->type = tailBlock->type;
+				newBlock->source = fmem_null;
+				newBlock->used = 0;
+
+				// Append next block to tail
+				newHeader->prev = tailBlock;
+				fmemBlockHeader *tailHeader = FMEM__GETHEADER(tailBlock);
+				tailHeader->next = newBlock;
+
+				// Big pushes may leave less space in the new block than in the current block
+				if (fmem__GetSpaceAfterPush(newBlock, size, alignment) >= fmem__GetSpaceAvailableFor(currentBlock, 0)) {
+					block->current = newBlock;
+				}
+				targetBlock = newBlock;
+			}
+		}
+	}
+
+	FMEM_ASSERT(fmem__IsFitting(targetBlock, size, alignment));
+	size_t padding = fmem__GetAlignmentPadding(targetBlock, alignment);
+	if (!fmem__CommitFor(targetBlock, targetBlock->used + padding + size)) {
+		return fmem_null;
+	}
+	uint8_t *result = (uint8_t *)targetBlock->base + targetBlock->used + padding;
+	targetBlock->used += padding + size;
+	*outPadding = padding;
+	if (flags & fmemPushFlags_Clear) {
+		FMEM_MEMSET(result, 0, size);
+	}
+	return(result);
+}
+
+fmem_api bool fmemSetAlignment(fmemMemoryBlock *block, const size_t alignment) {
+	if (block == fmem_null) {
+		return(false);
+	}
+	if (alignment > 0 && !fmem__IsPowerOfTwo(alignment)) {
+		return(false);
+	}
+	block->alignment = alignment;
+	return(true);
+}
+
+fmem_api uint8_t *fmemPush(fmemMemoryBlock *block, const size_t size, const fmemPushFlags flags) {
+	if (block == fmem_null || size == 0) {
+		return fmem_null;
+	}
+	uint8_t *result = fmem__Push(block, size, block->alignment, 0, flags);
+	return(result);
+}
+
+fmem_api uint8_t *fmemPushTagged(fmemMemoryBlock *block, const size_t size, const size_t alignment, const uint32_t tag, const fmemPushFlags flags) {
+	if (block == fmem_null || size == 0 || tag >= FMEM_MAX_TAG_COUNT) {
+		return fmem_null;
+	}
+	if (alignment > 0 && !fmem__IsPowerOfTwo(alignment)) {
+		return fmem_null;
+	}
+	// The default alignment of the block is the minimum, a bigger alignment is always a multiple of a smaller one
+	size_t finalAlignment = (alignment > block->alignment) ? alignment : block->alignment;
+	uint8_t *result = fmem__Push(block, size, finalAlignment, tag, flags);
+	return(result);
+}
+
+fmem_api uint8_t *fmemPushAligned(fmemMemoryBlock *block, const size_t size, const size_t alignment, const fmemPushFlags flags) {
+	uint8_t *result = fmemPushTagged(block, size, alignment, 0, flags);
+	return(result);
+}
+
+fmem_api uint8_t *fmemPushArrayAligned(fmemMemoryBlock *block, const size_t elementSize, const size_t count, const size_t alignment, const fmemPushFlags flags) {
+	if (elementSize == 0 || count == 0) {
+		return fmem_null;
+	}
+	if (count > (SIZE_MAX / elementSize)) {
+		return fmem_null;
+	}
+	uint8_t *result = fmemPushAligned(block, elementSize * count, alignment, flags);
+	return(result);
+}
+
+fmem_api bool fmemPushBlock(fmemMemoryBlock *src, fmemMemoryBlock *dst, const size_t size, const fmemPushFlags flags) {
 	if (src == fmem_null || dst == fmem_null || size == 0) {
 		return(false);
 	}
@@ -610,20 +1531,62 @@ fmem_api bool fmemPushBlock(fmemMemoryBlock *src, fmemMemoryBlock *dst, const si
 	if (base == fmem_null) {
 		return(false);
 	}
+	FMEM_MEMSET(dst, 0, sizeof(*dst));
 	dst->base = base;
 	dst->size = size;
-	dst->used = 0;
 	dst->source = src;
+	dst->alignment = src->alignment;
 	dst->type = fmemType_Fixed;
 	return(true);
 }
 
 fmem_api void fmemReset(fmemMemoryBlock *block) {
 	if (block != fmem_null && block->temporary == fmem_null) {
-		block->used = 0;
+		fmemStats *stats = block->stats;
+		if (stats != fmem_null) {
+			if (block->type == fmemType_Temporary) {
+				fmem__StatsRelease(stats, block->used);
+			} else {
+				stats->usedBytes = 0;
+				stats->paddingBytes = 0;
+				for (uint32_t tag = 0; tag < FMEM_MAX_TAG_COUNT; ++tag) {
+					stats->tags[tag].bytes = 0;
+					stats->tags[tag].pushCount = 0;
+				}
+			}
+			++stats->resetCount;
+		}
+		fmemMemoryBlock *resetBlock = block;
+		while (resetBlock != fmem_null) {
+			resetBlock->used = 0;
+			if (resetBlock->type != fmemType_Growable || resetBlock->base == fmem_null) {
+				break;
+			}
+			fmemBlockHeader *header = FMEM__GETHEADER(resetBlock);
+			resetBlock = header->next;
+		}
+		block->current = fmem_null;
 	}
 }
 
+fmem_api bool fmemDecommit(fmemMemoryBlock *block) {
+	if (block == fmem_null || block->type != fmemType_Virtual || block->base == fmem_null) {
+		return(false);
+	}
+	if (block->temporary != fmem_null) {
+		return(false);
+	}
+	size_t keepSize = fmem__AlignVirtualSize(block->used);
+	if (keepSize < block->committed) {
+		uint8_t *decommitBase = (uint8_t *)block->base + keepSize;
+		if (!fmem__VirtualDecommit(decommitBase, block->committed - keepSize)) {
+			return(false);
+		}
+		block->committed = keepSize;
+	}
+	return(true);
+}
+
 fmem_api bool fmemBeginTemporary(fmemMemoryBlock *source, fmemMemoryBlock *temporary) {
 	if (source == fmem_null || temporary == fmem_null) {
 		return(false);
@@ -631,21 +1594,25 @@ fmem_api bool fmemBeginTemporary(fmemMemoryBlock *source, fmemMemoryBlock *tempo
 	if (source->base == fmem_null || source->size == 0) {
 		return(false);
 	}
-	size_t remainingSize = fmemGetRemainingSize(source);
+	// Only the remaining size of the current block is contiguous
+	fmemMemoryBlock *currentBlock = fmem__GetCurrentBlock(source);
+	size_t remainingSize = fmem__GetSpaceAvailableFor(currentBlock, 0);
 	if (remainingSize == 0) {
 		return(false);
 	}
 	FMEM_MEMSET(temporary, 0, sizeof(*temporary));
-	temporary->base = (uint8_t *)source->base + source->used;
+	temporary->base = (uint8_t *)currentBlock->base + currentBlock->used;
 	temporary->size = remainingSize;
 	temporary->source = source;
+	temporary->alignment = source->alignment;
+	temporary->stats = source->stats;
 	temporary->type = fmemType_Temporary;
 
 	// TODO(final): Not thread-safe!
-	source->used += remainingSize;
+	currentBlock->used += remainingSize;
 	source->temporary = temporary;
 
-	FMEM_ASSERT(source->used == source->size);
+	FMEM_ASSERT(currentBlock->used == currentBlock->size);
 	return(true);
 }
 
@@ -657,15 +1624,890 @@ fmem_api void fmemEndTemporary(fmemMemoryBlock *temporary) {
 		return;
 	}
 	fmemMemoryBlock *sourceBlock = (fmemMemoryBlock *)temporary->source;
+	fmemMemoryBlock *currentBlock = fmem__GetCurrentBlock(sourceBlock);
 	FMEM_ASSERT(sourceBlock->temporary == temporary);
-	FMEM_ASSERT(sourceBlock->used == sourceBlock->size);
-	FMEM_ASSERT(temporary->size <= sourceBlock->size);
+	FMEM_ASSERT(currentBlock->used == currentBlock->size);
+	FMEM_ASSERT(temporary->size <= currentBlock->size);
 
 	// TODO(final): Not thread-safe!
 	sourceBlock->temporary = fmem_null;
-	sourceBlock->used -= temporary->size;
+	currentBlock->used -= temporary->size;
+	fmem__StatsRelease(temporary->stats, temporary->used);
 
 	FMEM_MEMSET(temporary, 0, sizeof(*temporary));
 }
 
+//
+// Concurrent block
+//
+static fmemConcurrentChunk *fmem__AllocateConcurrentChunk(const size_t size) {
+	// Chunk data starts at the next cache line after the chunk header
+	size_t headerSize = (sizeof(fmemConcurrentChunk) + FMEM_CACHELINE_SIZE - 1) & ~((size_t)FMEM_CACHELINE_SIZE - 1);
+	if (size > (SIZE_MAX - headerSize - FMEM_CACHELINE_SIZE)) {
+		return fmem_null;
+	}
+	uint8_t *memory = (uint8_t *)FMEM_MALLOC(headerSize + FMEM_CACHELINE_SIZE + size);
+	if (memory == fmem_null) {
+		return fmem_null;
+	}
+	fmemConcurrentChunk *chunk = (fmemConcurrentChunk *)memory;
+	FMEM_MEMSET(chunk, 0, sizeof(*chunk));
+	uintptr_t dataAddress = ((uintptr_t)memory + headerSize + FMEM_CACHELINE_SIZE - 1) & ~((uintptr_t)FMEM_CACHELINE_SIZE - 1);
+	chunk->base = (uint8_t *)dataAddress;
+	chunk->size = size;
+	return(chunk);
+}
+
+static uint8_t *fmem__ConcurrentChunkPush(fmemConcurrentChunk *chunk, const size_t size, const size_t alignment) {
+	uint8_t *result = fmem_null;
+	if (alignment > 1) {
+		// Padding depends on the current offset, so the offset has to be swapped
+		uintptr_t mask = (uintptr_t)alignment - 1;
+		for (;;) {
+			size_t used = fmem__AtomicLoadSize(&chunk->used);
+			if (used > chunk->size) {
+				break;
+			}
+			uintptr_t address = (uintptr_t)(chunk->base + used);
+			size_t padding = (size_t)(((uintptr_t)alignment - (address & mask)) & mask);
+			size_t remaining = chunk->size - used;
+			if (remaining < padding || (remaining - padding) < size) {
+				break;
+			}
+			if (fmem__AtomicCompareAndSwapSize(&chunk->used, used, used + padding + size)) {
+				result = chunk->base + used + padding;
+				break;
+			}
+		}
+	} else {
+		// A push which does not fit leaves the chunk overflowed, so all following pushes fail without retrying
+		size_t used = fmem__AtomicFetchAddSize(&chunk->used, size);
+		if (used <= chunk->size && (chunk->size - used) >= size) {
+			result = chunk->base + used;
+		}
+	}
+	return(result);
+}
+
+fmem_api bool fmemConcurrentInit(fmemConcurrentBlock *block, const size_t chunkSize) {
+	if (block == fmem_null) {
+		return(false);
+	}
+	FMEM_MEMSET(block, 0, sizeof(*block));
+	block->chunkSize = chunkSize > 0 ? chunkSize : FMEM_CONCURRENT_CHUNK_SIZE;
+	block->head = fmem__AllocateConcurrentChunk(block->chunkSize);
+	if (block->head == fmem_null) {
+		return(false);
+	}
+	return(true);
+}
+
+fmem_api void fmemConcurrentFree(fmemConcurrentBlock *block) {
+	if (block == fmem_null) {
+		return;
+	}
+	fmemConcurrentChunk *chunk = block->head;
+	while (chunk != fmem_null) {
+		fmemConcurrentChunk *next = chunk->next;
+		FMEM_FREE(chunk);
+		chunk = next;
+	}
+	FMEM_MEMSET(block, 0, sizeof(*block));
+}
+
+fmem_api uint8_t *fmemConcurrentPush(fmemConcurrentBlock *block, const size_t size, const size_t alignment, const fmemPushFlags flags) {
+	if (block == fmem_null || size == 0) {
+		return fmem_null;
+	}
+	if (alignment > 0 && !fmem__IsPowerOfTwo(alignment)) {
+		return fmem_null;
+	}
+	size_t alignedSize = (alignment > 1) ? (size + alignment - 1) : size;
+	if (alignedSize < size) {
+		return fmem_null;
+	}
+
+	uint8_t *result = fmem_null;
+	fmemConcurrentChunk *newChunk = fmem_null;
+	bool isPublished = false;
+	for (;;) {
+		fmemConcurrentChunk *head = (fmemConcurrentChunk *)fmem__AtomicLoadPtr((void *volatile *)&block->head);
+		if (head != fmem_null) {
+			result = fmem__ConcurrentChunkPush(head, size, alignment);
+			if (result != fmem_null) {
+				break;
+			}
+		}
+
+		// Head is full, prepare a new chunk and serve the push from it before anyone else can see it
+		if (newChunk == fmem_null) {
+			size_t chunkSize = (alignedSize > block->chunkSize) ? alignedSize : block->chunkSize;
+			newChunk = fmem__AllocateConcurrentChunk(chunkSize);
+			if (newChunk == fmem_null) {
+				return fmem_null;
+			}
+		}
+		newChunk->used = 0;
+		newChunk->next = head;
+		result = fmem__ConcurrentChunkPush(newChunk, size, alignment);
+		FMEM_ASSERT(result != fmem_null);
+		if (fmem__AtomicCompareAndSwapPtr((void *volatile *)&block->head, head, newChunk)) {
+			isPublished = true;
+			break;
+		}
+
+		// @NOTE(final): Another thread has published a chunk in the meantime, try that one first
+		result = fmem_null;
+	}
+
+	if (newChunk != fmem_null && !isPublished) {
+		FMEM_FREE(newChunk);
+	}
+	if (result != fmem_null && (flags & fmemPushFlags_Clear)) {
+		FMEM_MEMSET(result, 0, size);
+	}
+	return(result);
+}
+
+fmem_api void fmemConcurrentReset(fmemConcurrentBlock *block) {
+	if (block == fmem_null || block->head == fmem_null) {
+		return;
+	}
+	++block->generation;
+	fmemConcurrentChunk *head = block->head;
+	if (head->next == fmem_null) {
+		head->used = 0;
+		return;
+	}
+
+	// Merge all chunks into a single one, so the next frame needs no more chunks
+	size_t totalSize = fmemConcurrentGetTotalSize(block);
+	fmemConcurrentChunk *mergedChunk = fmem__AllocateConcurrentChunk(totalSize);
+	if (mergedChunk == fmem_null) {
+		// Keep all chunks, but only the head is used again
+		fmemConcurrentChunk *chunk = head;
+		while (chunk != fmem_null) {
+			chunk->used = 0;
+			chunk = chunk->next;
+		}
+		return;
+	}
+	size_t chunkSize = block->chunkSize;
+	size_t generation = block->generation;
+	fmemConcurrentFree(block);
+	block->head = mergedChunk;
+	block->chunkSize = chunkSize;
+	block->generation = generation;
+}
+
+fmem_api size_t fmemConcurrentGetTotalSize(fmemConcurrentBlock *block) {
+	size_t result = 0;
+	if (block != fmem_null) {
+		fmemConcurrentChunk *chunk = block->head;
+		while (chunk != fmem_null) {
+			result += chunk->size;
+			chunk = chunk->next;
+		}
+	}
+	return(result);
+}
+
+fmem_api bool fmemThreadCacheInit(fmemThreadCache *cache, fmemConcurrentBlock *owner, const size_t rangeSize) {
+	if (cache == fmem_null || owner == fmem_null) {
+		return(false);
+	}
+	FMEM_MEMSET(cache, 0, sizeof(*cache));
+	cache->owner = owner;
+	cache->rangeSize = rangeSize > 0 ? rangeSize : FMEM_THREAD_CACHE_SIZE;
+	cache->generation = owner->generation;
+	return(true);
+}
+
+fmem_api uint8_t *fmemThreadCachePush(fmemThreadCache *cache, const size_t size, const size_t alignment, const fmemPushFlags flags) {
+	if (cache == fmem_null || cache->owner == fmem_null || size == 0) {
+		return fmem_null;
+	}
+	if (alignment > 0 && !fmem__IsPowerOfTwo(alignment)) {
+		return fmem_null;
+	}
+
+	// The range belongs to the owner memory before its last reset
+	if (cache->generation != cache->owner->generation) {
+		cache->base = fmem_null;
+		cache->size = cache->used = 0;
+		cache->generation = cache->owner->generation;
+	}
+
+	size_t padding = 0;
+	bool isFitting = false;
+	if (cache->base != fmem_null) {
+		if (alignment > 1) {
+			uintptr_t mask = (uintptr_t)alignment - 1;
+			uintptr_t address = (uintptr_t)(cache->base + cache->used);
+			padding = (size_t)(((uintptr_t)alignment - (address & mask)) & mask);
+		}
+		size_t remaining = cache->size - cache->used;
+		isFitting = (remaining >= padding) && ((remaining - padding) >= size);
+	}
+
+	if (!isFitting) {
+		// Big pushes go directly to the owner, so the current range is not wasted
+		if (size > (cache->rangeSize / 4)) {
+			uint8_t *result = fmemConcurrentPush(cache->owner, size, alignment, flags);
+			return(result);
+		}
+		uint8_t *range = fmemConcurrentPush(cache->owner, cache->rangeSize, FMEM_CACHELINE_SIZE, fmemPushFlags_None);
+		if (range == fmem_null) {
+			return fmem_null;
+		}
+		cache->base = range;
+		cache->size = cache->rangeSize;
+		cache->used = 0;
+		padding = 0;
+		if (alignment > FMEM_CACHELINE_SIZE) {
+			uintptr_t mask = (uintptr_t)alignment - 1;
+			padding = (size_t)(((uintptr_t)alignment - ((uintptr_t)range & mask)) & mask);
+		}
+		if ((padding + size) > cache->size) {
+			uint8_t *result = fmemConcurrentPush(cache->owner, size, alignment, flags);
+			return(result);
+		}
+	}
+
+	uint8_t *result = cache->base + cache->used + padding;
+	cache->used += padding + size;
+	if (flags & fmemPushFlags_Clear) {
+		FMEM_MEMSET(result, 0, size);
+	}
+	return(result);
+}
+
+//
+// Scratch
+//
+static FMEM_THREAD_LOCAL fmemMemoryBlock fmem__threadScratchBlocks[FMEM_SCRATCH_COUNT];
+
+fmem_api fmemScratch fmemBeginScratchFrom(fmemMemoryBlock *block) {
+	fmemScratch result;
+	FMEM_MEMSET(&result, 0, sizeof(result));
+	if (block == fmem_null || block->temporary != fmem_null) {
+		return(result);
+	}
+	fmemMemoryBlock *currentBlock = fmem__GetCurrentBlock(block);
+	result.block = block;
+	result.current = block->current;
+	result.used = currentBlock->used;
+	if (currentBlock->base != fmem_null) {
+		// Big pushes may append blocks after the current block, so the tail is not always the current block
+		fmemMemoryBlock *tailBlock = currentBlock;
+		while (tailBlock->type == fmemType_Growable) {
+			fmemBlockHeader *tailHeader = FMEM__GETHEADER(tailBlock);
+			if (tailHeader->next == fmem_null) {
+				break;
+			}
+			tailBlock = tailHeader->next;
+		}
+		result.tail = tailBlock;
+		result.tailUsed = tailBlock->used;
+	}
+	return(result);
+}
+
+fmem_api fmemScratch fmemBeginScratch(const fmemMemoryBlock *conflict) {
+	fmemScratch result;
+	FMEM_MEMSET(&result, 0, sizeof(result));
+	for (int i = 0; i < FMEM_SCRATCH_COUNT; ++i) {
+		fmemMemoryBlock *scratchBlock = &fmem__threadScratchBlocks[i];
+		if (scratchBlock == conflict) {
+			continue;
+		}
+		if (scratchBlock->base == fmem_null) {
+			if (!fmemInit(scratchBlock, fmemType_Growable, FMEM_SCRATCH_BLOCK_SIZE)) {
+				return(result);
+			}
+		}
+		result = fmemBeginScratchFrom(scratchBlock);
+		break;
+	}
+	return(result);
+}
+
+fmem_api void fmemEndScratch(fmemScratch *scratch) {
+	if (scratch == fmem_null || scratch->block == fmem_null) {
+		return;
+	}
+	fmemMemoryBlock *block = scratch->block;
+	FMEM_ASSERT(block->temporary == fmem_null);
+
+	// @NOTE(final): Only the blocks appended after the tail are owned by the scratch entirely.
+	// Blocks between the current block and the tail may hold data from before the scratch (big pushes), so only the current and the tail block are restored.
+	// Pushes into any other block are not given back until the next reset.
+	fmemMemoryBlock *restoreBlock = (scratch->current != fmem_null) ? scratch->current : block;
+	if (restoreBlock->base != fmem_null) {
+		FMEM_ASSERT(scratch->used <= restoreBlock->used);
+		size_t releasedBytes = restoreBlock->used - scratch->used;
+		restoreBlock->used = scratch->used;
+		fmemMemoryBlock *tailBlock = (scratch->tail != fmem_null) ? scratch->tail : restoreBlock;
+		if (tailBlock != restoreBlock) {
+			FMEM_ASSERT(scratch->tailUsed <= tailBlock->used);
+			releasedBytes += tailBlock->used - scratch->tailUsed;
+			tailBlock->used = scratch->tailUsed;
+		}
+		fmemMemoryBlock *resetBlock = tailBlock;
+		while (resetBlock->type == fmemType_Growable) {
+			fmemBlockHeader *header = FMEM__GETHEADER(resetBlock);
+			resetBlock = header->next;
+			if (resetBlock == fmem_null) {
+				break;
+			}
+			releasedBytes += resetBlock->used;
+			resetBlock->used = 0;
+		}
+		fmem__StatsRelease(block->stats, releasedBytes);
+	}
+	block->current = scratch->current;
+	FMEM_MEMSET(scratch, 0, sizeof(*scratch));
+}
+
+fmem_api void fmemResetThreadScratch(void) {
+	for (int i = 0; i < FMEM_SCRATCH_COUNT; ++i) {
+		fmemReset(&fmem__threadScratchBlocks[i]);
+	}
+}
+
+fmem_api void fmemFreeThreadScratch(void) {
+	for (int i = 0; i < FMEM_SCRATCH_COUNT; ++i) {
+		fmemFree(&fmem__threadScratchBlocks[i]);
+	}
+}
+
+//
+// Pool
+//
+#define FMEM__POOL_DEFAULT_CACHE_CAPACITY 64
+
+static void fmem__PoolLock(fmemPool *pool) {
+	if (pool->flags & fmemPoolFlags_Concurrent) {
+		// Spin with a pause first, the lock is only held for a few instructions.
+		// When the owner was preempted, the time slice is given away instead of burning it.
+		uint32_t spinCount = 0;
+		while (!fmem__AtomicCompareAndSwapSize(&pool->lock, 0, 1)) {
+			while (fmem__AtomicLoadSize(&pool->lock) != 0) {
+				if (spinCount < FMEM_POOL_SPIN_COUNT) {
+					fmem__SpinPause();
+					++spinCount;
+				} else {
+					fmem__YieldThread();
+				}
+			}
+		}
+	}
+}
+
+static void fmem__PoolUnlock(fmemPool *pool) {
+	if (pool->flags & fmemPoolFlags_Concurrent) {
+		fmem__AtomicStoreSize(&pool->lock, 0);
+	}
+}
+
+static bool fmem__PoolIsPoisoned(const fmemPool *pool, const void *object) {
+	// First bytes are used by the free list
+	const uint8_t *bytes = (const uint8_t *)object;
+	for (size_t i = sizeof(fmemPoolNode); i < pool->objectSize; ++i) {
+		if (bytes[i] != FMEM_POOL_POISON_FREED) {
+			return(false);
+		}
+	}
+	return(true);
+}
+
+static void fmem__PoolPoisonReleased(const fmemPool *pool, void *object) {
+	if (pool->flags & fmemPoolFlags_Poison) {
+		// Object is still poisoned, so it was released twice
+		FMEM_ASSERT(pool->objectSize <= sizeof(fmemPoolNode) || !fmem__PoolIsPoisoned(pool, object));
+		FMEM_MEMSET(object, FMEM_POOL_POISON_FREED, pool->objectSize);
+	}
+}
+
+static void fmem__PoolCheckPoisoned(const fmemPool *pool, const void *object) {
+	if (pool->flags & fmemPoolFlags_Poison) {
+		// Object was written after it was released
+		FMEM_ASSERT(fmem__PoolIsPoisoned(pool, object));
+	}
+}
+
+static fmemPoolNode *fmem__PoolTakeUnlocked(fmemPool *pool) {
+	fmemPoolNode *result = fmem_null;
+	if (pool->freeList != fmem_null) {
+		result = pool->freeList;
+		pool->freeList = result->next;
+	} else {
+		result = (fmemPoolNode *)fmemPushAligned(&pool->block, pool->objectSize, pool->alignment, fmemPushFlags_None);
+		if (result == fmem_null) {
+			return fmem_null;
+		}
+		// New objects are poisoned like released ones, so all free objects can be checked the same way
+		if (pool->flags & fmemPoolFlags_Poison) {
+			FMEM_MEMSET(result, FMEM_POOL_POISON_FREED, pool->objectSize);
+		}
+		++pool->totalCount;
+	}
+	++pool->usedCount;
+	return(result);
+}
+
+static void fmem__PoolPutUnlocked(fmemPool *pool, fmemPoolNode *node) {
+	FMEM_ASSERT(pool->usedCount > 0);
+	node->next = pool->freeList;
+	pool->freeList = node;
+	--pool->usedCount;
+}
+
+static void fmem__PoolFinishPush(const fmemPool *pool, void *object, const fmemPushFlags flags) {
+	fmem__PoolCheckPoisoned(pool, object);
+	if (flags & fmemPushFlags_Clear) {
+		FMEM_MEMSET(object, 0, pool->objectSize);
+	} else if (pool->flags & fmemPoolFlags_Poison) {
+		FMEM_MEMSET(object, FMEM_POOL_POISON_PUSHED, pool->objectSize);
+	}
+}
+
+fmem_api bool fmemPoolInit(fmemPool *pool, const size_t objectSize, const size_t alignment, const size_t objectsPerBlock, const fmemPoolFlags flags) {
+	if (pool == fmem_null || objectSize == 0 || objectsPerBlock == 0) {
+		return(false);
+	}
+	if (alignment > 0 && !fmem__IsPowerOfTwo(alignment)) {
+		return(false);
+	}
+	FMEM_MEMSET(pool, 0, sizeof(*pool));
+
+	// Every object must be able to hold a free list node
+	size_t finalAlignment = (alignment > FMEM_ALIGNOF(fmemPoolNode)) ? alignment : FMEM_ALIGNOF(fmemPoolNode);
+	size_t finalSize = (objectSize > sizeof(fmemPoolNode)) ? objectSize : sizeof(fmemPoolNode);
+	finalSize = (finalSize + finalAlignment - 1) & ~(finalAlignment - 1);
+	if (objectsPerBlock > (SIZE_MAX / finalSize)) {
+		return(false);
+	}
+	if (!fmemInit(&pool->block, fmemType_Growable, finalSize * objectsPerBlock)) {
+		return(false);
+	}
+	pool->objectSize = finalSize;
+	pool->alignment = finalAlignment;
+	pool->flags = flags;
+	return(true);
+}
+
+fmem_api void fmemPoolFree(fmemPool *pool) {
+	if (pool == fmem_null) {
+		return;
+	}
+	fmemFree(&pool->block);
+	FMEM_MEMSET(pool, 0, sizeof(*pool));
+}
+
+fmem_api void *fmemPoolPush(fmemPool *pool, const fmemPushFlags flags) {
+	if (pool == fmem_null || pool->objectSize == 0) {
+		return fmem_null;
+	}
+	fmem__PoolLock(pool);
+	fmemPoolNode *result = fmem__PoolTakeUnlocked(pool);
+	fmem__PoolUnlock(pool);
+	if (result != fmem_null) {
+		fmem__PoolFinishPush(pool, result, flags);
+	}
+	return(result);
+}
+
+fmem_api void fmemPoolRelease(fmemPool *pool, void *object) {
+	if (pool == fmem_null || object == fmem_null) {
+		return;
+	}
+	fmem__PoolPoisonReleased(pool, object);
+	fmem__PoolLock(pool);
+	fmem__PoolPutUnlocked(pool, (fmemPoolNode *)object);
+	fmem__PoolUnlock(pool);
+}
+
+fmem_api void fmemPoolReset(fmemPool *pool) {
+	if (pool == fmem_null) {
+		return;
+	}
+	fmem__PoolLock(pool);
+	if (pool->flags & fmemPoolFlags_Poison) {
+		fmemMemoryBlock *poisonBlock = &pool->block;
+		while (poisonBlock != fmem_null && poisonBlock->base != fmem_null) {
+			FMEM_MEMSET(poisonBlock->base, FMEM_POOL_POISON_FREED, poisonBlock->used);
+			fmemBlockHeader *header = FMEM__GETHEADER(poisonBlock);
+			poisonBlock = header->next;
+		}
+	}
+	fmemReset(&pool->block);
+	pool->freeList = fmem_null;
+	pool->usedCount = 0;
+	pool->totalCount = 0;
+	++pool->generation;
+	fmem__PoolUnlock(pool);
+}
+
+fmem_api bool fmemPoolCacheInit(fmemPoolCache *cache, fmemPool *pool, const size_t capacity) {
+	if (cache == fmem_null || pool == fmem_null) {
+		return(false);
+	}
+	if (!(pool->flags & fmemPoolFlags_Concurrent)) {
+		return(false);
+	}
+	FMEM_MEMSET(cache, 0, sizeof(*cache));
+	cache->pool = pool;
+	cache->capacity = capacity > 1 ? capacity : FMEM__POOL_DEFAULT_CACHE_CAPACITY;
+	cache->generation = pool->generation;
+	return(true);
+}
+
+static void fmem__PoolCacheCheckGeneration(fmemPoolCache *cache) {
+	// Objects of the cache belongs to the pool memory before its last reset
+	size_t generation = fmem__AtomicLoadSize((volatile size_t *)&cache->pool->generation);
+	if (cache->generation != generation) {
+		cache->freeList = fmem_null;
+		cache->count = 0;
+		cache->generation = generation;
+	}
+}
+
+fmem_api void *fmemPoolCachePush(fmemPoolCache *cache, const fmemPushFlags flags) {
+	if (cache == fmem_null || cache->pool == fmem_null) {
+		return fmem_null;
+	}
+	fmemPool *pool = cache->pool;
+	fmem__PoolCacheCheckGeneration(cache);
+	if (cache->freeList == fmem_null) {
+		// Refill half of the cache at once
+		size_t refillCount = cache->capacity / 2;
+		fmem__PoolLock(pool);
+		for (size_t i = 0; i < refillCount; ++i) {
+			fmemPoolNode *node = fmem__PoolTakeUnlocked(pool);
+			if (node == fmem_null) {
+				break;
+			}
+			// Objects in the cache are counted as used by the pool
+			node->next = cache->freeList;
+			cache->freeList = node;
+			++cache->count;
+		}
+		fmem__PoolUnlock(pool);
+		if (cache->freeList == fmem_null) {
+			return fmem_null;
+		}
+	}
+	fmemPoolNode *result = cache->freeList;
+	cache->freeList = result->next;
+	--cache->count;
+	fmem__PoolFinishPush(pool, result, flags);
+	return(result);
+}
+
+fmem_api void fmemPoolCacheRelease(fmemPoolCache *cache, void *object) {
+	if (cache == fmem_null || cache->pool == fmem_null || object == fmem_null) {
+		return;
+	}
+	fmemPool *pool = cache->pool;
+	fmem__PoolCacheCheckGeneration(cache);
+	if (cache->count >= cache->capacity) {
+		// Move half of the cache back to the pool
+		size_t moveCount = cache->capacity / 2;
+		fmem__PoolLock(pool);
+		for (size_t i = 0; i < moveCount; ++i) {
+			fmemPoolNode *node = cache->freeList;
+			cache->freeList = node->next;
+			--cache->count;
+			fmem__PoolPutUnlocked(pool, node);
+		}
+		fmem__PoolUnlock(pool);
+	}
+	fmem__PoolPoisonReleased(pool, object);
+	fmemPoolNode *node = (fmemPoolNode *)object;
+	node->next = cache->freeList;
+	cache->freeList = node;
+	++cache->count;
+}
+
+fmem_api void fmemPoolCacheFlush(fmemPoolCache *cache) {
+	if (cache == fmem_null || cache->pool == fmem_null) {
+		return;
+	}
+	fmemPool *pool = cache->pool;
+	fmem__PoolCacheCheckGeneration(cache);
+	fmem__PoolLock(pool);
+	while (cache->freeList != fmem_null) {
+		fmemPoolNode *node = cache->freeList;
+		cache->freeList = node->next;
+		fmem__PoolPutUnlocked(pool, node);
+	}
+	fmem__PoolUnlock(pool);
+	cache->count = 0;
+}
+
+//
+// Frame allocator
+//
+fmem_api bool fmemFrameInit(fmemFrameAllocator *allocator, const uint32_t frameCount, const fmemType type, const size_t frameSize) {
+	if (allocator == fmem_null || frameCount < 2 || frameCount > FMEM_MAX_FRAME_COUNT) {
+		return(false);
+	}
+	if (type == fmemType_Temporary) {
+		return(false);
+	}
+	FMEM_MEMSET(allocator, 0, sizeof(*allocator));
+	for (uint32_t i = 0; i < frameCount; ++i) {
+		if (!fmemInit(&allocator->frames[i], type, frameSize)) {
+			fmemFrameFree(allocator);
+			return(false);
+		}
+	}
+	allocator->frameCount = frameCount;
+	return(true);
+}
+
+fmem_api void fmemFrameFree(fmemFrameAllocator *allocator) {
+	if (allocator == fmem_null) {
+		return;
+	}
+	for (uint32_t i = 0; i < FMEM_MAX_FRAME_COUNT; ++i) {
+		fmemFree(&allocator->frames[i]);
+	}
+	FMEM_MEMSET(allocator, 0, sizeof(*allocator));
+}
+
+fmem_api void fmemFrameSetFence(fmemFrameAllocator *allocator, fmem_frame_fence_wait_callback *waitFence, void *userData) {
+	if (allocator == fmem_null) {
+		return;
+	}
+	allocator->waitFence = waitFence;
+	allocator->fenceUserData = userData;
+}
+
+fmem_api fmemMemoryBlock *fmemFrameBegin(fmemFrameAllocator *allocator) {
+	if (allocator == fmem_null || allocator->frameCount == 0) {
+		return fmem_null;
+	}
+	uint64_t frameIndex = allocator->frameIndex + 1;
+	uint32_t slot = (uint32_t)(frameIndex % allocator->frameCount);
+	fmemMemoryBlock *block = &allocator->frames[slot];
+	uint64_t oldFrameIndex = allocator->frameIndices[slot];
+	if (oldFrameIndex > 0) {
+		// Consumers may still read the memory of the old frame
+		if (allocator->waitFence != fmem_null) {
+			allocator->waitFence(allocator->fenceUserData, oldFrameIndex);
+		}
+		fmemReset(block);
+	}
+	allocator->frameIndices[slot] = frameIndex;
+	allocator->frameIndex = frameIndex;
+	return(block);
+}
+
+fmem_api fmemMemoryBlock *fmemFrameGetBlock(fmemFrameAllocator *allocator, const uint32_t age) {
+	if (allocator == fmem_null || age >= allocator->frameCount || (uint64_t)age >= allocator->frameIndex) {
+		return fmem_null;
+	}
+	uint64_t frameIndex = allocator->frameIndex - age;
+	uint32_t slot = (uint32_t)(frameIndex % allocator->frameCount);
+	FMEM_ASSERT(allocator->frameIndices[slot] == frameIndex);
+	fmemMemoryBlock *result = &allocator->frames[slot];
+	return(result);
+}
+
+fmem_api uint8_t *fmemFramePush(fmemFrameAllocator *allocator, const size_t size, const size_t alignment, const fmemPushFlags flags) {
+	fmemMemoryBlock *block = fmemFrameGetBlock(allocator, 0);
+	if (block == fmem_null) {
+		return fmem_null;
+	}
+	uint8_t *result = fmemPushAligned(block, size, alignment, flags);
+	return(result);
+}
+
+//
+// Statistics
+//
+fmem_api bool fmemAttachStats(fmemMemoryBlock *block, fmemStats *stats) {
+	if (block == fmem_null) {
+		return(false);
+	}
+	if (stats != fmem_null) {
+		FMEM_MEMSET(stats, 0, sizeof(*stats));
+		stats->tags[0].name = "untagged";
+		stats->usedBytes = stats->peakBytes = fmem__GetUsedFrom(block);
+	}
+	block->stats = stats;
+	return(true);
+}
+
+fmem_api bool fmemSetTagName(fmemStats *stats, const uint32_t tag, const char *name) {
+	if (stats == fmem_null || tag >= FMEM_MAX_TAG_COUNT) {
+		return(false);
+	}
+	stats->tags[tag].name = name;
+	return(true);
+}
+
+typedef struct fmem__StringWriter {
+	char *buffer;
+	size_t maxBufferLen;
+	size_t length;
+} fmem__StringWriter;
+
+static void fmem__WriteChars(fmem__StringWriter *writer, const char *chars, const size_t len) {
+	// Copy what fits, but keep counting the required length
+	if (writer->buffer != fmem_null && writer->length < writer->maxBufferLen) {
+		size_t space = writer->maxBufferLen - writer->length - 1;
+		size_t copyLen = (len < space) ? len : space;
+		for (size_t i = 0; i < copyLen; ++i) {
+			writer->buffer[writer->length + i] = chars[i];
+		}
+		writer->buffer[writer->length + copyLen] = 0;
+	}
+	writer->length += len;
+}
+
+// Formats numbers and fixed strings only, names of any length are written by fmem__WriteName()
+static void fmem__WriteFormat(fmem__StringWriter *writer, const char *format, ...) {
+	char line[256];
+	va_list argList;
+	va_start(argList, format);
+	int count = FMEM_VSNPRINTF(line, sizeof(line), format, argList);
+	va_end(argList);
+	if (count <= 0) {
+		return;
+	}
+	FMEM_ASSERT((size_t)count < sizeof(line));
+	size_t len = ((size_t)count < sizeof(line)) ? (size_t)count : (sizeof(line) - 1);
+	fmem__WriteChars(writer, line, len);
+}
+
+// Writes a tag name of any length, escaped for a JSON string when needed
+static void fmem__WriteName(fmem__StringWriter *writer, const char *name, const bool isJSON) {
+	const char *start = name;
+	const char *p = name;
+	while (*p) {
+		uint8_t c = (uint8_t)*p;
+		if (isJSON && (c == '"' || c == '\\' || c < 0x20)) {
+			fmem__WriteChars(writer, start, p - start);
+			if (c < 0x20) {
+				fmem__WriteFormat(writer, "\\u%04x", (unsigned int)c);
+			} else {
+				fmem__WriteChars(writer, "\\", 1);
+				fmem__WriteChars(writer, p, 1);
+			}
+			start = p + 1;
+		}
+		++p;
+	}
+	fmem__WriteChars(writer, start, p - start);
+}
+
+fmem_api size_t fmemFormatStats(fmemMemoryBlock *block, const fmemStatsFormat format, char *buffer, const size_t maxBufferLen) {
+	fmem__StringWriter writer;
+	writer.buffer = buffer;
+	writer.maxBufferLen = maxBufferLen;
+	writer.length = 0;
+	if (buffer != fmem_null && maxBufferLen > 0) {
+		buffer[0] = 0;
+	}
+	if (block == fmem_null) {
+		return(0);
+	}
+	bool isJSON = format == fmemStatsFormat_JSON;
+
+	// Blocks before the current block only serve best fit pushes, therefore its free space counts as fragmentation
+	size_t totalSize = 0;
+	size_t totalUsed = 0;
+	size_t strandedSize = 0;
+	size_t blockCount = 0;
+	fmemMemoryBlock *currentBlock = fmem__GetCurrentBlock(block);
+	bool isBeforeCurrent = currentBlock != block;
+	fmemMemoryBlock *testBlock = block;
+	while (testBlock != fmem_null && testBlock->base != fmem_null) {
+		size_t freeSize = fmem__GetSpaceAvailableFor(testBlock, 0);
+		totalSize += testBlock->size;
+		totalUsed += testBlock->used;
+		if (testBlock == currentBlock) {
+			isBeforeCurrent = false;
+		} else if (isBeforeCurrent) {
+			strandedSize += freeSize;
+		}
+		++blockCount;
+		if (testBlock->type != fmemType_Growable) {
+			break;
+		}
+		fmemBlockHeader *header = FMEM__GETHEADER(testBlock);
+		testBlock = header->next;
+	}
+	double fragmentation = totalSize > 0 ? (double)strandedSize / (double)totalSize : 0.0;
+
+	if (isJSON) {
+		fmem__WriteFormat(&writer, "{\"totalSize\":%zu,\"usedSize\":%zu,\"blockCount\":%zu,\"strandedSize\":%zu,\"fragmentation\":%.4f", totalSize, totalUsed, blockCount, strandedSize, fragmentation);
+	} else {
+		fmem__WriteFormat(&writer, "Memory: %zu bytes in %zu blocks, %zu bytes used, %zu bytes stranded (fragmentation %.2f%%)\n", totalSize, blockCount, totalUsed, strandedSize, fragmentation * 100.0);
+	}
+
+	// Blocks
+	if (isJSON) {
+		fmem__WriteFormat(&writer, ",\"blocks\":[");
+	}
+	size_t blockIndex = 0;
+	testBlock = block;
+	while (testBlock != fmem_null && testBlock->base != fmem_null && blockIndex < FMEM_MAX_REPORT_BLOCK_COUNT) {
+		size_t freeSize = fmem__GetSpaceAvailableFor(testBlock, 0);
+		bool isCurrent = testBlock == currentBlock;
+		if (isJSON) {
+			fmem__WriteFormat(&writer, "%s{\"size\":%zu,\"used\":%zu,\"free\":%zu,\"current\":%s}", blockIndex > 0 ? "," : "", testBlock->size, testBlock->used, freeSize, isCurrent ? "true" : "false");
+		} else {
+			fmem__WriteFormat(&writer, "  Block[%zu]: size=%zu used=%zu free=%zu%s\n", blockIndex, testBlock->size, testBlock->used, freeSize, isCurrent ? " (current)" : "");
+		}
+		++blockIndex;
+		if (testBlock->type != fmemType_Growable) {
+			break;
+		}
+		fmemBlockHeader *header = FMEM__GETHEADER(testBlock);
+		testBlock = header->next;
+	}
+	if (isJSON) {
+		fmem__WriteFormat(&writer, "]");
+	}
+
+	// Statistics
+	const fmemStats *stats = block->stats;
+	if (stats != fmem_null) {
+		if (isJSON) {
+			fmem__WriteFormat(&writer, ",\"stats\":{\"usedBytes\":%zu,\"peakBytes\":%zu,\"paddingBytes\":%zu,\"pushCount\":%zu,\"failedPushCount\":%zu,\"resetCount\":%zu,\"tags\":[", stats->usedBytes, stats->peakBytes, stats->paddingBytes, stats->pushCount, stats->failedPushCount, stats->resetCount);
+		} else {
+			fmem__WriteFormat(&writer, "Stats: used=%zu peak=%zu padding=%zu pushes=%zu failed=%zu resets=%zu\n", stats->usedBytes, stats->peakBytes, stats->paddingBytes, stats->pushCount, stats->failedPushCount, stats->resetCount);
+		}
+		bool isFirstTag = true;
+		for (uint32_t tag = 0; tag < FMEM_MAX_TAG_COUNT; ++tag) {
+			const fmemTagStats *tagStats = &stats->tags[tag];
+			if (tagStats->peakBytes == 0) {
+				continue;
+			}
+			const char *name = tagStats->name != fmem_null ? tagStats->name : "";
+			if (isJSON) {
+				fmem__WriteFormat(&writer, "%s{\"tag\":%u,\"name\":\"", isFirstTag ? "" : ",", tag);
+				fmem__WriteName(&writer, name, true);
+				fmem__WriteFormat(&writer, "\",\"bytes\":%zu,\"peakBytes\":%zu,\"pushCount\":%zu}", tagStats->bytes, tagStats->peakBytes, tagStats->pushCount);
+			} else {
+				fmem__WriteFormat(&writer, "  Tag[%u] ", tag);
+				fmem__WriteName(&writer, name, false);
+				fmem__WriteFormat(&writer, ": bytes=%zu peak=%zu pushes=%zu\n", tagStats->bytes, tagStats->peakBytes, tagStats->pushCount);
+			}
+			isFirstTag = false;
+		}
+		if (isJSON) {
+			fmem__WriteFormat(&writer, "]}");
+		}
+	}
+	if (isJSON) {
+		fmem__WriteFormat(&writer, "}");
+	}
+	return(writer.length);
+}
+
 #endif // FMEM_IMPLEMENTATION
\ No newline at end of file
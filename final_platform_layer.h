@@ -162,6 +162,22 @@ SOFTWARE.
 	- New: Added storage class identifier fpl_no_inline
 	- New: Added macro fplAlwaysAssert()
 	- New: Added function fplIsPlatformInitialized()
+	- New: Added field timestamp to struct fplEvent
+	- New: Added fields deltaX/deltaY to struct fplMouseEvent
+	- New: Added field isEventCoalescing to struct fplWindowSettings
+	- New: Added struct fplSharedMemoryHandle and functions fplSharedMemoryCreate/fplSharedMemoryOpen/fplSharedMemoryClose/fplSharedMemoryRemove
+	- New: Added struct fplSharedRingBuffer, a lock-free single-producer single-consumer byte ring living in shared memory
+	- New: Added enum value fplInitFlags_Network
+	- New: Added struct fplSocketHandle and functions fplSocketCreate/fplSocketClose/fplSocketBind/fplSocketListen/fplSocketAccept/fplSocketConnect
+	- New: Added functions fplSocketSend/fplSocketReceive/fplSocketSendTo/fplSocketReceiveFrom for non-blocking socket I/O
+	- New: Added functions fplSocketSendPackets/fplSocketReceivePackets for batched UDP I/O
+	- New: Added struct fplSocketPoller and functions fplSocketPollerCreate/fplSocketPollerDestroy/fplSocketPollerAdd/fplSocketPollerRemove/fplSocketPollerWait
+	- New: Added function fplSocketPollerPushEvents and event type fplEventType_Socket
+	- New: Added function fplWalkDirectory for walking through directory trees in parallel
+	- New: Added struct fplFileWatcher and functions fplFileWatcherCreate/fplFileWatcherDestroy/fplFileWatcherAdd/fplFileWatcherUpdate
+	- New: Added event type fplEventType_FileWatch
+	- New: Added functions fplComputeHash/fplComputeFileHash for CRC-32C, XXH64 and MurmurHash3 128-bit hashes
+	- New: Added struct fplHashState and functions fplHashBegin/fplHashUpdate/fplHashEnd for streamed hashing
 	- New: Added FPL_IS_IDE macro for checking if any source editor is active.
 	- New: [MSVC] Always show implementation block when FPL_IS_IDE is set
 
@@ -175,6 +191,9 @@ SOFTWARE.
 	- Fixed: All non-tab spacings replaced with tab spacings
 	- Fixed: ARM64 was not detected properly
 	- Fixed: Atomics was not detected for ICC (Intel C/C++ Compiler)
+	- Fixed: fpl__ClearInternalEvents was releasing drop files memory for non-window events
+	- Fixed: FPL_API_AS_PRIVATE was not compiling in C++ (static in linkage specification)
+	- Fixed: [POSIX] fpl__PosixThreadProc was not declared as internal
 
 	- Changed: Removed fake thread-safe implementation of the internal event queue
 	- Changed: Changed drop event structure in fplWindowEvent to support multiple dropped files
@@ -236,6 +255,26 @@ SOFTWARE.
 	- Changed: [MSVC] Implemented fplCPUID/fplGetXCR0 for MSVC
 	- Changed: [GCC/Clang] Implemented fplCPUID/fplGetXCR0 for GCC/Clang
 	- Changed: [Win32] Input events are not flushed anymore, when disabled
+	- Changed: [X11] fplPollKeyboardState uses a cached keyboard state updated by key/focus events, instead of XQueryKeymap round-trips
+	- New: [Win32/X11] Coalescing of consecutive mouse move and resize events when fplWindowSettings.isEventCoalescing is set
+	- New: [Win32/X11] Event timestamps are taken from the native message/server time
+	- New: [POSIX/Win32] Implemented fplSharedMemoryCreate/fplSharedMemoryOpen/fplSharedMemoryClose/fplSharedMemoryRemove
+	- New: [Linux] Ring buffer waits are using futex instead of polling
+	- New: [POSIX/Win32] Implemented non-blocking UDP/TCP sockets
+	- New: [Win32] Load ws2_32.dll dynamically and start winsock only when fplInitFlags_Network is set
+	- New: [Linux] fplSocketSendPackets/fplSocketReceivePackets are using sendmmsg/recvmmsg
+	- New: [Linux] fplSocketPoller is using epoll
+	- Fixed: [POSIX] pthread_yield is optional now and fplThreadYield falls back to sched_yield (Removed in glibc 2.34)
+	- Fixed: [POSIX] fplDirectoryRemove was implemented as fplRemoveDirectory
+	- New: [Linux] fplWalkDirectory reads directories in batches with getdents64
+	- New: [Win32] fplWalkDirectory reads directories with FindFirstFileExW using large fetches
+	- New: [Linux] Implemented fplFileWatcher using inotify
+	- New: [Win32] Implemented fplFileWatcher using ReadDirectoryChangesW
+	- New: [X86/X64] CRC-32C hashes are computed with the SSE 4.2 crc32 instruction when available
+	- Fixed: [GCC/Clang] fplCPUID, fplGetXCR0 and fplRDTSC were returning zero always, so fplGetProcessorCapabilities detected nothing
+	- Fixed: [POSIX] fplReadFileBlock64 was looping forever when the end of the file was reached
+	- Fixed: [Win32] fplReadFileBlock64 was returning the size of the last chunk only and was looping forever on the end of the file
+	- Fixed: [POSIX] fplMemoryAllocate was not handling a failed mmap
 
 	## v0.9.3.0 beta
 	- Changed: Renamed fplSetWindowFullscreen to fplSetWindowFullscreenSize
@@ -1316,7 +1355,7 @@ SOFTWARE.
 		- Video
 		- Mappings/Conversions
 
-	- Networking (UDP, TCP)
+	- Networking (IPv6, DNS)
 		- [Win32] WinSock
 		- [POSIX] Socket
 
@@ -1605,7 +1644,7 @@ SOFTWARE.
 //! Main entry point api definition
 #define fpl_main
 
-#if defined(FPL_IS_CPP)
+#if defined(FPL_IS_CPP) && !defined(FPL_API_AS_PRIVATE)
 #	define fpl__m_platform_api extern "C" fpl_api
 #	define fpl__m_common_api extern "C" fpl_api
 #else
@@ -2142,6 +2181,7 @@ fplStaticAssert(sizeof(size_t) >= sizeof(uint32_t));
 #elif defined(FPL_COMPILER_GCC) || defined(FPL_COMPILER_CLANG)
 #	if defined(FPL_ARCH_X86) || defined(FPL_ARCH_X64)
 #		include <cpuid.h> // __cpuid_count
+#		include <nmmintrin.h> // _mm_crc32_u64
 #	endif // X86 or X64
 #endif
 
@@ -3046,8 +3086,10 @@ typedef enum fplInitFlags {
 	fplInitFlags_Audio = 1 << 3,
 	//! Support for game controllers
 	fplInitFlags_GameController = 1 << 4,
+	//! Support for sockets (Loads and starts winsock on Win32)
+	fplInitFlags_Network = 1 << 5,
 	//! All init flags
-	fplInitFlags_All = fplInitFlags_Console | fplInitFlags_Window | fplInitFlags_Video | fplInitFlags_Audio | fplInitFlags_GameController,
+	fplInitFlags_All = fplInitFlags_Console | fplInitFlags_Window | fplInitFlags_Video | fplInitFlags_Audio | fplInitFlags_GameController | fplInitFlags_Network,
 } fplInitFlags;
 //! InitFlags operator overloads for C++
 FPL_ENUM_AS_FLAGS_OPERATORS(fplInitFlags);
@@ -3418,6 +3460,8 @@ typedef struct fplWindowSettings {
 	fpl_b32 isFloating;
 	//! Is window in fullscreen mode
 	fpl_b32 isFullscreen;
+	//! Coalesce consecutive mouse move and window resize events into a single event (Default: false)
+	fpl_b32 isEventCoalescing;
 } fplWindowSettings;
 
 /**
@@ -4362,6 +4406,480 @@ fpl_platform_api bool fplSemaphoreRelease(fplSemaphoreHandle *semaphore);
 
 /** @} */
 
+// ----------------------------------------------------------------------------
+/**
+* @defgroup SharedMemory Shared memory & IPC
+* @brief This category contains functions for sharing memory regions and streaming bytes between processes
+* @{
+*/
+// ----------------------------------------------------------------------------
+
+//! A union containing the internal shared memory handle for any platform
+typedef union fplInternalSharedMemoryHandle {
+#if defined(FPL_PLATFORM_WINDOWS)
+	//! Win32 file mapping handle
+	HANDLE win32MappingHandle;
+#elif defined(FPL_SUBPLATFORM_POSIX)
+	//! Posix shared memory file descriptor
+	int posixFileHandle;
+#endif
+} fplInternalSharedMemoryHandle;
+
+//! The shared memory handle structure
+typedef struct fplSharedMemoryHandle {
+	//! Internal shared memory handle
+	fplInternalSharedMemoryHandle internalHandle;
+	//! The name of the shared memory region
+	char name[FPL_MAX_NAME_LENGTH];
+	//! The base address of the mapped region
+	void *base;
+	//! The size of the mapped region in bytes
+	size_t size;
+	//! Is true when this handle has created the region and removes it on close
+	fpl_b32 isOwner;
+	//! Shared memory region is valid
+	fpl_b32 isValid;
+} fplSharedMemoryHandle;
+
+//! The single-producer single-consumer ring buffer structure, living inside a shared memory region
+typedef struct fplSharedRingBuffer {
+	//! The shared memory region, containing the ring header and the data
+	fplSharedMemoryHandle memory;
+	//! Internal ring header at the start of the shared memory region
+	void *header;
+	//! The data section of the ring
+	uint8_t *data;
+	//! The capacity of the data section in bytes (Always a power of two)
+	size_t capacity;
+	//! Ring buffer is valid
+	fpl_b32 isValid;
+} fplSharedRingBuffer;
+
+/**
+* @brief Creates a new named shared memory region with the given size and maps it into the address space of the calling process.
+* @param name The name of the shared memory region, without any slashes
+* @param size The size of the region in bytes
+* @param outHandle The pointer to the @ref fplSharedMemoryHandle structure
+* @return Returns true when the region was created and mapped, false otherwise.
+* @note The function fails when a region with the same name already exists.
+* @note The memory is zero initialized.
+* @see @ref section_category_sharedmemory_regions
+*/
+fpl_platform_api bool fplSharedMemoryCreate(const char *name, const size_t size, fplSharedMemoryHandle *outHandle);
+/**
+* @brief Opens an existing named shared memory region and maps it into the address space of the calling process.
+* @param name The name of the shared memory region, without any slashes
+* @param outHandle The pointer to the @ref fplSharedMemoryHandle structure
+* @return Returns true when the region was opened and mapped, false otherwise.
+* @see @ref section_category_sharedmemory_regions
+*/
+fpl_platform_api bool fplSharedMemoryOpen(const char *name, fplSharedMemoryHandle *outHandle);
+/**
+* @brief Unmaps the given shared memory region and removes the name from the system when the handle is the owner.
+* @param handle The pointer to the @ref fplSharedMemoryHandle structure
+* @note Processes which have the region still mapped can continue to use it.
+* @see @ref section_category_sharedmemory_regions
+*/
+fpl_platform_api void fplSharedMemoryClose(fplSharedMemoryHandle *handle);
+/**
+* @brief Removes the name of a shared memory region from the system, without mapping it.
+* @param name The name of the shared memory region, without any slashes
+* @return Returns true when the name was removed, false otherwise.
+* @note Use this to remove names left behind by a process which was terminated before closing its regions.
+* @note Processes which have the region still mapped can continue to use it.
+* @note On Win32 the name is removed by the system when the last handle is closed, so this always returns false.
+* @see @ref section_category_sharedmemory_regions
+*/
+fpl_platform_api bool fplSharedMemoryRemove(const char *name);
+
+/**
+* @brief Creates a new named shared memory region, containing a lock-free single-producer single-consumer byte ring.
+* @param name The name of the shared memory region, without any slashes
+* @param capacity The capacity of the ring in bytes, must be a power of two
+* @param outRing The pointer to the @ref fplSharedRingBuffer structure
+* @return Returns true when the ring was created, false otherwise.
+* @see @ref section_category_sharedmemory_ring
+*/
+fpl_common_api bool fplSharedRingBufferCreate(const char *name, const size_t capacity, fplSharedRingBuffer *outRing);
+/**
+* @brief Opens an existing ring, created by @ref fplSharedRingBufferCreate() from any process.
+* @param name The name of the shared memory region, without any slashes
+* @param outRing The pointer to the @ref fplSharedRingBuffer structure
+* @return Returns true when the ring was opened, false otherwise.
+* @see @ref section_category_sharedmemory_ring
+*/
+fpl_common_api bool fplSharedRingBufferOpen(const char *name, fplSharedRingBuffer *outRing);
+/**
+* @brief Closes the given ring and the underlying shared memory region.
+* @param ring The pointer to the @ref fplSharedRingBuffer structure
+* @see @ref section_category_sharedmemory_ring
+*/
+fpl_common_api void fplSharedRingBufferClose(fplSharedRingBuffer *ring);
+/**
+* @brief Writes all the given bytes into the ring, waiting until enough space is available or the timeout has been reached.
+* @param ring The pointer to the @ref fplSharedRingBuffer structure
+* @param data The source bytes
+* @param size The number of bytes to write, must not exceed the capacity of the ring
+* @param timeout The number of milliseconds to wait. When this is set to @ref FPL_TIMEOUT_INFINITE it will wait infinitly, when zero it will not wait at all.
+* @return Returns true when all bytes was written, false otherwise.
+* @warning Only one thread/process is allowed to write into the ring at the same time.
+* @see @ref section_category_sharedmemory_ring
+*/
+fpl_common_api bool fplSharedRingBufferWrite(fplSharedRingBuffer *ring, const void *data, const size_t size, const fplTimeoutValue timeout);
+/**
+* @brief Reads up to the given number of bytes from the ring, waiting until at least one byte is available or the timeout has been reached.
+* @param ring The pointer to the @ref fplSharedRingBuffer structure
+* @param dest The target buffer
+* @param maxSize The maximum number of bytes to read
+* @param timeout The number of milliseconds to wait. When this is set to @ref FPL_TIMEOUT_INFINITE it will wait infinitly, when zero it will not wait at all.
+* @return Returns the number of bytes read or zero on timeout.
+* @warning Only one thread/process is allowed to read from the ring at the same time.
+* @see @ref section_category_sharedmemory_ring
+*/
+fpl_common_api size_t fplSharedRingBufferRead(fplSharedRingBuffer *ring, void *dest, const size_t maxSize, const fplTimeoutValue timeout);
+/**
+* @brief Gets the number of bytes which can be read from the ring without waiting.
+* @param ring The pointer to the @ref fplSharedRingBuffer structure
+* @return Returns the number of readable bytes.
+* @see @ref section_category_sharedmemory_ring
+*/
+fpl_common_api size_t fplSharedRingBufferGetReadableSize(fplSharedRingBuffer *ring);
+/**
+* @brief Gets the number of bytes which can be written into the ring without waiting.
+* @param ring The pointer to the @ref fplSharedRingBuffer structure
+* @return Returns the number of writable bytes.
+* @see @ref section_category_sharedmemory_ring
+*/
+fpl_common_api size_t fplSharedRingBufferGetWritableSize(fplSharedRingBuffer *ring);
+
+/** @} */
+
+// ----------------------------------------------------------------------------
+/**
+* @defgroup Network Network functions
+* @brief This category contains functions for non-blocking UDP/TCP sockets and socket polling
+* @{
+*/
+// ----------------------------------------------------------------------------
+
+//! The maximum number of sockets a single poller can watch
+#define FPL_MAX_SOCKET_POLLER_COUNT 4096
+
+//! An enumeration of socket types (UDP, TCP)
+typedef enum fplSocketType {
+	//! No socket type
+	fplSocketType_None = 0,
+	//! Datagram socket (UDP)
+	fplSocketType_UDP,
+	//! Stream socket (TCP)
+	fplSocketType_TCP,
+} fplSocketType;
+
+//! An enumeration of socket operation results
+typedef enum fplSocketResult {
+	//! Operation has completed
+	fplSocketResult_Success = 0,
+	//! Operation would block, try again when the socket is ready
+	fplSocketResult_WouldBlock,
+	//! Connection was closed by the remote side
+	fplSocketResult_Closed,
+	//! Operation has failed
+	fplSocketResult_Failed,
+} fplSocketResult;
+
+//! An enumeration of socket poll flags
+typedef enum fplSocketPollFlags {
+	//! Nothing
+	fplSocketPollFlags_None = 0,
+	//! Socket is readable or has a pending connection
+	fplSocketPollFlags_Read = 1 << 0,
+	//! Socket is writable or has finished connecting
+	fplSocketPollFlags_Write = 1 << 1,
+	//! Remote side has closed the connection (Output only)
+	fplSocketPollFlags_Closed = 1 << 2,
+	//! Socket has an error (Output only)
+	fplSocketPollFlags_Error = 1 << 3,
+} fplSocketPollFlags;
+//! fplSocketPollFlags operator overloads for C++
+FPL_ENUM_AS_FLAGS_OPERATORS(fplSocketPollFlags);
+
+//! A structure containing a IPv4 address and a port
+typedef struct fplSocketAddress {
+	//! The IPv4 address, in the order as written (127.0.0.1 = { 127, 0, 0, 1 })
+	uint8_t ip[4];
+	//! The port in host byte order
+	uint16_t port;
+} fplSocketAddress;
+
+//! A union containing the internal socket handle for any platform
+typedef union fplInternalSocketHandle {
+#if defined(FPL_PLATFORM_WINDOWS)
+	//! Win32 socket handle (SOCKET)
+	uintptr_t win32Socket;
+#elif defined(FPL_SUBPLATFORM_POSIX)
+	//! Posix socket file descriptor
+	int posixSocket;
+#endif
+} fplInternalSocketHandle;
+
+//! The socket handle structure
+typedef struct fplSocketHandle {
+	//! Internal socket handle
+	fplInternalSocketHandle internalHandle;
+	//! Socket type
+	fplSocketType type;
+	//! Socket is valid
+	fpl_b32 isValid;
+} fplSocketHandle;
+
+//! A structure containing a single datagram for batched sending/receiving
+typedef struct fplSocketPacket {
+	//! The packet data
+	void *data;
+	//! The size of the data in bytes. On receive, this is the capacity of the data on input and the received size on output
+	size_t size;
+	//! The target address on send, the source address on receive
+	fplSocketAddress address;
+} fplSocketPacket;
+
+//! A structure containing a socket readiness event
+typedef struct fplSocketEvent {
+	//! The socket this event is for
+	fplSocketHandle socket;
+	//! The user data, passed to @ref fplSocketPollerAdd()
+	void *userData;
+	//! The ready flags
+	fplSocketPollFlags flags;
+} fplSocketEvent;
+
+//! Internal socket poller entry
+typedef struct fplSocketPollerEntry {
+	//! The socket
+	fplSocketHandle socket;
+	//! The user data
+	void *userData;
+	//! The requested poll flags
+	fplSocketPollFlags flags;
+	//! Is this entry in use
+	fpl_b32 isUsed;
+} fplSocketPollerEntry;
+
+//! A union containing the internal socket poller handle for any platform
+typedef union fplInternalSocketPollerHandle {
+#if defined(FPL_PLATFORM_LINUX)
+	//! Linux epoll file descriptor
+	int linuxEpollHandle;
+#endif
+	//! Pointer to platform specific poll descriptors
+	void *pollDescriptors;
+} fplInternalSocketPollerHandle;
+
+//! The socket poller structure
+typedef struct fplSocketPoller {
+	//! Internal poller handle
+	fplInternalSocketPollerHandle internalHandle;
+	//! The entries for each watched socket
+	fplSocketPollerEntry *entries;
+	//! The maximum number of entries
+	uint32_t capacity;
+	//! The number of used entries
+	uint32_t count;
+	//! Poller is valid
+	fpl_b32 isValid;
+} fplSocketPoller;
+
+/**
+* @brief Converts the given IPv4 string and port into a @ref fplSocketAddress.
+* @param ip The IPv4 address in dotted notation (127.0.0.1)
+* @param port The port
+* @param outAddress The pointer to the @ref fplSocketAddress structure
+* @return Returns true when the string is a valid IPv4 address, false otherwise.
+* @see @ref section_category_network_addresses
+*/
+fpl_common_api bool fplSocketAddressFromString(const char *ip, const uint16_t port, fplSocketAddress *outAddress);
+/**
+* @brief Writes the given @ref fplSocketAddress as a ip:port string into the buffer.
+* @param address The pointer to the @ref fplSocketAddress structure
+* @param buffer The target buffer
+* @param maxBufferLen The max length of the target buffer
+* @return Returns the pointer to the first character in the buffer or @ref fpl_null.
+* @see @ref section_category_network_addresses
+*/
+fpl_common_api char *fplSocketAddressToString(const fplSocketAddress *address, char *buffer, const size_t maxBufferLen);
+
+/**
+* @brief Creates a new non-blocking socket of the given type.
+* @param type The @ref fplSocketType
+* @param outSocket The pointer to the @ref fplSocketHandle structure
+* @return Returns true when the socket was created, false otherwise.
+* @note TCP sockets have nagle disabled (TCP_NODELAY).
+* @note Requires the platform to be initialized with @ref fplInitFlags_Network.
+* @see @ref section_category_network_sockets
+*/
+fpl_platform_api bool fplSocketCreate(const fplSocketType type, fplSocketHandle *outSocket);
+/**
+* @brief Closes the given socket.
+* @param socket The pointer to the @ref fplSocketHandle structure
+* @see @ref section_category_network_sockets
+*/
+fpl_platform_api void fplSocketClose(fplSocketHandle *socket);
+/**
+* @brief Binds the socket to the given local address. A port of zero selects any free port.
+* @param socket The pointer to the @ref fplSocketHandle structure
+* @param address The pointer to the @ref fplSocketAddress structure
+* @return Returns true when the socket was bound, false otherwise.
+* @see @ref section_category_network_sockets
+*/
+fpl_platform_api bool fplSocketBind(fplSocketHandle *socket, const fplSocketAddress *address);
+/**
+* @brief Gets the local address the socket is bound to.
+* @param socket The pointer to the @ref fplSocketHandle structure
+* @param outAddress The pointer to the @ref fplSocketAddress structure
+* @return Returns true when the address was retrieved, false otherwise.
+* @see @ref section_category_network_sockets
+*/
+fpl_platform_api bool fplSocketGetLocalAddress(fplSocketHandle *socket, fplSocketAddress *outAddress);
+/**
+* @brief Starts listening for incoming connections on the given TCP socket.
+* @param socket The pointer to the @ref fplSocketHandle structure
+* @param backlog The maximum length of the pending connections queue
+* @return Returns true when the socket is listening, false otherwise.
+* @see @ref section_category_network_tcp
+*/
+fpl_platform_api bool fplSocketListen(fplSocketHandle *socket, const uint32_t backlog);
+/**
+* @brief Accepts the next pending connection from the given listening TCP socket.
+* @param socket The pointer to the listening @ref fplSocketHandle structure
+* @param outClient The pointer to the @ref fplSocketHandle structure for the new non-blocking connection
+* @param outAddress The optional pointer to the @ref fplSocketAddress structure for the remote address
+* @return Returns @ref fplSocketResult_Success when a connection was accepted, @ref fplSocketResult_WouldBlock when there is no pending connection.
+* @see @ref section_category_network_tcp
+*/
+fpl_platform_api fplSocketResult fplSocketAccept(fplSocketHandle *socket, fplSocketHandle *outClient, fplSocketAddress *outAddress);
+/**
+* @brief Starts connecting the given TCP socket to the remote address.
+* @param socket The pointer to the @ref fplSocketHandle structure
+* @param address The pointer to the remote @ref fplSocketAddress structure
+* @return Returns @ref fplSocketResult_Success when connected immediatly, @ref fplSocketResult_WouldBlock when the connection is in progress.
+* @note The socket gets writable, when the connection is established.
+* @see @ref section_category_network_tcp
+*/
+fpl_platform_api fplSocketResult fplSocketConnect(fplSocketHandle *socket, const fplSocketAddress *address);
+/**
+* @brief Sends bytes over a connected TCP socket.
+* @param socket The pointer to the @ref fplSocketHandle structure
+* @param data The source bytes
+* @param size The number of bytes to send
+* @param outSent The pointer to the number of bytes actually sent
+* @return Returns the @ref fplSocketResult
+* @see @ref section_category_network_tcp
+*/
+fpl_platform_api fplSocketResult fplSocketSend(fplSocketHandle *socket, const void *data, const size_t size, size_t *outSent);
+/**
+* @brief Receives bytes from a connected TCP socket.
+* @param socket The pointer to the @ref fplSocketHandle structure
+* @param buffer The target buffer
+* @param maxSize The maximum number of bytes to receive
+* @param outReceived The pointer to the number of bytes actually received
+* @return Returns the @ref fplSocketResult, @ref fplSocketResult_Closed when the remote side has closed the connection.
+* @see @ref section_category_network_tcp
+*/
+fpl_platform_api fplSocketResult fplSocketReceive(fplSocketHandle *socket, void *buffer, const size_t maxSize, size_t *outReceived);
+/**
+* @brief Sends a single datagram to the given address.
+* @param socket The pointer to the @ref fplSocketHandle structure
+* @param data The source bytes
+* @param size The number of bytes to send
+* @param address The pointer to the target @ref fplSocketAddress structure
+* @return Returns the @ref fplSocketResult
+* @see @ref section_category_network_udp
+*/
+fpl_platform_api fplSocketResult fplSocketSendTo(fplSocketHandle *socket, const void *data, const size_t size, const fplSocketAddress *address);
+/**
+* @brief Receives a single datagram.
+* @param socket The pointer to the @ref fplSocketHandle structure
+* @param buffer The target buffer
+* @param maxSize The maximum number of bytes to receive
+* @param outAddress The optional pointer to the @ref fplSocketAddress structure for the source address
+* @param outReceived The pointer to the number of bytes actually received
+* @return Returns the @ref fplSocketResult
+* @see @ref section_category_network_udp
+*/
+fpl_platform_api fplSocketResult fplSocketReceiveFrom(fplSocketHandle *socket, void *buffer, const size_t maxSize, fplSocketAddress *outAddress, size_t *outReceived);
+/**
+* @brief Sends multiple datagrams with as few system calls as possible.
+* @param socket The pointer to the @ref fplSocketHandle structure
+* @param packets The array of @ref fplSocketPacket
+* @param count The number of packets
+* @return Returns the number of packets sent, it is less than the count when the socket would block.
+* @see @ref section_category_network_udp
+*/
+fpl_platform_api size_t fplSocketSendPackets(fplSocketHandle *socket, const fplSocketPacket *packets, const size_t count);
+/**
+* @brief Receives multiple datagrams with as few system calls as possible.
+* @param socket The pointer to the @ref fplSocketHandle structure
+* @param packets The array of @ref fplSocketPacket, containing the target buffers
+* @param count The number of packets
+* @return Returns the number of packets received.
+* @see @ref section_category_network_udp
+*/
+fpl_platform_api size_t fplSocketReceivePackets(fplSocketHandle *socket, fplSocketPacket *packets, const size_t count);
+
+/**
+* @brief Creates a new socket poller for watching up to the given number of sockets.
+* @param maxSocketCount The maximum number of sockets, limited to @ref FPL_MAX_SOCKET_POLLER_COUNT
+* @param outPoller The pointer to the @ref fplSocketPoller structure
+* @return Returns true when the poller was created, false otherwise.
+* @see @ref section_category_network_poller
+*/
+fpl_platform_api bool fplSocketPollerCreate(const uint32_t maxSocketCount, fplSocketPoller *outPoller);
+/**
+* @brief Releases the given socket poller, the watched sockets are not closed.
+* @param poller The pointer to the @ref fplSocketPoller structure
+* @see @ref section_category_network_poller
+*/
+fpl_platform_api void fplSocketPollerDestroy(fplSocketPoller *poller);
+/**
+* @brief Starts watching the given socket for the given readiness flags.
+* @param poller The pointer to the @ref fplSocketPoller structure
+* @param socket The pointer to the @ref fplSocketHandle structure
+* @param flags The @ref fplSocketPollFlags to watch for
+* @param userData The user data, which is returned in every @ref fplSocketEvent for this socket
+* @return Returns true when the socket is watched, false otherwise.
+* @see @ref section_category_network_poller
+*/
+fpl_platform_api bool fplSocketPollerAdd(fplSocketPoller *poller, fplSocketHandle *socket, const fplSocketPollFlags flags, void *userData);
+/**
+* @brief Stops watching the given socket.
+* @param poller The pointer to the @ref fplSocketPoller structure
+* @param socket The pointer to the @ref fplSocketHandle structure
+* @return Returns true when the socket was watched before, false otherwise.
+* @see @ref section_category_network_poller
+*/
+fpl_platform_api bool fplSocketPollerRemove(fplSocketPoller *poller, fplSocketHandle *socket);
+/**
+* @brief Waits until any of the watched sockets gets ready or the timeout has been reached.
+* @param poller The pointer to the @ref fplSocketPoller structure
+* @param events The target array of @ref fplSocketEvent
+* @param maxEventCount The maximum number of events
+* @param timeout The number of milliseconds to wait. When this is set to @ref FPL_TIMEOUT_INFINITE it will wait infinitly, when zero it will not wait at all.
+* @return Returns the number of events written.
+* @note Readiness is level-triggered, a socket is reported again until it is drained.
+* @see @ref section_category_network_poller
+*/
+fpl_platform_api size_t fplSocketPollerWait(fplSocketPoller *poller, fplSocketEvent *events, const size_t maxEventCount, const fplTimeoutValue timeout);
+/**
+* @brief Waits for ready sockets like @ref fplSocketPollerWait() and pushes them as @ref fplEventType_Socket into the internal event queue.
+* @param poller The pointer to the @ref fplSocketPoller structure
+* @param timeout The number of milliseconds to wait. When this is set to @ref FPL_TIMEOUT_INFINITE it will wait infinitly, when zero it will not wait at all.
+* @return Returns the number of pushed events.
+* @note Requires the window system, use @ref fplPollEvent() to retrieve the events.
+* @see @ref section_category_network_poller
+*/
+fpl_common_api size_t fplSocketPollerPushEvents(fplSocketPoller *poller, const fplTimeoutValue timeout);
+
+/** @} */
+
 // ----------------------------------------------------------------------------
 /**
 * @defgroup Strings String functions
@@ -4946,6 +5464,208 @@ fpl_platform_api bool fplListDirNext(fplFileEntry *entry);
 */
 fpl_platform_api void fplListDirEnd(fplFileEntry *entry);
 
+//! Maximum number of threads used for walking through directories
+#define FPL_MAX_WALK_DIRECTORY_THREAD_COUNT 16
+
+//! An enumeration of directory walk flags
+typedef enum fplWalkDirectoryFlags {
+	//! Walks the first level only
+	fplWalkDirectoryFlags_None = 0,
+	//! Walks into all sub-directories
+	fplWalkDirectoryFlags_Recursive = 1 << 0,
+	//! Do not report any files
+	fplWalkDirectoryFlags_SkipFiles = 1 << 1,
+	//! Do not report any directories (Recursion is not affected)
+	fplWalkDirectoryFlags_SkipDirectories = 1 << 2,
+	//! Ignore hidden files and directories
+	fplWalkDirectoryFlags_SkipHidden = 1 << 3,
+	//! Fill out the size of files, even when this requires a additional stat call
+	fplWalkDirectoryFlags_QuerySize = 1 << 4,
+} fplWalkDirectoryFlags;
+//! fplWalkDirectoryFlags operator overloads for C++
+FPL_ENUM_AS_FLAGS_OPERATORS(fplWalkDirectoryFlags);
+
+//! A structure containing the informations for a file or directory found by @ref fplWalkDirectory()
+typedef struct fplWalkDirectoryEntry {
+	//! Full path (Only valid inside the callback)
+	const char *fullPath;
+	//! Name, pointing into the full path
+	const char *name;
+	//! Entry type
+	fplFileEntryType type;
+	//! Attributes
+	fplFileAttributeFlags attributes;
+	//! Size (Zero when not a file or not queried)
+	size_t size;
+	//! Depth, starting at one for the entries in the root directory
+	uint32_t depth;
+} fplWalkDirectoryEntry;
+
+/**
+* @brief A callback for processing a entry found by @ref fplWalkDirectory()
+* @param entry The pointer to the @ref fplWalkDirectoryEntry structure
+* @param userData The user data pointer
+* @return Returns true to continue walking, false to stop.
+* @note This callback is called from multiple threads at the same time!
+*/
+typedef bool (fpl_walk_directory_callback)(const fplWalkDirectoryEntry *entry, void *userData);
+
+//! A structure containing the settings for @ref fplWalkDirectory()
+typedef struct fplWalkDirectorySettings {
+	//! The callback for each found entry
+	fpl_walk_directory_callback *callback;
+	//! The user data passed to the callback
+	void *userData;
+	//! The filter wildcard applied to the entry names (If empty or null it will not filter anything at all)
+	const char *filter;
+	//! The @ref fplWalkDirectoryFlags
+	fplWalkDirectoryFlags flags;
+	//! Maximum depth of reported entries (Zero for no limit)
+	uint32_t maxDepth;
+	//! Number of threads walking through the directories (Zero for the number of processor cores)
+	uint32_t threadCount;
+} fplWalkDirectorySettings;
+
+/**
+* @brief Resets the given directory walk settings to default values (Recursive, no filter, one thread per core).
+* @param settings The pointer to the @ref fplWalkDirectorySettings structure
+*/
+fpl_common_api void fplSetDefaultWalkDirectorySettings(fplWalkDirectorySettings *settings);
+/**
+* @brief Walks through all files / directories in the given directory and reports them to a callback.
+* @param path The full path to the root directory
+* @param settings The pointer to the @ref fplWalkDirectorySettings structure
+* @param outEntryCount The optional pointer to the number of reported entries
+* @return Returns true when the root directory was walked through, false otherwise.
+* @note Sub-directories are walked by multiple threads, so the order of the entries is not defined.
+* @note Symbolic links to directories are reported, but never walked into.
+* @see @ref section_category_io_paths_walking
+*/
+fpl_common_api bool fplWalkDirectory(const char *path, const fplWalkDirectorySettings *settings, size_t *outEntryCount);
+
+//! Default number of milliseconds a change must be quiet, before it is reported by a @ref fplFileWatcher
+#define FPL_DEFAULT_FILE_WATCH_DEBOUNCE_TIME 50
+
+//! An enumeration of file watch flags
+typedef enum fplFileWatchFlags {
+	//! Watches a single file or the first level of a directory
+	fplFileWatchFlags_None = 0,
+	//! Watches all sub-directories as well
+	fplFileWatchFlags_Recursive = 1 << 0,
+} fplFileWatchFlags;
+//! fplFileWatchFlags operator overloads for C++
+FPL_ENUM_AS_FLAGS_OPERATORS(fplFileWatchFlags);
+
+//! An enumeration of file watch event types (Created, Modified, Deleted)
+typedef enum fplFileWatchEventType {
+	//! No change
+	fplFileWatchEventType_None = 0,
+	//! File or directory was created or moved into the watched path
+	fplFileWatchEventType_Created,
+	//! File was modified
+	fplFileWatchEventType_Modified,
+	//! File or directory was deleted or moved out of the watched path
+	fplFileWatchEventType_Deleted,
+} fplFileWatchEventType;
+
+//! Forward declare file watcher
+typedef struct fplFileWatcher fplFileWatcher;
+
+//! A structure containing a single change, reported by a @ref fplFileWatcher
+typedef struct fplFileWatchEvent {
+	//! The internal memory block
+	fplMemoryBlock internalMemory;
+	//! The file watcher
+	fplFileWatcher *watcher;
+	//! The user data of the watch, see @ref fplFileWatcherAdd()
+	void *userData;
+	//! Full path (Do not release this memory, its automatically released after the event is processed)
+	const char *path;
+	//! Event type
+	fplFileWatchEventType type;
+} fplFileWatchEvent;
+
+/**
+* @brief A callback for processing a change reported by a @ref fplFileWatcher
+* @param event The pointer to the @ref fplFileWatchEvent structure
+* @param userData The user data pointer from the @ref fplFileWatcherSettings
+*/
+typedef void (fpl_file_watch_callback)(const fplFileWatchEvent *event, void *userData);
+
+//! A structure containing the settings for a @ref fplFileWatcher
+typedef struct fplFileWatcherSettings {
+	//! The callback for each change (When null the changes are pushed into the internal event queue)
+	fpl_file_watch_callback *callback;
+	//! The user data passed to the callback
+	void *userData;
+	//! Number of milliseconds a change must be quiet, before it is reported
+	uint32_t debounceTime;
+} fplFileWatcherSettings;
+
+//! A union containing the internal file watcher handle for any platform
+typedef union fplInternalFileWatcherHandle {
+#if defined(FPL_PLATFORM_LINUX)
+	//! Linux inotify handle
+	int linuxInotifyHandle;
+#endif
+	//! Dummy field
+	int dummy;
+} fplInternalFileWatcherHandle;
+
+//! A structure containing the file watcher state
+typedef struct fplFileWatcher {
+	//! Internal handle
+	fplInternalFileWatcherHandle internalHandle;
+	//! Settings
+	fplFileWatcherSettings settings;
+	//! Internal state (Watches, directories and pending changes)
+	void *internalState;
+	//! Is valid
+	fpl_b32 isValid;
+} fplFileWatcher;
+
+/**
+* @brief Resets the given file watcher settings to default values (No callback, default debounce time).
+* @param settings The pointer to the @ref fplFileWatcherSettings structure
+*/
+fpl_common_api void fplSetDefaultFileWatcherSettings(fplFileWatcherSettings *settings);
+/**
+* @brief Creates a file watcher without any watches.
+* @param settings The pointer to the @ref fplFileWatcherSettings structure (Optional)
+* @param outWatcher The pointer to the @ref fplFileWatcher structure
+* @return Returns true when the file watcher was created, false otherwise.
+* @see @ref section_category_io_paths_watching
+*/
+fpl_common_api bool fplFileWatcherCreate(const fplFileWatcherSettings *settings, fplFileWatcher *outWatcher);
+/**
+* @brief Releases all watches and pending changes of the given file watcher.
+* @param watcher The pointer to the @ref fplFileWatcher structure
+* @see @ref section_category_io_paths_watching
+*/
+fpl_common_api void fplFileWatcherDestroy(fplFileWatcher *watcher);
+/**
+* @brief Starts watching the given file or directory for changes.
+* @param watcher The pointer to the @ref fplFileWatcher structure
+* @param path The full path to a existing file or directory
+* @param flags The @ref fplFileWatchFlags
+* @param userData The user data pointer passed to each @ref fplFileWatchEvent of this watch
+* @return Returns true when the watch was added, false otherwise.
+* @note A file is watched by its parent directory, so replacing the file by renaming is detected as well.
+* @note A bare file name is watched in the current directory and reported as "./name".
+* @see @ref section_category_io_paths_watching
+*/
+fpl_common_api bool fplFileWatcherAdd(fplFileWatcher *watcher, const char *path, const fplFileWatchFlags flags, void *userData);
+/**
+* @brief Reads all changes from the OS and reports the changes, which are quiet for the debounce time.
+* @param watcher The pointer to the @ref fplFileWatcher structure
+* @param timeout The number of milliseconds to wait for changes. When this is set to @ref FPL_TIMEOUT_INFINITE it will wait until at least one change is reported, when zero it will not wait at all.
+* @return Returns the number of reported changes.
+* @note Changes are passed to the callback or pushed as @ref fplEventType_FileWatch into the internal event queue, when no callback is set.
+* @note When nothing has changed, this is a single non-blocking system call.
+* @see @ref section_category_io_paths_watching
+*/
+fpl_common_api size_t fplFileWatcherUpdate(fplFileWatcher *watcher, const fplTimeoutValue timeout);
+
 /** @} */
 
 // ----------------------------------------------------------------------------
@@ -5018,6 +5738,118 @@ fpl_common_api char *fplPathCombine(char *destPath, const size_t maxDestPathLen,
 
 /** @} */
 
+// ----------------------------------------------------------------------------
+/**
+* @defgroup Hashing Hashing functions
+* @brief This category contains functions for computing non-cryptographic hashes from memory buffers or files
+* @{
+*/
+// ----------------------------------------------------------------------------
+
+//! Defines the size in bytes of each block, which is read from a file while computing its hash
+#define FPL_HASH_FILE_BLOCK_SIZE (1024 * 1024)
+
+//! An enumeration of hash types
+typedef enum fplHashType {
+	//! No or unknown hash type
+	fplHashType_None = 0,
+	//! 32-bit CRC with the Castagnoli polynomial (CRC-32C), accelerated by SSE 4.2 when available
+	fplHashType_CRC32C,
+	//! 64-bit xxHash (XXH64)
+	fplHashType_XXH64,
+	//! 128-bit MurmurHash3 (x64 variant)
+	fplHashType_Murmur3_128,
+} fplHashType;
+
+//! Defines the first @ref fplHashType value
+#define FPL_FIRST_HASHTYPE fplHashType_None
+//! Defines the last @ref fplHashType value
+#define FPL_LAST_HASHTYPE fplHashType_Murmur3_128
+
+//! A union containing a computed hash value, unused bytes are always zero
+typedef union fplHashValue {
+	//! The 32-bit value for @ref fplHashType_CRC32C
+	uint32_t u32;
+	//! The 64-bit value for @ref fplHashType_XXH64
+	uint64_t u64;
+	//! The 128-bit value for @ref fplHashType_Murmur3_128, the first 64-bit part first
+	uint64_t u128[2];
+	//! The raw bytes
+	uint8_t bytes[16];
+} fplHashValue;
+
+//! A structure containing the state for computing a hash from multiple chunks of memory
+typedef struct fplHashState {
+	//! The unprocessed input bytes
+	uint8_t buffer[32];
+	//! The internal accumulators
+	uint64_t acc[4];
+	//! The total number of bytes passed in
+	uint64_t totalLength;
+	//! The seed
+	uint64_t seed;
+	//! The number of unprocessed bytes in the buffer
+	uint32_t bufferLength;
+	//! The @ref fplHashType
+	fplHashType type;
+	//! Is the hash computed with special CPU instructions. Can be cleared after @ref fplHashBegin() to force the portable implementation, for example to verify the results
+	fpl_b32 isAccelerated;
+} fplHashState;
+
+/**
+* @brief Starts computing a hash from multiple chunks of memory.
+* @param state The target @ref fplHashState structure
+* @param type The @ref fplHashType
+* @param seed The seed, for @ref fplHashType_CRC32C this is the CRC of the previous data or zero
+* @return Returns true when the hash type is supported, false otherwise.
+* @see @ref section_category_io_hashing_streaming
+*/
+fpl_common_api bool fplHashBegin(fplHashState *state, const fplHashType type, const uint64_t seed);
+/**
+* @brief Feeds the next chunk of memory into the hash.
+* @param state The @ref fplHashState structure
+* @param data The pointer to the data
+* @param size The size of the data in bytes
+* @see @ref section_category_io_hashing_streaming
+*/
+fpl_common_api void fplHashUpdate(fplHashState *state, const void *data, const size_t size);
+/**
+* @brief Finishes the hash and writes the result into the output value.
+* @param state The @ref fplHashState structure
+* @param outValue The target @ref fplHashValue
+* @return Returns true when the hash was computed, false otherwise.
+* @see @ref section_category_io_hashing_streaming
+*/
+fpl_common_api bool fplHashEnd(fplHashState *state, fplHashValue *outValue);
+/**
+* @brief Computes the hash for the given memory buffer.
+* @param type The @ref fplHashType
+* @param data The pointer to the data
+* @param size The size of the data in bytes
+* @param outValue The target @ref fplHashValue
+* @return Returns true when the hash was computed, false otherwise.
+* @see @ref section_category_io_hashing_buffers
+*/
+fpl_common_api bool fplComputeHash(const fplHashType type, const void *data, const size_t size, fplHashValue *outValue);
+/**
+* @brief Computes the hash for the entire content of the given file.
+* @param type The @ref fplHashType
+* @param filePath The path to the file
+* @param outValue The target @ref fplHashValue
+* @return Returns true when the file was read entirely and the hash was computed, false otherwise.
+* @note The file is read in blocks of @ref FPL_HASH_FILE_BLOCK_SIZE bytes.
+* @see @ref section_category_io_hashing_files
+*/
+fpl_common_api bool fplComputeFileHash(const fplHashType type, const char *filePath, fplHashValue *outValue);
+/**
+* @brief Gets the string representation of the given hash type.
+* @param type The @ref fplHashType
+* @return Returns a string for the given hash type
+*/
+fpl_common_api const char *fplGetHashTypeString(const fplHashType type);
+
+/** @} */
+
 #if defined(FPL__ENABLE_WINDOW)
 // ----------------------------------------------------------------------------
 /**
@@ -5377,6 +6209,10 @@ typedef struct fplMouseEvent {
 	int32_t mouseX;
 	//! Mouse Y-Position
 	int32_t mouseY;
+	//! Mouse X-Delta since the last mouse move event (Accumulated when coalescing)
+	int32_t deltaX;
+	//! Mouse Y-Delta since the last mouse move event (Accumulated when coalescing)
+	int32_t deltaY;
 	//! Mouse wheel delta
 	float wheelDelta;
 } fplMouseEvent;
@@ -5523,10 +6359,16 @@ typedef enum fplEventType {
 	fplEventType_Mouse,
 	//! Gamepad event
 	fplEventType_Gamepad,
+	//! Socket event
+	fplEventType_Socket,
+	//! File watch event
+	fplEventType_FileWatch,
 } fplEventType;
 
 //! A structure containing event data for all event types (Window, Keyboard, Mouse, etc.)
 typedef struct fplEvent {
+	//! Time in milliseconds when the event happened in the time base of @ref fplGetTimeInMillisecondsHP(). Taken from the native event time when there is one (X11 server time, Win32 message time), otherwise when the event was received
+	double timestamp;
 	//! Event type
 	fplEventType type;
 	union {
@@ -5538,6 +6380,10 @@ typedef struct fplEvent {
 		fplMouseEvent mouse;
 		//! Gamepad event data
 		fplGamepadEvent gamepad;
+		//! Socket event data
+		fplSocketEvent socket;
+		//! File watch event data
+		fplFileWatchEvent fileWatch;
 	};
 } fplEvent;
 
@@ -6238,6 +7084,8 @@ fpl_main int main(int argc, char **args);
 #define FPL__MODULE_CORE "Core"
 #define FPL__MODULE_FILES "Files"
 #define FPL__MODULE_THREADING "Threading"
+#define FPL__MODULE_SHAREDMEMORY "SharedMemory"
+#define FPL__MODULE_NETWORK "Network"
 #define FPL__MODULE_MEMORY "Memory"
 #define FPL__MODULE_WINDOW "Window"
 #define FPL__MODULE_LIBRARIES "Libraries"
@@ -6632,6 +7480,8 @@ fpl_internal void fpl__ParseVersionString(const char *versionStr, fplVersionInfo
 #	include <shlobj.h>		// SHGetFolderPath
 #	include <xinput.h>		// XInputGetState
 #	include <shellapi.h>	// HDROP
+#	include <winsock2.h>	// socket, WSAPoll
+#	include <ws2tcpip.h>	// socklen_t
 
 #	if defined(FPL_IS_CPP)
 #		define fpl__Win32IsEqualGuid(a, b) InlineIsEqualGUID(a, b)
@@ -6730,6 +7580,107 @@ fpl_internal void fpl__Win32LoadXInputApi(fpl__Win32XInputApi *xinputApi) {
 	}
 }
 
+//
+// Winsock
+//
+#define FPL__FUNC_WIN32_WSAStartup(name) int WSAAPI name(WORD wVersionRequested, LPWSADATA lpWSAData)
+typedef FPL__FUNC_WIN32_WSAStartup(fpl__win32_func_WSAStartup);
+#define FPL__FUNC_WIN32_WSACleanup(name) int WSAAPI name(void)
+typedef FPL__FUNC_WIN32_WSACleanup(fpl__win32_func_WSACleanup);
+#define FPL__FUNC_WIN32_WSAGetLastError(name) int WSAAPI name(void)
+typedef FPL__FUNC_WIN32_WSAGetLastError(fpl__win32_func_WSAGetLastError);
+#define FPL__FUNC_WIN32_WSAPoll(name) int WSAAPI name(LPWSAPOLLFD fdArray, ULONG fds, INT timeout)
+typedef FPL__FUNC_WIN32_WSAPoll(fpl__win32_func_WSAPoll);
+#define FPL__FUNC_WIN32_socket(name) SOCKET WSAAPI name(int af, int type, int protocol)
+typedef FPL__FUNC_WIN32_socket(fpl__win32_func_socket);
+#define FPL__FUNC_WIN32_closesocket(name) int WSAAPI name(SOCKET s)
+typedef FPL__FUNC_WIN32_closesocket(fpl__win32_func_closesocket);
+#define FPL__FUNC_WIN32_ioctlsocket(name) int WSAAPI name(SOCKET s, long cmd, u_long *argp)
+typedef FPL__FUNC_WIN32_ioctlsocket(fpl__win32_func_ioctlsocket);
+#define FPL__FUNC_WIN32_setsockopt(name) int WSAAPI name(SOCKET s, int level, int optname, const char *optval, int optlen)
+typedef FPL__FUNC_WIN32_setsockopt(fpl__win32_func_setsockopt);
+#define FPL__FUNC_WIN32_bind(name) int WSAAPI name(SOCKET s, const struct sockaddr *addr, int addrlen)
+typedef FPL__FUNC_WIN32_bind(fpl__win32_func_bind);
+#define FPL__FUNC_WIN32_getsockname(name) int WSAAPI name(SOCKET s, struct sockaddr *addr, int *addrlen)
+typedef FPL__FUNC_WIN32_getsockname(fpl__win32_func_getsockname);
+#define FPL__FUNC_WIN32_listen(name) int WSAAPI name(SOCKET s, int backlog)
+typedef FPL__FUNC_WIN32_listen(fpl__win32_func_listen);
+#define FPL__FUNC_WIN32_accept(name) SOCKET WSAAPI name(SOCKET s, struct sockaddr *addr, int *addrlen)
+typedef FPL__FUNC_WIN32_accept(fpl__win32_func_accept);
+#define FPL__FUNC_WIN32_connect(name) int WSAAPI name(SOCKET s, const struct sockaddr *addr, int addrlen)
+typedef FPL__FUNC_WIN32_connect(fpl__win32_func_connect);
+#define FPL__FUNC_WIN32_send(name) int WSAAPI name(SOCKET s, const char *buf, int len, int flags)
+typedef FPL__FUNC_WIN32_send(fpl__win32_func_send);
+#define FPL__FUNC_WIN32_recv(name) int WSAAPI name(SOCKET s, char *buf, int len, int flags)
+typedef FPL__FUNC_WIN32_recv(fpl__win32_func_recv);
+#define FPL__FUNC_WIN32_sendto(name) int WSAAPI name(SOCKET s, const char *buf, int len, int flags, const struct sockaddr *to, int tolen)
+typedef FPL__FUNC_WIN32_sendto(fpl__win32_func_sendto);
+#define FPL__FUNC_WIN32_recvfrom(name) int WSAAPI name(SOCKET s, char *buf, int len, int flags, struct sockaddr *from, int *fromlen)
+typedef FPL__FUNC_WIN32_recvfrom(fpl__win32_func_recvfrom);
+
+typedef struct fpl__Win32WinsockApi {
+	HMODULE ws2Library;
+	fpl__win32_func_WSAStartup *WSAStartup;
+	fpl__win32_func_WSACleanup *WSACleanup;
+	fpl__win32_func_WSAGetLastError *WSAGetLastError;
+	fpl__win32_func_WSAPoll *WSAPoll;
+	fpl__win32_func_socket *socket;
+	fpl__win32_func_closesocket *closesocket;
+	fpl__win32_func_ioctlsocket *ioctlsocket;
+	fpl__win32_func_setsockopt *setsockopt;
+	fpl__win32_func_bind *bind;
+	fpl__win32_func_getsockname *getsockname;
+	fpl__win32_func_listen *listen;
+	fpl__win32_func_accept *accept;
+	fpl__win32_func_connect *connect;
+	fpl__win32_func_send *send;
+	fpl__win32_func_recv *recv;
+	fpl__win32_func_sendto *sendto;
+	fpl__win32_func_recvfrom *recvfrom;
+} fpl__Win32WinsockApi;
+
+fpl_internal void fpl__Win32UnloadWinsockApi(fpl__Win32WinsockApi *winsockApi) {
+	fplAssert(winsockApi != fpl_null);
+	if (winsockApi->ws2Library != fpl_null) {
+		FreeLibrary(winsockApi->ws2Library);
+	}
+	fplClearStruct(winsockApi);
+}
+
+fpl_internal bool fpl__Win32LoadWinsockApi(fpl__Win32WinsockApi *winsockApi) {
+	fplAssert(winsockApi != fpl_null);
+	bool result = false;
+	fplClearStruct(winsockApi);
+	const char *libName = "ws2_32.dll";
+	do {
+		HMODULE libHandle = fpl_null;
+		FPL__WIN32_LOAD_LIBRARY(FPL__MODULE_NETWORK, libHandle, libName);
+		winsockApi->ws2Library = libHandle;
+		FPL__WIN32_GET_FUNCTION_ADDRESS(FPL__MODULE_NETWORK, libHandle, libName, winsockApi, fpl__win32_func_WSAStartup, WSAStartup);
+		FPL__WIN32_GET_FUNCTION_ADDRESS(FPL__MODULE_NETWORK, libHandle, libName, winsockApi, fpl__win32_func_WSACleanup, WSACleanup);
+		FPL__WIN32_GET_FUNCTION_ADDRESS(FPL__MODULE_NETWORK, libHandle, libName, winsockApi, fpl__win32_func_WSAGetLastError, WSAGetLastError);
+		FPL__WIN32_GET_FUNCTION_ADDRESS(FPL__MODULE_NETWORK, libHandle, libName, winsockApi, fpl__win32_func_WSAPoll, WSAPoll);
+		FPL__WIN32_GET_FUNCTION_ADDRESS(FPL__MODULE_NETWORK, libHandle, libName, winsockApi, fpl__win32_func_socket, socket);
+		FPL__WIN32_GET_FUNCTION_ADDRESS(FPL__MODULE_NETWORK, libHandle, libName, winsockApi, fpl__win32_func_closesocket, closesocket);
+		FPL__WIN32_GET_FUNCTION_ADDRESS(FPL__MODULE_NETWORK, libHandle, libName, winsockApi, fpl__win32_func_ioctlsocket, ioctlsocket);
+		FPL__WIN32_GET_FUNCTION_ADDRESS(FPL__MODULE_NETWORK, libHandle, libName, winsockApi, fpl__win32_func_setsockopt, setsockopt);
+		FPL__WIN32_GET_FUNCTION_ADDRESS(FPL__MODULE_NETWORK, libHandle, libName, winsockApi, fpl__win32_func_bind, bind);
+		FPL__WIN32_GET_FUNCTION_ADDRESS(FPL__MODULE_NETWORK, libHandle, libName, winsockApi, fpl__win32_func_getsockname, getsockname);
+		FPL__WIN32_GET_FUNCTION_ADDRESS(FPL__MODULE_NETWORK, libHandle, libName, winsockApi, fpl__win32_func_listen, listen);
+		FPL__WIN32_GET_FUNCTION_ADDRESS(FPL__MODULE_NETWORK, libHandle, libName, winsockApi, fpl__win32_func_accept, accept);
+		FPL__WIN32_GET_FUNCTION_ADDRESS(FPL__MODULE_NETWORK, libHandle, libName, winsockApi, fpl__win32_func_connect, connect);
+		FPL__WIN32_GET_FUNCTION_ADDRESS(FPL__MODULE_NETWORK, libHandle, libName, winsockApi, fpl__win32_func_send, send);
+		FPL__WIN32_GET_FUNCTION_ADDRESS(FPL__MODULE_NETWORK, libHandle, libName, winsockApi, fpl__win32_func_recv, recv);
+		FPL__WIN32_GET_FUNCTION_ADDRESS(FPL__MODULE_NETWORK, libHandle, libName, winsockApi, fpl__win32_func_sendto, sendto);
+		FPL__WIN32_GET_FUNCTION_ADDRESS(FPL__MODULE_NETWORK, libHandle, libName, winsockApi, fpl__win32_func_recvfrom, recvfrom);
+		result = true;
+	} while (0);
+	if (!result) {
+		fpl__Win32UnloadWinsockApi(winsockApi);
+	}
+	return(result);
+}
+
 //
 // WINAPI functions
 //
@@ -7185,6 +8136,11 @@ typedef struct fpl__Win32ConsoleState {
 	fpl_b32 isAllocated;
 } fpl__Win32ConsoleState;
 
+typedef struct fpl__Win32NetworkState {
+	fpl__Win32WinsockApi winsockApi;
+	fpl_b32 isStarted;
+} fpl__Win32NetworkState;
+
 typedef struct fpl__Win32InitState {
 	HINSTANCE appInstance;
 	LARGE_INTEGER performanceFrequency;
@@ -7192,6 +8148,7 @@ typedef struct fpl__Win32InitState {
 
 typedef struct fpl__Win32AppState {
 	fpl__Win32XInputState xinput;
+	fpl__Win32NetworkState network;
 	fpl__Win32Api winApi;
 	fpl__Win32ConsoleState console;
 } fpl__Win32AppState;
@@ -7239,6 +8196,11 @@ typedef struct fpl__Win32WindowState {
 #	include <unistd.h> // read, write, close, access, rmdir, getpid, sysconf, geteuid
 #	include <ctype.h> // isspace
 #	include <pwd.h> // getpwuid
+#	include <poll.h> // poll
+#	include <sys/socket.h> // socket, bind, sendto, recvfrom
+#	include <sys/uio.h> // iovec
+#	include <netinet/in.h> // sockaddr_in, htons
+#	include <netinet/tcp.h> // TCP_NODELAY
 
 // @TODO(final): Detect the case of (Older POSIX versions where st_atim != st_atime)
 #if !defined(FPL_PLATFORM_ANDROID)
@@ -7394,7 +8356,8 @@ fpl_internal bool fpl__PThreadLoadApi(fpl__PThreadApi *pthreadApi) {
 			FPL__POSIX_GET_FUNCTION_ADDRESS(FPL__MODULE_PTHREAD, libHandle, libName, pthreadApi, fpl__pthread_func_pthread_kill, pthread_kill);
 			FPL__POSIX_GET_FUNCTION_ADDRESS(FPL__MODULE_PTHREAD, libHandle, libName, pthreadApi, fpl__pthread_func_pthread_join, pthread_join);
 			FPL__POSIX_GET_FUNCTION_ADDRESS(FPL__MODULE_PTHREAD, libHandle, libName, pthreadApi, fpl__pthread_func_pthread_exit, pthread_exit);
-			FPL__POSIX_GET_FUNCTION_ADDRESS(FPL__MODULE_PTHREAD, libHandle, libName, pthreadApi, fpl__pthread_func_pthread_yield, pthread_yield);
+			// @NOTE(final): pthread_yield was removed from newer glibc versions, sched_yield is used as fallback
+			FPL__POSIX_GET_FUNCTION_ADDRESS_OPTIONAL(FPL__MODULE_PTHREAD, libHandle, libName, pthreadApi, fpl__pthread_func_pthread_yield, pthread_yield);
 			FPL__POSIX_GET_FUNCTION_ADDRESS_OPTIONAL(FPL__MODULE_PTHREAD, libHandle, libName, pthreadApi, fpl__pthread_func_pthread_timedjoin_np, pthread_timedjoin_np);
 
 			// pthread_mutex_t
@@ -7790,6 +8753,8 @@ typedef struct fpl__X11WindowState {
 	Atom xdndSelection;
 	Atom xdndTypeList;
 	Atom textUriList;
+	// Cached keyboard state, same bit layout as XQueryKeymap
+	char keyStates[32];
 } fpl__X11WindowState;
 
 typedef struct fpl__X11PreWindowSetupResult {
@@ -7853,6 +8818,11 @@ typedef struct fpl__PlatformWindowState {
 	fplKey keyMap[256];
 	fplButtonState keyStates[256];
 	fplButtonState mouseStates[5];
+	fplWindowPosition lastMousePosition;
+	double nativeEventTime;
+	double nativeTimeOffset;
+	fpl_b32 hasMousePosition;
+	fpl_b32 hasNativeTimeOffset;
 	fpl_b32 isRunning;
 
 #if defined(FPL_PLATFORM_WINDOWS)
@@ -7969,9 +8939,12 @@ fpl_internal void fpl__ClearInternalEvents() {
 	eventQueue->pollIndex = 0;
 	for (size_t eventIndex = 0; eventIndex < eventCount; ++eventIndex) {
 		fplEvent *ev = &eventQueue->events[eventIndex];
-		if (ev->window.dropFiles.internalMemory.base != fpl_null) {
+		if (ev->type == fplEventType_Window && ev->window.type == fplWindowEventType_DroppedFiles && ev->window.dropFiles.internalMemory.base != fpl_null) {
 			fpl__ReleaseDynamicMemory(ev->window.dropFiles.internalMemory.base);
 			fplClearStruct(&ev->window.dropFiles.internalMemory);
+		} else if (ev->type == fplEventType_FileWatch && ev->fileWatch.internalMemory.base != fpl_null) {
+			fpl__ReleaseDynamicMemory(ev->fileWatch.internalMemory.base);
+			fplClearStruct(&ev->fileWatch.internalMemory);
 		}
 	}
 	eventQueue->pushCount = 0;
@@ -7995,7 +8968,34 @@ fpl_internal bool fpl__PollInternalEvent(fplEvent *ev) {
 	return(result);
 }
 
-fpl_internal void fpl__PushInternalEvent(const fplEvent *event) {
+// @NOTE(final): Native event times (X11 server time, Win32 message time) are 32-bit millisecond counters with an unknown origin.
+// They are converted into the time base of fplGetTimeInMillisecondsHP(), using the smallest offset seen between both clocks - an event is never received before it happened.
+// A native time of zero means the current event has no native time.
+fpl_internal void fpl__SetNativeEventTime(fpl__PlatformWindowState *windowState, const uint32_t nativeTime) {
+	if (nativeTime == 0) {
+		windowState->nativeEventTime = 0.0;
+		return;
+	}
+	double offset = fplGetTimeInMillisecondsHP() - (double)nativeTime;
+	// The offset jumps by the full 32-bit range, when the native counter wraps around
+	if (!windowState->hasNativeTimeOffset || offset < windowState->nativeTimeOffset || (offset - windowState->nativeTimeOffset) > (double)(UINT32_MAX / 2)) {
+		windowState->nativeTimeOffset = offset;
+		windowState->hasNativeTimeOffset = true;
+	}
+	windowState->nativeEventTime = (double)nativeTime + windowState->nativeTimeOffset;
+}
+
+fpl_internal double fpl__GetEventTimestamp() {
+	fpl__PlatformAppState *appState = fpl__global__AppState;
+	fplAssert(appState != fpl_null);
+	if (appState->window.nativeEventTime > 0.0) {
+		return(appState->window.nativeEventTime);
+	}
+	// Synthetic events or events without a native time
+	return(fplGetTimeInMillisecondsHP());
+}
+
+fpl_internal bool fpl__PushInternalEvent(const fplEvent *event) {
 	fpl__PlatformAppState *appState = fpl__global__AppState;
 	fplAssert(appState != fpl_null);
 	fpl__EventQueue *eventQueue = &appState->window.eventQueue;
@@ -8003,7 +9003,29 @@ fpl_internal void fpl__PushInternalEvent(const fplEvent *event) {
 	if (eventQueue->pushCount < FPL__MAX_EVENT_COUNT) {
 		uint32_t eventIndex = eventQueue->pushCount++;
 		eventQueue->events[eventIndex] = *event;
+		if (event->timestamp == 0.0) {
+			eventQueue->events[eventIndex].timestamp = fpl__GetEventTimestamp();
+		}
+		return(true);
+	}
+	return(false);
+}
+
+// @NOTE(final): Returns the last pushed event, when it was not polled yet - used for coalescing
+fpl_internal fplEvent *fpl__GetCoalescableInternalEvent(const fplEventType type) {
+	fpl__PlatformAppState *appState = fpl__global__AppState;
+	fplAssert(appState != fpl_null);
+	if (!appState->currentSettings.window.isEventCoalescing) {
+		return fpl_null;
 	}
+	fpl__EventQueue *eventQueue = &appState->window.eventQueue;
+	if (eventQueue->pushCount > eventQueue->pollIndex) {
+		fplEvent *lastEvent = &eventQueue->events[eventQueue->pushCount - 1];
+		if (lastEvent->type == type) {
+			return(lastEvent);
+		}
+	}
+	return fpl_null;
 }
 
 fpl_internal void fpl__PushWindowStateEvent(const fplWindowEventType windowType) {
@@ -8014,6 +9036,14 @@ fpl_internal void fpl__PushWindowStateEvent(const fplWindowEventType windowType)
 }
 
 fpl_internal void fpl__PushWindowSizeEvent(const fplWindowEventType windowType, uint32_t w, uint32_t h) {
+	// Only the last size of consecutive resizes are kept, when coalescing
+	fplEvent *lastEvent = fpl__GetCoalescableInternalEvent(fplEventType_Window);
+	if (lastEvent != fpl_null && lastEvent->window.type == windowType) {
+		lastEvent->timestamp = fpl__GetEventTimestamp();
+		lastEvent->window.size.width = w;
+		lastEvent->window.size.height = h;
+		return;
+	}
 	fplEvent newEvent = fplZeroInit;
 	newEvent.type = fplEventType_Window;
 	newEvent.window.type = windowType;
@@ -8083,13 +9113,25 @@ fpl_internal void fpl__PushMouseWheelEvent(const int32_t x, const int32_t y, con
 	fpl__PushInternalEvent(&newEvent);
 }
 
-fpl_internal void fpl__PushMouseMoveEvent(const int32_t x, const int32_t y) {
+fpl_internal void fpl__PushMouseMoveEvent(const int32_t x, const int32_t y, const int32_t deltaX, const int32_t deltaY) {
+	// Consecutive mouse moves are merged into one event with the final position and the accumulated delta, when coalescing
+	fplEvent *lastEvent = fpl__GetCoalescableInternalEvent(fplEventType_Mouse);
+	if (lastEvent != fpl_null && lastEvent->mouse.type == fplMouseEventType_Move) {
+		lastEvent->timestamp = fpl__GetEventTimestamp();
+		lastEvent->mouse.mouseX = x;
+		lastEvent->mouse.mouseY = y;
+		lastEvent->mouse.deltaX += deltaX;
+		lastEvent->mouse.deltaY += deltaY;
+		return;
+	}
 	fplEvent newEvent = fplZeroInit;
 	newEvent.type = fplEventType_Mouse;
 	newEvent.mouse.type = fplMouseEventType_Move;
 	newEvent.mouse.mouseButton = fplMouseButtonType_None;
 	newEvent.mouse.mouseX = x;
 	newEvent.mouse.mouseY = y;
+	newEvent.mouse.deltaX = deltaX;
+	newEvent.mouse.deltaY = deltaY;
 	fpl__PushInternalEvent(&newEvent);
 }
 
@@ -8125,7 +9167,16 @@ fpl_internal void fpl__HandleMouseButtonEvent(fpl__PlatformWindowState *windowSt
 }
 
 fpl_internal void fpl__HandleMouseMoveEvent(fpl__PlatformWindowState *windowState, const int32_t x, const int32_t y) {
-	fpl__PushMouseMoveEvent(x, y);
+	int32_t deltaX = 0;
+	int32_t deltaY = 0;
+	if (windowState->hasMousePosition) {
+		deltaX = x - windowState->lastMousePosition.left;
+		deltaY = y - windowState->lastMousePosition.top;
+	}
+	windowState->lastMousePosition.left = x;
+	windowState->lastMousePosition.top = y;
+	windowState->hasMousePosition = true;
+	fpl__PushMouseMoveEvent(x, y, deltaX, deltaY);
 }
 
 fpl_internal void fpl__HandleMouseWheelEvent(fpl__PlatformWindowState *windowState, const int32_t x, const int32_t y, const float wheelDelta) {
@@ -8756,6 +9807,9 @@ fpl_common_api void *fplMemoryAlignedAllocate(const size_t size, const size_t al
 	// Allocate empty memory to hold a size of a pointer + alignment padding + the actual data
 	size_t newSize = sizeof(void *) + (alignment << 1) + size;
 	void *basePtr = fplMemoryAllocate(newSize);
+	if (basePtr == fpl_null) {
+		return fpl_null;
+	}
 	// The resulting address starts after the stored base pointer
 	void *alignedPtr = (void *)((uint8_t *)basePtr + sizeof(void *));
 	// Move the resulting address to a aligned one when not aligned
@@ -8858,7 +9912,7 @@ fpl_common_api void fplMemoryCopy(const void *sourceMem, const size_t sourceSize
 #	elif defined(FPL_COMPILER_GCC) ||defined(FPL_COMPILER_CLANG)
 
 		// CPUID for GCC/CLANG
-fpl_internal void fpl__m_CPUID(fplCPUIDLeaf *outLeaf, const uint32_t functionId) {
+fpl_internal void fpl__GCC_CPUID(fplCPUIDLeaf *outLeaf, const uint32_t functionId) {
 	int eax = 0, ebx = 0, ecx = 0, edx = 0;
 	__cpuid_count(functionId, 0, eax, ebx, ecx, edx);
 	outLeaf->eax = eax;
@@ -8866,29 +9920,32 @@ fpl_internal void fpl__m_CPUID(fplCPUIDLeaf *outLeaf, const uint32_t functionId)
 	outLeaf->ecx = ecx;
 	outLeaf->edx = edx;
 }
+#		define fpl__m_CPUID(outLeaf, functionId) fpl__GCC_CPUID(outLeaf, functionId)
 
 		// XCR0 for GCC/CLANG
-fpl_internal uint64_t fpl__m_GetXCR0(void) {
+fpl_internal uint64_t fpl__GCC_GetXCR0(void) {
 	uint32_t eax, edx;
 	__asm(".byte 0x0F, 0x01, 0xd0" : "=a"(eax), "=d"(edx) : "c"(0));
 	return eax;
 }
+#		define fpl__m_GetXCR0() fpl__GCC_GetXCR0()
 
 		// RDTSC for non-MSVC
 #		if defined(FPL_ARCH_X86)
-fpl_force_inline uint64_t fpl__m_RDTSC(void) {
+fpl_force_inline uint64_t fpl__GCC_RDTSC(void) {
 	unsigned long long int result;
 	__asm__ volatile (".byte 0x0f, 0x31" : "=A" (result));
 	return((uint64_t)result);
 }
 #		elif defined(FPL_ARCH_X64)
-fpl_force_inline uint64_t fpl__m_RDTSC(void) {
+fpl_force_inline uint64_t fpl__GCC_RDTSC(void) {
 	unsigned hi, lo;
 	__asm__ __volatile__("rdtsc" : "=a"(lo), "=d"(hi));
 	uint64_t result = (uint64_t)(((unsigned long long)lo) | (((unsigned long long)hi) << 32));
 	return (result);
 }
 #		endif
+#		define fpl__m_RDTSC() fpl__GCC_RDTSC()
 #	endif
 
 fpl_common_api void fplCPUID(fplCPUIDLeaf *outLeaf, const uint32_t functionId) {
@@ -9215,57 +10272,1117 @@ fpl_common_api const fplThreadHandle *fplGetMainThread() {
 }
 
 //
-// Common Files
+// Common Shared Memory
 //
-#if !defined(FPL__COMMON_FILES_DEFINED)
-#define FPL__COMMON_FILES_DEFINED
+#if !defined(FPL__COMMON_SHAREDMEMORY_DEFINED)
+#define FPL__COMMON_SHAREDMEMORY_DEFINED
 
-fpl_common_api size_t fplReadFileBlock(const fplFileHandle *fileHandle, const size_t sizeToRead, void *targetBuffer, const size_t maxTargetBufferSize) {
-#if defined(FPL_CPU_64BIT)
-	return fplReadFileBlock64(fileHandle, sizeToRead, targetBuffer, maxTargetBufferSize);
-#else
-	return fplReadFileBlock32(fileHandle, (uint32_t)sizeToRead, targetBuffer, (uint32_t)maxTargetBufferSize);
-#endif
-}
+// Waits until the value at the given address differs from the expected value or the timeout has been reached.
+// Spurious wake ups are allowed, the caller always re-checks its condition.
+fpl_internal void fpl__SharedMemoryWaitU32(volatile uint32_t *address, const uint32_t expectedValue, const fplTimeoutValue timeout);
+// Wakes up all waiters on the given address, including waiters from other processes.
+fpl_internal void fpl__SharedMemoryWakeU32(volatile uint32_t *address);
 
-fpl_common_api size_t fplWriteFileBlock(const fplFileHandle *fileHandle, void *sourceBuffer, const size_t sourceSize) {
-#if defined(FPL_CPU_64BIT)
-	return fplWriteFileBlock64(fileHandle, sourceBuffer, sourceSize);
-#else
-	return fplWriteFileBlock32(fileHandle, sourceBuffer, (uint32_t)sourceSize);
-#endif
+#if !defined(FPL_PLATFORM_LINUX)
+// Portable fallback for platforms without a cross-process address wait
+fpl_internal void fpl__SharedMemoryPollWaitU32(volatile uint32_t *address, const uint32_t expectedValue, const fplTimeoutValue timeout) {
+	double startTime = fplGetTimeInMillisecondsHP();
+	uint32_t iteration = 0;
+	while (fplAtomicLoadU32(address) == expectedValue) {
+		if (timeout != FPL_TIMEOUT_INFINITE && (fplGetTimeInMillisecondsHP() - startTime) >= (double)timeout) {
+			break;
+		}
+		if (iteration++ < 64) {
+			fplThreadYield();
+		} else {
+			fplThreadSleep(1);
+		}
+	}
 }
-
-fpl_common_api size_t fplSetFilePosition(const fplFileHandle *fileHandle, const intptr_t position, const fplFilePositionMode mode) {
-#if defined(FPL_CPU_64BIT)
-	return fplSetFilePosition64(fileHandle, position, mode);
-#else
-	return fplSetFilePosition32(fileHandle, (int32_t)position, mode);
 #endif
+
+#define FPL__SHARED_RING_MAGIC 0x474E5246 // FRNG
+#define FPL__SHARED_RING_VERSION 1
+
+// The ring header is stored at the start of the shared memory region, followed by the data section.
+// Read- and write positions are monotonic byte counters, the data offset is (position & (capacity - 1)).
+// Each side has its own cache line, so the producer and the consumer never write into the same line.
+typedef struct fpl__SharedRingHeader {
+	volatile uint32_t magic;
+	uint32_t version;
+	uint64_t capacity;
+	uint8_t padding0[FPL__ARBITARY_PADDING - 16];
+	// Written by the producer
+	volatile uint64_t writePosition;
+	volatile uint32_t dataSequence;
+	volatile uint32_t writerWaiting;
+	uint8_t padding1[FPL__ARBITARY_PADDING - 16];
+	// Written by the consumer
+	volatile uint64_t readPosition;
+	volatile uint32_t spaceSequence;
+	volatile uint32_t readerWaiting;
+	uint8_t padding2[FPL__ARBITARY_PADDING - 16];
+} fpl__SharedRingHeader;
+
+fpl_internal bool fpl__SharedRingGetRemainingTimeout(const double startTime, const fplTimeoutValue timeout, fplTimeoutValue *outRemaining) {
+	if (timeout == FPL_TIMEOUT_INFINITE) {
+		*outRemaining = FPL_TIMEOUT_INFINITE;
+		return true;
+	}
+	double elapsed = fplGetTimeInMillisecondsHP() - startTime;
+	if (elapsed >= (double)timeout) {
+		return false;
+	}
+	*outRemaining = fplMax((fplTimeoutValue)((double)timeout - elapsed), 1);
+	return true;
 }
 
-fpl_common_api size_t fplGetFilePosition(const fplFileHandle *fileHandle) {
-#if defined(FPL_CPU_64BIT)
-	return fplGetFilePosition64(fileHandle);
-#else
-	return fplGetFilePosition32(fileHandle);
-#endif
+// Sleeps until the position of the other side has changed.
+// The waiting flag is set before the position is checked again and the other side publishes its position before it checks the flag,
+// so a wake up cannot get lost. The sequence number protects against a publish between our last check and the actual wait.
+fpl_internal void fpl__SharedRingWaitForPosition(volatile uint64_t *position, const uint64_t lastPosition, volatile uint32_t *sequence, volatile uint32_t *waitingFlag, const fplTimeoutValue timeout) {
+	uint32_t lastSequence = fplAtomicLoadU32(sequence);
+	fplAtomicStoreU32(waitingFlag, 1);
+	if (fplAtomicLoadU64(position) == lastPosition) {
+		fpl__SharedMemoryWaitU32(sequence, lastSequence, timeout);
+	}
+	fplAtomicStoreU32(waitingFlag, 0);
 }
 
-fpl_common_api size_t fplGetFileSizeFromPath(const char *filePath) {
-#if defined(FPL_CPU_64BIT)
-	return fplGetFileSizeFromPath64(filePath);
-#else
-	return fplGetFileSizeFromPath32(filePath);
-#endif
+fpl_internal void fpl__SharedRingPublishPosition(volatile uint64_t *position, const uint64_t newPosition, volatile uint32_t *sequence, volatile uint32_t *waitingFlag) {
+	fplAtomicStoreU64(position, newPosition);
+	fplAtomicIncrementU32(sequence);
+	if (fplAtomicLoadU32(waitingFlag)) {
+		fpl__SharedMemoryWakeU32(sequence);
+	}
 }
 
-fpl_common_api size_t fplGetFileSizeFromHandle(const fplFileHandle *fileHandle) {
+fpl_common_api bool fplSharedRingBufferCreate(const char *name, const size_t capacity, fplSharedRingBuffer *outRing) {
+	FPL__CheckArgumentNull(name, false);
+	FPL__CheckArgumentZero(capacity, false);
+	FPL__CheckArgumentNull(outRing, false);
+	if (capacity & (capacity - 1)) {
+		FPL__ERROR(FPL__MODULE_SHAREDMEMORY, "Capacity parameter '%zu' must be a power of two", capacity);
+		return false;
+	}
+	fplClearStruct(outRing);
+	if (!fplSharedMemoryCreate(name, sizeof(fpl__SharedRingHeader) + capacity, &outRing->memory)) {
+		return false;
+	}
+	fpl__SharedRingHeader *header = (fpl__SharedRingHeader *)outRing->memory.base;
+	header->version = FPL__SHARED_RING_VERSION;
+	header->capacity = (uint64_t)capacity;
+	// Magic is stored last, so other processes never see a partially initialized header
+	fplAtomicStoreU32(&header->magic, FPL__SHARED_RING_MAGIC);
+	outRing->header = header;
+	outRing->data = (uint8_t *)outRing->memory.base + sizeof(fpl__SharedRingHeader);
+	outRing->capacity = capacity;
+	outRing->isValid = true;
+	return true;
+}
+
+fpl_common_api bool fplSharedRingBufferOpen(const char *name, fplSharedRingBuffer *outRing) {
+	FPL__CheckArgumentNull(name, false);
+	FPL__CheckArgumentNull(outRing, false);
+	fplClearStruct(outRing);
+	if (!fplSharedMemoryOpen(name, &outRing->memory)) {
+		return false;
+	}
+	fpl__SharedRingHeader *header = (fpl__SharedRingHeader *)outRing->memory.base;
+	bool isValidHeader = false;
+	if (outRing->memory.size >= sizeof(fpl__SharedRingHeader) && fplAtomicLoadU32(&header->magic) == FPL__SHARED_RING_MAGIC && header->version == FPL__SHARED_RING_VERSION) {
+		uint64_t capacity = header->capacity;
+		isValidHeader = (capacity > 0) && !(capacity & (capacity - 1)) && (capacity <= (uint64_t)(outRing->memory.size - sizeof(fpl__SharedRingHeader)));
+	}
+	if (!isValidHeader) {
+		FPL__ERROR(FPL__MODULE_SHAREDMEMORY, "Shared memory '%s' does not contain a valid ring buffer", name);
+		fplSharedMemoryClose(&outRing->memory);
+		fplClearStruct(outRing);
+		return false;
+	}
+	outRing->header = header;
+	outRing->data = (uint8_t *)outRing->memory.base + sizeof(fpl__SharedRingHeader);
+	outRing->capacity = (size_t)header->capacity;
+	outRing->isValid = true;
+	return true;
+}
+
+fpl_common_api void fplSharedRingBufferClose(fplSharedRingBuffer *ring) {
+	if (ring != fpl_null && ring->isValid) {
+		fplSharedMemoryClose(&ring->memory);
+		fplClearStruct(ring);
+	}
+}
+
+fpl_common_api size_t fplSharedRingBufferGetReadableSize(fplSharedRingBuffer *ring) {
+	FPL__CheckArgumentNull(ring, 0);
+	if (!ring->isValid) {
+		return 0;
+	}
+	fpl__SharedRingHeader *header = (fpl__SharedRingHeader *)ring->header;
+	uint64_t readPosition = fplAtomicLoadU64(&header->readPosition);
+	uint64_t writePosition = fplAtomicLoadU64(&header->writePosition);
+	size_t result = (size_t)(writePosition - readPosition);
+	return(result);
+}
+
+fpl_common_api size_t fplSharedRingBufferGetWritableSize(fplSharedRingBuffer *ring) {
+	FPL__CheckArgumentNull(ring, 0);
+	if (!ring->isValid) {
+		return 0;
+	}
+	size_t result = ring->capacity - fplSharedRingBufferGetReadableSize(ring);
+	return(result);
+}
+
+fpl_common_api bool fplSharedRingBufferWrite(fplSharedRingBuffer *ring, const void *data, const size_t size, const fplTimeoutValue timeout) {
+	FPL__CheckArgumentNull(ring, false);
+	FPL__CheckArgumentNull(data, false);
+	FPL__CheckArgumentZero(size, false);
+	if (!ring->isValid) {
+		FPL__ERROR(FPL__MODULE_SHAREDMEMORY, "Ring buffer '%p' is not valid", ring);
+		return false;
+	}
+	FPL__CheckArgumentMax(size, ring->capacity, false);
+	fpl__SharedRingHeader *header = (fpl__SharedRingHeader *)ring->header;
+
+	// Only the producer changes the write position, so there is no need for an atomic load
+	uint64_t writePosition = header->writePosition;
+
+	// Wait for enough free space
+	double startTime = fplGetTimeInMillisecondsHP();
+	for (;;) {
+		uint64_t readPosition = fplAtomicLoadU64(&header->readPosition);
+		size_t freeSpace = ring->capacity - (size_t)(writePosition - readPosition);
+		if (freeSpace >= size) {
+			break;
+		}
+		fplTimeoutValue remaining;
+		if (!fpl__SharedRingGetRemainingTimeout(startTime, timeout, &remaining)) {
+			return false;
+		}
+		fpl__SharedRingWaitForPosition(&header->readPosition, readPosition, &header->spaceSequence, &header->writerWaiting, remaining);
+	}
+
+	// Copy in up to two parts, when wrapping around the end
+	size_t offset = (size_t)(writePosition & (uint64_t)(ring->capacity - 1));
+	size_t firstSize = fplMin(size, ring->capacity - offset);
+	fplMemoryCopy(data, firstSize, ring->data + offset);
+	if (firstSize < size) {
+		fplMemoryCopy((const uint8_t *)data + firstSize, size - firstSize, ring->data);
+	}
+
+	fpl__SharedRingPublishPosition(&header->writePosition, writePosition + size, &header->dataSequence, &header->readerWaiting);
+	return true;
+}
+
+fpl_common_api size_t fplSharedRingBufferRead(fplSharedRingBuffer *ring, void *dest, const size_t maxSize, const fplTimeoutValue timeout) {
+	FPL__CheckArgumentNull(ring, 0);
+	FPL__CheckArgumentNull(dest, 0);
+	FPL__CheckArgumentZero(maxSize, 0);
+	if (!ring->isValid) {
+		FPL__ERROR(FPL__MODULE_SHAREDMEMORY, "Ring buffer '%p' is not valid", ring);
+		return 0;
+	}
+	fpl__SharedRingHeader *header = (fpl__SharedRingHeader *)ring->header;
+
+	// Only the consumer changes the read position, so there is no need for an atomic load
+	uint64_t readPosition = header->readPosition;
+
+	// Wait for at least one byte
+	size_t available;
+	double startTime = fplGetTimeInMillisecondsHP();
+	for (;;) {
+		uint64_t writePosition = fplAtomicLoadU64(&header->writePosition);
+		available = (size_t)(writePosition - readPosition);
+		if (available > 0) {
+			break;
+		}
+		fplTimeoutValue remaining;
+		if (!fpl__SharedRingGetRemainingTimeout(startTime, timeout, &remaining)) {
+			return 0;
+		}
+		fpl__SharedRingWaitForPosition(&header->writePosition, writePosition, &header->dataSequence, &header->readerWaiting, remaining);
+	}
+
+	size_t result = fplMin(available, maxSize);
+	size_t offset = (size_t)(readPosition & (uint64_t)(ring->capacity - 1));
+	size_t firstSize = fplMin(result, ring->capacity - offset);
+	fplMemoryCopy(ring->data + offset, firstSize, dest);
+	if (firstSize < result) {
+		fplMemoryCopy(ring->data, result - firstSize, (uint8_t *)dest + firstSize);
+	}
+
+	fpl__SharedRingPublishPosition(&header->readPosition, readPosition + result, &header->spaceSequence, &header->writerWaiting);
+	return(result);
+}
+#endif // FPL__COMMON_SHAREDMEMORY_DEFINED
+
+//
+// Common Network
+//
+#if !defined(FPL__COMMON_NETWORK_DEFINED)
+#define FPL__COMMON_NETWORK_DEFINED
+
+fpl_common_api bool fplSocketAddressFromString(const char *ip, const uint16_t port, fplSocketAddress *outAddress) {
+	FPL__CheckArgumentNull(ip, false);
+	FPL__CheckArgumentNull(outAddress, false);
+	uint8_t parts[4];
+	const char *p = ip;
+	for (int partIndex = 0; partIndex < 4; ++partIndex) {
+		uint32_t value = 0;
+		int digitCount = 0;
+		while (*p >= '0' && *p <= '9') {
+			value = value * 10 + (uint32_t)(*p - '0');
+			++digitCount;
+			++p;
+		}
+		if (digitCount == 0 || digitCount > 3 || value > 255) {
+			return false;
+		}
+		parts[partIndex] = (uint8_t)value;
+		if (partIndex < 3) {
+			if (*p != '.') {
+				return false;
+			}
+			++p;
+		}
+	}
+	if (*p != 0) {
+		return false;
+	}
+	fplClearStruct(outAddress);
+	fplMemoryCopy(parts, sizeof(parts), outAddress->ip);
+	outAddress->port = port;
+	return true;
+}
+
+fpl_common_api char *fplSocketAddressToString(const fplSocketAddress *address, char *buffer, const size_t maxBufferLen) {
+	FPL__CheckArgumentNull(address, fpl_null);
+	FPL__CheckArgumentNull(buffer, fpl_null);
+	FPL__CheckArgumentZero(maxBufferLen, fpl_null);
+	char *result = fplFormatString(buffer, maxBufferLen, "%u.%u.%u.%u:%u", address->ip[0], address->ip[1], address->ip[2], address->ip[3], address->port);
+	return(result);
+}
+
+fpl_internal void fpl__SocketAddressToNative(const fplSocketAddress *address, struct sockaddr_in *outNative) {
+	fplClearStruct(outNative);
+	outNative->sin_family = AF_INET;
+	// Port is stored byte by byte in network order, so htons() and the socket library are not required here
+	uint8_t *portBytes = (uint8_t *)&outNative->sin_port;
+	portBytes[0] = (uint8_t)(address->port >> 8);
+	portBytes[1] = (uint8_t)(address->port & 0xFF);
+	// Bytes are already in network order
+	fplMemoryCopy(address->ip, sizeof(address->ip), &outNative->sin_addr);
+}
+
+fpl_internal void fpl__SocketAddressFromNative(const struct sockaddr_in *native, fplSocketAddress *outAddress) {
+	fplClearStruct(outAddress);
+	fplMemoryCopy(&native->sin_addr, sizeof(outAddress->ip), outAddress->ip);
+	const uint8_t *portBytes = (const uint8_t *)&native->sin_port;
+	outAddress->port = (uint16_t)((portBytes[0] << 8) | portBytes[1]);
+}
+
+fpl_internal bool fpl__IsValidSocket(const fplSocketHandle *socket, const fplSocketType requiredType) {
+	if (!socket->isValid) {
+		FPL__ERROR(FPL__MODULE_NETWORK, "Socket '%p' is not valid", socket);
+		return false;
+	}
+	if (requiredType != fplSocketType_None && socket->type != requiredType) {
+		FPL__ERROR(FPL__MODULE_NETWORK, "Socket '%p' has the wrong type '%d', expect '%d'", socket, socket->type, requiredType);
+		return false;
+	}
+	return true;
+}
+
+fpl_internal bool fpl__IsSameSocket(const fplSocketHandle *a, const fplSocketHandle *b) {
+#if defined(FPL_PLATFORM_WINDOWS)
+	bool result = a->internalHandle.win32Socket == b->internalHandle.win32Socket;
+#else
+	bool result = a->internalHandle.posixSocket == b->internalHandle.posixSocket;
+#endif
+	return(result);
+}
+
+// Allocates the poller entries and the given number of platform specific bytes for each entry
+fpl_internal bool fpl__SocketPollerInit(const uint32_t maxSocketCount, const size_t descriptorSize, fplSocketPoller *outPoller) {
+	FPL__CheckArgumentZero(maxSocketCount, false);
+	FPL__CheckArgumentMax(maxSocketCount, FPL_MAX_SOCKET_POLLER_COUNT, false);
+	fplClearStruct(outPoller);
+	size_t entriesSize = sizeof(fplSocketPollerEntry) * maxSocketCount;
+	size_t memorySize = entriesSize + descriptorSize * maxSocketCount;
+	void *memory = fpl__AllocateDynamicMemory(memorySize, 16);
+	if (memory == fpl_null) {
+		FPL__ERROR(FPL__MODULE_NETWORK, "Failed allocating poller memory of '%zu' bytes", memorySize);
+		return false;
+	}
+	fplMemoryClear(memory, memorySize);
+	outPoller->entries = (fplSocketPollerEntry *)memory;
+	if (descriptorSize > 0) {
+		outPoller->internalHandle.pollDescriptors = (uint8_t *)memory + entriesSize;
+	}
+	outPoller->capacity = maxSocketCount;
+	return true;
+}
+
+fpl_internal void fpl__SocketPollerRelease(fplSocketPoller *poller) {
+	if (poller->entries != fpl_null) {
+		fpl__ReleaseDynamicMemory(poller->entries);
+	}
+	fplClearStruct(poller);
+}
+
+// Returns the index of a new entry for the given socket or -1 when the poller is full or the socket is already added
+fpl_internal int32_t fpl__SocketPollerAddEntry(fplSocketPoller *poller, fplSocketHandle *socket, const fplSocketPollFlags flags, void *userData) {
+	int32_t freeIndex = -1;
+	for (uint32_t entryIndex = 0; entryIndex < poller->capacity; ++entryIndex) {
+		fplSocketPollerEntry *entry = poller->entries + entryIndex;
+		if (entry->isUsed) {
+			if (fpl__IsSameSocket(&entry->socket, socket)) {
+				FPL__ERROR(FPL__MODULE_NETWORK, "Socket '%p' is already added to the poller", socket);
+				return -1;
+			}
+		} else if (freeIndex == -1) {
+			freeIndex = (int32_t)entryIndex;
+		}
+	}
+	if (freeIndex == -1) {
+		FPL__ERROR(FPL__MODULE_NETWORK, "Poller is full, max '%u' sockets are allowed", poller->capacity);
+		return -1;
+	}
+	fplSocketPollerEntry *entry = poller->entries + freeIndex;
+	entry->socket = *socket;
+	entry->flags = flags;
+	entry->userData = userData;
+	entry->isUsed = true;
+	poller->count++;
+	return(freeIndex);
+}
+
+fpl_internal int32_t fpl__SocketPollerFindEntry(fplSocketPoller *poller, fplSocketHandle *socket) {
+	for (uint32_t entryIndex = 0; entryIndex < poller->capacity; ++entryIndex) {
+		fplSocketPollerEntry *entry = poller->entries + entryIndex;
+		if (entry->isUsed && fpl__IsSameSocket(&entry->socket, socket)) {
+			return (int32_t)entryIndex;
+		}
+	}
+	return -1;
+}
+
+fpl_internal void fpl__SocketPollerRemoveEntry(fplSocketPoller *poller, const int32_t entryIndex) {
+	fplAssert(entryIndex >= 0 && (uint32_t)entryIndex < poller->capacity);
+	fplClearStruct(poller->entries + entryIndex);
+	fplAssert(poller->count > 0);
+	poller->count--;
+}
+
+fpl_common_api size_t fplSocketPollerPushEvents(fplSocketPoller *poller, const fplTimeoutValue timeout) {
+	FPL__CheckArgumentNull(poller, 0);
+#if defined(FPL__ENABLE_WINDOW)
+	FPL__CheckPlatform(0);
+	fplSocketEvent socketEvents[64];
+	size_t result = fplSocketPollerWait(poller, socketEvents, fplArrayCount(socketEvents), timeout);
+	for (size_t eventIndex = 0; eventIndex < result; ++eventIndex) {
+		fplEvent newEvent = fplZeroInit;
+		newEvent.type = fplEventType_Socket;
+		newEvent.socket = socketEvents[eventIndex];
+		fpl__PushInternalEvent(&newEvent);
+	}
+	return(result);
+#else
+	(void)timeout;
+	FPL__ERROR(FPL__MODULE_NETWORK, "Socket events requires the window system, use fplSocketPollerWait() instead");
+	return 0;
+#endif
+}
+#endif // FPL__COMMON_NETWORK_DEFINED
+
+//
+// Common Files
+//
+#if !defined(FPL__COMMON_FILES_DEFINED)
+#define FPL__COMMON_FILES_DEFINED
+
+fpl_common_api size_t fplReadFileBlock(const fplFileHandle *fileHandle, const size_t sizeToRead, void *targetBuffer, const size_t maxTargetBufferSize) {
+#if defined(FPL_CPU_64BIT)
+	return fplReadFileBlock64(fileHandle, sizeToRead, targetBuffer, maxTargetBufferSize);
+#else
+	return fplReadFileBlock32(fileHandle, (uint32_t)sizeToRead, targetBuffer, (uint32_t)maxTargetBufferSize);
+#endif
+}
+
+fpl_common_api size_t fplWriteFileBlock(const fplFileHandle *fileHandle, void *sourceBuffer, const size_t sourceSize) {
+#if defined(FPL_CPU_64BIT)
+	return fplWriteFileBlock64(fileHandle, sourceBuffer, sourceSize);
+#else
+	return fplWriteFileBlock32(fileHandle, sourceBuffer, (uint32_t)sourceSize);
+#endif
+}
+
+fpl_common_api size_t fplSetFilePosition(const fplFileHandle *fileHandle, const intptr_t position, const fplFilePositionMode mode) {
+#if defined(FPL_CPU_64BIT)
+	return fplSetFilePosition64(fileHandle, position, mode);
+#else
+	return fplSetFilePosition32(fileHandle, (int32_t)position, mode);
+#endif
+}
+
+fpl_common_api size_t fplGetFilePosition(const fplFileHandle *fileHandle) {
+#if defined(FPL_CPU_64BIT)
+	return fplGetFilePosition64(fileHandle);
+#else
+	return fplGetFilePosition32(fileHandle);
+#endif
+}
+
+fpl_common_api size_t fplGetFileSizeFromPath(const char *filePath) {
+#if defined(FPL_CPU_64BIT)
+	return fplGetFileSizeFromPath64(filePath);
+#else
+	return fplGetFileSizeFromPath32(filePath);
+#endif
+}
+
+fpl_common_api size_t fplGetFileSizeFromHandle(const fplFileHandle *fileHandle) {
 #if defined(FPL_CPU_64BIT)
 	return fplGetFileSizeFromHandle64(fileHandle);
 #else
-	return fplGetFileSizeFromHandle32(fileHandle);
+	return fplGetFileSizeFromHandle32(fileHandle);
+#endif
+}
+
+typedef struct fpl__WalkDirectoryNode {
+	struct fpl__WalkDirectoryNode *next;
+	uint32_t depth;
+	uint32_t pathLength;
+	// Followed by the zero terminated path
+} fpl__WalkDirectoryNode;
+
+typedef struct fpl__WalkDirectoryState {
+	fplWalkDirectorySettings settings;
+	fplMutexHandle mutex;
+	fplConditionVariable condition;
+	fpl__WalkDirectoryNode *pending;
+	size_t activeCount;
+	size_t entryCount;
+	volatile uint32_t isStopped;
+} fpl__WalkDirectoryState;
+
+// Reads all entries from the given directory and calls fpl__WalkDirectoryReport() for each entry, implemented per platform
+fpl_internal void fpl__WalkDirectoryRead(fpl__WalkDirectoryState *state, const char *path, const uint32_t depth, size_t *entryCount);
+
+fpl_internal bool fpl__WalkDirectoryPush(fpl__WalkDirectoryState *state, const char *path, const size_t pathLength, const uint32_t depth) {
+	size_t memorySize = sizeof(fpl__WalkDirectoryNode) + pathLength + 1;
+	fpl__WalkDirectoryNode *node = (fpl__WalkDirectoryNode *)fpl__AllocateDynamicMemory(memorySize, 8);
+	if (node == fpl_null) {
+		FPL__ERROR(FPL__MODULE_FILES, "Failed allocating directory node of '%zu' bytes for path '%s'", memorySize, path);
+		return(false);
+	}
+	node->depth = depth;
+	node->pathLength = (uint32_t)pathLength;
+	char *nodePath = (char *)(node + 1);
+	fplCopyStringLen(path, pathLength, nodePath, pathLength + 1);
+	fplMutexLock(&state->mutex);
+	node->next = state->pending;
+	state->pending = node;
+	++state->activeCount;
+	fplConditionSignal(&state->condition);
+	fplMutexUnlock(&state->mutex);
+	return(true);
+}
+
+// Called by the platform reader for each entry, returns false when the walk was stopped
+fpl_internal bool fpl__WalkDirectoryReport(fpl__WalkDirectoryState *state, const char *dirPath, const size_t dirPathLength, const char *name, const fplFileEntryType type, const fplFileAttributeFlags attributes, const size_t size, const bool isLink, const uint32_t depth, size_t *entryCount) {
+	if (fplAtomicLoadU32(&state->isStopped)) {
+		return(false);
+	}
+	const fplWalkDirectorySettings *settings = &state->settings;
+	if ((settings->flags & fplWalkDirectoryFlags_SkipHidden) && (attributes & fplFileAttributeFlags_Hidden)) {
+		return(true);
+	}
+
+	char fullPath[FPL_MAX_PATH_LENGTH];
+	size_t nameLength = fplGetStringLength(name);
+	if (dirPathLength + 1 + nameLength >= fplArrayCount(fullPath)) {
+		FPL__WARNING(FPL__MODULE_FILES, "Path of '%s' in directory '%s' is too long, skip it", name, dirPath);
+		return(true);
+	}
+	fplMemoryCopy(dirPath, dirPathLength, fullPath);
+	size_t nameOffset = dirPathLength;
+	if (nameOffset > 0 && fullPath[nameOffset - 1] != FPL_PATH_SEPARATOR) {
+		fullPath[nameOffset++] = FPL_PATH_SEPARATOR;
+	}
+	fplCopyStringLen(name, nameLength, fullPath + nameOffset, fplArrayCount(fullPath) - nameOffset);
+	size_t fullPathLength = nameOffset + nameLength;
+
+	if ((type == fplFileEntryType_Directory) && !isLink && (settings->flags & fplWalkDirectoryFlags_Recursive)) {
+		if (settings->maxDepth == 0 || depth < settings->maxDepth) {
+			fpl__WalkDirectoryPush(state, fullPath, fullPathLength, depth + 1);
+		}
+	}
+
+	bool report;
+	if (type == fplFileEntryType_Directory) {
+		report = !(settings->flags & fplWalkDirectoryFlags_SkipDirectories);
+	} else {
+		report = !(settings->flags & fplWalkDirectoryFlags_SkipFiles);
+	}
+	if (report && (settings->filter != fpl_null)) {
+		report = fplIsStringMatchWildcard(name, settings->filter);
+	}
+	if (report) {
+		fplWalkDirectoryEntry entry = fplZeroInit;
+		entry.fullPath = fullPath;
+		entry.name = fullPath + nameOffset;
+		entry.type = type;
+		entry.attributes = attributes;
+		entry.size = size;
+		entry.depth = depth;
+		++*entryCount;
+		if (!settings->callback(&entry, settings->userData)) {
+			fplAtomicStoreU32(&state->isStopped, 1);
+			return(false);
+		}
+	}
+	return(true);
+}
+
+fpl_internal void fpl__WalkDirectoryWorker(fpl__WalkDirectoryState *state) {
+	size_t entryCount = 0;
+	fplMutexLock(&state->mutex);
+	for (;;) {
+		while (state->pending == fpl_null && state->activeCount > 0) {
+			fplConditionWait(&state->condition, &state->mutex, FPL_TIMEOUT_INFINITE);
+		}
+		if (state->pending == fpl_null) {
+			break;
+		}
+		if (fplAtomicLoadU32(&state->isStopped)) {
+			// Pending directories are never processed, so wake up all waiting workers
+			fplConditionBroadcast(&state->condition);
+			break;
+		}
+		fpl__WalkDirectoryNode *node = state->pending;
+		state->pending = node->next;
+		fplMutexUnlock(&state->mutex);
+
+		const char *nodePath = (const char *)(node + 1);
+		fpl__WalkDirectoryRead(state, nodePath, node->depth, &entryCount);
+		fpl__ReleaseDynamicMemory(node);
+
+		fplMutexLock(&state->mutex);
+		--state->activeCount;
+		if (state->activeCount == 0) {
+			fplConditionBroadcast(&state->condition);
+		}
+	}
+	state->entryCount += entryCount;
+	fplMutexUnlock(&state->mutex);
+}
+
+fpl_internal void fpl__WalkDirectoryThreadProc(const fplThreadHandle *thread, void *data) {
+	(void)thread;
+	fpl__WalkDirectoryState *state = (fpl__WalkDirectoryState *)data;
+	fpl__WalkDirectoryWorker(state);
+}
+
+fpl_common_api void fplSetDefaultWalkDirectorySettings(fplWalkDirectorySettings *settings) {
+	FPL__CheckArgumentNullNoRet(settings);
+	fplClearStruct(settings);
+	settings->flags = fplWalkDirectoryFlags_Recursive;
+}
+
+fpl_common_api bool fplWalkDirectory(const char *path, const fplWalkDirectorySettings *settings, size_t *outEntryCount) {
+	FPL__CheckArgumentNull(path, false);
+	FPL__CheckArgumentNull(settings, false);
+	FPL__CheckArgumentNull(settings->callback, false);
+	FPL__CheckPlatform(false);
+	if (outEntryCount != fpl_null) {
+		*outEntryCount = 0;
+	}
+	if (!fplDirectoryExists(path)) {
+		FPL__ERROR(FPL__MODULE_FILES, "Directory '%s' does not exists", path);
+		return(false);
+	}
+
+	fpl__WalkDirectoryState state = fplZeroInit;
+	state.settings = *settings;
+	if (fplGetStringLength(state.settings.filter) == 0 || fplIsStringEqual(state.settings.filter, "*")) {
+		state.settings.filter = fpl_null;
+	}
+	if (!fplMutexInit(&state.mutex)) {
+		return(false);
+	}
+	if (!fplConditionInit(&state.condition)) {
+		fplMutexDestroy(&state.mutex);
+		return(false);
+	}
+
+	bool result = fpl__WalkDirectoryPush(&state, path, fplGetStringLength(path), 1);
+	if (result) {
+		// @NOTE(final): Without recursion there is only a single directory, so there is nothing to spread across threads
+		size_t threadCount = settings->threadCount > 0 ? settings->threadCount : fplGetProcessorCoreCount();
+		threadCount = fplMax(fplMin(threadCount, FPL_MAX_WALK_DIRECTORY_THREAD_COUNT), 1);
+		if (!(settings->flags & fplWalkDirectoryFlags_Recursive)) {
+			threadCount = 1;
+		}
+
+		// The calling thread is a worker as well
+		fplThreadHandle *threads[FPL_MAX_WALK_DIRECTORY_THREAD_COUNT];
+		size_t startedThreadCount = 0;
+		for (size_t threadIndex = 1; threadIndex < threadCount; ++threadIndex) {
+			fplThreadHandle *thread = fplThreadCreate(fpl__WalkDirectoryThreadProc, &state);
+			if (thread == fpl_null) {
+				break;
+			}
+			threads[startedThreadCount++] = thread;
+		}
+		fpl__WalkDirectoryWorker(&state);
+		if (startedThreadCount > 0) {
+			fplThreadWaitForAll(threads, startedThreadCount, sizeof(fplThreadHandle *), FPL_TIMEOUT_INFINITE);
+		}
+	}
+
+	// Release the remaining directories, when the walk was stopped
+	fpl__WalkDirectoryNode *node = state.pending;
+	while (node != fpl_null) {
+		fpl__WalkDirectoryNode *next = node->next;
+		fpl__ReleaseDynamicMemory(node);
+		node = next;
+	}
+
+	fplConditionDestroy(&state.condition);
+	fplMutexDestroy(&state.mutex);
+
+	if (outEntryCount != fpl_null) {
+		*outEntryCount = state.entryCount;
+	}
+	return(result);
+}
+
+typedef struct fpl__FileWatchEntry {
+	char *path;
+	size_t pathLength;
+	void *userData;
+	fplFileWatchFlags flags;
+	bool isFile;
+} fpl__FileWatchEntry;
+
+typedef struct fpl__FileWatchChange {
+	char *path;
+	size_t pathLength;
+	size_t entryIndex;
+	double time;
+	fplFileWatchEventType type;
+} fpl__FileWatchChange;
+
+typedef struct fpl__FileWatchDirectory {
+#if defined(FPL_PLATFORM_WINDOWS)
+	OVERLAPPED win32Overlapped;
+	HANDLE win32DirectoryHandle;
+	void *win32Buffer;
+#elif defined(FPL_PLATFORM_LINUX)
+	int linuxWatchDescriptor;
+#endif
+	char *path;
+	size_t pathLength;
+	bool isRecursive;
+} fpl__FileWatchDirectory;
+
+typedef struct fpl__FileWatcherState {
+	fpl__FileWatchEntry *entries;
+	fpl__FileWatchChange *changes;
+	// @NOTE(final): Directories are allocated one by one, because the platform may hold pointers into it (Overlapped I/O)
+	fpl__FileWatchDirectory **directories;
+	size_t entryCount;
+	size_t entryCapacity;
+	size_t changeCount;
+	size_t changeCapacity;
+	size_t directoryCount;
+	size_t directoryCapacity;
+} fpl__FileWatcherState;
+
+// Platform specific file watcher functions
+fpl_internal bool fpl__FileWatcherInitPlatform(fplFileWatcher *watcher);
+fpl_internal void fpl__FileWatcherReleasePlatform(fplFileWatcher *watcher);
+fpl_internal bool fpl__FileWatcherWatchDirectory(fplFileWatcher *watcher, const char *path, const size_t pathLength, const bool isRecursive);
+fpl_internal void fpl__FileWatcherReadChanges(fplFileWatcher *watcher, const fplTimeoutValue timeout);
+
+fpl_internal bool fpl__FileWatcherReserve(void **items, size_t *capacity, const size_t count, const size_t itemSize) {
+	if (count < *capacity) {
+		return(true);
+	}
+	size_t newCapacity = fplMax(*capacity * 2, 16);
+	void *newItems = fpl__AllocateDynamicMemory(newCapacity * itemSize, 16);
+	if (newItems == fpl_null) {
+		FPL__ERROR(FPL__MODULE_FILES, "Failed allocating '%zu' file watch items", newCapacity);
+		return(false);
+	}
+	if (*items != fpl_null) {
+		if (count > 0) {
+			fplMemoryCopy(*items, count * itemSize, newItems);
+		}
+		fpl__ReleaseDynamicMemory(*items);
+	}
+	*items = newItems;
+	*capacity = newCapacity;
+	return(true);
+}
+
+fpl_internal char *fpl__FileWatcherCopyPath(const char *path, const size_t pathLength) {
+	char *result = (char *)fpl__AllocateDynamicMemory(pathLength + 1, 8);
+	if (result != fpl_null) {
+		fplCopyStringLen(path, pathLength, result, pathLength + 1);
+	}
+	return(result);
+}
+
+fpl_internal fpl__FileWatchDirectory *fpl__FileWatcherFindDirectory(fpl__FileWatcherState *state, const char *path, const size_t pathLength) {
+	for (size_t directoryIndex = 0; directoryIndex < state->directoryCount; ++directoryIndex) {
+		fpl__FileWatchDirectory *directory = state->directories[directoryIndex];
+		if (directory->pathLength == pathLength && fplIsStringEqualLen(directory->path, pathLength, path, pathLength)) {
+			return(directory);
+		}
+	}
+	return(fpl_null);
+}
+
+// Adds a empty directory, the platform fills out the rest
+fpl_internal fpl__FileWatchDirectory *fpl__FileWatcherAddDirectory(fpl__FileWatcherState *state, const char *path, const size_t pathLength, const bool isRecursive) {
+	if (!fpl__FileWatcherReserve((void **)&state->directories, &state->directoryCapacity, state->directoryCount, sizeof(*state->directories))) {
+		return(fpl_null);
+	}
+	fpl__FileWatchDirectory *directory = (fpl__FileWatchDirectory *)fpl__AllocateDynamicMemory(sizeof(fpl__FileWatchDirectory), 16);
+	if (directory == fpl_null) {
+		return(fpl_null);
+	}
+	fplClearStruct(directory);
+	directory->path = fpl__FileWatcherCopyPath(path, pathLength);
+	if (directory->path == fpl_null) {
+		fpl__ReleaseDynamicMemory(directory);
+		return(fpl_null);
+	}
+	directory->pathLength = pathLength;
+	directory->isRecursive = isRecursive;
+	state->directories[state->directoryCount++] = directory;
+	return(directory);
+}
+
+// Removes the given directory, the platform must release its resources before
+fpl_internal void fpl__FileWatcherRemoveDirectory(fpl__FileWatcherState *state, fpl__FileWatchDirectory *directory) {
+	for (size_t directoryIndex = 0; directoryIndex < state->directoryCount; ++directoryIndex) {
+		if (state->directories[directoryIndex] == directory) {
+			state->directories[directoryIndex] = state->directories[--state->directoryCount];
+			fpl__ReleaseDynamicMemory(directory->path);
+			fpl__ReleaseDynamicMemory(directory);
+			break;
+		}
+	}
+}
+
+fpl_internal bool fpl__FileWatcherIsMatch(const fpl__FileWatchEntry *entry, const char *path, const size_t pathLength) {
+	if (entry->isFile) {
+		return(entry->pathLength == pathLength && fplIsStringEqualLen(entry->path, entry->pathLength, path, pathLength));
+	}
+	if (pathLength <= entry->pathLength + 1 || !fplIsStringEqualLen(entry->path, entry->pathLength, path, entry->pathLength)) {
+		return(false);
+	}
+	if (path[entry->pathLength] != FPL_PATH_SEPARATOR) {
+		return(false);
+	}
+	if (!(entry->flags & fplFileWatchFlags_Recursive)) {
+		// Only the first level
+		for (size_t charIndex = entry->pathLength + 1; charIndex < pathLength; ++charIndex) {
+			if (path[charIndex] == FPL_PATH_SEPARATOR) {
+				return(false);
+			}
+		}
+	}
+	return(true);
+}
+
+// Combines the directory path and a name into a full path and returns its length
+fpl_internal size_t fpl__FileWatcherBuildPath(const fpl__FileWatchDirectory *directory, const char *name, const size_t nameLength, char *outPath, const size_t maxPathLength) {
+	size_t nameOffset = directory->pathLength;
+	if (nameOffset + 1 + nameLength >= maxPathLength) {
+		return 0;
+	}
+	fplMemoryCopy(directory->path, directory->pathLength, outPath);
+	if (nameOffset > 0 && outPath[nameOffset - 1] != FPL_PATH_SEPARATOR) {
+		outPath[nameOffset++] = FPL_PATH_SEPARATOR;
+	}
+	fplCopyStringLen(name, nameLength, outPath + nameOffset, maxPathLength - nameOffset);
+	return(nameOffset + nameLength);
+}
+
+// Called by the platform for each change, the change is merged with a pending change for the same path
+fpl_internal void fpl__FileWatcherPushChange(fplFileWatcher *watcher, const char *path, const size_t pathLength, const fplFileWatchEventType type) {
+	fpl__FileWatcherState *state = (fpl__FileWatcherState *)watcher->internalState;
+	double now = fplGetTimeInMillisecondsHP();
+	for (size_t entryIndex = 0; entryIndex < state->entryCount; ++entryIndex) {
+		if (!fpl__FileWatcherIsMatch(&state->entries[entryIndex], path, pathLength)) {
+			continue;
+		}
+		fpl__FileWatchChange *change = fpl_null;
+		for (size_t changeIndex = 0; changeIndex < state->changeCount; ++changeIndex) {
+			fpl__FileWatchChange *pending = &state->changes[changeIndex];
+			if (pending->entryIndex == entryIndex && pending->pathLength == pathLength && fplIsStringEqualLen(pending->path, pathLength, path, pathLength)) {
+				change = pending;
+				break;
+			}
+		}
+		if (change != fpl_null) {
+			if (change->type == fplFileWatchEventType_Created && type == fplFileWatchEventType_Deleted) {
+				// Created and deleted while quiet (Temporary files), so nothing has changed at all
+				fpl__ReleaseDynamicMemory(change->path);
+				// Keep the order of the remaining changes
+				--state->changeCount;
+				for (size_t moveIndex = (size_t)(change - state->changes); moveIndex < state->changeCount; ++moveIndex) {
+					state->changes[moveIndex] = state->changes[moveIndex + 1];
+				}
+				continue;
+			} else if (change->type == fplFileWatchEventType_Deleted && type == fplFileWatchEventType_Created) {
+				change->type = fplFileWatchEventType_Modified;
+			} else if (change->type != fplFileWatchEventType_Created) {
+				change->type = type;
+			}
+			change->time = now;
+		} else {
+			if (!fpl__FileWatcherReserve((void **)&state->changes, &state->changeCapacity, state->changeCount, sizeof(*state->changes))) {
+				return;
+			}
+			char *changePath = fpl__FileWatcherCopyPath(path, pathLength);
+			if (changePath == fpl_null) {
+				return;
+			}
+			change = &state->changes[state->changeCount++];
+			change->path = changePath;
+			change->pathLength = pathLength;
+			change->entryIndex = entryIndex;
+			change->type = type;
+			change->time = now;
+		}
+	}
+}
+
+// Reports all changes which are quiet for the debounce time and returns the number of reported changes
+fpl_internal size_t fpl__FileWatcherFlushChanges(fplFileWatcher *watcher) {
+	fpl__FileWatcherState *state = (fpl__FileWatcherState *)watcher->internalState;
+	double now = fplGetTimeInMillisecondsHP();
+	size_t result = 0;
+	size_t changeIndex = 0;
+	while (changeIndex < state->changeCount) {
+		fpl__FileWatchChange *change = &state->changes[changeIndex];
+		if ((now - change->time) < (double)watcher->settings.debounceTime) {
+			++changeIndex;
+			continue;
+		}
+		fplFileWatchEvent fileEvent = fplZeroInit;
+		fileEvent.watcher = watcher;
+		fileEvent.userData = state->entries[change->entryIndex].userData;
+		fileEvent.path = change->path;
+		fileEvent.type = change->type;
+		if (watcher->settings.callback != fpl_null) {
+			watcher->settings.callback(&fileEvent, watcher->settings.userData);
+			fpl__ReleaseDynamicMemory(change->path);
+		} else {
+#if defined(FPL__ENABLE_WINDOW)
+			// @NOTE(final): The event owns the path memory now, it is released after the event was polled
+			fileEvent.internalMemory.base = change->path;
+			fileEvent.internalMemory.size = change->pathLength + 1;
+			fplEvent newEvent = fplZeroInit;
+			newEvent.type = fplEventType_FileWatch;
+			newEvent.fileWatch = fileEvent;
+			if (!fpl__PushInternalEvent(&newEvent)) {
+				FPL__WARNING(FPL__MODULE_FILES, "Event queue is full, drop change for file '%s'", change->path);
+				fpl__ReleaseDynamicMemory(change->path);
+			}
+#else
+			fpl__ReleaseDynamicMemory(change->path);
+#endif
+		}
+		++result;
+		// Keep the order of the remaining changes
+		--state->changeCount;
+		for (size_t moveIndex = changeIndex; moveIndex < state->changeCount; ++moveIndex) {
+			state->changes[moveIndex] = state->changes[moveIndex + 1];
+		}
+	}
+	return(result);
+}
+
+fpl_common_api void fplSetDefaultFileWatcherSettings(fplFileWatcherSettings *settings) {
+	FPL__CheckArgumentNullNoRet(settings);
+	fplClearStruct(settings);
+	settings->debounceTime = FPL_DEFAULT_FILE_WATCH_DEBOUNCE_TIME;
+}
+
+fpl_common_api bool fplFileWatcherCreate(const fplFileWatcherSettings *settings, fplFileWatcher *outWatcher) {
+	FPL__CheckArgumentNull(outWatcher, false);
+	FPL__CheckPlatform(false);
+	fplClearStruct(outWatcher);
+	if (settings != fpl_null) {
+		outWatcher->settings = *settings;
+	} else {
+		fplSetDefaultFileWatcherSettings(&outWatcher->settings);
+	}
+#if !defined(FPL__ENABLE_WINDOW)
+	if (outWatcher->settings.callback == fpl_null) {
+		FPL__ERROR(FPL__MODULE_FILES, "File watch events requires the window system, set a callback instead");
+		return false;
+	}
 #endif
+	fpl__FileWatcherState *state = (fpl__FileWatcherState *)fpl__AllocateDynamicMemory(sizeof(fpl__FileWatcherState), 16);
+	if (state == fpl_null) {
+		FPL__ERROR(FPL__MODULE_FILES, "Failed allocating file watcher state of '%zu' bytes", sizeof(fpl__FileWatcherState));
+		return false;
+	}
+	fplClearStruct(state);
+	outWatcher->internalState = state;
+	if (!fpl__FileWatcherInitPlatform(outWatcher)) {
+		fpl__ReleaseDynamicMemory(state);
+		fplClearStruct(outWatcher);
+		return false;
+	}
+	outWatcher->isValid = true;
+	return true;
+}
+
+fpl_common_api void fplFileWatcherDestroy(fplFileWatcher *watcher) {
+	FPL__CheckArgumentNullNoRet(watcher);
+	if (!watcher->isValid) {
+		return;
+	}
+	fpl__FileWatcherState *state = (fpl__FileWatcherState *)watcher->internalState;
+	fpl__FileWatcherReleasePlatform(watcher);
+	while (state->directoryCount > 0) {
+		fpl__FileWatcherRemoveDirectory(state, state->directories[state->directoryCount - 1]);
+	}
+	for (size_t changeIndex = 0; changeIndex < state->changeCount; ++changeIndex) {
+		fpl__ReleaseDynamicMemory(state->changes[changeIndex].path);
+	}
+	for (size_t entryIndex = 0; entryIndex < state->entryCount; ++entryIndex) {
+		fpl__ReleaseDynamicMemory(state->entries[entryIndex].path);
+	}
+	if (state->directories != fpl_null) {
+		fpl__ReleaseDynamicMemory(state->directories);
+	}
+	if (state->changes != fpl_null) {
+		fpl__ReleaseDynamicMemory(state->changes);
+	}
+	if (state->entries != fpl_null) {
+		fpl__ReleaseDynamicMemory(state->entries);
+	}
+	fpl__ReleaseDynamicMemory(state);
+	fplClearStruct(watcher);
+}
+
+fpl_common_api bool fplFileWatcherAdd(fplFileWatcher *watcher, const char *path, const fplFileWatchFlags flags, void *userData) {
+	FPL__CheckArgumentNull(watcher, false);
+	FPL__CheckArgumentNull(path, false);
+	if (!watcher->isValid) {
+		FPL__ERROR(FPL__MODULE_FILES, "File watcher '%p' is not valid", watcher);
+		return false;
+	}
+	fpl__FileWatcherState *state = (fpl__FileWatcherState *)watcher->internalState;
+
+	bool isFile;
+	if (fplDirectoryExists(path)) {
+		isFile = false;
+	} else if (fplFileExists(path)) {
+		isFile = true;
+	} else {
+		FPL__ERROR(FPL__MODULE_FILES, "File or directory '%s' does not exists", path);
+		return false;
+	}
+
+	// A bare file name has no parent directory to watch, so it is watched in the current directory
+	char relativeFilePath[FPL_MAX_PATH_LENGTH];
+	if (isFile && fplExtractFileName(path) == path) {
+		if (fplPathCombine(relativeFilePath, fplArrayCount(relativeFilePath), 2, ".", path) == fpl_null) {
+			return false;
+		}
+		path = relativeFilePath;
+	}
+
+	size_t pathLength = fplGetStringLength(path);
+	while (pathLength > 1 && path[pathLength - 1] == FPL_PATH_SEPARATOR) {
+		--pathLength;
+	}
+
+	// Files are watched by its parent directory
+	size_t directoryLength = pathLength;
+	if (isFile) {
+		const char *fileName = fplExtractFileName(path);
+		directoryLength = (size_t)(fileName - path);
+		// Keep the separator for root directories only
+		if (directoryLength > 1 && path[directoryLength - 2] != ':') {
+			--directoryLength;
+		}
+	}
+
+	if (!fpl__FileWatcherReserve((void **)&state->entries, &state->entryCapacity, state->entryCount, sizeof(*state->entries))) {
+		return false;
+	}
+	fpl__FileWatchEntry *entry = &state->entries[state->entryCount];
+	fplClearStruct(entry);
+	entry->path = fpl__FileWatcherCopyPath(path, pathLength);
+	if (entry->path == fpl_null) {
+		return false;
+	}
+	entry->pathLength = pathLength;
+	entry->flags = flags;
+	entry->userData = userData;
+	entry->isFile = isFile;
+
+	bool isRecursive = !isFile && (flags & fplFileWatchFlags_Recursive);
+	if (!fpl__FileWatcherWatchDirectory(watcher, path, directoryLength, isRecursive)) {
+		fpl__ReleaseDynamicMemory(entry->path);
+		return false;
+	}
+	++state->entryCount;
+	return true;
+}
+
+fpl_common_api size_t fplFileWatcherUpdate(fplFileWatcher *watcher, const fplTimeoutValue timeout) {
+	FPL__CheckArgumentNull(watcher, 0);
+	if (!watcher->isValid) {
+		FPL__ERROR(FPL__MODULE_FILES, "File watcher '%p' is not valid", watcher);
+		return 0;
+	}
+	fpl__FileWatcherState *state = (fpl__FileWatcherState *)watcher->internalState;
+	if (state->directoryCount == 0 && state->changeCount == 0) {
+		return 0;
+	}
+	double startTime = fplGetTimeInMillisecondsHP();
+	size_t result = 0;
+	for (;;) {
+		double now = fplGetTimeInMillisecondsHP();
+		fplTimeoutValue waitTime = timeout;
+		if (timeout != FPL_TIMEOUT_INFINITE) {
+			double remaining = (double)timeout - (now - startTime);
+			waitTime = remaining > 0 ? (fplTimeoutValue)remaining : 0;
+		}
+		if (state->changeCount > 0) {
+			// Wake up when the oldest pending change gets quiet
+			double oldestTime = state->changes[0].time;
+			for (size_t changeIndex = 1; changeIndex < state->changeCount; ++changeIndex) {
+				oldestTime = fplMin(oldestTime, state->changes[changeIndex].time);
+			}
+			double quietTime = (double)watcher->settings.debounceTime - (now - oldestTime);
+			fplTimeoutValue quietWaitTime = quietTime > 0 ? (fplTimeoutValue)quietTime + 1 : 0;
+			waitTime = fplMin(waitTime, quietWaitTime);
+		}
+		fpl__FileWatcherReadChanges(watcher, waitTime);
+		result += fpl__FileWatcherFlushChanges(watcher);
+		if (result > 0 || timeout == 0) {
+			break;
+		}
+		if (timeout != FPL_TIMEOUT_INFINITE && (fplGetTimeInMillisecondsHP() - startTime) >= (double)timeout) {
+			break;
+		}
+	}
+	return(result);
 }
 
 #endif // FPL__COMMON_FILES_DEFINED
@@ -9419,7 +11536,449 @@ fpl_common_api char *fplPathCombine(char *destPath, const size_t maxDestPathLen,
 	va_end(vargs);
 	return currentDestPtr;
 }
-#endif // FPL__COMMON_PATHS_DEFINED
+#endif // FPL__COMMON_PATHS_DEFINED
+
+//
+// Common Hashing
+//
+#if !defined(FPL__COMMON_HASHING_DEFINED)
+#define FPL__COMMON_HASHING_DEFINED
+
+// @NOTE(final): Reads are assembled from single bytes, so they are unaligned and endian independent. Compilers turns them into a single load.
+fpl_force_inline uint32_t fpl__HashRead32(const uint8_t *p) {
+	uint32_t result = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+	return(result);
+}
+
+fpl_force_inline uint64_t fpl__HashRead64(const uint8_t *p) {
+	uint64_t result = (uint64_t)fpl__HashRead32(p) | ((uint64_t)fpl__HashRead32(p + 4) << 32);
+	return(result);
+}
+
+fpl_force_inline uint64_t fpl__HashRotateLeft64(const uint64_t value, const int bits) {
+	uint64_t result = (value << bits) | (value >> (64 - bits));
+	return(result);
+}
+
+//
+// CRC-32C
+//
+#define FPL__CRC32C_POLYNOMIAL 0x82F63B78U
+
+#define FPL__CRC32C_STATE_UNKNOWN 0
+#define FPL__CRC32C_STATE_SOFTWARE 1
+#define FPL__CRC32C_STATE_HARDWARE 2
+#define FPL__CRC32C_STATE_INITIALIZING 3
+
+// Slicing-by-8 tables for the software fallback, computed once on first use
+fpl_globalvar uint32_t fpl__global__CRC32CTable[8][256] = fplZeroInit;
+fpl_globalvar volatile int32_t fpl__global__CRC32CState = FPL__CRC32C_STATE_UNKNOWN;
+
+fpl_internal void fpl__CRC32CBuildTable() {
+	for (uint32_t i = 0; i < 256; ++i) {
+		uint32_t crc = i;
+		for (int k = 0; k < 8; ++k) {
+			crc = (crc & 1) ? (crc >> 1) ^ FPL__CRC32C_POLYNOMIAL : (crc >> 1);
+		}
+		fpl__global__CRC32CTable[0][i] = crc;
+	}
+	for (uint32_t i = 0; i < 256; ++i) {
+		uint32_t crc = fpl__global__CRC32CTable[0][i];
+		for (int t = 1; t < 8; ++t) {
+			crc = fpl__global__CRC32CTable[0][crc & 0xFF] ^ (crc >> 8);
+			fpl__global__CRC32CTable[t][i] = crc;
+		}
+	}
+}
+
+fpl_internal bool fpl__CRC32CIsAccelerated() {
+	int32_t state = fplAtomicLoadS32(&fpl__global__CRC32CState);
+	while (state == FPL__CRC32C_STATE_UNKNOWN || state == FPL__CRC32C_STATE_INITIALIZING) {
+		// @NOTE(final): Only the first thread builds the tables, all other threads wait until the state is published
+		if (fplIsAtomicCompareAndSwapS32(&fpl__global__CRC32CState, FPL__CRC32C_STATE_UNKNOWN, FPL__CRC32C_STATE_INITIALIZING)) {
+			fpl__CRC32CBuildTable();
+			fplProcessorCapabilities caps;
+			bool hasCRC = fplGetProcessorCapabilities(&caps) && caps.hasSSE4_2;
+#if !(defined(FPL_ARCH_X64) || defined(FPL_ARCH_X86))
+			// @IMPLEMENT(final): CRC-32C instructions for ARM64
+			hasCRC = false;
+#endif
+			state = hasCRC ? FPL__CRC32C_STATE_HARDWARE : FPL__CRC32C_STATE_SOFTWARE;
+			fplAtomicStoreS32(&fpl__global__CRC32CState, state);
+			break;
+		}
+		fplThreadYield();
+		state = fplAtomicLoadS32(&fpl__global__CRC32CState);
+	}
+	return(state == FPL__CRC32C_STATE_HARDWARE);
+}
+
+fpl_internal uint32_t fpl__CRC32CSoftware(uint32_t crc, const uint8_t *p, size_t size) {
+	while (size >= 8) {
+		uint32_t lo = fpl__HashRead32(p) ^ crc;
+		uint32_t hi = fpl__HashRead32(p + 4);
+		crc =
+			fpl__global__CRC32CTable[7][lo & 0xFF] ^ fpl__global__CRC32CTable[6][(lo >> 8) & 0xFF] ^
+			fpl__global__CRC32CTable[5][(lo >> 16) & 0xFF] ^ fpl__global__CRC32CTable[4][lo >> 24] ^
+			fpl__global__CRC32CTable[3][hi & 0xFF] ^ fpl__global__CRC32CTable[2][(hi >> 8) & 0xFF] ^
+			fpl__global__CRC32CTable[1][(hi >> 16) & 0xFF] ^ fpl__global__CRC32CTable[0][hi >> 24];
+		p += 8;
+		size -= 8;
+	}
+	while (size > 0) {
+		crc = fpl__global__CRC32CTable[0][(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+		--size;
+	}
+	return(crc);
+}
+
+#if defined(FPL_ARCH_X64) || defined(FPL_ARCH_X86)
+#	if defined(FPL_COMPILER_GCC) || defined(FPL_COMPILER_CLANG)
+#		define FPL__HASH_TARGET_SSE42 __attribute__((target("sse4.2")))
+#	else
+#		define FPL__HASH_TARGET_SSE42
+#	endif
+FPL__HASH_TARGET_SSE42 fpl_internal uint32_t fpl__CRC32CHardware(uint32_t crc, const uint8_t *p, size_t size) {
+#	if defined(FPL_ARCH_X64)
+	uint64_t crc64 = crc;
+	while (size >= 32) {
+		crc64 = _mm_crc32_u64(crc64, fpl__HashRead64(p + 0));
+		crc64 = _mm_crc32_u64(crc64, fpl__HashRead64(p + 8));
+		crc64 = _mm_crc32_u64(crc64, fpl__HashRead64(p + 16));
+		crc64 = _mm_crc32_u64(crc64, fpl__HashRead64(p + 24));
+		p += 32;
+		size -= 32;
+	}
+	while (size >= 8) {
+		crc64 = _mm_crc32_u64(crc64, fpl__HashRead64(p));
+		p += 8;
+		size -= 8;
+	}
+	crc = (uint32_t)crc64;
+#	else
+	while (size >= 4) {
+		crc = _mm_crc32_u32(crc, fpl__HashRead32(p));
+		p += 4;
+		size -= 4;
+	}
+#	endif
+	while (size > 0) {
+		crc = _mm_crc32_u8(crc, *p++);
+		--size;
+	}
+	return(crc);
+}
+#endif // FPL_ARCH_X64 || FPL_ARCH_X86
+
+fpl_internal uint32_t fpl__CRC32CUpdate(const bool isAccelerated, const uint32_t crc, const uint8_t *p, const size_t size) {
+#if defined(FPL_ARCH_X64) || defined(FPL_ARCH_X86)
+	if (isAccelerated) {
+		return fpl__CRC32CHardware(crc, p, size);
+	}
+#endif
+	return fpl__CRC32CSoftware(crc, p, size);
+}
+
+//
+// XXH64
+//
+#define FPL__XXH64_PRIME1 0x9E3779B185EBCA87ULL
+#define FPL__XXH64_PRIME2 0xC2B2AE3D27D4EB4FULL
+#define FPL__XXH64_PRIME3 0x165667B19E3779F9ULL
+#define FPL__XXH64_PRIME4 0x85EBCA77C2B2AE63ULL
+#define FPL__XXH64_PRIME5 0x27D4EB2F165667C5ULL
+
+fpl_force_inline uint64_t fpl__XXH64Round(uint64_t acc, const uint64_t input) {
+	acc += input * FPL__XXH64_PRIME2;
+	acc = fpl__HashRotateLeft64(acc, 31);
+	acc *= FPL__XXH64_PRIME1;
+	return(acc);
+}
+
+fpl_force_inline uint64_t fpl__XXH64MergeRound(uint64_t acc, const uint64_t value) {
+	acc ^= fpl__XXH64Round(0, value);
+	acc = acc * FPL__XXH64_PRIME1 + FPL__XXH64_PRIME4;
+	return(acc);
+}
+
+// Processes all 32-byte stripes and returns the number of consumed bytes
+fpl_internal size_t fpl__XXH64Stripes(uint64_t *acc, const uint8_t *p, const size_t size) {
+	uint64_t v1 = acc[0], v2 = acc[1], v3 = acc[2], v4 = acc[3];
+	size_t count = size / 32;
+	for (size_t i = 0; i < count; ++i) {
+		v1 = fpl__XXH64Round(v1, fpl__HashRead64(p + 0));
+		v2 = fpl__XXH64Round(v2, fpl__HashRead64(p + 8));
+		v3 = fpl__XXH64Round(v3, fpl__HashRead64(p + 16));
+		v4 = fpl__XXH64Round(v4, fpl__HashRead64(p + 24));
+		p += 32;
+	}
+	acc[0] = v1; acc[1] = v2; acc[2] = v3; acc[3] = v4;
+	return(count * 32);
+}
+
+fpl_internal uint64_t fpl__XXH64Finish(const fplHashState *state) {
+	uint64_t h;
+	if (state->totalLength >= 32) {
+		const uint64_t *acc = state->acc;
+		h = fpl__HashRotateLeft64(acc[0], 1) + fpl__HashRotateLeft64(acc[1], 7) + fpl__HashRotateLeft64(acc[2], 12) + fpl__HashRotateLeft64(acc[3], 18);
+		h = fpl__XXH64MergeRound(h, acc[0]);
+		h = fpl__XXH64MergeRound(h, acc[1]);
+		h = fpl__XXH64MergeRound(h, acc[2]);
+		h = fpl__XXH64MergeRound(h, acc[3]);
+	} else {
+		h = state->seed + FPL__XXH64_PRIME5;
+	}
+	h += state->totalLength;
+	const uint8_t *p = state->buffer;
+	uint32_t remaining = state->bufferLength;
+	while (remaining >= 8) {
+		h ^= fpl__XXH64Round(0, fpl__HashRead64(p));
+		h = fpl__HashRotateLeft64(h, 27) * FPL__XXH64_PRIME1 + FPL__XXH64_PRIME4;
+		p += 8;
+		remaining -= 8;
+	}
+	if (remaining >= 4) {
+		h ^= (uint64_t)fpl__HashRead32(p) * FPL__XXH64_PRIME1;
+		h = fpl__HashRotateLeft64(h, 23) * FPL__XXH64_PRIME2 + FPL__XXH64_PRIME3;
+		p += 4;
+		remaining -= 4;
+	}
+	while (remaining > 0) {
+		h ^= (*p++) * FPL__XXH64_PRIME5;
+		h = fpl__HashRotateLeft64(h, 11) * FPL__XXH64_PRIME1;
+		--remaining;
+	}
+	h ^= h >> 33;
+	h *= FPL__XXH64_PRIME2;
+	h ^= h >> 29;
+	h *= FPL__XXH64_PRIME3;
+	h ^= h >> 32;
+	return(h);
+}
+
+//
+// MurmurHash3 x64 128
+//
+#define FPL__MURMUR3_C1 0x87C37B91114253D5ULL
+#define FPL__MURMUR3_C2 0x4CF5AD432745937FULL
+
+fpl_force_inline uint64_t fpl__Murmur3Mix(uint64_t k) {
+	k ^= k >> 33;
+	k *= 0xFF51AFD7ED558CCDULL;
+	k ^= k >> 33;
+	k *= 0xC4CEB9FE1A85EC53ULL;
+	k ^= k >> 33;
+	return(k);
+}
+
+// Processes all 16-byte blocks and returns the number of consumed bytes
+fpl_internal size_t fpl__Murmur3Blocks(uint64_t *acc, const uint8_t *p, const size_t size) {
+	uint64_t h1 = acc[0], h2 = acc[1];
+	size_t count = size / 16;
+	for (size_t i = 0; i < count; ++i) {
+		uint64_t k1 = fpl__HashRead64(p + 0);
+		uint64_t k2 = fpl__HashRead64(p + 8);
+		k1 *= FPL__MURMUR3_C1; k1 = fpl__HashRotateLeft64(k1, 31); k1 *= FPL__MURMUR3_C2; h1 ^= k1;
+		h1 = fpl__HashRotateLeft64(h1, 27); h1 += h2; h1 = h1 * 5 + 0x52DCE729;
+		k2 *= FPL__MURMUR3_C2; k2 = fpl__HashRotateLeft64(k2, 33); k2 *= FPL__MURMUR3_C1; h2 ^= k2;
+		h2 = fpl__HashRotateLeft64(h2, 31); h2 += h1; h2 = h2 * 5 + 0x38495AB5;
+		p += 16;
+	}
+	acc[0] = h1; acc[1] = h2;
+	return(count * 16);
+}
+
+fpl_internal void fpl__Murmur3Finish(const fplHashState *state, uint64_t *outH1, uint64_t *outH2) {
+	uint64_t h1 = state->acc[0], h2 = state->acc[1];
+	const uint8_t *tail = state->buffer;
+	uint32_t remaining = state->bufferLength;
+	fplAssert(remaining < 16);
+	uint64_t k1 = 0, k2 = 0;
+	for (uint32_t i = remaining; i > 8; --i) {
+		k2 ^= (uint64_t)tail[i - 1] << ((i - 9) * 8);
+	}
+	if (remaining > 8) {
+		k2 *= FPL__MURMUR3_C2; k2 = fpl__HashRotateLeft64(k2, 33); k2 *= FPL__MURMUR3_C1; h2 ^= k2;
+	}
+	for (uint32_t i = fplMin(remaining, 8); i > 0; --i) {
+		k1 ^= (uint64_t)tail[i - 1] << ((i - 1) * 8);
+	}
+	if (remaining > 0) {
+		k1 *= FPL__MURMUR3_C1; k1 = fpl__HashRotateLeft64(k1, 31); k1 *= FPL__MURMUR3_C2; h1 ^= k1;
+	}
+	h1 ^= state->totalLength;
+	h2 ^= state->totalLength;
+	h1 += h2;
+	h2 += h1;
+	h1 = fpl__Murmur3Mix(h1);
+	h2 = fpl__Murmur3Mix(h2);
+	h1 += h2;
+	h2 += h1;
+	*outH1 = h1;
+	*outH2 = h2;
+}
+
+//
+// Hash API
+//
+fpl_internal uint32_t fpl__GetHashBlockSize(const fplHashType type) {
+	switch (type) {
+		case fplHashType_XXH64:
+			return 32;
+		case fplHashType_Murmur3_128:
+			return 16;
+		default:
+			return 0;
+	}
+}
+
+fpl_internal size_t fpl__HashProcessBlocks(fplHashState *state, const uint8_t *p, const size_t size) {
+	switch (state->type) {
+		case fplHashType_XXH64:
+			return fpl__XXH64Stripes(state->acc, p, size);
+		case fplHashType_Murmur3_128:
+			return fpl__Murmur3Blocks(state->acc, p, size);
+		default:
+			return 0;
+	}
+}
+
+fpl_common_api bool fplHashBegin(fplHashState *state, const fplHashType type, const uint64_t seed) {
+	FPL__CheckArgumentNull(state, false);
+	fplClearStruct(state);
+	state->type = type;
+	state->seed = seed;
+	switch (type) {
+		case fplHashType_CRC32C:
+			state->isAccelerated = fpl__CRC32CIsAccelerated();
+			state->acc[0] = ~(uint32_t)seed;
+			break;
+		case fplHashType_XXH64:
+			state->acc[0] = seed + FPL__XXH64_PRIME1 + FPL__XXH64_PRIME2;
+			state->acc[1] = seed + FPL__XXH64_PRIME2;
+			state->acc[2] = seed;
+			state->acc[3] = seed - FPL__XXH64_PRIME1;
+			break;
+		case fplHashType_Murmur3_128:
+			state->acc[0] = seed;
+			state->acc[1] = seed;
+			break;
+		default:
+			FPL__ERROR(FPL__MODULE_CORE, "Hash type '%d' is not supported", type);
+			state->type = fplHashType_None;
+			return false;
+	}
+	return true;
+}
+
+fpl_common_api void fplHashUpdate(fplHashState *state, const void *data, const size_t size) {
+	FPL__CheckArgumentNullNoRet(state);
+	if (size == 0) {
+		return;
+	}
+	FPL__CheckArgumentNullNoRet(data);
+	const uint8_t *p = (const uint8_t *)data;
+	state->totalLength += size;
+	if (state->type == fplHashType_CRC32C) {
+		state->acc[0] = fpl__CRC32CUpdate(state->isAccelerated != 0, (uint32_t)state->acc[0], p, size);
+		return;
+	}
+	uint32_t blockSize = fpl__GetHashBlockSize(state->type);
+	if (blockSize == 0) {
+		return;
+	}
+	size_t remaining = size;
+	if (state->bufferLength > 0) {
+		size_t fill = fplMin(remaining, (size_t)(blockSize - state->bufferLength));
+		fplMemoryCopy(p, fill, state->buffer + state->bufferLength);
+		state->bufferLength += (uint32_t)fill;
+		p += fill;
+		remaining -= fill;
+		if (state->bufferLength < blockSize) {
+			return;
+		}
+		fpl__HashProcessBlocks(state, state->buffer, blockSize);
+		state->bufferLength = 0;
+	}
+	size_t consumed = fpl__HashProcessBlocks(state, p, remaining);
+	p += consumed;
+	remaining -= consumed;
+	if (remaining > 0) {
+		fplMemoryCopy(p, remaining, state->buffer);
+		state->bufferLength = (uint32_t)remaining;
+	}
+}
+
+fpl_common_api bool fplHashEnd(fplHashState *state, fplHashValue *outValue) {
+	FPL__CheckArgumentNull(state, false);
+	FPL__CheckArgumentNull(outValue, false);
+	fplClearStruct(outValue);
+	switch (state->type) {
+		case fplHashType_CRC32C:
+			outValue->u32 = ~(uint32_t)state->acc[0];
+			break;
+		case fplHashType_XXH64:
+			outValue->u64 = fpl__XXH64Finish(state);
+			break;
+		case fplHashType_Murmur3_128:
+			fpl__Murmur3Finish(state, &outValue->u128[0], &outValue->u128[1]);
+			break;
+		default:
+			FPL__ERROR(FPL__MODULE_CORE, "Hash state is not initialized");
+			return false;
+	}
+	return true;
+}
+
+fpl_common_api bool fplComputeHash(const fplHashType type, const void *data, const size_t size, fplHashValue *outValue) {
+	FPL__CheckArgumentNull(outValue, false);
+	fplHashState state;
+	if (!fplHashBegin(&state, type, 0)) {
+		return false;
+	}
+	fplHashUpdate(&state, data, size);
+	bool result = fplHashEnd(&state, outValue);
+	return(result);
+}
+
+fpl_common_api bool fplComputeFileHash(const fplHashType type, const char *filePath, fplHashValue *outValue) {
+	FPL__CheckArgumentNull(filePath, false);
+	FPL__CheckArgumentNull(outValue, false);
+	fplHashState state;
+	if (!fplHashBegin(&state, type, 0)) {
+		return false;
+	}
+	fplFileHandle file;
+	if (!fplOpenBinaryFile(filePath, &file)) {
+		FPL__ERROR(FPL__MODULE_FILES, "Failed opening file '%s' for hashing", filePath);
+		return false;
+	}
+	bool result = false;
+	uint8_t *block = (uint8_t *)fpl__AllocateDynamicMemory(FPL_HASH_FILE_BLOCK_SIZE, 64);
+	if (block != fpl_null) {
+		uint64_t fileSize = fplGetFileSizeFromHandle64(&file);
+		uint64_t totalRead = 0;
+		for (;;) {
+			uint64_t readBytes = fplReadFileBlock64(&file, FPL_HASH_FILE_BLOCK_SIZE, block, FPL_HASH_FILE_BLOCK_SIZE);
+			if (readBytes == 0) {
+				break;
+			}
+			fplHashUpdate(&state, block, (size_t)readBytes);
+			totalRead += readBytes;
+		}
+		if (totalRead == fileSize) {
+			result = fplHashEnd(&state, outValue);
+		} else {
+			FPL__ERROR(FPL__MODULE_FILES, "Failed reading file '%s' for hashing, got '%zu' of '%zu' bytes", filePath, (size_t)totalRead, (size_t)fileSize);
+		}
+		fpl__ReleaseDynamicMemory(block);
+	} else {
+		FPL__ERROR(FPL__MODULE_FILES, "Failed allocating '%zu' bytes for hashing file '%s'", (size_t)FPL_HASH_FILE_BLOCK_SIZE, filePath);
+	}
+	fplCloseFile(&file);
+	return(result);
+}
+#endif // FPL__COMMON_HASHING_DEFINED
 
 //
 // Common Window
@@ -9611,6 +12170,21 @@ fpl_common_api const char *fplGetArchTypeString(const fplArchType type) {
 	const char *result = fpl__global_ArchTypeNameTable[index];
 	return(result);
 }
+
+#define FPL__HASHTYPE_COUNT FPL__ENUM_COUNT(FPL_FIRST_HASHTYPE, FPL_LAST_HASHTYPE)
+fpl_globalvar const char *fpl__global_HashTypeNameTable[] = {
+	"None", // No or unknown hash type
+	"CRC32C", // 32-bit CRC with the Castagnoli polynomial
+	"XXH64", // 64-bit xxHash
+	"Murmur3_128", // 128-bit MurmurHash3
+};
+fplStaticAssert(fplArrayCount(fpl__global_HashTypeNameTable) == FPL__HASHTYPE_COUNT);
+
+fpl_common_api const char *fplGetHashTypeString(const fplHashType type) {
+	uint32_t index = FPL__ENUM_VALUE_TO_ARRAY_INDEX(type, FPL_FIRST_HASHTYPE, FPL_LAST_HASHTYPE);
+	const char *result = fpl__global_HashTypeNameTable[index];
+	return(result);
+}
 #endif // FPL_COMMON_DEFINED
 
 // ############################################################################
@@ -10606,6 +13180,11 @@ fpl_internal void fpl__Win32ReleasePlatform(fpl__PlatformInitState *initState, f
 	if (appState->initFlags & fplInitFlags_GameController) {
 		fpl__Win32UnloadXInputApi(&win32AppState->xinput.xinputApi);
 	}
+	if (win32AppState->network.isStarted) {
+		win32AppState->network.winsockApi.WSACleanup();
+		win32AppState->network.isStarted = false;
+	}
+	fpl__Win32UnloadWinsockApi(&win32AppState->network.winsockApi);
 	fpl__Win32UnloadApi(&win32AppState->winApi);
 }
 
@@ -10928,6 +13507,18 @@ fpl_internal bool fpl__Win32InitPlatform(const fplInitFlags initFlags, const fpl
 		fpl__Win32LoadXInputApi(&win32AppState->xinput.xinputApi);
 	}
 
+	// Load and start winsock
+	if (initFlags & fplInitFlags_Network) {
+		if (fpl__Win32LoadWinsockApi(&win32AppState->network.winsockApi)) {
+			WSADATA wsaData;
+			if (win32AppState->network.winsockApi.WSAStartup(MAKEWORD(2, 2), &wsaData) == 0) {
+				win32AppState->network.isStarted = true;
+			} else {
+				FPL__WARNING(FPL__MODULE_NETWORK, "Failed starting winsock, sockets are not available");
+			}
+		}
+	}
+
 	// Init console
 	if (!(initFlags & fplInitFlags_Window) && (initFlags & fplInitFlags_Console)) {
 		HWND consoleHandle = GetConsoleWindow();
@@ -11827,6 +14418,507 @@ fpl_platform_api void fplMemoryFree(void *ptr) {
 	VirtualFree(ptr, 0, MEM_RELEASE);
 }
 
+//
+// Win32 Shared Memory
+//
+fpl_platform_api bool fplSharedMemoryCreate(const char *name, const size_t size, fplSharedMemoryHandle *outHandle) {
+	FPL__CheckArgumentNull(name, false);
+	FPL__CheckArgumentZero(size, false);
+	FPL__CheckArgumentNull(outHandle, false);
+	wchar_t nameWide[FPL_MAX_NAME_LENGTH];
+	fplUTF8StringToWideString(name, fplGetStringLength(name), nameWide, fplArrayCount(nameWide));
+	uint64_t size64 = (uint64_t)size;
+	HANDLE mappingHandle = CreateFileMappingW(INVALID_HANDLE_VALUE, fpl_null, PAGE_READWRITE, (DWORD)(size64 >> 32), (DWORD)(size64 & 0xFFFFFFFF), nameWide);
+	if (mappingHandle == fpl_null) {
+		FPL__ERROR(FPL__MODULE_SHAREDMEMORY, "Failed creating shared memory '%s' with size of '%zu' bytes", name, size);
+		return false;
+	}
+	if (GetLastError() == ERROR_ALREADY_EXISTS) {
+		CloseHandle(mappingHandle);
+		FPL__ERROR(FPL__MODULE_SHAREDMEMORY, "Shared memory '%s' already exists", name);
+		return false;
+	}
+	void *base = MapViewOfFile(mappingHandle, FILE_MAP_ALL_ACCESS, 0, 0, size);
+	if (base == fpl_null) {
+		CloseHandle(mappingHandle);
+		FPL__ERROR(FPL__MODULE_SHAREDMEMORY, "Failed mapping shared memory '%s'", name);
+		return false;
+	}
+	fplClearStruct(outHandle);
+	fplCopyString(name, outHandle->name, fplArrayCount(outHandle->name));
+	outHandle->internalHandle.win32MappingHandle = mappingHandle;
+	outHandle->base = base;
+	outHandle->size = size;
+	outHandle->isOwner = true;
+	outHandle->isValid = true;
+	return true;
+}
+
+fpl_platform_api bool fplSharedMemoryOpen(const char *name, fplSharedMemoryHandle *outHandle) {
+	FPL__CheckArgumentNull(name, false);
+	FPL__CheckArgumentNull(outHandle, false);
+	wchar_t nameWide[FPL_MAX_NAME_LENGTH];
+	fplUTF8StringToWideString(name, fplGetStringLength(name), nameWide, fplArrayCount(nameWide));
+	HANDLE mappingHandle = OpenFileMappingW(FILE_MAP_ALL_ACCESS, FALSE, nameWide);
+	if (mappingHandle == fpl_null) {
+		FPL__ERROR(FPL__MODULE_SHAREDMEMORY, "Failed opening shared memory '%s'", name);
+		return false;
+	}
+	void *base = MapViewOfFile(mappingHandle, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+	if (base == fpl_null) {
+		CloseHandle(mappingHandle);
+		FPL__ERROR(FPL__MODULE_SHAREDMEMORY, "Failed mapping shared memory '%s'", name);
+		return false;
+	}
+	// @NOTE(final): The region size is rounded up to the page size
+	MEMORY_BASIC_INFORMATION memInfo = fplZeroInit;
+	VirtualQuery(base, &memInfo, sizeof(memInfo));
+	fplClearStruct(outHandle);
+	fplCopyString(name, outHandle->name, fplArrayCount(outHandle->name));
+	outHandle->internalHandle.win32MappingHandle = mappingHandle;
+	outHandle->base = base;
+	outHandle->size = (size_t)memInfo.RegionSize;
+	outHandle->isValid = true;
+	return true;
+}
+
+fpl_platform_api void fplSharedMemoryClose(fplSharedMemoryHandle *handle) {
+	if (handle != fpl_null && handle->isValid) {
+		// The name is removed by the system, when the last handle gets closed
+		UnmapViewOfFile(handle->base);
+		CloseHandle(handle->internalHandle.win32MappingHandle);
+		fplClearStruct(handle);
+	}
+}
+
+fpl_platform_api bool fplSharedMemoryRemove(const char *name) {
+	FPL__CheckArgumentNull(name, false);
+	// Named file mappings have no name to remove, they are gone when the last handle is closed
+	return false;
+}
+
+fpl_internal void fpl__SharedMemoryWaitU32(volatile uint32_t *address, const uint32_t expectedValue, const fplTimeoutValue timeout) {
+	// @TODO(final/Win32): WaitOnAddress() works inside a single process only, use a named event to sleep across processes
+	fpl__SharedMemoryPollWaitU32(address, expectedValue, timeout);
+}
+
+fpl_internal void fpl__SharedMemoryWakeU32(volatile uint32_t *address) {
+	// Polling waiters does not need any wake up
+	(void)address;
+}
+
+//
+// Win32 Network
+//
+fpl_internal fplSocketResult fpl__Win32GetSocketResultFromError(const int errorCode) {
+	switch (errorCode) {
+		case WSAEWOULDBLOCK:
+		case WSAEINPROGRESS:
+		case WSAEINTR:
+			return fplSocketResult_WouldBlock;
+		case WSAECONNRESET:
+		case WSAECONNABORTED:
+		case WSAENOTCONN:
+		case WSAESHUTDOWN:
+			return fplSocketResult_Closed;
+		default:
+			return fplSocketResult_Failed;
+	}
+}
+
+// Returns the winsock api, when the platform was initialized with fplInitFlags_Network
+fpl_internal const fpl__Win32WinsockApi *fpl__Win32GetWinsockApi() {
+	FPL__CheckPlatform(fpl_null);
+	const fpl__Win32NetworkState *networkState = &fpl__global__AppState->win32.network;
+	if (!networkState->isStarted) {
+		FPL__ERROR(FPL__MODULE_NETWORK, "Winsock is not started, initialize the platform with fplInitFlags_Network");
+		return fpl_null;
+	}
+	return &networkState->winsockApi;
+}
+
+fpl_internal bool fpl__Win32SetupSocket(const fpl__Win32WinsockApi *wsapi, const SOCKET s, const fplSocketType type) {
+	u_long nonBlocking = 1;
+	if (wsapi->ioctlsocket(s, FIONBIO, &nonBlocking) != 0) {
+		FPL__ERROR(FPL__MODULE_NETWORK, "Failed setting socket '%p' to non-blocking mode, error code: %d", (void *)s, wsapi->WSAGetLastError());
+		return false;
+	}
+	if (type == fplSocketType_TCP) {
+		BOOL enabled = TRUE;
+		wsapi->setsockopt(s, IPPROTO_TCP, TCP_NODELAY, (const char *)&enabled, sizeof(enabled));
+	}
+	return true;
+}
+
+fpl_platform_api bool fplSocketCreate(const fplSocketType type, fplSocketHandle *outSocket) {
+	FPL__CheckArgumentInvalid(type, type == fplSocketType_None, false);
+	FPL__CheckArgumentNull(outSocket, false);
+	const fpl__Win32WinsockApi *wsapi = fpl__Win32GetWinsockApi();
+	if (wsapi == fpl_null) {
+		return false;
+	}
+	SOCKET s;
+	if (type == fplSocketType_UDP) {
+		s = wsapi->socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	} else {
+		s = wsapi->socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	}
+	if (s == INVALID_SOCKET) {
+		FPL__ERROR(FPL__MODULE_NETWORK, "Failed creating socket of type '%d', error code: %d", type, wsapi->WSAGetLastError());
+		return false;
+	}
+	if (!fpl__Win32SetupSocket(wsapi, s, type)) {
+		wsapi->closesocket(s);
+		return false;
+	}
+	fplClearStruct(outSocket);
+	outSocket->internalHandle.win32Socket = (uintptr_t)s;
+	outSocket->type = type;
+	outSocket->isValid = true;
+	return true;
+}
+
+fpl_platform_api void fplSocketClose(fplSocketHandle *socket) {
+	if (socket != fpl_null && socket->isValid) {
+		const fpl__Win32WinsockApi *wsapi = fpl__Win32GetWinsockApi();
+		if (wsapi != fpl_null) {
+			wsapi->closesocket((SOCKET)socket->internalHandle.win32Socket);
+		}
+		fplClearStruct(socket);
+	}
+}
+
+fpl_platform_api bool fplSocketBind(fplSocketHandle *socket, const fplSocketAddress *address) {
+	FPL__CheckArgumentNull(socket, false);
+	FPL__CheckArgumentNull(address, false);
+	const fpl__Win32WinsockApi *wsapi = fpl__Win32GetWinsockApi();
+	if (wsapi == fpl_null) {
+		return false;
+	}
+	if (!fpl__IsValidSocket(socket, fplSocketType_None)) {
+		return false;
+	}
+	SOCKET s = (SOCKET)socket->internalHandle.win32Socket;
+	struct sockaddr_in native;
+	fpl__SocketAddressToNative(address, &native);
+	if (wsapi->bind(s, (struct sockaddr *)&native, sizeof(native)) != 0) {
+		FPL__ERROR(FPL__MODULE_NETWORK, "Failed binding socket '%p' to port '%u', error code: %d", (void *)s, address->port, wsapi->WSAGetLastError());
+		return false;
+	}
+	return true;
+}
+
+fpl_platform_api bool fplSocketGetLocalAddress(fplSocketHandle *socket, fplSocketAddress *outAddress) {
+	FPL__CheckArgumentNull(socket, false);
+	FPL__CheckArgumentNull(outAddress, false);
+	const fpl__Win32WinsockApi *wsapi = fpl__Win32GetWinsockApi();
+	if (wsapi == fpl_null) {
+		return false;
+	}
+	if (!fpl__IsValidSocket(socket, fplSocketType_None)) {
+		return false;
+	}
+	struct sockaddr_in native;
+	int nativeLen = sizeof(native);
+	if (wsapi->getsockname((SOCKET)socket->internalHandle.win32Socket, (struct sockaddr *)&native, &nativeLen) != 0) {
+		return false;
+	}
+	fpl__SocketAddressFromNative(&native, outAddress);
+	return true;
+}
+
+fpl_platform_api bool fplSocketListen(fplSocketHandle *socket, const uint32_t backlog) {
+	FPL__CheckArgumentNull(socket, false);
+	const fpl__Win32WinsockApi *wsapi = fpl__Win32GetWinsockApi();
+	if (wsapi == fpl_null) {
+		return false;
+	}
+	if (!fpl__IsValidSocket(socket, fplSocketType_TCP)) {
+		return false;
+	}
+	if (wsapi->listen((SOCKET)socket->internalHandle.win32Socket, (int)backlog) != 0) {
+		FPL__ERROR(FPL__MODULE_NETWORK, "Failed listening on socket '%p', error code: %d", (void *)socket->internalHandle.win32Socket, wsapi->WSAGetLastError());
+		return false;
+	}
+	return true;
+}
+
+fpl_platform_api fplSocketResult fplSocketAccept(fplSocketHandle *socket, fplSocketHandle *outClient, fplSocketAddress *outAddress) {
+	FPL__CheckArgumentNull(socket, fplSocketResult_Failed);
+	FPL__CheckArgumentNull(outClient, fplSocketResult_Failed);
+	const fpl__Win32WinsockApi *wsapi = fpl__Win32GetWinsockApi();
+	if (wsapi == fpl_null) {
+		return fplSocketResult_Failed;
+	}
+	if (!fpl__IsValidSocket(socket, fplSocketType_TCP)) {
+		return fplSocketResult_Failed;
+	}
+	struct sockaddr_in native;
+	int nativeLen = sizeof(native);
+	SOCKET s = wsapi->accept((SOCKET)socket->internalHandle.win32Socket, (struct sockaddr *)&native, &nativeLen);
+	if (s == INVALID_SOCKET) {
+		fplSocketResult result = fpl__Win32GetSocketResultFromError(wsapi->WSAGetLastError());
+		return(result == fplSocketResult_Closed ? fplSocketResult_WouldBlock : result);
+	}
+	if (!fpl__Win32SetupSocket(wsapi, s, fplSocketType_TCP)) {
+		wsapi->closesocket(s);
+		return fplSocketResult_Failed;
+	}
+	fplClearStruct(outClient);
+	outClient->internalHandle.win32Socket = (uintptr_t)s;
+	outClient->type = fplSocketType_TCP;
+	outClient->isValid = true;
+	if (outAddress != fpl_null) {
+		fpl__SocketAddressFromNative(&native, outAddress);
+	}
+	return fplSocketResult_Success;
+}
+
+fpl_platform_api fplSocketResult fplSocketConnect(fplSocketHandle *socket, const fplSocketAddress *address) {
+	FPL__CheckArgumentNull(socket, fplSocketResult_Failed);
+	FPL__CheckArgumentNull(address, fplSocketResult_Failed);
+	const fpl__Win32WinsockApi *wsapi = fpl__Win32GetWinsockApi();
+	if (wsapi == fpl_null) {
+		return fplSocketResult_Failed;
+	}
+	if (!fpl__IsValidSocket(socket, fplSocketType_TCP)) {
+		return fplSocketResult_Failed;
+	}
+	struct sockaddr_in native;
+	fpl__SocketAddressToNative(address, &native);
+	if (wsapi->connect((SOCKET)socket->internalHandle.win32Socket, (struct sockaddr *)&native, sizeof(native)) != 0) {
+		fplSocketResult result = fpl__Win32GetSocketResultFromError(wsapi->WSAGetLastError());
+		return(result);
+	}
+	return fplSocketResult_Success;
+}
+
+fpl_platform_api fplSocketResult fplSocketSend(fplSocketHandle *socket, const void *data, const size_t size, size_t *outSent) {
+	FPL__CheckArgumentNull(socket, fplSocketResult_Failed);
+	FPL__CheckArgumentNull(data, fplSocketResult_Failed);
+	FPL__CheckArgumentNull(outSent, fplSocketResult_Failed);
+	FPL__CheckArgumentMax(size, INT32_MAX, fplSocketResult_Failed);
+	const fpl__Win32WinsockApi *wsapi = fpl__Win32GetWinsockApi();
+	if (wsapi == fpl_null) {
+		return fplSocketResult_Failed;
+	}
+	*outSent = 0;
+	if (!fpl__IsValidSocket(socket, fplSocketType_TCP)) {
+		return fplSocketResult_Failed;
+	}
+	int sent = wsapi->send((SOCKET)socket->internalHandle.win32Socket, (const char *)data, (int)size, 0);
+	if (sent == SOCKET_ERROR) {
+		return fpl__Win32GetSocketResultFromError(wsapi->WSAGetLastError());
+	}
+	*outSent = (size_t)sent;
+	return fplSocketResult_Success;
+}
+
+fpl_platform_api fplSocketResult fplSocketReceive(fplSocketHandle *socket, void *buffer, const size_t maxSize, size_t *outReceived) {
+	FPL__CheckArgumentNull(socket, fplSocketResult_Failed);
+	FPL__CheckArgumentNull(buffer, fplSocketResult_Failed);
+	FPL__CheckArgumentZero(maxSize, fplSocketResult_Failed);
+	FPL__CheckArgumentNull(outReceived, fplSocketResult_Failed);
+	const fpl__Win32WinsockApi *wsapi = fpl__Win32GetWinsockApi();
+	if (wsapi == fpl_null) {
+		return fplSocketResult_Failed;
+	}
+	*outReceived = 0;
+	if (!fpl__IsValidSocket(socket, fplSocketType_TCP)) {
+		return fplSocketResult_Failed;
+	}
+	int received = wsapi->recv((SOCKET)socket->internalHandle.win32Socket, (char *)buffer, (int)fplMin(maxSize, (size_t)INT32_MAX), 0);
+	if (received == SOCKET_ERROR) {
+		return fpl__Win32GetSocketResultFromError(wsapi->WSAGetLastError());
+	} else if (received == 0) {
+		return fplSocketResult_Closed;
+	}
+	*outReceived = (size_t)received;
+	return fplSocketResult_Success;
+}
+
+fpl_platform_api fplSocketResult fplSocketSendTo(fplSocketHandle *socket, const void *data, const size_t size, const fplSocketAddress *address) {
+	FPL__CheckArgumentNull(socket, fplSocketResult_Failed);
+	FPL__CheckArgumentNull(data, fplSocketResult_Failed);
+	FPL__CheckArgumentNull(address, fplSocketResult_Failed);
+	FPL__CheckArgumentMax(size, INT32_MAX, fplSocketResult_Failed);
+	const fpl__Win32WinsockApi *wsapi = fpl__Win32GetWinsockApi();
+	if (wsapi == fpl_null) {
+		return fplSocketResult_Failed;
+	}
+	if (!fpl__IsValidSocket(socket, fplSocketType_UDP)) {
+		return fplSocketResult_Failed;
+	}
+	struct sockaddr_in native;
+	fpl__SocketAddressToNative(address, &native);
+	int sent = wsapi->sendto((SOCKET)socket->internalHandle.win32Socket, (const char *)data, (int)size, 0, (struct sockaddr *)&native, sizeof(native));
+	if (sent == SOCKET_ERROR) {
+		return fpl__Win32GetSocketResultFromError(wsapi->WSAGetLastError());
+	}
+	return fplSocketResult_Success;
+}
+
+fpl_platform_api fplSocketResult fplSocketReceiveFrom(fplSocketHandle *socket, void *buffer, const size_t maxSize, fplSocketAddress *outAddress, size_t *outReceived) {
+	FPL__CheckArgumentNull(socket, fplSocketResult_Failed);
+	FPL__CheckArgumentNull(buffer, fplSocketResult_Failed);
+	FPL__CheckArgumentZero(maxSize, fplSocketResult_Failed);
+	FPL__CheckArgumentNull(outReceived, fplSocketResult_Failed);
+	const fpl__Win32WinsockApi *wsapi = fpl__Win32GetWinsockApi();
+	if (wsapi == fpl_null) {
+		return fplSocketResult_Failed;
+	}
+	*outReceived = 0;
+	if (!fpl__IsValidSocket(socket, fplSocketType_UDP)) {
+		return fplSocketResult_Failed;
+	}
+	struct sockaddr_in native;
+	int nativeLen = sizeof(native);
+	int received = wsapi->recvfrom((SOCKET)socket->internalHandle.win32Socket, (char *)buffer, (int)fplMin(maxSize, (size_t)INT32_MAX), 0, (struct sockaddr *)&native, &nativeLen);
+	if (received == SOCKET_ERROR) {
+		return fpl__Win32GetSocketResultFromError(wsapi->WSAGetLastError());
+	}
+	if (outAddress != fpl_null) {
+		fpl__SocketAddressFromNative(&native, outAddress);
+	}
+	*outReceived = (size_t)received;
+	return fplSocketResult_Success;
+}
+
+fpl_platform_api size_t fplSocketSendPackets(fplSocketHandle *socket, const fplSocketPacket *packets, const size_t count) {
+	FPL__CheckArgumentNull(socket, 0);
+	FPL__CheckArgumentNull(packets, 0);
+	// @TODO(final/Win32): Use registered I/O (RIO) for real batching
+	size_t result = 0;
+	while (result < count) {
+		const fplSocketPacket *packet = packets + result;
+		if (fplSocketSendTo(socket, packet->data, packet->size, &packet->address) != fplSocketResult_Success) {
+			break;
+		}
+		++result;
+	}
+	return(result);
+}
+
+fpl_platform_api size_t fplSocketReceivePackets(fplSocketHandle *socket, fplSocketPacket *packets, const size_t count) {
+	FPL__CheckArgumentNull(socket, 0);
+	FPL__CheckArgumentNull(packets, 0);
+	// @TODO(final/Win32): Use registered I/O (RIO) for real batching
+	size_t result = 0;
+	while (result < count) {
+		fplSocketPacket *packet = packets + result;
+		size_t received;
+		if (fplSocketReceiveFrom(socket, packet->data, packet->size, &packet->address, &received) != fplSocketResult_Success) {
+			break;
+		}
+		packet->size = received;
+		++result;
+	}
+	return(result);
+}
+
+fpl_platform_api bool fplSocketPollerCreate(const uint32_t maxSocketCount, fplSocketPoller *outPoller) {
+	FPL__CheckArgumentNull(outPoller, false);
+	// Each entry has a WSAPOLLFD and a index back to the entry
+	if (!fpl__SocketPollerInit(maxSocketCount, sizeof(WSAPOLLFD) + sizeof(uint32_t), outPoller)) {
+		return false;
+	}
+	outPoller->isValid = true;
+	return true;
+}
+
+fpl_platform_api void fplSocketPollerDestroy(fplSocketPoller *poller) {
+	if (poller != fpl_null && poller->isValid) {
+		fpl__SocketPollerRelease(poller);
+	}
+}
+
+fpl_platform_api bool fplSocketPollerAdd(fplSocketPoller *poller, fplSocketHandle *socket, const fplSocketPollFlags flags, void *userData) {
+	FPL__CheckArgumentNull(poller, false);
+	FPL__CheckArgumentNull(socket, false);
+	if (!poller->isValid || !fpl__IsValidSocket(socket, fplSocketType_None)) {
+		return false;
+	}
+	bool result = fpl__SocketPollerAddEntry(poller, socket, flags, userData) != -1;
+	return(result);
+}
+
+fpl_platform_api bool fplSocketPollerRemove(fplSocketPoller *poller, fplSocketHandle *socket) {
+	FPL__CheckArgumentNull(poller, false);
+	FPL__CheckArgumentNull(socket, false);
+	int32_t entryIndex = fpl__SocketPollerFindEntry(poller, socket);
+	if (entryIndex == -1) {
+		return false;
+	}
+	fpl__SocketPollerRemoveEntry(poller, entryIndex);
+	return true;
+}
+
+fpl_platform_api size_t fplSocketPollerWait(fplSocketPoller *poller, fplSocketEvent *events, const size_t maxEventCount, const fplTimeoutValue timeout) {
+	FPL__CheckArgumentNull(poller, 0);
+	FPL__CheckArgumentNull(events, 0);
+	FPL__CheckArgumentZero(maxEventCount, 0);
+	const fpl__Win32WinsockApi *wsapi = fpl__Win32GetWinsockApi();
+	if (wsapi == fpl_null) {
+		return 0;
+	}
+	if (!poller->isValid) {
+		return 0;
+	}
+	// @TODO(final/Win32): Use IO completion ports instead of WSAPoll()
+	WSAPOLLFD *descriptors = (WSAPOLLFD *)poller->internalHandle.pollDescriptors;
+	uint32_t *entryIndices = (uint32_t *)(descriptors + poller->capacity);
+	ULONG descriptorCount = 0;
+	for (uint32_t entryIndex = 0; entryIndex < poller->capacity; ++entryIndex) {
+		const fplSocketPollerEntry *entry = poller->entries + entryIndex;
+		if (entry->isUsed) {
+			WSAPOLLFD *descriptor = descriptors + descriptorCount;
+			descriptor->fd = (SOCKET)entry->socket.internalHandle.win32Socket;
+			descriptor->events = 0;
+			if (entry->flags & fplSocketPollFlags_Read) {
+				descriptor->events |= POLLRDNORM;
+			}
+			if (entry->flags & fplSocketPollFlags_Write) {
+				descriptor->events |= POLLWRNORM;
+			}
+			descriptor->revents = 0;
+			entryIndices[descriptorCount++] = entryIndex;
+		}
+	}
+	if (descriptorCount == 0) {
+		if (timeout > 0) {
+			Sleep(timeout == FPL_TIMEOUT_INFINITE ? INFINITE : timeout);
+		}
+		return 0;
+	}
+	int pollResult = wsapi->WSAPoll(descriptors, descriptorCount, timeout == FPL_TIMEOUT_INFINITE ? -1 : (INT)timeout);
+	size_t result = 0;
+	for (ULONG descriptorIndex = 0; pollResult > 0 && descriptorIndex < descriptorCount && result < maxEventCount; ++descriptorIndex) {
+		const WSAPOLLFD *descriptor = descriptors + descriptorIndex;
+		if (descriptor->revents == 0) {
+			continue;
+		}
+		const fplSocketPollerEntry *entry = poller->entries + entryIndices[descriptorIndex];
+		uint32_t flags = 0;
+		if (descriptor->revents & POLLRDNORM) {
+			flags |= fplSocketPollFlags_Read;
+		}
+		if (descriptor->revents & POLLWRNORM) {
+			flags |= fplSocketPollFlags_Write;
+		}
+		if (descriptor->revents & POLLHUP) {
+			flags |= fplSocketPollFlags_Closed;
+		}
+		if (descriptor->revents & (POLLERR | POLLNVAL)) {
+			flags |= fplSocketPollFlags_Error;
+		}
+		fplSocketEvent *ev = events + result++;
+		ev->socket = entry->socket;
+		ev->userData = entry->userData;
+		ev->flags = (fplSocketPollFlags)flags;
+	}
+	return(result);
+}
+
 //
 // Win32 Files
 //
@@ -11911,9 +15003,10 @@ fpl_platform_api uint64_t fplReadFileBlock64(const fplFileHandle *fileHandle, co
 		uint8_t *target = (uint8_t *)targetBuffer + bufferPos;
 		uint64_t size = fplMin(remainingSize, MaxDWORD);
 		fplAssert(size <= MaxDWORD);
-		if (ReadFile(win32FileHandle, target, (DWORD)size, &bytesRead, fpl_null) == TRUE) {
-			result = bytesRead;
+		if (ReadFile(win32FileHandle, target, (DWORD)size, &bytesRead, fpl_null) == TRUE && bytesRead > 0) {
+			result += bytesRead;
 		} else {
+			// Error or end of file
 			break;
 		}
 		remainingSize -= bytesRead;
@@ -12318,20 +15411,221 @@ fpl_platform_api bool fplListDirNext(fplFileEntry *entry) {
 				if (lstrcmpW(findData.cFileName, L".") == 0 || lstrcmpW(findData.cFileName, L"..") == 0) {
 					continue;
 				}
-				fpl__Win32FillFileEntry(entry->internalRoot.rootPath, &findData, entry);
-				result = true;
+				fpl__Win32FillFileEntry(entry->internalRoot.rootPath, &findData, entry);
+				result = true;
+				break;
+			}
+		} while (foundNext);
+	}
+	return(result);
+}
+fpl_platform_api void fplListDirEnd(fplFileEntry *entry) {
+	FPL__CheckArgumentNullNoRet(entry);
+	if (entry->internalHandle.win32FileHandle != INVALID_HANDLE_VALUE) {
+		HANDLE searchHandle = entry->internalHandle.win32FileHandle;
+		FindClose(searchHandle);
+		fplClearStruct(entry);
+	}
+}
+
+fpl_internal void fpl__WalkDirectoryRead(fpl__WalkDirectoryState *state, const char *path, const uint32_t depth, size_t *entryCount) {
+	size_t pathLength = fplGetStringLength(path);
+	char pathAndFilter[FPL_MAX_PATH_LENGTH];
+	fplCopyStringLen(path, pathLength, pathAndFilter, fplArrayCount(pathAndFilter));
+	fplEnforcePathSeparatorLen(pathAndFilter, fplArrayCount(pathAndFilter));
+	fplStringAppend("*", pathAndFilter, fplArrayCount(pathAndFilter));
+	wchar_t pathAndFilterWide[FPL_MAX_PATH_LENGTH];
+	fplUTF8StringToWideString(pathAndFilter, fplGetStringLength(pathAndFilter), pathAndFilterWide, fplArrayCount(pathAndFilterWide));
+
+	// @NOTE(final): Basic info skips the short names and large fetch reads the entries in bigger batches
+	WIN32_FIND_DATAW findData;
+	HANDLE searchHandle = FindFirstFileExW(pathAndFilterWide, FindExInfoBasic, &findData, FindExSearchNameMatch, fpl_null, FIND_FIRST_EX_LARGE_FETCH);
+	if (searchHandle == INVALID_HANDLE_VALUE) {
+		FPL__WARNING(FPL__MODULE_FILES, "Failed opening directory '%s'", path);
+		return;
+	}
+	char name[FPL_MAX_FILENAME_LENGTH];
+	do {
+		if (lstrcmpW(findData.cFileName, L".") == 0 || lstrcmpW(findData.cFileName, L"..") == 0) {
+			continue;
+		}
+		fplWideStringToUTF8String(findData.cFileName, lstrlenW(findData.cFileName), name, fplArrayCount(name));
+		DWORD attribs = findData.dwFileAttributes;
+		fplFileEntryType type = (attribs & FILE_ATTRIBUTE_DIRECTORY) ? fplFileEntryType_Directory : fplFileEntryType_File;
+		fplFileAttributeFlags attributes = fplFileAttributeFlags_None;
+		if (attribs & FILE_ATTRIBUTE_NORMAL) {
+			attributes = fplFileAttributeFlags_Normal;
+		} else {
+			if (attribs & FILE_ATTRIBUTE_HIDDEN) {
+				attributes |= fplFileAttributeFlags_Hidden;
+			}
+			if (attribs & FILE_ATTRIBUTE_ARCHIVE) {
+				attributes |= fplFileAttributeFlags_Archive;
+			}
+			if (attribs & FILE_ATTRIBUTE_SYSTEM) {
+				attributes |= fplFileAttributeFlags_System;
+			}
+		}
+		size_t size = 0;
+		if (type == fplFileEntryType_File) {
+			ULARGE_INTEGER ul;
+			ul.LowPart = findData.nFileSizeLow;
+			ul.HighPart = findData.nFileSizeHigh;
+			size = (size_t)ul.QuadPart;
+		}
+		bool isLink = (attribs & FILE_ATTRIBUTE_REPARSE_POINT) != 0;
+		if (!fpl__WalkDirectoryReport(state, path, pathLength, name, type, attributes, size, isLink, depth, entryCount)) {
+			break;
+		}
+	} while (FindNextFileW(searchHandle, &findData) == TRUE);
+	FindClose(searchHandle);
+}
+
+#define FPL__WIN32_FILE_WATCH_BUFFER_SIZE (64 * 1024)
+#define FPL__WIN32_FILE_WATCH_FILTER (FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_CREATION)
+
+fpl_internal bool fpl__Win32FileWatcherBeginRead(fpl__FileWatchDirectory *directory) {
+	BOOL result = ReadDirectoryChangesW(directory->win32DirectoryHandle, directory->win32Buffer, FPL__WIN32_FILE_WATCH_BUFFER_SIZE, directory->isRecursive ? TRUE : FALSE, FPL__WIN32_FILE_WATCH_FILTER, fpl_null, &directory->win32Overlapped, fpl_null);
+	return(result == TRUE);
+}
+
+fpl_internal void fpl__Win32FileWatcherReleaseDirectory(fpl__FileWatchDirectory *directory) {
+	if (directory->win32DirectoryHandle != INVALID_HANDLE_VALUE && directory->win32DirectoryHandle != fpl_null) {
+		// The buffer must stay valid until the pending read is cancelled
+		if (!HasOverlappedIoCompleted(&directory->win32Overlapped)) {
+			CancelIo(directory->win32DirectoryHandle);
+			DWORD bytesTransferred;
+			GetOverlappedResult(directory->win32DirectoryHandle, &directory->win32Overlapped, &bytesTransferred, TRUE);
+		}
+		CloseHandle(directory->win32DirectoryHandle);
+		directory->win32DirectoryHandle = INVALID_HANDLE_VALUE;
+	}
+	if (directory->win32Overlapped.hEvent != fpl_null) {
+		CloseHandle(directory->win32Overlapped.hEvent);
+		directory->win32Overlapped.hEvent = fpl_null;
+	}
+	if (directory->win32Buffer != fpl_null) {
+		fpl__ReleaseDynamicMemory(directory->win32Buffer);
+		directory->win32Buffer = fpl_null;
+	}
+}
+
+fpl_internal bool fpl__FileWatcherInitPlatform(fplFileWatcher *watcher) {
+	(void)watcher;
+	return(true);
+}
+
+fpl_internal void fpl__FileWatcherReleasePlatform(fplFileWatcher *watcher) {
+	fpl__FileWatcherState *state = (fpl__FileWatcherState *)watcher->internalState;
+	for (size_t directoryIndex = 0; directoryIndex < state->directoryCount; ++directoryIndex) {
+		fpl__Win32FileWatcherReleaseDirectory(state->directories[directoryIndex]);
+	}
+}
+
+fpl_internal bool fpl__FileWatcherWatchDirectory(fplFileWatcher *watcher, const char *path, const size_t pathLength, const bool isRecursive) {
+	fpl__FileWatcherState *state = (fpl__FileWatcherState *)watcher->internalState;
+	fpl__FileWatchDirectory *directory = fpl__FileWatcherFindDirectory(state, path, pathLength);
+	if (directory != fpl_null) {
+		if (isRecursive && !directory->isRecursive) {
+			// @NOTE(final): The recursive flag is applied on the next read
+			directory->isRecursive = true;
+		}
+		return(true);
+	}
+	char dirPath[FPL_MAX_PATH_LENGTH];
+	fplCopyStringLen(path, pathLength, dirPath, fplArrayCount(dirPath));
+	wchar_t dirPathWide[FPL_MAX_PATH_LENGTH];
+	fplUTF8StringToWideString(dirPath, pathLength, dirPathWide, fplArrayCount(dirPathWide));
+	HANDLE dirHandle = CreateFileW(dirPathWide, FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, fpl_null, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, fpl_null);
+	if (dirHandle == INVALID_HANDLE_VALUE) {
+		FPL__ERROR(FPL__MODULE_FILES, "Failed opening directory '%s' for watching", dirPath);
+		return(false);
+	}
+	directory = fpl__FileWatcherAddDirectory(state, path, pathLength, isRecursive);
+	if (directory == fpl_null) {
+		CloseHandle(dirHandle);
+		return(false);
+	}
+	directory->win32DirectoryHandle = dirHandle;
+	directory->win32Overlapped.hEvent = CreateEventW(fpl_null, TRUE, FALSE, fpl_null);
+	directory->win32Buffer = fpl__AllocateDynamicMemory(FPL__WIN32_FILE_WATCH_BUFFER_SIZE, 16);
+	if (directory->win32Overlapped.hEvent == fpl_null || directory->win32Buffer == fpl_null || !fpl__Win32FileWatcherBeginRead(directory)) {
+		FPL__ERROR(FPL__MODULE_FILES, "Failed watching directory '%s'", dirPath);
+		fpl__Win32FileWatcherReleaseDirectory(directory);
+		fpl__FileWatcherRemoveDirectory(state, directory);
+		return(false);
+	}
+	return(true);
+}
+
+fpl_internal void fpl__FileWatcherReadChanges(fplFileWatcher *watcher, const fplTimeoutValue timeout) {
+	fpl__FileWatcherState *state = (fpl__FileWatcherState *)watcher->internalState;
+	if (state->directoryCount == 0) {
+		return;
+	}
+	// @TODO(final/Win32): Use a IO completion port, to wait for more than MAXIMUM_WAIT_OBJECTS directories
+	HANDLE waitHandles[MAXIMUM_WAIT_OBJECTS];
+	DWORD waitCount = (DWORD)fplMin(state->directoryCount, (size_t)MAXIMUM_WAIT_OBJECTS);
+	for (DWORD waitIndex = 0; waitIndex < waitCount; ++waitIndex) {
+		waitHandles[waitIndex] = state->directories[waitIndex]->win32Overlapped.hEvent;
+	}
+	DWORD waitTime = timeout == FPL_TIMEOUT_INFINITE ? INFINITE : (DWORD)timeout;
+	if (WaitForMultipleObjects(waitCount, waitHandles, FALSE, waitTime) == WAIT_TIMEOUT) {
+		return;
+	}
+	char name[FPL_MAX_FILENAME_LENGTH];
+	char fullPath[FPL_MAX_PATH_LENGTH];
+	size_t directoryIndex = 0;
+	while (directoryIndex < state->directoryCount) {
+		fpl__FileWatchDirectory *directory = state->directories[directoryIndex];
+		DWORD bytesTransferred = 0;
+		if (!GetOverlappedResult(directory->win32DirectoryHandle, &directory->win32Overlapped, &bytesTransferred, FALSE)) {
+			if (GetLastError() != ERROR_IO_INCOMPLETE) {
+				// Directory was deleted or is not accessible anymore
+				fpl__Win32FileWatcherReleaseDirectory(directory);
+				fpl__FileWatcherRemoveDirectory(state, directory);
+				continue;
+			}
+			++directoryIndex;
+			continue;
+		}
+		if (bytesTransferred == 0) {
+			FPL__WARNING(FPL__MODULE_FILES, "Too many file changes in directory '%s', some changes are lost", directory->path);
+		}
+		const uint8_t *p = (const uint8_t *)directory->win32Buffer;
+		while (bytesTransferred > 0) {
+			const FILE_NOTIFY_INFORMATION *info = (const FILE_NOTIFY_INFORMATION *)p;
+			fplWideStringToUTF8String(info->FileName, info->FileNameLength / sizeof(wchar_t), name, fplArrayCount(name));
+			size_t pathLength = fpl__FileWatcherBuildPath(directory, name, fplGetStringLength(name), fullPath, fplArrayCount(fullPath));
+			if (pathLength > 0) {
+				fplFileWatchEventType type;
+				switch (info->Action) {
+					case FILE_ACTION_ADDED:
+					case FILE_ACTION_RENAMED_NEW_NAME:
+						type = fplFileWatchEventType_Created;
+						break;
+					case FILE_ACTION_REMOVED:
+					case FILE_ACTION_RENAMED_OLD_NAME:
+						type = fplFileWatchEventType_Deleted;
+						break;
+					default:
+						type = fplFileWatchEventType_Modified;
+						break;
+				}
+				fpl__FileWatcherPushChange(watcher, fullPath, pathLength, type);
+			}
+			if (info->NextEntryOffset == 0) {
 				break;
 			}
-		} while (foundNext);
-	}
-	return(result);
-}
-fpl_platform_api void fplListDirEnd(fplFileEntry *entry) {
-	FPL__CheckArgumentNullNoRet(entry);
-	if (entry->internalHandle.win32FileHandle != INVALID_HANDLE_VALUE) {
-		HANDLE searchHandle = entry->internalHandle.win32FileHandle;
-		FindClose(searchHandle);
-		fplClearStruct(entry);
+			p += info->NextEntryOffset;
+		}
+		if (!fpl__Win32FileWatcherBeginRead(directory)) {
+			FPL__WARNING(FPL__MODULE_FILES, "Failed watching directory '%s' again", directory->path);
+			fpl__Win32FileWatcherReleaseDirectory(directory);
+			fpl__FileWatcherRemoveDirectory(state, directory);
+			continue;
+		}
+		++directoryIndex;
 	}
 }
 
@@ -12737,8 +16031,11 @@ fpl_internal void fpl__Win32HandleMessage(const fpl__Win32Api *wapi, fpl__Platfo
 	if (appState->currentSettings.window.callbacks.eventCallback != fpl_null) {
 		appState->currentSettings.window.callbacks.eventCallback(fplGetPlatformType(), windowState, &msg, appState->currentSettings.window.callbacks.eventUserData);
 	}
+	// Events pushed while dispatching are stamped with the message time
+	fpl__SetNativeEventTime(&appState->window, (uint32_t)msg->time);
 	wapi->user.TranslateMessage(msg);
 	wapi->user.DispatchMessageW(msg);
+	fpl__SetNativeEventTime(&appState->window, 0);
 }
 
 fpl_internal bool fpl__Win32ProcessNextEvent(const fpl__Win32Api *wapi, fpl__PlatformAppState *appState, fpl__Win32WindowState *windowState) {
@@ -13251,7 +16548,7 @@ fpl_internal void fpl__InitWaitTimeSpec(const uint32_t milliseconds, struct time
 	outSpec->tv_nsec += nanoSecs;
 }
 
-void *fpl__PosixThreadProc(void *data) {
+fpl_internal void *fpl__PosixThreadProc(void *data) {
 	fplAssert(fpl__global__AppState != fpl_null);
 	const fpl__PThreadApi *pthreadApi = &fpl__global__AppState->posix.pthreadApi;
 	fplThreadHandle *thread = (fplThreadHandle *)data;
@@ -13679,7 +16976,12 @@ fpl_platform_api bool fplThreadYield() {
 	FPL__CheckPlatform(false);
 	const fpl__PlatformAppState *appState = fpl__global__AppState;
 	const fpl__PThreadApi *pthreadApi = &appState->posix.pthreadApi;
-	bool result = (pthreadApi->pthread_yield() == 0);
+	bool result;
+	if (pthreadApi->pthread_yield != fpl_null) {
+		result = (pthreadApi->pthread_yield() == 0);
+	} else {
+		result = (sched_yield() == 0);
+	}
 	return(result);
 }
 
@@ -13995,6 +17297,10 @@ fpl_platform_api void *fplMemoryAllocate(const size_t size) {
 	// Allocate empty memory to hold the size + some arbitary padding + the actual data
 	size_t newSize = sizeof(size_t) + FPL__MEMORY_PADDING + size;
 	void *basePtr = mmap(fpl_null, newSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (basePtr == MAP_FAILED) {
+		FPL__ERROR(FPL__MODULE_MEMORY, "Failed allocating memory of %zu bytes", size);
+		return fpl_null;
+	}
 	// Write the size at the beginning
 	*(size_t *)basePtr = newSize;
 	// The resulting address starts after the arbitary padding
@@ -14010,6 +17316,473 @@ fpl_platform_api void fplMemoryFree(void *ptr) {
 	munmap(basePtr, storedSize);
 }
 
+//
+// POSIX Shared Memory
+//
+fpl_internal bool fpl__PosixGetSharedMemoryPath(const char *name, char *outPath, const size_t maxOutPathLen) {
+	if (fplGetStringLength(name) == 0) {
+		FPL__ERROR(FPL__MODULE_SHAREDMEMORY, "Shared memory name are not allowed to be empty");
+		return false;
+	}
+	const char *p = name;
+	while (*p) {
+		if (*p == '/') {
+			FPL__ERROR(FPL__MODULE_SHAREDMEMORY, "Shared memory name '%s' are not allowed to contain slashes", name);
+			return false;
+		}
+		++p;
+	}
+#if defined(FPL_PLATFORM_LINUX)
+	// @NOTE(final): shm_open() is just a open() on /dev/shm in glibc, but requires librt on older versions - so we skip that dependency
+	const char *prefix = "/dev/shm/";
+#else
+	const char *prefix = "/";
+#endif
+	fplCopyString(prefix, outPath, maxOutPathLen);
+	bool result = fplStringAppend(name, outPath, maxOutPathLen) != fpl_null;
+	return(result);
+}
+
+fpl_internal int fpl__PosixOpenSharedMemory(const char *path, const int flags) {
+#if defined(FPL_PLATFORM_LINUX)
+	int result = open(path, flags | O_NOFOLLOW | O_CLOEXEC, 0600);
+#else
+	int result = shm_open(path, flags, 0600);
+#endif
+	return(result);
+}
+
+fpl_internal bool fpl__PosixUnlinkSharedMemory(const char *path) {
+#if defined(FPL_PLATFORM_LINUX)
+	bool result = unlink(path) == 0;
+#else
+	bool result = shm_unlink(path) == 0;
+#endif
+	return(result);
+}
+
+fpl_platform_api bool fplSharedMemoryCreate(const char *name, const size_t size, fplSharedMemoryHandle *outHandle) {
+	FPL__CheckArgumentNull(name, false);
+	FPL__CheckArgumentZero(size, false);
+	FPL__CheckArgumentNull(outHandle, false);
+	char path[FPL_MAX_PATH_LENGTH];
+	if (!fpl__PosixGetSharedMemoryPath(name, path, fplArrayCount(path))) {
+		return false;
+	}
+	int fd = fpl__PosixOpenSharedMemory(path, O_RDWR | O_CREAT | O_EXCL);
+	if (fd == -1) {
+		FPL__ERROR(FPL__MODULE_SHAREDMEMORY, "Failed creating shared memory '%s', error code: %d", path, errno);
+		return false;
+	}
+	if (ftruncate(fd, (off_t)size) != 0) {
+		FPL__ERROR(FPL__MODULE_SHAREDMEMORY, "Failed resizing shared memory '%s' to '%zu' bytes, error code: %d", path, size, errno);
+		close(fd);
+		fpl__PosixUnlinkSharedMemory(path);
+		return false;
+	}
+	void *base = mmap(fpl_null, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (base == MAP_FAILED) {
+		FPL__ERROR(FPL__MODULE_SHAREDMEMORY, "Failed mapping shared memory '%s', error code: %d", path, errno);
+		close(fd);
+		fpl__PosixUnlinkSharedMemory(path);
+		return false;
+	}
+	fplClearStruct(outHandle);
+	fplCopyString(name, outHandle->name, fplArrayCount(outHandle->name));
+	outHandle->internalHandle.posixFileHandle = fd;
+	outHandle->base = base;
+	outHandle->size = size;
+	outHandle->isOwner = true;
+	outHandle->isValid = true;
+	return true;
+}
+
+fpl_platform_api bool fplSharedMemoryOpen(const char *name, fplSharedMemoryHandle *outHandle) {
+	FPL__CheckArgumentNull(name, false);
+	FPL__CheckArgumentNull(outHandle, false);
+	char path[FPL_MAX_PATH_LENGTH];
+	if (!fpl__PosixGetSharedMemoryPath(name, path, fplArrayCount(path))) {
+		return false;
+	}
+	int fd = fpl__PosixOpenSharedMemory(path, O_RDWR);
+	if (fd == -1) {
+		FPL__ERROR(FPL__MODULE_SHAREDMEMORY, "Failed opening shared memory '%s', error code: %d", path, errno);
+		return false;
+	}
+	struct stat sb;
+	if (fstat(fd, &sb) != 0 || sb.st_size <= 0) {
+		FPL__ERROR(FPL__MODULE_SHAREDMEMORY, "Failed getting size of shared memory '%s'", path);
+		close(fd);
+		return false;
+	}
+	size_t size = (size_t)sb.st_size;
+	void *base = mmap(fpl_null, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (base == MAP_FAILED) {
+		FPL__ERROR(FPL__MODULE_SHAREDMEMORY, "Failed mapping shared memory '%s', error code: %d", path, errno);
+		close(fd);
+		return false;
+	}
+	fplClearStruct(outHandle);
+	fplCopyString(name, outHandle->name, fplArrayCount(outHandle->name));
+	outHandle->internalHandle.posixFileHandle = fd;
+	outHandle->base = base;
+	outHandle->size = size;
+	outHandle->isValid = true;
+	return true;
+}
+
+fpl_platform_api void fplSharedMemoryClose(fplSharedMemoryHandle *handle) {
+	if (handle != fpl_null && handle->isValid) {
+		munmap(handle->base, handle->size);
+		close(handle->internalHandle.posixFileHandle);
+		if (handle->isOwner) {
+			char path[FPL_MAX_PATH_LENGTH];
+			if (fpl__PosixGetSharedMemoryPath(handle->name, path, fplArrayCount(path))) {
+				fpl__PosixUnlinkSharedMemory(path);
+			}
+		}
+		fplClearStruct(handle);
+	}
+}
+
+fpl_platform_api bool fplSharedMemoryRemove(const char *name) {
+	FPL__CheckArgumentNull(name, false);
+	char path[FPL_MAX_PATH_LENGTH];
+	if (!fpl__PosixGetSharedMemoryPath(name, path, fplArrayCount(path))) {
+		return false;
+	}
+	bool result = fpl__PosixUnlinkSharedMemory(path);
+	return(result);
+}
+
+//
+// POSIX Network
+//
+#if defined(MSG_NOSIGNAL)
+#	define FPL__POSIX_SOCKET_SEND_FLAGS MSG_NOSIGNAL
+#else
+#	define FPL__POSIX_SOCKET_SEND_FLAGS 0
+#endif
+
+fpl_internal fplSocketResult fpl__PosixGetSocketResultFromError(const int errorCode) {
+	switch (errorCode) {
+		case EAGAIN:
+#if EWOULDBLOCK != EAGAIN
+		case EWOULDBLOCK:
+#endif
+		case EINPROGRESS:
+		case EINTR:
+			return fplSocketResult_WouldBlock;
+		case ECONNRESET:
+		case ECONNABORTED:
+		case EPIPE:
+		case ENOTCONN:
+			return fplSocketResult_Closed;
+		default:
+			return fplSocketResult_Failed;
+	}
+}
+
+fpl_internal bool fpl__PosixSetupSocket(const int fd, const fplSocketType type) {
+	int flags = fcntl(fd, F_GETFL, 0);
+	if (flags == -1 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) == -1) {
+		FPL__ERROR(FPL__MODULE_NETWORK, "Failed setting socket '%d' to non-blocking mode, error code: %d", fd, errno);
+		return false;
+	}
+	fcntl(fd, F_SETFD, FD_CLOEXEC);
+	int enabled = 1;
+	if (type == fplSocketType_TCP) {
+		setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enabled, sizeof(enabled));
+	}
+#if defined(SO_NOSIGPIPE)
+	setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &enabled, sizeof(enabled));
+#endif
+	return true;
+}
+
+fpl_platform_api bool fplSocketCreate(const fplSocketType type, fplSocketHandle *outSocket) {
+	FPL__CheckArgumentInvalid(type, type == fplSocketType_None, false);
+	FPL__CheckArgumentNull(outSocket, false);
+	int fd;
+	if (type == fplSocketType_UDP) {
+		fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	} else {
+		fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	}
+	if (fd == -1) {
+		FPL__ERROR(FPL__MODULE_NETWORK, "Failed creating socket of type '%d', error code: %d", type, errno);
+		return false;
+	}
+	if (!fpl__PosixSetupSocket(fd, type)) {
+		close(fd);
+		return false;
+	}
+	fplClearStruct(outSocket);
+	outSocket->internalHandle.posixSocket = fd;
+	outSocket->type = type;
+	outSocket->isValid = true;
+	return true;
+}
+
+fpl_platform_api void fplSocketClose(fplSocketHandle *socket) {
+	if (socket != fpl_null && socket->isValid) {
+		close(socket->internalHandle.posixSocket);
+		fplClearStruct(socket);
+	}
+}
+
+fpl_platform_api bool fplSocketBind(fplSocketHandle *socket, const fplSocketAddress *address) {
+	FPL__CheckArgumentNull(socket, false);
+	FPL__CheckArgumentNull(address, false);
+	if (!fpl__IsValidSocket(socket, fplSocketType_None)) {
+		return false;
+	}
+	int fd = socket->internalHandle.posixSocket;
+	if (socket->type == fplSocketType_TCP) {
+		// Allow restarting a server, while old connections are in TIME_WAIT
+		int enabled = 1;
+		setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &enabled, sizeof(enabled));
+	}
+	struct sockaddr_in native;
+	fpl__SocketAddressToNative(address, &native);
+	if (bind(fd, (struct sockaddr *)&native, sizeof(native)) != 0) {
+		FPL__ERROR(FPL__MODULE_NETWORK, "Failed binding socket '%d' to port '%u', error code: %d", fd, address->port, errno);
+		return false;
+	}
+	return true;
+}
+
+fpl_platform_api bool fplSocketGetLocalAddress(fplSocketHandle *socket, fplSocketAddress *outAddress) {
+	FPL__CheckArgumentNull(socket, false);
+	FPL__CheckArgumentNull(outAddress, false);
+	if (!fpl__IsValidSocket(socket, fplSocketType_None)) {
+		return false;
+	}
+	struct sockaddr_in native;
+	socklen_t nativeLen = sizeof(native);
+	if (getsockname(socket->internalHandle.posixSocket, (struct sockaddr *)&native, &nativeLen) != 0) {
+		return false;
+	}
+	fpl__SocketAddressFromNative(&native, outAddress);
+	return true;
+}
+
+fpl_platform_api bool fplSocketListen(fplSocketHandle *socket, const uint32_t backlog) {
+	FPL__CheckArgumentNull(socket, false);
+	if (!fpl__IsValidSocket(socket, fplSocketType_TCP)) {
+		return false;
+	}
+	if (listen(socket->internalHandle.posixSocket, (int)backlog) != 0) {
+		FPL__ERROR(FPL__MODULE_NETWORK, "Failed listening on socket '%d', error code: %d", socket->internalHandle.posixSocket, errno);
+		return false;
+	}
+	return true;
+}
+
+fpl_platform_api fplSocketResult fplSocketAccept(fplSocketHandle *socket, fplSocketHandle *outClient, fplSocketAddress *outAddress) {
+	FPL__CheckArgumentNull(socket, fplSocketResult_Failed);
+	FPL__CheckArgumentNull(outClient, fplSocketResult_Failed);
+	if (!fpl__IsValidSocket(socket, fplSocketType_TCP)) {
+		return fplSocketResult_Failed;
+	}
+	struct sockaddr_in native;
+	socklen_t nativeLen = sizeof(native);
+	int fd = accept(socket->internalHandle.posixSocket, (struct sockaddr *)&native, &nativeLen);
+	if (fd == -1) {
+		fplSocketResult result = fpl__PosixGetSocketResultFromError(errno);
+		return(result == fplSocketResult_Closed ? fplSocketResult_WouldBlock : result);
+	}
+	if (!fpl__PosixSetupSocket(fd, fplSocketType_TCP)) {
+		close(fd);
+		return fplSocketResult_Failed;
+	}
+	fplClearStruct(outClient);
+	outClient->internalHandle.posixSocket = fd;
+	outClient->type = fplSocketType_TCP;
+	outClient->isValid = true;
+	if (outAddress != fpl_null) {
+		fpl__SocketAddressFromNative(&native, outAddress);
+	}
+	return fplSocketResult_Success;
+}
+
+fpl_platform_api fplSocketResult fplSocketConnect(fplSocketHandle *socket, const fplSocketAddress *address) {
+	FPL__CheckArgumentNull(socket, fplSocketResult_Failed);
+	FPL__CheckArgumentNull(address, fplSocketResult_Failed);
+	if (!fpl__IsValidSocket(socket, fplSocketType_TCP)) {
+		return fplSocketResult_Failed;
+	}
+	struct sockaddr_in native;
+	fpl__SocketAddressToNative(address, &native);
+	if (connect(socket->internalHandle.posixSocket, (struct sockaddr *)&native, sizeof(native)) != 0) {
+		fplSocketResult result = fpl__PosixGetSocketResultFromError(errno);
+		return(result);
+	}
+	return fplSocketResult_Success;
+}
+
+fpl_platform_api fplSocketResult fplSocketSend(fplSocketHandle *socket, const void *data, const size_t size, size_t *outSent) {
+	FPL__CheckArgumentNull(socket, fplSocketResult_Failed);
+	FPL__CheckArgumentNull(data, fplSocketResult_Failed);
+	FPL__CheckArgumentNull(outSent, fplSocketResult_Failed);
+	*outSent = 0;
+	if (!fpl__IsValidSocket(socket, fplSocketType_TCP)) {
+		return fplSocketResult_Failed;
+	}
+	ssize_t sent = send(socket->internalHandle.posixSocket, data, size, FPL__POSIX_SOCKET_SEND_FLAGS);
+	if (sent < 0) {
+		return fpl__PosixGetSocketResultFromError(errno);
+	}
+	*outSent = (size_t)sent;
+	return fplSocketResult_Success;
+}
+
+fpl_platform_api fplSocketResult fplSocketReceive(fplSocketHandle *socket, void *buffer, const size_t maxSize, size_t *outReceived) {
+	FPL__CheckArgumentNull(socket, fplSocketResult_Failed);
+	FPL__CheckArgumentNull(buffer, fplSocketResult_Failed);
+	FPL__CheckArgumentZero(maxSize, fplSocketResult_Failed);
+	FPL__CheckArgumentNull(outReceived, fplSocketResult_Failed);
+	*outReceived = 0;
+	if (!fpl__IsValidSocket(socket, fplSocketType_TCP)) {
+		return fplSocketResult_Failed;
+	}
+	ssize_t received = recv(socket->internalHandle.posixSocket, buffer, maxSize, 0);
+	if (received < 0) {
+		return fpl__PosixGetSocketResultFromError(errno);
+	} else if (received == 0) {
+		return fplSocketResult_Closed;
+	}
+	*outReceived = (size_t)received;
+	return fplSocketResult_Success;
+}
+
+fpl_platform_api fplSocketResult fplSocketSendTo(fplSocketHandle *socket, const void *data, const size_t size, const fplSocketAddress *address) {
+	FPL__CheckArgumentNull(socket, fplSocketResult_Failed);
+	FPL__CheckArgumentNull(data, fplSocketResult_Failed);
+	FPL__CheckArgumentNull(address, fplSocketResult_Failed);
+	if (!fpl__IsValidSocket(socket, fplSocketType_UDP)) {
+		return fplSocketResult_Failed;
+	}
+	struct sockaddr_in native;
+	fpl__SocketAddressToNative(address, &native);
+	ssize_t sent = sendto(socket->internalHandle.posixSocket, data, size, FPL__POSIX_SOCKET_SEND_FLAGS, (struct sockaddr *)&native, sizeof(native));
+	if (sent < 0) {
+		return fpl__PosixGetSocketResultFromError(errno);
+	}
+	return fplSocketResult_Success;
+}
+
+fpl_platform_api fplSocketResult fplSocketReceiveFrom(fplSocketHandle *socket, void *buffer, const size_t maxSize, fplSocketAddress *outAddress, size_t *outReceived) {
+	FPL__CheckArgumentNull(socket, fplSocketResult_Failed);
+	FPL__CheckArgumentNull(buffer, fplSocketResult_Failed);
+	FPL__CheckArgumentZero(maxSize, fplSocketResult_Failed);
+	FPL__CheckArgumentNull(outReceived, fplSocketResult_Failed);
+	*outReceived = 0;
+	if (!fpl__IsValidSocket(socket, fplSocketType_UDP)) {
+		return fplSocketResult_Failed;
+	}
+	struct sockaddr_in native;
+	socklen_t nativeLen = sizeof(native);
+	ssize_t received = recvfrom(socket->internalHandle.posixSocket, buffer, maxSize, 0, (struct sockaddr *)&native, &nativeLen);
+	if (received < 0) {
+		return fpl__PosixGetSocketResultFromError(errno);
+	}
+	if (outAddress != fpl_null) {
+		fpl__SocketAddressFromNative(&native, outAddress);
+	}
+	*outReceived = (size_t)received;
+	return fplSocketResult_Success;
+}
+
+#if !defined(FPL_PLATFORM_LINUX)
+// Single datagram fallback for platforms without batched socket calls
+fpl_internal size_t fpl__PosixSocketSendPackets(fplSocketHandle *socket, const fplSocketPacket *packets, const size_t count) {
+	size_t result = 0;
+	while (result < count) {
+		const fplSocketPacket *packet = packets + result;
+		if (fplSocketSendTo(socket, packet->data, packet->size, &packet->address) != fplSocketResult_Success) {
+			break;
+		}
+		++result;
+	}
+	return(result);
+}
+
+fpl_internal size_t fpl__PosixSocketReceivePackets(fplSocketHandle *socket, fplSocketPacket *packets, const size_t count) {
+	size_t result = 0;
+	while (result < count) {
+		fplSocketPacket *packet = packets + result;
+		size_t received;
+		if (fplSocketReceiveFrom(socket, packet->data, packet->size, &packet->address, &received) != fplSocketResult_Success) {
+			break;
+		}
+		packet->size = received;
+		++result;
+	}
+	return(result);
+}
+
+// poll() based poller fallback for platforms without epoll
+fpl_internal bool fpl__PosixSocketPollerCreate(const uint32_t maxSocketCount, fplSocketPoller *outPoller) {
+	FPL__CheckArgumentNull(outPoller, false);
+	// Each entry has a pollfd and a index back to the entry
+	if (!fpl__SocketPollerInit(maxSocketCount, sizeof(struct pollfd) + sizeof(uint32_t), outPoller)) {
+		return false;
+	}
+	outPoller->isValid = true;
+	return true;
+}
+
+fpl_internal size_t fpl__PosixSocketPollerWait(fplSocketPoller *poller, fplSocketEvent *events, const size_t maxEventCount, const fplTimeoutValue timeout) {
+	struct pollfd *descriptors = (struct pollfd *)poller->internalHandle.pollDescriptors;
+	uint32_t *entryIndices = (uint32_t *)(descriptors + poller->capacity);
+	nfds_t descriptorCount = 0;
+	for (uint32_t entryIndex = 0; entryIndex < poller->capacity; ++entryIndex) {
+		const fplSocketPollerEntry *entry = poller->entries + entryIndex;
+		if (entry->isUsed) {
+			struct pollfd *descriptor = descriptors + descriptorCount;
+			descriptor->fd = entry->socket.internalHandle.posixSocket;
+			descriptor->events = 0;
+			if (entry->flags & fplSocketPollFlags_Read) {
+				descriptor->events |= POLLIN;
+			}
+			if (entry->flags & fplSocketPollFlags_Write) {
+				descriptor->events |= POLLOUT;
+			}
+			descriptor->revents = 0;
+			entryIndices[descriptorCount++] = entryIndex;
+		}
+	}
+	int pollResult = poll(descriptors, descriptorCount, timeout == FPL_TIMEOUT_INFINITE ? -1 : (int)timeout);
+	size_t result = 0;
+	for (nfds_t descriptorIndex = 0; pollResult > 0 && descriptorIndex < descriptorCount && result < maxEventCount; ++descriptorIndex) {
+		const struct pollfd *descriptor = descriptors + descriptorIndex;
+		if (descriptor->revents == 0) {
+			continue;
+		}
+		const fplSocketPollerEntry *entry = poller->entries + entryIndices[descriptorIndex];
+		fplSocketEvent *ev = events + result++;
+		ev->socket = entry->socket;
+		ev->userData = entry->userData;
+		uint32_t flags = 0;
+		if (descriptor->revents & POLLIN) {
+			flags |= fplSocketPollFlags_Read;
+		}
+		if (descriptor->revents & POLLOUT) {
+			flags |= fplSocketPollFlags_Write;
+		}
+		if (descriptor->revents & POLLHUP) {
+			flags |= fplSocketPollFlags_Closed;
+		}
+		if (descriptor->revents & (POLLERR | POLLNVAL)) {
+			flags |= fplSocketPollFlags_Error;
+		}
+		ev->flags = (fplSocketPollFlags)flags;
+	}
+	return(result);
+}
+#endif // !FPL_PLATFORM_LINUX
+
 //
 // POSIX Files
 //
@@ -14106,9 +17879,10 @@ fpl_platform_api uint64_t fplReadFileBlock64(const fplFileHandle *fileHandle, co
 		do {
 			res = read(posixFileHandle, target, size);
 		} while (res == -1 && errno == EINTR);
-		if (res != -1) {
+		if (res > 0) {
 			result += res;
 		} else {
+			// Error or end of file
 			break;
 		}
 		remainingSize -= res;
@@ -14429,7 +18203,7 @@ fpl_platform_api bool fplDirectoriesCreate(const char *path) {
 	bool result = mkdir(path, S_IRWXU | S_IRWXG | S_IRWXO) == 0;
 	return(result);
 }
-fpl_platform_api bool fplRemoveDirectory(const char *path) {
+fpl_platform_api bool fplDirectoryRemove(const char *path) {
 	FPL__CheckArgumentNull(path, false);
 	bool result = rmdir(path) == 0;
 	return(result);
@@ -14540,6 +18314,78 @@ fpl_platform_api void fplListDirEnd(fplFileEntry *entry) {
 	}
 }
 
+// Reports a single directory entry to the walker, the type is taken from d_type and stat is called only when required
+fpl_internal bool fpl__PosixWalkDirectoryEntry(fpl__WalkDirectoryState *state, const int dirFd, const char *path, const size_t pathLength, const char *name, const unsigned char dirType, const uint32_t depth, size_t *entryCount) {
+	if (name[0] == '.' && (name[1] == 0 || (name[1] == '.' && name[2] == 0))) {
+		return(true);
+	}
+	fplFileEntryType type = fplFileEntryType_Unknown;
+	bool isLink = false;
+	bool needStat = false;
+	switch (dirType) {
+		case DT_DIR:
+			type = fplFileEntryType_Directory;
+			break;
+		case DT_REG:
+			type = fplFileEntryType_File;
+			break;
+		case DT_LNK:
+			isLink = true;
+			needStat = true;
+			break;
+		case DT_UNKNOWN:
+			needStat = true;
+			break;
+		default:
+			break;
+	}
+	if (type == fplFileEntryType_File && (state->settings.flags & fplWalkDirectoryFlags_QuerySize)) {
+		needStat = true;
+	}
+	size_t size = 0;
+	if (needStat) {
+		struct stat sb;
+		if (dirType == DT_UNKNOWN && fstatat(dirFd, name, &sb, AT_SYMLINK_NOFOLLOW) == 0 && S_ISLNK(sb.st_mode)) {
+			isLink = true;
+		}
+		// @NOTE(final): Links are resolved to the type of the target
+		if (fstatat(dirFd, name, &sb, 0) == 0) {
+			if (S_ISDIR(sb.st_mode)) {
+				type = fplFileEntryType_Directory;
+			} else if (S_ISREG(sb.st_mode)) {
+				type = fplFileEntryType_File;
+				size = (size_t)sb.st_size;
+			}
+		}
+	}
+	fplFileAttributeFlags attributes = fplFileAttributeFlags_None;
+	if (name[0] == '.') {
+		// @NOTE(final): Any filename starting with dot is hidden in POSIX
+		attributes |= fplFileAttributeFlags_Hidden;
+	}
+	bool result = fpl__WalkDirectoryReport(state, path, pathLength, name, type, attributes, size, isLink, depth, entryCount);
+	return(result);
+}
+
+#if !defined(FPL_PLATFORM_LINUX)
+fpl_internal void fpl__WalkDirectoryRead(fpl__WalkDirectoryState *state, const char *path, const uint32_t depth, size_t *entryCount) {
+	DIR *dir = opendir(path);
+	if (dir == fpl_null) {
+		FPL__WARNING(FPL__MODULE_FILES, "Failed opening directory '%s'", path);
+		return;
+	}
+	size_t pathLength = fplGetStringLength(path);
+	int dirFd = dirfd(dir);
+	struct dirent *dp;
+	while ((dp = readdir(dir)) != fpl_null) {
+		if (!fpl__PosixWalkDirectoryEntry(state, dirFd, path, pathLength, dp->d_name, dp->d_type, depth, entryCount)) {
+			break;
+		}
+	}
+	closedir(dir);
+}
+#endif // !FPL_PLATFORM_LINUX
+
 //
 // POSIX Operating System
 //
@@ -15382,7 +19228,18 @@ fpl_internal void *fpl__X11ParseUriPaths(const char *text, size_t *size, int *co
 	return filesTableMemory;
 }
 
-fpl_internal void fpl__X11HandleEvent(const fpl__X11SubplatformState *subplatform, fpl__PlatformAppState *appState, XEvent *ev) {
+fpl_internal void fpl__X11SetCachedKeyState(fpl__X11WindowState *windowState, const unsigned int keyCode, const bool isDown) {
+	if (keyCode < 256) {
+		char mask = (char)(1 << (keyCode % 8));
+		if (isDown) {
+			windowState->keyStates[keyCode / 8] |= mask;
+		} else {
+			windowState->keyStates[keyCode / 8] &= ~mask;
+		}
+	}
+}
+
+fpl_internal void fpl__X11DispatchEvent(const fpl__X11SubplatformState *subplatform, fpl__PlatformAppState *appState, XEvent *ev) {
 	fplAssert((subplatform != fpl_null) && (appState != fpl_null) && (ev != fpl_null));
 	fpl__PlatformWindowState *winState = &appState->window;
 	fpl__X11WindowState *x11WinState = &winState->x11;
@@ -15559,6 +19416,7 @@ fpl_internal void fpl__X11HandleEvent(const fpl__X11SubplatformState *subplatfor
 		case KeyPress:
 		{
 			// Keyboard button down
+			fpl__X11SetCachedKeyState(x11WinState, ev->xkey.keycode, true);
 			if (!appState->currentSettings.input.disabledEvents) {
 				int keyState = ev->xkey.state;
 				uint64_t keyCode = (uint64_t)ev->xkey.keycode;
@@ -15594,10 +19452,14 @@ fpl_internal void fpl__X11HandleEvent(const fpl__X11SubplatformState *subplatfor
 				int keyState = ev->xkey.state;
 				int keyCode = ev->xkey.keycode;
 				if (physical) {
+					fpl__X11SetCachedKeyState(x11WinState, keyCode, false);
 					fpl__HandleKeyboardButtonEvent(winState, (uint64_t)keyCode, fpl__X11TranslateModifierFlags(keyState), fplButtonState_Release, true);
 				} else {
 					fpl__HandleKeyboardButtonEvent(winState, (uint64_t)keyCode, fpl__X11TranslateModifierFlags(keyState), fplButtonState_Repeat, false);
 				}
+			} else {
+				// No key-repeat detection without events, the repeated key press will set the state again
+				fpl__X11SetCachedKeyState(x11WinState, ev->xkey.keycode, false);
 			}
 		} break;
 
@@ -15664,6 +19526,12 @@ fpl_internal void fpl__X11HandleEvent(const fpl__X11SubplatformState *subplatfor
 			if (ev->xfocus.mode == NotifyGrab || ev->xfocus.mode == NotifyUngrab) {
 				return;
 			}
+
+			// Keys may have changed while we had no focus, so resync the cached keyboard state once
+			if (!x11Api->XQueryKeymap(x11WinState->display, x11WinState->keyStates)) {
+				fplClearStruct(&x11WinState->keyStates);
+			}
+
 			fpl__PushWindowStateEvent(fplWindowEventType_GotFocus);
 		} break;
 
@@ -15674,6 +19542,10 @@ fpl_internal void fpl__X11HandleEvent(const fpl__X11SubplatformState *subplatfor
 			if (ev->xfocus.mode == NotifyGrab || ev->xfocus.mode == NotifyUngrab) {
 				return;
 			}
+
+			// We wont get any key releases without focus, so all keys are treated as released
+			fplClearStruct(&x11WinState->keyStates);
+
 			fpl__PushWindowStateEvent(fplWindowEventType_LostFocus);
 		} break;
 
@@ -15715,6 +19587,56 @@ fpl_internal void fpl__X11HandleEvent(const fpl__X11SubplatformState *subplatfor
 	}
 }
 
+fpl_internal Time fpl__X11GetEventTime(const XEvent *ev) {
+	switch (ev->type) {
+		case KeyPress:
+		case KeyRelease:
+			return(ev->xkey.time);
+		case ButtonPress:
+		case ButtonRelease:
+			return(ev->xbutton.time);
+		case MotionNotify:
+			return(ev->xmotion.time);
+		case EnterNotify:
+		case LeaveNotify:
+			return(ev->xcrossing.time);
+		case PropertyNotify:
+			return(ev->xproperty.time);
+		case SelectionNotify:
+			return(ev->xselection.time);
+		case SelectionRequest:
+			return(ev->xselectionrequest.time);
+		case SelectionClear:
+			return(ev->xselectionclear.time);
+		default:
+			return(CurrentTime);
+	}
+}
+
+fpl_internal void fpl__X11HandleEvent(const fpl__X11SubplatformState *subplatform, fpl__PlatformAppState *appState, XEvent *ev) {
+	fplAssert((subplatform != fpl_null) && (appState != fpl_null) && (ev != fpl_null));
+	fpl__X11WindowState *x11WinState = &appState->window.x11;
+	const fpl__X11Api *x11Api = &appState->x11.api;
+
+	if (ev->type == ConfigureNotify && appState->currentSettings.window.isEventCoalescing) {
+		// Skip to the last configure event of a consecutive run, only the final size/position is relevant.
+		// @NOTE(final): Only the head of the queue is taken, so the order to other events (Expose, MapNotify, etc.) is kept
+		while (x11Api->XPending(x11WinState->display)) {
+			XEvent nextEvent;
+			x11Api->XPeekEvent(x11WinState->display, &nextEvent);
+			if (nextEvent.type != ConfigureNotify || nextEvent.xconfigure.window != ev->xconfigure.window) {
+				break;
+			}
+			x11Api->XNextEvent(x11WinState->display, ev);
+		}
+	}
+
+	// Events pushed for this X11 event are stamped with the server time, when there is one (CurrentTime is zero)
+	fpl__SetNativeEventTime(&appState->window, (uint32_t)fpl__X11GetEventTime(ev));
+	fpl__X11DispatchEvent(subplatform, appState, ev);
+	fpl__SetNativeEventTime(&appState->window, 0);
+}
+
 fpl_platform_api bool fplIsWindowRunning() {
 	FPL__CheckPlatform(false);
 	bool result = fpl__global__AppState->window.isRunning;
@@ -15744,7 +19666,16 @@ fpl_internal bool fpl__X11ProcessNextEvent(const fpl__X11SubplatformState *subpl
 	bool result = false;
 	const fpl__X11Api *x11Api = &subplatform->api;
 	fpl__X11WindowState *windowState = &appState->window.x11;
-	if (x11Api->XPending(windowState->display)) {
+	if (appState->currentSettings.window.isEventCoalescing) {
+		// Drain all pending events, so consecutive mouse moves and resizes can be merged in the internal queue
+		const fpl__EventQueue *eventQueue = &appState->window.eventQueue;
+		while ((eventQueue->pushCount < (FPL__MAX_EVENT_COUNT - 1)) && x11Api->XPending(windowState->display)) {
+			XEvent ev;
+			x11Api->XNextEvent(windowState->display, &ev);
+			fpl__X11HandleEvent(subplatform, appState, &ev);
+			result = true;
+		}
+	} else if (x11Api->XPending(windowState->display)) {
 		XEvent ev;
 		x11Api->XNextEvent(windowState->display, &ev);
 		fpl__X11HandleEvent(subplatform, appState, &ev);
@@ -16056,51 +19987,48 @@ fpl_platform_api bool fplPollKeyboardState(fplKeyboardState *outState) {
 	FPL__CheckPlatform(false);
 	FPL__CheckArgumentNull(outState, false);
 	fpl__PlatformAppState *appState = fpl__global__AppState;
-	const fpl__X11SubplatformState *subplatform = &appState->x11;
-	const fpl__X11Api *x11Api = &subplatform->api;
 	const fpl__X11WindowState *windowState = &appState->window.x11;
-	bool result = false;
-	char keysReturn[32] = fplZeroInit;
-	if (x11Api->XQueryKeymap(windowState->display, keysReturn)) {
-		fplClearStruct(outState);
-		for (uint64_t keyCode = 0; keyCode < 256; ++keyCode) {
-			bool isDown = (keysReturn[keyCode / 8] & (1 << (keyCode % 8))) != 0;
-			outState->keyStatesRaw[keyCode] = isDown ? 1 : 0;
-			fplKey mappedKey = fpl__GetMappedKey(&appState->window, keyCode);
-			if (outState->buttonStatesMapped[(int)mappedKey] == fplButtonState_Release) {
-				outState->buttonStatesMapped[(int)mappedKey] = isDown ? fplButtonState_Press : fplButtonState_Release;
-			}
-		}
-		outState->modifiers = fplKeyboardModifierFlags_None;
-		if (outState->buttonStatesMapped[fplKey_LeftShift] == fplButtonState_Press) {
-			outState->modifiers |= fplKeyboardModifierFlags_LShift;
-		}
-		if (outState->buttonStatesMapped[fplKey_RightShift] == fplButtonState_Press) {
-			outState->modifiers |= fplKeyboardModifierFlags_RShift;
-		}
-		if (outState->buttonStatesMapped[fplKey_LeftControl] == fplButtonState_Press) {
-			outState->modifiers |= fplKeyboardModifierFlags_LCtrl;
-		}
-		if (outState->buttonStatesMapped[fplKey_RightControl] == fplButtonState_Press) {
-			outState->modifiers |= fplKeyboardModifierFlags_RCtrl;
-		}
-		if (outState->buttonStatesMapped[fplKey_LeftAlt] == fplButtonState_Press) {
-			outState->modifiers |= fplKeyboardModifierFlags_LAlt;
-		}
-		if (outState->buttonStatesMapped[fplKey_RightAlt] == fplButtonState_Press) {
-			outState->modifiers |= fplKeyboardModifierFlags_RAlt;
-		}
-		if (outState->buttonStatesMapped[fplKey_LeftSuper] == fplButtonState_Press) {
-			outState->modifiers |= fplKeyboardModifierFlags_LSuper;
-		}
-		if (outState->buttonStatesMapped[fplKey_RightSuper] == fplButtonState_Press) {
-			outState->modifiers |= fplKeyboardModifierFlags_RSuper;
-		}
-		// @FINISH(fina/X11): Get caps states (Capslock, Numlock, Scrolllock)
 
-		result = true;
+	// @NOTE(final): Answered from the cached keyboard state, which is updated by the key/focus events.
+	// Querying the keymap from the X-Server is a synchronous round-trip, so we do that on focus-in only.
+	const char *keyStates = windowState->keyStates;
+	fplClearStruct(outState);
+	for (uint64_t keyCode = 0; keyCode < 256; ++keyCode) {
+		bool isDown = (keyStates[keyCode / 8] & (1 << (keyCode % 8))) != 0;
+		outState->keyStatesRaw[keyCode] = isDown ? 1 : 0;
+		fplKey mappedKey = fpl__GetMappedKey(&appState->window, keyCode);
+		if (outState->buttonStatesMapped[(int)mappedKey] == fplButtonState_Release) {
+			outState->buttonStatesMapped[(int)mappedKey] = isDown ? fplButtonState_Press : fplButtonState_Release;
+		}
 	}
-	return(result);
+	outState->modifiers = fplKeyboardModifierFlags_None;
+	if (outState->buttonStatesMapped[fplKey_LeftShift] == fplButtonState_Press) {
+		outState->modifiers |= fplKeyboardModifierFlags_LShift;
+	}
+	if (outState->buttonStatesMapped[fplKey_RightShift] == fplButtonState_Press) {
+		outState->modifiers |= fplKeyboardModifierFlags_RShift;
+	}
+	if (outState->buttonStatesMapped[fplKey_LeftControl] == fplButtonState_Press) {
+		outState->modifiers |= fplKeyboardModifierFlags_LCtrl;
+	}
+	if (outState->buttonStatesMapped[fplKey_RightControl] == fplButtonState_Press) {
+		outState->modifiers |= fplKeyboardModifierFlags_RCtrl;
+	}
+	if (outState->buttonStatesMapped[fplKey_LeftAlt] == fplButtonState_Press) {
+		outState->modifiers |= fplKeyboardModifierFlags_LAlt;
+	}
+	if (outState->buttonStatesMapped[fplKey_RightAlt] == fplButtonState_Press) {
+		outState->modifiers |= fplKeyboardModifierFlags_RAlt;
+	}
+	if (outState->buttonStatesMapped[fplKey_LeftSuper] == fplButtonState_Press) {
+		outState->modifiers |= fplKeyboardModifierFlags_LSuper;
+	}
+	if (outState->buttonStatesMapped[fplKey_RightSuper] == fplButtonState_Press) {
+		outState->modifiers |= fplKeyboardModifierFlags_RSuper;
+	}
+	// @FINISH(fina/X11): Get caps states (Capslock, Numlock, Scrolllock)
+
+	return(true);
 }
 
 fpl_platform_api bool fplPollMouseState(fplMouseState *outState) {
@@ -16142,6 +20070,9 @@ fpl_platform_api bool fplQueryCursorPosition(int32_t *outX, int32_t *outY) {
 #	include <sys/epoll.h> // epoll_create, epoll_ctl, epoll_wait
 #	include <sys/select.h> // select
 #	include <linux/joystick.h> // js_event, axis_state, etc.
+#	include <linux/futex.h> // FUTEX_WAIT, FUTEX_WAKE
+#	include <sys/syscall.h> // SYS_futex, syscall
+#	include <sys/inotify.h> // inotify_init1, inotify_add_watch
 
 fpl_internal void fpl__LinuxReleasePlatform(fpl__PlatformInitState *initState, fpl__PlatformAppState *appState) {
 #if defined(FPL__ENABLE_WINDOW)
@@ -16561,6 +20492,417 @@ fpl_platform_api bool fplSignalSet(fplSignalHandle *signal) {
 	return(result);
 }
 
+//
+// Linux Shared Memory
+//
+fpl_internal void fpl__SharedMemoryWaitU32(volatile uint32_t *address, const uint32_t expectedValue, const fplTimeoutValue timeout) {
+	// @NOTE(final): No FUTEX_PRIVATE_FLAG, because the futex word lives in memory shared between processes
+	if (timeout == FPL_TIMEOUT_INFINITE) {
+		syscall(SYS_futex, address, FUTEX_WAIT, expectedValue, fpl_null, fpl_null, 0);
+	} else {
+		struct timespec t;
+		t.tv_sec = timeout / 1000;
+		t.tv_nsec = (timeout % 1000) * 1000000;
+		syscall(SYS_futex, address, FUTEX_WAIT, expectedValue, &t, fpl_null, 0);
+	}
+}
+
+fpl_internal void fpl__SharedMemoryWakeU32(volatile uint32_t *address) {
+	syscall(SYS_futex, address, FUTEX_WAKE, INT32_MAX, fpl_null, fpl_null, 0);
+}
+
+//
+// Linux Files
+//
+#define FPL__LINUX_WALK_DIRECTORY_BUFFER_SIZE (32 * 1024)
+
+// @NOTE(final): Same layout as struct linux_dirent64, which is not declared in any user-space header
+typedef struct fpl__LinuxDirectoryEntry64 {
+	uint64_t d_ino;
+	int64_t d_off;
+	unsigned short d_reclen;
+	unsigned char d_type;
+	char d_name[1];
+} fpl__LinuxDirectoryEntry64;
+
+fpl_internal void fpl__WalkDirectoryRead(fpl__WalkDirectoryState *state, const char *path, const uint32_t depth, size_t *entryCount) {
+	int dirFd = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (dirFd == -1) {
+		FPL__WARNING(FPL__MODULE_FILES, "Failed opening directory '%s'", path);
+		return;
+	}
+	size_t pathLength = fplGetStringLength(path);
+	// @NOTE(final): Read many entries with a single getdents64 call, instead of going through readdir() one by one
+	uint64_t buffer[FPL__LINUX_WALK_DIRECTORY_BUFFER_SIZE / sizeof(uint64_t)];
+	bool isRunning = true;
+	while (isRunning) {
+		long bytesRead = syscall(SYS_getdents64, dirFd, buffer, sizeof(buffer));
+		if (bytesRead <= 0) {
+			if (bytesRead < 0) {
+				FPL__WARNING(FPL__MODULE_FILES, "Failed reading entries from directory '%s'", path);
+			}
+			break;
+		}
+		const uint8_t *p = (const uint8_t *)buffer;
+		const uint8_t *end = p + bytesRead;
+		while (p < end) {
+			const fpl__LinuxDirectoryEntry64 *dp = (const fpl__LinuxDirectoryEntry64 *)p;
+			if (!fpl__PosixWalkDirectoryEntry(state, dirFd, path, pathLength, dp->d_name, dp->d_type, depth, entryCount)) {
+				isRunning = false;
+				break;
+			}
+			p += dp->d_reclen;
+		}
+	}
+	close(dirFd);
+}
+
+#define FPL__LINUX_FILE_WATCH_MASK (IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR)
+
+fpl_internal bool fpl__LinuxFileWatcherAddWatch(fplFileWatcher *watcher, const char *path, const size_t pathLength, const bool isRecursive) {
+	fpl__FileWatcherState *state = (fpl__FileWatcherState *)watcher->internalState;
+	fpl__FileWatchDirectory *directory = fpl__FileWatcherFindDirectory(state, path, pathLength);
+	if (directory != fpl_null) {
+		directory->isRecursive |= isRecursive;
+		return(true);
+	}
+	char dirPath[FPL_MAX_PATH_LENGTH];
+	fplCopyStringLen(path, pathLength, dirPath, fplArrayCount(dirPath));
+	int wd = inotify_add_watch(watcher->internalHandle.linuxInotifyHandle, dirPath, FPL__LINUX_FILE_WATCH_MASK);
+	if (wd == -1) {
+		FPL__WARNING(FPL__MODULE_FILES, "Failed watching directory '%s', error code: %d", dirPath, errno);
+		return(false);
+	}
+	directory = fpl__FileWatcherAddDirectory(state, path, pathLength, isRecursive);
+	if (directory == fpl_null) {
+		inotify_rm_watch(watcher->internalHandle.linuxInotifyHandle, wd);
+		return(false);
+	}
+	directory->linuxWatchDescriptor = wd;
+	return(true);
+}
+
+typedef struct fpl__LinuxFileWatchWalkContext {
+	fplFileWatcher *watcher;
+	bool reportEntries;
+} fpl__LinuxFileWatchWalkContext;
+
+fpl_internal bool fpl__LinuxFileWatchWalkCallback(const fplWalkDirectoryEntry *entry, void *userData) {
+	fpl__LinuxFileWatchWalkContext *context = (fpl__LinuxFileWatchWalkContext *)userData;
+	size_t pathLength = fplGetStringLength(entry->fullPath);
+	if (entry->type == fplFileEntryType_Directory) {
+		fpl__LinuxFileWatcherAddWatch(context->watcher, entry->fullPath, pathLength, true);
+	}
+	if (context->reportEntries) {
+		fpl__FileWatcherPushChange(context->watcher, entry->fullPath, pathLength, fplFileWatchEventType_Created);
+	}
+	return(true);
+}
+
+// Watches all sub-directories of the given directory, because inotify is not recursive
+fpl_internal void fpl__LinuxFileWatcherWatchSubDirectories(fplFileWatcher *watcher, const char *path, const bool reportEntries) {
+	fpl__LinuxFileWatchWalkContext context = fplZeroInit;
+	context.watcher = watcher;
+	context.reportEntries = reportEntries;
+	fplWalkDirectorySettings settings;
+	fplSetDefaultWalkDirectorySettings(&settings);
+	settings.callback = fpl__LinuxFileWatchWalkCallback;
+	settings.userData = &context;
+	if (!reportEntries) {
+		settings.flags |= fplWalkDirectoryFlags_SkipFiles;
+	}
+	// @NOTE(final): The watcher is not thread-safe, so walk on the calling thread only
+	settings.threadCount = 1;
+	fplWalkDirectory(path, &settings, fpl_null);
+}
+
+fpl_internal bool fpl__FileWatcherInitPlatform(fplFileWatcher *watcher) {
+	int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (fd == -1) {
+		FPL__ERROR(FPL__MODULE_FILES, "Failed creating inotify instance, error code: %d", errno);
+		return(false);
+	}
+	watcher->internalHandle.linuxInotifyHandle = fd;
+	return(true);
+}
+
+fpl_internal void fpl__FileWatcherReleasePlatform(fplFileWatcher *watcher) {
+	// @NOTE(final): Closing the inotify instance releases all watches
+	close(watcher->internalHandle.linuxInotifyHandle);
+	watcher->internalHandle.linuxInotifyHandle = -1;
+}
+
+fpl_internal bool fpl__FileWatcherWatchDirectory(fplFileWatcher *watcher, const char *path, const size_t pathLength, const bool isRecursive) {
+	fpl__FileWatcherState *state = (fpl__FileWatcherState *)watcher->internalState;
+	fpl__FileWatchDirectory *existing = fpl__FileWatcherFindDirectory(state, path, pathLength);
+	bool wasRecursive = existing != fpl_null && existing->isRecursive;
+	if (!fpl__LinuxFileWatcherAddWatch(watcher, path, pathLength, isRecursive)) {
+		return(false);
+	}
+	if (isRecursive && !wasRecursive) {
+		char dirPath[FPL_MAX_PATH_LENGTH];
+		fplCopyStringLen(path, pathLength, dirPath, fplArrayCount(dirPath));
+		fpl__LinuxFileWatcherWatchSubDirectories(watcher, dirPath, false);
+	}
+	return(true);
+}
+
+fpl_internal void fpl__FileWatcherReadChanges(fplFileWatcher *watcher, const fplTimeoutValue timeout) {
+	fpl__FileWatcherState *state = (fpl__FileWatcherState *)watcher->internalState;
+	int fd = watcher->internalHandle.linuxInotifyHandle;
+	struct pollfd pollDescriptor = fplZeroInit;
+	pollDescriptor.fd = fd;
+	pollDescriptor.events = POLLIN;
+	int waitTime = timeout == FPL_TIMEOUT_INFINITE ? -1 : (int)timeout;
+	if (poll(&pollDescriptor, 1, waitTime) <= 0) {
+		return;
+	}
+	uint64_t buffer[4096 / sizeof(uint64_t)];
+	char fullPath[FPL_MAX_PATH_LENGTH];
+	for (;;) {
+		ssize_t bytesRead = read(fd, buffer, sizeof(buffer));
+		if (bytesRead <= 0) {
+			break;
+		}
+		const uint8_t *p = (const uint8_t *)buffer;
+		const uint8_t *end = p + bytesRead;
+		while (p < end) {
+			const struct inotify_event *ev = (const struct inotify_event *)p;
+			p += sizeof(struct inotify_event) + ev->len;
+			if (ev->mask & IN_Q_OVERFLOW) {
+				FPL__WARNING(FPL__MODULE_FILES, "Too many file changes, some changes are lost");
+				continue;
+			}
+			fpl__FileWatchDirectory *directory = fpl_null;
+			for (size_t directoryIndex = 0; directoryIndex < state->directoryCount; ++directoryIndex) {
+				if (state->directories[directoryIndex]->linuxWatchDescriptor == ev->wd) {
+					directory = state->directories[directoryIndex];
+					break;
+				}
+			}
+			if (directory == fpl_null) {
+				continue;
+			}
+			if (ev->mask & IN_IGNORED) {
+				// Directory was deleted or unmounted
+				fpl__FileWatcherRemoveDirectory(state, directory);
+				continue;
+			}
+			if (ev->len == 0) {
+				continue;
+			}
+			size_t pathLength = fpl__FileWatcherBuildPath(directory, ev->name, fplGetStringLength(ev->name), fullPath, fplArrayCount(fullPath));
+			if (pathLength == 0) {
+				continue;
+			}
+			fplFileWatchEventType type;
+			if (ev->mask & (IN_CREATE | IN_MOVED_TO)) {
+				type = fplFileWatchEventType_Created;
+			} else if (ev->mask & (IN_DELETE | IN_MOVED_FROM)) {
+				type = fplFileWatchEventType_Deleted;
+			} else {
+				type = fplFileWatchEventType_Modified;
+			}
+			fpl__FileWatcherPushChange(watcher, fullPath, pathLength, type);
+			if ((ev->mask & IN_ISDIR) && (type == fplFileWatchEventType_Created) && directory->isRecursive) {
+				// @NOTE(final): Files may be created before the watch is added, so all entries of a new directory are reported
+				fpl__LinuxFileWatcherAddWatch(watcher, fullPath, pathLength, true);
+				fpl__LinuxFileWatcherWatchSubDirectories(watcher, fullPath, true);
+			}
+		}
+	}
+}
+
+//
+// Linux Network
+//
+#define FPL__LINUX_SOCKET_BATCH_COUNT 64
+
+// @NOTE(final): Same layout as struct mmsghdr, which is only declared with _GNU_SOURCE - so we call sendmmsg/recvmmsg with syscall() directly
+typedef struct fpl__LinuxMultiMessageHeader {
+	struct msghdr msg_hdr;
+	unsigned int msg_len;
+} fpl__LinuxMultiMessageHeader;
+
+fpl_platform_api size_t fplSocketSendPackets(fplSocketHandle *socket, const fplSocketPacket *packets, const size_t count) {
+	FPL__CheckArgumentNull(socket, 0);
+	FPL__CheckArgumentNull(packets, 0);
+	if (!fpl__IsValidSocket(socket, fplSocketType_UDP)) {
+		return 0;
+	}
+	fpl__LinuxMultiMessageHeader headers[FPL__LINUX_SOCKET_BATCH_COUNT];
+	struct iovec vectors[FPL__LINUX_SOCKET_BATCH_COUNT];
+	struct sockaddr_in addresses[FPL__LINUX_SOCKET_BATCH_COUNT];
+	size_t result = 0;
+	while (result < count) {
+		size_t batchCount = fplMin(count - result, (size_t)FPL__LINUX_SOCKET_BATCH_COUNT);
+		for (size_t batchIndex = 0; batchIndex < batchCount; ++batchIndex) {
+			const fplSocketPacket *packet = packets + result + batchIndex;
+			fpl__SocketAddressToNative(&packet->address, &addresses[batchIndex]);
+			vectors[batchIndex].iov_base = packet->data;
+			vectors[batchIndex].iov_len = packet->size;
+			fpl__LinuxMultiMessageHeader *header = &headers[batchIndex];
+			fplClearStruct(header);
+			header->msg_hdr.msg_name = &addresses[batchIndex];
+			header->msg_hdr.msg_namelen = sizeof(addresses[batchIndex]);
+			header->msg_hdr.msg_iov = &vectors[batchIndex];
+			header->msg_hdr.msg_iovlen = 1;
+		}
+		int sentCount = (int)syscall(SYS_sendmmsg, socket->internalHandle.posixSocket, headers, (unsigned int)batchCount, FPL__POSIX_SOCKET_SEND_FLAGS);
+		if (sentCount <= 0) {
+			break;
+		}
+		result += (size_t)sentCount;
+		if ((size_t)sentCount < batchCount) {
+			break;
+		}
+	}
+	return(result);
+}
+
+fpl_platform_api size_t fplSocketReceivePackets(fplSocketHandle *socket, fplSocketPacket *packets, const size_t count) {
+	FPL__CheckArgumentNull(socket, 0);
+	FPL__CheckArgumentNull(packets, 0);
+	if (!fpl__IsValidSocket(socket, fplSocketType_UDP)) {
+		return 0;
+	}
+	fpl__LinuxMultiMessageHeader headers[FPL__LINUX_SOCKET_BATCH_COUNT];
+	struct iovec vectors[FPL__LINUX_SOCKET_BATCH_COUNT];
+	struct sockaddr_in addresses[FPL__LINUX_SOCKET_BATCH_COUNT];
+	size_t result = 0;
+	while (result < count) {
+		size_t batchCount = fplMin(count - result, (size_t)FPL__LINUX_SOCKET_BATCH_COUNT);
+		for (size_t batchIndex = 0; batchIndex < batchCount; ++batchIndex) {
+			fplSocketPacket *packet = packets + result + batchIndex;
+			vectors[batchIndex].iov_base = packet->data;
+			vectors[batchIndex].iov_len = packet->size;
+			fpl__LinuxMultiMessageHeader *header = &headers[batchIndex];
+			fplClearStruct(header);
+			header->msg_hdr.msg_name = &addresses[batchIndex];
+			header->msg_hdr.msg_namelen = sizeof(addresses[batchIndex]);
+			header->msg_hdr.msg_iov = &vectors[batchIndex];
+			header->msg_hdr.msg_iovlen = 1;
+		}
+		int receivedCount = (int)syscall(SYS_recvmmsg, socket->internalHandle.posixSocket, headers, (unsigned int)batchCount, MSG_DONTWAIT, fpl_null);
+		if (receivedCount <= 0) {
+			break;
+		}
+		for (int receivedIndex = 0; receivedIndex < receivedCount; ++receivedIndex) {
+			fplSocketPacket *packet = packets + result + receivedIndex;
+			packet->size = headers[receivedIndex].msg_len;
+			fpl__SocketAddressFromNative(&addresses[receivedIndex], &packet->address);
+		}
+		result += (size_t)receivedCount;
+		if ((size_t)receivedCount < batchCount) {
+			break;
+		}
+	}
+	return(result);
+}
+
+fpl_internal uint32_t fpl__LinuxGetEpollEvents(const fplSocketPollFlags flags) {
+	uint32_t result = EPOLLRDHUP;
+	if (flags & fplSocketPollFlags_Read) {
+		result |= EPOLLIN;
+	}
+	if (flags & fplSocketPollFlags_Write) {
+		result |= EPOLLOUT;
+	}
+	return(result);
+}
+
+fpl_platform_api bool fplSocketPollerCreate(const uint32_t maxSocketCount, fplSocketPoller *outPoller) {
+	FPL__CheckArgumentNull(outPoller, false);
+	if (!fpl__SocketPollerInit(maxSocketCount, 0, outPoller)) {
+		return false;
+	}
+	int epollHandle = epoll_create1(EPOLL_CLOEXEC);
+	if (epollHandle == -1) {
+		FPL__ERROR(FPL__MODULE_NETWORK, "Failed creating epoll instance, error code: %d", errno);
+		fpl__SocketPollerRelease(outPoller);
+		return false;
+	}
+	outPoller->internalHandle.linuxEpollHandle = epollHandle;
+	outPoller->isValid = true;
+	return true;
+}
+
+fpl_platform_api void fplSocketPollerDestroy(fplSocketPoller *poller) {
+	if (poller != fpl_null && poller->isValid) {
+		close(poller->internalHandle.linuxEpollHandle);
+		fpl__SocketPollerRelease(poller);
+	}
+}
+
+fpl_platform_api bool fplSocketPollerAdd(fplSocketPoller *poller, fplSocketHandle *socket, const fplSocketPollFlags flags, void *userData) {
+	FPL__CheckArgumentNull(poller, false);
+	FPL__CheckArgumentNull(socket, false);
+	if (!poller->isValid || !fpl__IsValidSocket(socket, fplSocketType_None)) {
+		return false;
+	}
+	int32_t entryIndex = fpl__SocketPollerAddEntry(poller, socket, flags, userData);
+	if (entryIndex == -1) {
+		return false;
+	}
+	struct epoll_event ev = fplZeroInit;
+	ev.events = fpl__LinuxGetEpollEvents(flags);
+	ev.data.u32 = (uint32_t)entryIndex;
+	if (epoll_ctl(poller->internalHandle.linuxEpollHandle, EPOLL_CTL_ADD, socket->internalHandle.posixSocket, &ev) != 0) {
+		FPL__ERROR(FPL__MODULE_NETWORK, "Failed adding socket '%d' to epoll, error code: %d", socket->internalHandle.posixSocket, errno);
+		fpl__SocketPollerRemoveEntry(poller, entryIndex);
+		return false;
+	}
+	return true;
+}
+
+fpl_platform_api bool fplSocketPollerRemove(fplSocketPoller *poller, fplSocketHandle *socket) {
+	FPL__CheckArgumentNull(poller, false);
+	FPL__CheckArgumentNull(socket, false);
+	int32_t entryIndex = fpl__SocketPollerFindEntry(poller, socket);
+	if (entryIndex == -1) {
+		return false;
+	}
+	epoll_ctl(poller->internalHandle.linuxEpollHandle, EPOLL_CTL_DEL, socket->internalHandle.posixSocket, fpl_null);
+	fpl__SocketPollerRemoveEntry(poller, entryIndex);
+	return true;
+}
+
+fpl_platform_api size_t fplSocketPollerWait(fplSocketPoller *poller, fplSocketEvent *events, const size_t maxEventCount, const fplTimeoutValue timeout) {
+	FPL__CheckArgumentNull(poller, 0);
+	FPL__CheckArgumentNull(events, 0);
+	FPL__CheckArgumentZero(maxEventCount, 0);
+	if (!poller->isValid) {
+		return 0;
+	}
+	struct epoll_event epollEvents[FPL__LINUX_SOCKET_BATCH_COUNT];
+	int epollEventCount = (int)fplMin(maxEventCount, (size_t)FPL__LINUX_SOCKET_BATCH_COUNT);
+	int t = timeout == FPL_TIMEOUT_INFINITE ? -1 : (int)timeout;
+	int readyCount = epoll_wait(poller->internalHandle.linuxEpollHandle, epollEvents, epollEventCount, t);
+	size_t result = 0;
+	for (int readyIndex = 0; readyIndex < readyCount; ++readyIndex) {
+		const struct epoll_event *epollEvent = &epollEvents[readyIndex];
+		const fplSocketPollerEntry *entry = poller->entries + epollEvent->data.u32;
+		uint32_t flags = 0;
+		if (epollEvent->events & EPOLLIN) {
+			flags |= fplSocketPollFlags_Read;
+		}
+		if (epollEvent->events & EPOLLOUT) {
+			flags |= fplSocketPollFlags_Write;
+		}
+		if (epollEvent->events & (EPOLLHUP | EPOLLRDHUP)) {
+			flags |= fplSocketPollFlags_Closed;
+		}
+		if (epollEvent->events & EPOLLERR) {
+			flags |= fplSocketPollFlags_Error;
+		}
+		fplSocketEvent *ev = events + result++;
+		ev->socket = entry->socket;
+		ev->userData = entry->userData;
+		ev->flags = (fplSocketPollFlags)flags;
+	}
+	return(result);
+}
+
 //
 // Linux Hardware
 //
@@ -16668,6 +21010,115 @@ fpl_internal bool fpl__UnixInitPlatform(const fplInitFlags initFlags, const fplS
 	return true;
 }
 
+//
+// Unix Shared Memory
+//
+fpl_internal void fpl__SharedMemoryWaitU32(volatile uint32_t *address, const uint32_t expectedValue, const fplTimeoutValue timeout) {
+	// @IMPLEMENT(final/Unix): Use _umtx_op() on FreeBSD to sleep across processes
+	fpl__SharedMemoryPollWaitU32(address, expectedValue, timeout);
+}
+
+fpl_internal void fpl__SharedMemoryWakeU32(volatile uint32_t *address) {
+	// Polling waiters does not need any wake up
+	(void)address;
+}
+
+//
+// Unix Files
+//
+fpl_internal bool fpl__FileWatcherInitPlatform(fplFileWatcher *watcher) {
+	// @IMPLEMENT(final/Unix): Use kqueue with EVFILT_VNODE for watching files
+	(void)watcher;
+	FPL__ERROR(FPL__MODULE_FILES, "File watching is not implemented on this platform");
+	return(false);
+}
+
+fpl_internal void fpl__FileWatcherReleasePlatform(fplFileWatcher *watcher) {
+	(void)watcher;
+}
+
+fpl_internal bool fpl__FileWatcherWatchDirectory(fplFileWatcher *watcher, const char *path, const size_t pathLength, const bool isRecursive) {
+	(void)watcher;
+	(void)path;
+	(void)pathLength;
+	(void)isRecursive;
+	return(false);
+}
+
+fpl_internal void fpl__FileWatcherReadChanges(fplFileWatcher *watcher, const fplTimeoutValue timeout) {
+	(void)watcher;
+	(void)timeout;
+}
+
+//
+// Unix Network
+//
+fpl_platform_api size_t fplSocketSendPackets(fplSocketHandle *socket, const fplSocketPacket *packets, const size_t count) {
+	FPL__CheckArgumentNull(socket, 0);
+	FPL__CheckArgumentNull(packets, 0);
+	if (!fpl__IsValidSocket(socket, fplSocketType_UDP)) {
+		return 0;
+	}
+	// @IMPLEMENT(final/Unix): Use sendmmsg() on FreeBSD 11+
+	size_t result = fpl__PosixSocketSendPackets(socket, packets, count);
+	return(result);
+}
+
+fpl_platform_api size_t fplSocketReceivePackets(fplSocketHandle *socket, fplSocketPacket *packets, const size_t count) {
+	FPL__CheckArgumentNull(socket, 0);
+	FPL__CheckArgumentNull(packets, 0);
+	if (!fpl__IsValidSocket(socket, fplSocketType_UDP)) {
+		return 0;
+	}
+	// @IMPLEMENT(final/Unix): Use recvmmsg() on FreeBSD 11+
+	size_t result = fpl__PosixSocketReceivePackets(socket, packets, count);
+	return(result);
+}
+
+fpl_platform_api bool fplSocketPollerCreate(const uint32_t maxSocketCount, fplSocketPoller *outPoller) {
+	// @IMPLEMENT(final/Unix): Use kqueue instead of poll()
+	bool result = fpl__PosixSocketPollerCreate(maxSocketCount, outPoller);
+	return(result);
+}
+
+fpl_platform_api void fplSocketPollerDestroy(fplSocketPoller *poller) {
+	if (poller != fpl_null && poller->isValid) {
+		fpl__SocketPollerRelease(poller);
+	}
+}
+
+fpl_platform_api bool fplSocketPollerAdd(fplSocketPoller *poller, fplSocketHandle *socket, const fplSocketPollFlags flags, void *userData) {
+	FPL__CheckArgumentNull(poller, false);
+	FPL__CheckArgumentNull(socket, false);
+	if (!poller->isValid || !fpl__IsValidSocket(socket, fplSocketType_None)) {
+		return false;
+	}
+	bool result = fpl__SocketPollerAddEntry(poller, socket, flags, userData) != -1;
+	return(result);
+}
+
+fpl_platform_api bool fplSocketPollerRemove(fplSocketPoller *poller, fplSocketHandle *socket) {
+	FPL__CheckArgumentNull(poller, false);
+	FPL__CheckArgumentNull(socket, false);
+	int32_t entryIndex = fpl__SocketPollerFindEntry(poller, socket);
+	if (entryIndex == -1) {
+		return false;
+	}
+	fpl__SocketPollerRemoveEntry(poller, entryIndex);
+	return true;
+}
+
+fpl_platform_api size_t fplSocketPollerWait(fplSocketPoller *poller, fplSocketEvent *events, const size_t maxEventCount, const fplTimeoutValue timeout) {
+	FPL__CheckArgumentNull(poller, 0);
+	FPL__CheckArgumentNull(events, 0);
+	FPL__CheckArgumentZero(maxEventCount, 0);
+	if (!poller->isValid) {
+		return 0;
+	}
+	size_t result = fpl__PosixSocketPollerWait(poller, events, maxEventCount, timeout);
+	return(result);
+}
+
 //
 // Unix Hardware
 //
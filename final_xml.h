@@ -14,10 +14,15 @@ The main usage is to read xml files, such as .TMX
 or other asset xml based file formats.
 
 It uses a block allocator memory scheme based on malloc.
-Use FXML_MALLOC/FXML_FREE to provide your own memory allocation function.
+Tags and strings are bump allocated from the last block, new blocks are growing geometrically.
+Use FXML_MALLOC/FXML_FREE to provide your own memory allocation function,
+or use fxmlInitWithAllocator() to parse into memory provided by the caller.
 
 The only dependencies are a C99 complaint compiler.
 
+Text, attribute values, comments, whitespaces and names are scanned 16 or 32 bytes at a time,
+when the compiler targets SSE2, AVX2 or ARM64 NEON. Define FXML_NO_SIMD to use the scalar scanning only.
+
 -------------------------------------------------------------------------------
 	Getting started
 -------------------------------------------------------------------------------
@@ -44,6 +49,201 @@ if(fxmlInitFromMemory(xml1, strlen(xml1), &ctx)) {
 	fxmlFree(&ctx);
 }
 
+-------------------------------------------------------------------------------
+	Parsing into caller memory
+-------------------------------------------------------------------------------
+
+When final_memory.h is included before this header, all parse memory can be pushed
+into a fmemMemoryBlock and released with one fmemReset() or fmemFree():
+
+fmemMemoryBlock parseMem;
+fmemInit(&parseMem, fmemType_Growable, FMEM_MEGABYTES(4));
+fxmlContext ctx = FXML_ZERO_INIT;
+if(fxmlInitFromMemoryBlock(xmlStream, xmlStreamLen, &parseMem, &ctx)) {
+	fxmlTag root = FXML_ZERO_INIT;
+	if(fxmlParse(&ctx, &root)) {
+		// ...
+	}
+	fxmlFree(&ctx); // Does not release anything, the memory belongs to the block
+}
+fmemReset(&parseMem);
+
+Any other allocator can be used with fxmlInitWithAllocator() and a fxml_allocate_callback.
+
+-------------------------------------------------------------------------------
+	Zero-copy parsing
+-------------------------------------------------------------------------------
+
+By default all names and values are copied into the parser memory (fxmlParseMode_Copy).
+
+With fxmlParseMode_View the names and values are views into the source data and only values
+with entities are decoded into parser memory. Views are NOT zero terminated, so use the nameLen/valueLen
+fields of fxmlTag or fxmlGetAttributeValueString()/fxmlGetTagValueString().
+Never pass the name or value to C-string functions and never use fxmlGetAttributeValue()/fxmlGetTagValue() in this mode:
+
+fxmlContext ctx = FXML_ZERO_INIT;
+if(fxmlInitFromMemory(xmlStream, xmlStreamLen, &ctx)) {
+	ctx.mode = fxmlParseMode_View;
+	...
+}
+
+When the source data can be modified, fxmlInitInSitu() decodes the values in place and terminates
+all names and values in the source data after parsing. Nothing is copied, except for a string ending
+at the very end of the source data, which has no byte left for its zero terminator:
+
+if(fxmlInitInSitu(mutableXmlStream, xmlStreamLen, &ctx)) {
+	...
+}
+
+In both modes the source data must be kept alive as long as the parsed tags are used.
+
+-------------------------------------------------------------------------------
+	Fast lookup
+-------------------------------------------------------------------------------
+
+All names are interned while parsing, so every tag with the same name shares the same fxmlAtom.
+Look up the atom once and compare or search with it, which is a pointer compare per tag:
+
+const fxmlAtom *objectAtom = fxmlFindAtom(&ctx, "object");
+const fxmlAtom *xAtom = fxmlFindAtom(&ctx, "x");
+for(fxmlTag *child = groupTag->firstChild; child; child = child->nextSibling) {
+	if(child->atom == objectAtom) {
+		const char *x = fxmlGetAttributeValueByAtom(child, xAtom);
+	}
+}
+
+fxmlFindAtom() returns null when the name does not appear in the document at all.
+For tags with many children or attributes, fxmlBuildIndex() adds a hashed index to the tag and all its descendants
+with at least the given number of children or attributes. All find functions use the index when there is one.
+
+-------------------------------------------------------------------------------
+	Queries
+-------------------------------------------------------------------------------
+
+A subset of XPath finds tags without walking the children by hand.
+Compile a query once and run it as often as needed, running a query never allocates any memory:
+
+fxmlQuery groundQuery;
+fxmlQueryCompile(&groundQuery, "map/layer[@name='ground']/data");
+fxmlTag *dataTag = fxmlQueryFirst(&groundQuery, &root);
+
+fxmlQuery spawnQuery;
+fxmlQueryCompile(&spawnQuery, "//object[@type='spawn']/@name");
+fxmlTag *nameAttributes[64];
+size_t count = fxmlQueryAll(&spawnQuery, &root, nameAttributes, 64); // Total count, may be more than 64
+
+Supported are child steps 'a/b', descendant steps 'a//b', any name '*', a final attribute step '@name'
+and the predicates [@name], [@name='value'], [@name!='value'] and [position], starting at one.
+Queries starting with '/' run from the top of the tree, others from the given tag.
+Matches are returned in document order without duplicates.
+Names and values are not copied, the expression must stay valid as long as the query is used.
+
+-------------------------------------------------------------------------------
+	Parallel parsing
+-------------------------------------------------------------------------------
+
+Documents with large sibling subtrees, such as the layers of a map, can be parsed on multiple threads.
+fxmlPrepareParallel() scans the structure of the document, parses everything before the first child of the root element
+and splits the children into jobs of about the same size. Each job is parsed by fxmlParseParallelJob() into its own memory,
+from any thread. fxmlFinishParallel() moves all jobs into the context, parses the rest and validates the tree:
+
+fxmlParallelJob jobs[8];
+size_t jobCount = fxmlPrepareParallel(&ctx, &root, jobs, 8);
+for(size_t i = 0; i < jobCount; ++i) {
+	RunOnWorkerThread(fxmlParseParallelJob, &jobs[i]);
+}
+WaitForAllWorkers();
+if(fxmlFinishParallel(&ctx, &root, jobs, jobCount)) {
+	// Same tree as fxmlParse() would return
+}
+fxmlFree(&ctx);
+
+The allocate callback, if any, is called from multiple threads and must be thread-safe.
+When final_platform_layer.h is included before, fxmlParseParallel() does all of this with FPL threads.
+
+-------------------------------------------------------------------------------
+	Binary cache
+-------------------------------------------------------------------------------
+
+fxmlSaveBinary() writes a parsed tree into a single relocatable blob, which can be stored next to the source file.
+fxmlLoadBinary() turns the blob back into a tree without parsing, only the pointers inside the blob are fixed up.
+The blob must be writable and stay alive as long as the tags are used, a private (copy-on-write) mapping works too.
+Loading fails when the source hash does not match, so a changed source file invalidates the cache:
+
+uint64_t sourceHash = fxmlComputeSourceHash(sourceData, sourceSize);
+fxmlContext cacheCtx = FXML_ZERO_INIT;
+fxmlTag *root = fxmlLoadBinary(cacheData, cacheSize, sourceHash, &cacheCtx);
+if(root == fxml_null) {
+	// Parse the source and save the cache
+	size_t binarySize = fxmlSaveBinary(&ctx, &parsedRoot, sourceHash, fxml_null, 0);
+	void *binary = malloc(binarySize);
+	fxmlSaveBinary(&ctx, &parsedRoot, sourceHash, binary, binarySize);
+}
+
+The blob depends on the pointer size and the byte order, it is a cache and not a exchange format.
+Names, values and atoms are the same as in fxmlParseMode_Copy, fxmlFindAtom() works on the loaded context as well.
+The loaded context owns no memory, unless fxmlBuildIndex() is used on it, which must be released with fxmlFree().
+
+-------------------------------------------------------------------------------
+	Streaming
+-------------------------------------------------------------------------------
+
+fxmlNextEvent() reads a document as a sequence of events without building any tags.
+The memory usage is the buffer provided by the caller, regardless of the document size.
+Tags must fit into the buffer, larger text is split into multiple events with isPartial set.
+
+static size_t ReadFromFile(void *userData, void *buffer, const size_t maxSize) {
+	return fread(buffer, 1, maxSize, (FILE *)userData);
+}
+
+char buffer[64 * 1024];
+fxmlReader reader;
+if(fxmlReaderInit(&reader, buffer, sizeof(buffer), ReadFromFile, file)) {
+	fxmlEvent event;
+	while(fxmlNextEvent(&reader, &event)) {
+		if(event.type == fxmlEventType_StartElement && event.depth == 1 && !IsInteresting(&event.name)) {
+			fxmlSkipElement(&reader); // Skips all attributes and children
+		}
+	}
+	if(reader.isError) {
+		// Malformed document
+	}
+}
+
+Names and values are views into the buffer and are valid until the next call to fxmlNextEvent().
+A document in writable memory can be read without a buffer, using fxmlReaderInitFromMemory().
+
+-------------------------------------------------------------------------------
+	Writing
+-------------------------------------------------------------------------------
+
+fxmlWriter writes elements, attributes and text, special characters are escaped automatically.
+With fxmlWriterInit() everything goes into a growing buffer, with fxmlWriterInitWithCallback() the buffer is
+passed to the callback whenever it is full, so files are written in large blocks.
+Pass a indentation such as "  " for pretty printing or null for the most compact output:
+
+static size_t WriteToFile(void *userData, const void *data, const size_t size) {
+	return fwrite(data, 1, size, (FILE *)userData);
+}
+
+char buffer[64 * 1024];
+fxmlWriter writer;
+fxmlWriterInitWithCallback(&writer, buffer, sizeof(buffer), WriteToFile, file, "  ");
+fxmlWriteDeclaration(&writer);
+fxmlWriteStartElement(&writer, "map");
+fxmlWriteAttribute(&writer, "name", "Tom & Jerry");
+fxmlWriteStartElement(&writer, "data");
+fxmlWriteText(&writer, "1,2,3,4");
+fxmlWriteEndElement(&writer); // </data>
+fxmlWriteTag(&writer, parsedLayerTag); // Writes a parsed tag with all its children
+fxmlWriteEndElement(&writer); // </map>
+bool success = fxmlWriterFlush(&writer);
+fxmlWriterFree(&writer);
+
+Element names are not copied and must stay valid until the element is ended.
+Elements without content are written as self closing tags.
+Indentation is never added inside of elements that contain text, so that the text stays unchanged.
+
 -------------------------------------------------------------------------------
 	License
 -------------------------------------------------------------------------------
@@ -75,7 +275,7 @@ SOFTWARE.
 
 /*!
 	\file final_xml.h
-	\version v0.2.0 alpha
+	\version v0.3.0 alpha
 	\author Torsten Spaete
 	\brief Final XML (FXML) - A open source C99 single file header xml parser library.
 */
@@ -84,6 +284,35 @@ SOFTWARE.
 	\page page_changelog Changelog
 	\tableofcontents
 
+	## v0.3.0 alpha:
+	- Changed: Inner text, attribute values, comments, whitespaces and identifiers are scanned with SSE2/AVX2/NEON when available
+	- Changed: Entity decoding copies runs without entities at once
+	- New: Added define FXML_NO_SIMD for disabling the vectorized scanning
+	- New: Added fxmlParseMode for parsing names and values as views into the source data (fxmlParseMode_View) or in place (fxmlParseMode_InSitu)
+	- New: Added fxmlInitInSitu()
+	- New: Added fields nameLen/valueLen to fxmlTag
+	- New: Added fxmlGetAttributeValueString()/fxmlGetTagValueString()
+	- New: Added atoms for interned names with fxmlFindAtom()/fxmlFindTagByAtom()/fxmlFindAttributeByAtom()/fxmlGetAttributeValueByAtom()/fxmlGetTagValueByAtom()
+	- New: Added fxmlBuildIndex() for hashed lookup of children and attributes
+	- New: Added parallel parsing with fxmlPrepareParallel()/fxmlParseParallelJob()/fxmlFinishParallel() and fxmlParseParallel() when FPL is included
+	- Changed: Parsing stops at the data size, instead of the first zero character only
+	- New: Added binary cache with fxmlSaveBinary()/fxmlLoadBinary()/fxmlComputeSourceHash()
+	- Changed: Names are interned while parsing, in copy mode every distinct name is copied once only
+	- New: Added compiled path queries with fxmlQueryCompile()/fxmlQueryFirst()/fxmlQueryAll()
+	- New: Added fxmlWriter for writing elements, attributes, escaped text and parsed tags into a buffer or a write callback
+	- New: Added streaming reader fxmlReader with fxmlReaderInit()/fxmlReaderInitFromMemory()/fxmlNextEvent()/fxmlSkipElement()
+	- Fixed: Reading past the end of source data without a zero terminator in tags, comments and entities
+	- Fixed: Closing tags with a namespace prefix were never matching
+	- Fixed: Buffer overflow for entity names longer than 16 characters
+	- Fixed: Allocations are searching no longer through all blocks, the last block is used with pointer bumping only
+	- Fixed: Tags are always aligned to pointer size
+	- Fixed: Replaced non-portable memcpy_s with FXML_MEMCPY
+	- Fixed: Out of memory is a parse error now, instead of a crash
+	- Changed: New blocks are growing geometrically, up to 16 MB per block
+	- Changed: Only tags are cleared, instead of entire blocks
+	- New: Added fxmlInitWithAllocator() for parsing into caller provided memory
+	- New: Added fxmlInitFromMemoryBlock() for parsing into a fmemMemoryBlock, when final_memory.h is included before
+
 	## v0.2.0 alpha:
 	- Fixed critical crash when allocating memory (Wrong capacity)
 	- Fixed heap corruption for UTF-8 decoding
@@ -135,6 +364,14 @@ SOFTWARE.
 #	include <string.h>
 #	define FXML_MEMSET memset
 #endif
+#ifndef FXML_MEMCPY
+#	include <string.h>
+#	define FXML_MEMCPY memcpy
+#endif
+#ifndef FXML_MEMMOVE
+#	include <string.h>
+#	define FXML_MEMMOVE memmove
+#endif
 #ifndef FXML_ASSERT
 #	include <assert.h>
 #	define FXML_ASSERT assert
@@ -180,9 +417,43 @@ extern "C" {
 		size_t capacity;
 	} fxmlMemory;
 
+	typedef enum fxmlParseMode {
+		//! Names and values are copied into the parser memory and are zero terminated
+		fxmlParseMode_Copy = 0,
+		//! Names and values are views into the source data and are not zero terminated, only values with entities are decoded into the parser memory
+		fxmlParseMode_View,
+		//! Names and values are decoded and zero terminated in the source data, which must be writable
+		fxmlParseMode_InSitu,
+	} fxmlParseMode;
+
+	//! Interned name, all tags with the same name share the same atom
+	typedef struct fxmlAtom {
+		const char *name;
+		size_t len;
+		uint32_t hash;
+		//! Unique id starting at one, in the order the names appeared in the document
+		uint32_t id;
+	} fxmlAtom;
+
+	struct fxmlTag;
+
+	//! Hashed lookup for the children and attributes of a tag, see fxmlBuildIndex()
+	typedef struct fxmlTagIndex {
+		struct fxmlTag **children;
+		struct fxmlTag **attributes;
+		uint32_t childMask;
+		uint32_t attributeMask;
+	} fxmlTagIndex;
+
 	typedef struct fxmlTag {
+		//! Name of the tag or attribute. @warning Not zero terminated with fxmlParseMode_View, only nameLen characters are valid
 		char *name;
+		//! Value of the tag or attribute. @warning Not zero terminated with fxmlParseMode_View, only valueLen characters are valid
 		char *value;
+		size_t nameLen;
+		size_t valueLen;
+		const fxmlAtom *atom;
+		fxmlTagIndex *index;
 		struct fxmlTag *parent;
 		struct fxmlTag *nextSibling;
 		struct fxmlTag *prevSibling;
@@ -194,24 +465,230 @@ extern "C" {
 		bool isClosed;
 	} fxmlTag;
 
+	//! Returns memory of at least the size with the alignment, or null when there is no memory left
+	typedef void *(fxml_allocate_callback)(void *userData, const size_t size, const size_t alignment);
+
 	typedef struct fxmlContext {
 		const void *data;
 		const char *ptr;
 		size_t size;
 		fxmlMemory *firstMem;
 		fxmlMemory *lastMem;
+		fxml_allocate_callback *allocate;
+		void *allocateUserData;
 		fxmlTag *root;
 		fxmlTag *curParent;
+		fxmlAtom **atomSlots;
+		uint32_t atomSlotCount;
+		uint32_t atomCount;
+		fxmlParseMode mode;
 		bool isError;
 	} fxmlContext;
 
+	typedef enum fxmlEventType {
+		fxmlEventType_None = 0,
+		//! Start of a element, name is the element name
+		fxmlEventType_StartElement,
+		//! Attribute of the last started element, name and value are set
+		fxmlEventType_Attribute,
+		//! Decoded text inside a element, text with whitespaces only is skipped
+		fxmlEventType_Text,
+		//! End of a element, name is the element name
+		fxmlEventType_EndElement,
+	} fxmlEventType;
+
+	typedef struct fxmlEvent {
+		fxmlString name;
+		fxmlString value;
+		fxmlEventType type;
+		//! Depth of the element, the root element has a depth of zero
+		uint32_t depth;
+		//! Text did not fit into the buffer, the next text event continues it
+		bool isPartial;
+	} fxmlEvent;
+
+	//! Reads up to maxSize bytes into the buffer and returns the number of bytes read, zero means end of stream
+	typedef size_t (fxml_read_callback)(void *userData, void *buffer, const size_t maxSize);
+
+#ifndef FXML_READER_MAX_DEPTH
+	//! Maximum element depth for fxmlReader
+#	define FXML_READER_MAX_DEPTH 256
+#endif
+
+#ifndef FXML_READER_NAME_BUFFER_SIZE
+	//! Size in bytes for the names of all open elements in fxmlReader
+#	define FXML_READER_NAME_BUFFER_SIZE (FXML_READER_MAX_DEPTH * 16)
+#endif
+
+#ifndef FXML_MAX_PARALLEL_JOBS
+	//! Maximum number of jobs for parallel parsing
+#	define FXML_MAX_PARALLEL_JOBS 64
+#endif
+
+	//! Range of sibling elements, parsed by fxmlParseParallelJob() into its own memory
+	typedef struct fxmlParallelJob {
+		fxmlContext context;
+		fxmlTag root;
+	} fxmlParallelJob;
+
+	typedef struct fxmlReader {
+		fxml_read_callback *read;
+		void *readUserData;
+		char *buffer;
+		size_t capacity;
+		size_t pos;
+		size_t end;
+		size_t tagEnd;
+		fxmlString tagName;
+		// Names of the open elements, copied because the buffer is compacted while reading
+		char names[FXML_READER_NAME_BUFFER_SIZE];
+		uint32_t nameOffsets[FXML_READER_MAX_DEPTH];
+		uint32_t namesUsed;
+		uint32_t depth;
+		bool isStarted;
+		bool isInTag;
+		bool isEndOfStream;
+		bool isSkipping;
+		bool isError;
+	} fxmlReader;
+
+	//! Writes the data and returns the number of bytes written, anything less than size is a error
+	typedef size_t (fxml_write_callback)(void *userData, const void *data, const size_t size);
+
+#ifndef FXML_WRITER_MAX_DEPTH
+	//! Maximum element depth for fxmlWriter
+#	define FXML_WRITER_MAX_DEPTH 256
+#endif
+
+	typedef struct fxmlWriter {
+		fxml_write_callback *write;
+		void *writeUserData;
+		//! Written data, with a write callback only the data not flushed yet
+		char *buffer;
+		//! Indentation for each level, null disables pretty printing
+		const char *indent;
+		size_t capacity;
+		size_t used;
+		//! Number of bytes passed to the write callback
+		size_t flushedSize;
+		fxmlString elementNames[FXML_WRITER_MAX_DEPTH];
+		uint8_t elementFlags[FXML_WRITER_MAX_DEPTH];
+		uint32_t depth;
+		bool isOwnBuffer;
+		bool isInStartTag;
+		bool isError;
+	} fxmlWriter;
+
+#ifndef FXML_QUERY_MAX_STEPS
+	//! Maximum number of steps in a query
+#	define FXML_QUERY_MAX_STEPS 16
+#endif
+#ifndef FXML_QUERY_MAX_PREDICATES
+	//! Maximum number of predicates of all steps in a query
+#	define FXML_QUERY_MAX_PREDICATES 16
+#endif
+
+	typedef enum fxmlQueryPredicateType {
+		fxmlQueryPredicateType_None = 0,
+		//! [@name]
+		fxmlQueryPredicateType_HasAttribute,
+		//! [@name='value']
+		fxmlQueryPredicateType_AttributeEquals,
+		//! [@name!='value']
+		fxmlQueryPredicateType_AttributeNotEquals,
+		//! [position], starting at one
+		fxmlQueryPredicateType_Position,
+	} fxmlQueryPredicateType;
+
+	typedef struct fxmlQueryPredicate {
+		fxmlString name;
+		fxmlString value;
+		uint32_t nameHash;
+		uint32_t position;
+		fxmlQueryPredicateType type;
+	} fxmlQueryPredicate;
+
+	typedef struct fxmlQueryStep {
+		fxmlString name;
+		uint32_t nameHash;
+		uint32_t predicateStart;
+		uint32_t predicateCount;
+		//! Step follows a '//' and matches at any depth
+		bool isDescendant;
+		//! Last step selecting a attribute of the matched elements
+		bool isAttribute;
+		//! Step matches any element name '*'
+		bool isAnyName;
+	} fxmlQueryStep;
+
+	//! Compiled query, see fxmlQueryCompile()
+	typedef struct fxmlQuery {
+		fxmlQueryStep steps[FXML_QUERY_MAX_STEPS];
+		fxmlQueryPredicate predicates[FXML_QUERY_MAX_PREDICATES];
+		uint32_t stepCount;
+		uint32_t predicateCount;
+		//! Query starts with '/' and runs from the top of the tree
+		bool isAbsolute;
+		bool isValid;
+	} fxmlQuery;
+
 	fxml_api bool fxmlInitFromMemory(const void *data, const size_t dataSize, fxmlContext *outContext);
+	fxml_api bool fxmlInitInSitu(void *data, const size_t dataSize, fxmlContext *outContext);
+	fxml_api bool fxmlInitWithAllocator(const void *data, const size_t dataSize, fxml_allocate_callback *allocate, void *userData, fxmlContext *outContext);
+#if defined(FMEM_H)
+	fxml_api bool fxmlInitFromMemoryBlock(const void *data, const size_t dataSize, fmemMemoryBlock *block, fxmlContext *outContext);
+#endif
 	fxml_api bool fxmlParse(fxmlContext *context, fxmlTag *outRoot);
 	fxml_api void fxmlFree(fxmlContext *context);
 	fxml_api fxmlTag *fxmlFindTagByName(fxmlTag *tag, const char *name);
 	fxml_api fxmlTag *fxmlFindAttributeByName(fxmlTag *tag, const char *name);
+	//! Returns the value of the attribute as a zero terminated string. @warning With fxmlParseMode_View the value is not zero terminated, use fxmlGetAttributeValueString() instead
 	fxml_api const char *fxmlGetAttributeValue(fxmlTag *tag, const char *attrName);
+	//! Returns the value of the child tag as a zero terminated string. @warning With fxmlParseMode_View the value is not zero terminated, use fxmlGetTagValueString() instead
 	fxml_api const char *fxmlGetTagValue(fxmlTag *tag, const char *tagName);
+	fxml_api fxmlString fxmlGetAttributeValueString(fxmlTag *tag, const char *attrName);
+	fxml_api fxmlString fxmlGetTagValueString(fxmlTag *tag, const char *tagName);
+
+	fxml_api const fxmlAtom *fxmlFindAtom(const fxmlContext *context, const char *name);
+	fxml_api fxmlTag *fxmlFindTagByAtom(fxmlTag *tag, const fxmlAtom *atom);
+	fxml_api fxmlTag *fxmlFindAttributeByAtom(fxmlTag *tag, const fxmlAtom *atom);
+	//! Returns the value of the attribute as a zero terminated string. @warning With fxmlParseMode_View the value is not zero terminated, use the valueLen of fxmlFindAttributeByAtom() instead
+	fxml_api const char *fxmlGetAttributeValueByAtom(fxmlTag *tag, const fxmlAtom *atom);
+	//! Returns the value of the child tag as a zero terminated string. @warning With fxmlParseMode_View the value is not zero terminated, use the valueLen of fxmlFindTagByAtom() instead
+	fxml_api const char *fxmlGetTagValueByAtom(fxmlTag *tag, const fxmlAtom *atom);
+	fxml_api bool fxmlBuildIndex(fxmlContext *context, fxmlTag *tag, const size_t minCount);
+
+	fxml_api size_t fxmlPrepareParallel(fxmlContext *context, fxmlTag *outRoot, fxmlParallelJob *jobs, const size_t maxJobs);
+	fxml_api bool fxmlParseParallelJob(fxmlParallelJob *job);
+	fxml_api bool fxmlFinishParallel(fxmlContext *context, fxmlTag *outRoot, fxmlParallelJob *jobs, const size_t jobCount);
+#if defined(FPL_HEADER_H)
+	fxml_api bool fxmlParseParallel(fxmlContext *context, fxmlTag *outRoot, const size_t threadCount);
+#endif
+
+	fxml_api uint64_t fxmlComputeSourceHash(const void *data, const size_t dataSize);
+	fxml_api size_t fxmlSaveBinary(const fxmlContext *context, const fxmlTag *root, const uint64_t sourceHash, void *buffer, const size_t bufferSize);
+	fxml_api fxmlTag *fxmlLoadBinary(void *data, const size_t dataSize, const uint64_t sourceHash, fxmlContext *outContext);
+
+	fxml_api bool fxmlReaderInit(fxmlReader *reader, void *buffer, const size_t bufferSize, fxml_read_callback *read, void *userData);
+	fxml_api bool fxmlReaderInitFromMemory(fxmlReader *reader, void *data, const size_t dataSize);
+	fxml_api bool fxmlNextEvent(fxmlReader *reader, fxmlEvent *outEvent);
+	fxml_api bool fxmlSkipElement(fxmlReader *reader);
+
+	fxml_api bool fxmlWriterInit(fxmlWriter *writer, const char *indent);
+	fxml_api bool fxmlWriterInitWithCallback(fxmlWriter *writer, void *buffer, const size_t bufferSize, fxml_write_callback *write, void *userData, const char *indent);
+	fxml_api bool fxmlWriteDeclaration(fxmlWriter *writer);
+	fxml_api bool fxmlWriteStartElement(fxmlWriter *writer, const char *name);
+	fxml_api bool fxmlWriteAttribute(fxmlWriter *writer, const char *name, const char *value);
+	fxml_api bool fxmlWriteText(fxmlWriter *writer, const char *text);
+	fxml_api bool fxmlWriteComment(fxmlWriter *writer, const char *text);
+	fxml_api bool fxmlWriteEndElement(fxmlWriter *writer);
+	fxml_api bool fxmlWriteTag(fxmlWriter *writer, const fxmlTag *tag);
+	fxml_api bool fxmlWriterFlush(fxmlWriter *writer);
+	fxml_api void fxmlWriterFree(fxmlWriter *writer);
+
+	fxml_api bool fxmlQueryCompile(fxmlQuery *query, const char *expression);
+	fxml_api fxmlTag *fxmlQueryFirst(const fxmlQuery *query, fxmlTag *tag);
+	fxml_api size_t fxmlQueryAll(const fxmlQuery *query, fxmlTag *tag, fxmlTag **outTags, const size_t maxTags);
 
 #ifdef __cplusplus
 }
@@ -230,8 +707,72 @@ extern "C" {
 #endif
 
 #define FXML__MIN_ALLOC_SIZE 4096
-#define FXML__MIN_TAG_ALLOC_COUNT 16
+#define FXML__MAX_GROW_SIZE (16 * 1024 * 1024)
 #define FXML__BLOCK_PADDING sizeof(uintptr_t)
+#define FXML__TAG_ALIGNMENT sizeof(void *)
+#define FXML__MIN_READER_BUFFER_SIZE 16
+#define FXML__MIN_ATOM_SLOT_COUNT 64
+#define FXML__WRITER_FLAG_CHILDREN 0x01
+#define FXML__WRITER_FLAG_TEXT 0x02
+
+//
+// Vectorized scanning, selected by the compiler target
+//
+#if !defined(FXML_NO_SIMD)
+#	if defined(__AVX2__)
+#		include <immintrin.h>
+#		define FXML__SIMD_AVX2
+#	elif defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#		include <emmintrin.h>
+#		define FXML__SIMD_SSE2
+#	elif (defined(__aarch64__) && defined(__ARM_NEON)) || defined(_M_ARM64)
+#		include <arm_neon.h>
+#		define FXML__SIMD_NEON
+#	endif
+#endif
+
+#if defined(FXML__SIMD_AVX2)
+typedef __m256i fxml__Vec;
+#	define FXML__SIMD_WIDTH 32
+#	define FXML__SIMD_MASK_BITS_PER_BYTE 1
+#	define fxml__VecLoad(ptr) _mm256_loadu_si256((const __m256i *)(ptr))
+#	define fxml__VecSet(c) _mm256_set1_epi8(c)
+#	define fxml__VecEq(a, b) _mm256_cmpeq_epi8(a, b)
+#	define fxml__VecGreater(a, b) _mm256_cmpgt_epi8(a, b)
+#	define fxml__VecOr(a, b) _mm256_or_si256(a, b)
+#	define fxml__VecAnd(a, b) _mm256_and_si256(a, b)
+#	define fxml__VecNot(a) _mm256_xor_si256(a, _mm256_cmpeq_epi8(a, a))
+#	define fxml__VecMask(a) ((uint64_t)(uint32_t)_mm256_movemask_epi8(a))
+#elif defined(FXML__SIMD_SSE2)
+typedef __m128i fxml__Vec;
+#	define FXML__SIMD_WIDTH 16
+#	define FXML__SIMD_MASK_BITS_PER_BYTE 1
+#	define fxml__VecLoad(ptr) _mm_loadu_si128((const __m128i *)(ptr))
+#	define fxml__VecSet(c) _mm_set1_epi8(c)
+#	define fxml__VecEq(a, b) _mm_cmpeq_epi8(a, b)
+#	define fxml__VecGreater(a, b) _mm_cmpgt_epi8(a, b)
+#	define fxml__VecOr(a, b) _mm_or_si128(a, b)
+#	define fxml__VecAnd(a, b) _mm_and_si128(a, b)
+#	define fxml__VecNot(a) _mm_xor_si128(a, _mm_cmpeq_epi8(a, a))
+#	define fxml__VecMask(a) ((uint64_t)(uint32_t)_mm_movemask_epi8(a))
+#elif defined(FXML__SIMD_NEON)
+typedef uint8x16_t fxml__Vec;
+#	define FXML__SIMD_WIDTH 16
+// There is no movemask on NEON, narrowing gives 4 bits per byte instead
+#	define FXML__SIMD_MASK_BITS_PER_BYTE 4
+#	define fxml__VecLoad(ptr) vld1q_u8((const uint8_t *)(ptr))
+#	define fxml__VecSet(c) vdupq_n_u8((uint8_t)(c))
+#	define fxml__VecEq(a, b) vceqq_u8(a, b)
+#	define fxml__VecGreater(a, b) vcgtq_s8(vreinterpretq_s8_u8(a), vreinterpretq_s8_u8(b))
+#	define fxml__VecOr(a, b) vorrq_u8(a, b)
+#	define fxml__VecAnd(a, b) vandq_u8(a, b)
+#	define fxml__VecNot(a) vmvnq_u8(a)
+#	define fxml__VecMask(a) vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(a), 4)), 0)
+#endif
+
+#if defined(FXML__SIMD_WIDTH) && defined(_MSC_VER)
+#	include <intrin.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -254,6 +795,120 @@ extern "C" {
 		return(result);
 	}
 
+#if defined(FXML__SIMD_WIDTH)
+	static inline size_t fxml__FindFirstBit(const uint64_t mask) {
+		FXML_ASSERT(mask != 0);
+#	if defined(_MSC_VER)
+		unsigned long index;
+		if ((uint32_t)mask != 0) {
+			_BitScanForward(&index, (unsigned long)(uint32_t)mask);
+		} else {
+			_BitScanForward(&index, (unsigned long)(uint32_t)(mask >> 32));
+			index += 32;
+		}
+		return((size_t)index);
+#	else
+		return((size_t)__builtin_ctzll(mask));
+#	endif
+	}
+
+	// Range check on signed bytes, bytes above 127 are negative and never in range
+	static inline fxml__Vec fxml__VecInRange(const fxml__Vec v, const char lo, const char hi) {
+		fxml__Vec result = fxml__VecAnd(fxml__VecGreater(v, fxml__VecSet(lo - 1)), fxml__VecGreater(fxml__VecSet(hi + 1), v));
+		return(result);
+	}
+
+	static inline const char *fxml__GetMaskPosition(const char *ptr, const uint64_t mask) {
+		const char *result = ptr + fxml__FindFirstBit(mask) / FXML__SIMD_MASK_BITS_PER_BYTE;
+		return(result);
+	}
+#endif
+
+	// The scan functions skip over full vectors only and stop at or before the first byte which needs the scalar checks.
+	// Without SIMD they return the pointer unchanged.
+
+	// Skips until the first zero, a or b
+	static const char *fxml__ScanUntil(const char *ptr, const char *end, const char a, const char b) {
+#if defined(FXML__SIMD_WIDTH)
+		const fxml__Vec va = fxml__VecSet(a);
+		const fxml__Vec vb = fxml__VecSet(b);
+		const fxml__Vec vzero = fxml__VecSet(0);
+		while (ptr < end && (size_t)(end - ptr) >= FXML__SIMD_WIDTH) {
+			fxml__Vec v = fxml__VecLoad(ptr);
+			fxml__Vec match = fxml__VecOr(fxml__VecOr(fxml__VecEq(v, va), fxml__VecEq(v, vb)), fxml__VecEq(v, vzero));
+			uint64_t mask = fxml__VecMask(match);
+			if (mask != 0) {
+				return fxml__GetMaskPosition(ptr, mask);
+			}
+			ptr += FXML__SIMD_WIDTH;
+		}
+#endif
+		return(ptr);
+	}
+
+	// Skips until the first non-whitespace
+	static const char *fxml__ScanWhitespaces(const char *ptr, const char *end) {
+#if defined(FXML__SIMD_WIDTH)
+		const fxml__Vec vspace = fxml__VecSet(' ');
+		const fxml__Vec vtab = fxml__VecSet('\t');
+		const fxml__Vec vlf = fxml__VecSet('\n');
+		const fxml__Vec vcr = fxml__VecSet('\r');
+		while (ptr < end && (size_t)(end - ptr) >= FXML__SIMD_WIDTH) {
+			fxml__Vec v = fxml__VecLoad(ptr);
+			fxml__Vec whitespace = fxml__VecOr(fxml__VecOr(fxml__VecEq(v, vspace), fxml__VecEq(v, vtab)), fxml__VecOr(fxml__VecEq(v, vlf), fxml__VecEq(v, vcr)));
+			uint64_t mask = fxml__VecMask(fxml__VecNot(whitespace));
+			if (mask != 0) {
+				return fxml__GetMaskPosition(ptr, mask);
+			}
+			ptr += FXML__SIMD_WIDTH;
+		}
+#endif
+		return(ptr);
+	}
+
+	// Skips until the first character which is not alpha numeric, underscore or minus
+	static const char *fxml__ScanIdent(const char *ptr, const char *end) {
+#if defined(FXML__SIMD_WIDTH)
+		const fxml__Vec vunderscore = fxml__VecSet('_');
+		const fxml__Vec vminus = fxml__VecSet('-');
+		while (ptr < end && (size_t)(end - ptr) >= FXML__SIMD_WIDTH) {
+			fxml__Vec v = fxml__VecLoad(ptr);
+			fxml__Vec alpha = fxml__VecOr(fxml__VecInRange(v, 'a', 'z'), fxml__VecInRange(v, 'A', 'Z'));
+			fxml__Vec ident = fxml__VecOr(fxml__VecOr(alpha, fxml__VecInRange(v, '0', '9')), fxml__VecOr(fxml__VecEq(v, vunderscore), fxml__VecEq(v, vminus)));
+			uint64_t mask = fxml__VecMask(fxml__VecNot(ident));
+			if (mask != 0) {
+				return fxml__GetMaskPosition(ptr, mask);
+			}
+			ptr += FXML__SIMD_WIDTH;
+		}
+#endif
+		return(ptr);
+	}
+
+	static inline const char *fxml__GetEnd(const fxmlContext *context) {
+		const char *result = (const char *)context->data + context->size;
+		return(result);
+	}
+
+	// Returns the character or zero at the end, the source data does not need to be zero terminated
+	static inline char fxml__CharAt(const char *ptr, const char *end) {
+		char result = (ptr < end) ? *ptr : 0;
+		return(result);
+	}
+
+	static inline char fxml__PeekChar(const fxmlContext *context, const size_t offset) {
+		char result = fxml__CharAt(context->ptr + offset, fxml__GetEnd(context));
+		return(result);
+	}
+
+	static const char *fxml__FindChar(const char *ptr, const char *end, const char c) {
+		ptr = fxml__ScanUntil(ptr, end, c, c);
+		while (ptr < end && *ptr != c) {
+			++ptr;
+		}
+		return(ptr);
+	}
+
 	static bool fxml__IsEqualString(const char *a, const char *b) {
 		if ((a == fxml_null) && (b == fxml_null)) {
 			return true;
@@ -274,6 +929,31 @@ extern "C" {
 		return(true);
 	}
 
+	// Compares a string with the length against a zero terminated string
+	static bool fxml__IsEqualStringLen(const char *a, const size_t aLen, const char *b) {
+		if (a == fxml_null || b == fxml_null) {
+			return (a == b);
+		}
+		for (size_t i = 0; i < aLen; ++i) {
+			if (b[i] != a[i] || !b[i]) {
+				return false;
+			}
+		}
+		return(b[aLen] == 0);
+	}
+
+	static bool fxml__IsEqualView(const char *a, const size_t aLen, const fxmlString *b) {
+		if (aLen != b->len) {
+			return false;
+		}
+		for (size_t i = 0; i < aLen; ++i) {
+			if (a[i] != b->start[i]) {
+				return false;
+			}
+		}
+		return(true);
+	}
+
 	static size_t fxml__ComputeBlockSize(const size_t minSize, const size_t blockSize) {
 		size_t result = blockSize;
 		while (result < minSize) {
@@ -291,56 +971,77 @@ extern "C" {
 				FXML_FREE(blockBase);
 				mem = next;
 			}
+			context->firstMem = context->lastMem = fxml_null;
 		}
 	}
 
-	static void *fxml__AllocMemory(fxmlContext *context, const size_t size, const size_t allocCount) {
-		// Find block which have the required space first
-		fxmlMemory *mem = context->firstMem;
-		while (mem != fxml_null) {
-			if ((mem->used + size) <= mem->capacity) {
-				break;
+	static size_t fxml__GetAlignmentPadding(const void *ptr, const size_t alignment) {
+		FXML_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0);
+		size_t result = (alignment - ((uintptr_t)ptr & (alignment - 1))) & (alignment - 1);
+		return(result);
+	}
+
+	static void *fxml__AllocMemory(fxmlContext *context, const size_t size, const size_t alignment) {
+		if (context->allocate != fxml_null) {
+			void *result = context->allocate(context->allocateUserData, size, alignment);
+			if (result == fxml_null) {
+				context->isError = true;
 			}
-			mem = mem->next;
+			return(result);
 		}
 
-		if (mem == fxml_null) {
-			// Allocate new block
-			size_t allocationSize = size * allocCount;
-			size_t headerMemorySize = sizeof(fxmlMemory) + FXML__BLOCK_PADDING;
-			size_t blockSize = fxml__ComputeBlockSize(headerMemorySize + allocationSize, FXML__MIN_ALLOC_SIZE);
-			void *blockBase = FXML_MALLOC(blockSize);
-			FXML_ASSERT(blockBase != fxml_null);
-			FXML_MEMSET(blockBase, 0, blockSize);
-
-			fxmlMemory *newBlock = (fxmlMemory *)blockBase;
-			newBlock->capacity = blockSize - headerMemorySize;
-			newBlock->used = 0;
-			newBlock->base = (uint8_t *)blockBase + headerMemorySize;
-			newBlock->next = fxml_null;
-
-			FXML_ASSERT(newBlock->capacity >= allocationSize);
-
-			if (context->lastMem == fxml_null) {
-				context->firstMem = context->lastMem = newBlock;
-			} else {
-				fxmlMemory *lastMem = (fxmlMemory *)context->lastMem;
-				lastMem->next = newBlock;
-				context->lastMem = newBlock;
+		// Only the last block is used, blocks before are full enough
+		fxmlMemory *mem = context->lastMem;
+		if (mem != fxml_null) {
+			uint8_t *ptr = (uint8_t *)mem->base + mem->used;
+			size_t padding = fxml__GetAlignmentPadding(ptr, alignment);
+			if ((mem->used + padding + size) <= mem->capacity) {
+				mem->used += padding + size;
+				return(ptr + padding);
 			}
+		}
 
-			mem = newBlock;
+		// Allocate new block, twice as large as the last one
+		size_t headerMemorySize = sizeof(fxmlMemory) + FXML__BLOCK_PADDING;
+		size_t growSize = FXML__MIN_ALLOC_SIZE;
+		if (mem != fxml_null) {
+			growSize = mem->capacity + headerMemorySize;
+			if (growSize < FXML__MAX_GROW_SIZE) {
+				growSize *= 2;
+			}
+		}
+		size_t blockSize = fxml__ComputeBlockSize(headerMemorySize + alignment + size, growSize);
+		void *blockBase = FXML_MALLOC(blockSize);
+		if (blockBase == fxml_null) {
+			context->isError = true;
+			return fxml_null;
 		}
 
+		fxmlMemory *newBlock = (fxmlMemory *)blockBase;
+		newBlock->capacity = blockSize - headerMemorySize;
+		newBlock->used = 0;
+		newBlock->base = (uint8_t *)blockBase + headerMemorySize;
+		newBlock->next = fxml_null;
 
-		void *result = (uint8_t *)mem->base + mem->used;
-		mem->used += size;
+		if (context->lastMem == fxml_null) {
+			context->firstMem = context->lastMem = newBlock;
+		} else {
+			context->lastMem->next = newBlock;
+			context->lastMem = newBlock;
+		}
 
-		return(result);
+		uint8_t *ptr = (uint8_t *)newBlock->base;
+		size_t padding = fxml__GetAlignmentPadding(ptr, alignment);
+		FXML_ASSERT(padding + size <= newBlock->capacity);
+		newBlock->used = padding + size;
+		return(ptr + padding);
 	}
 
 	static fxmlTag *fxml__AllocTag(fxmlContext *context) {
-		fxmlTag *mem = (fxmlTag *)fxml__AllocMemory(context, sizeof(fxmlTag), FXML__MIN_TAG_ALLOC_COUNT);
+		fxmlTag *mem = (fxmlTag *)fxml__AllocMemory(context, sizeof(fxmlTag), FXML__TAG_ALIGNMENT);
+		if (mem != fxml_null) {
+			FXML_MEMSET(mem, 0, sizeof(*mem));
+		}
 		return(mem);
 	}
 
@@ -348,30 +1049,43 @@ extern "C" {
 		size_t requiredLen = str->len + 1;
 		size_t requiredSize = sizeof(char) * requiredLen;
 		char *mem = (char *)fxml__AllocMemory(context, requiredSize, 1);
+		if (mem == fxml_null) {
+			return fxml_null;
+		}
 		size_t len = str->len;
-		memcpy_s(mem, len + 1, str->start, len);
+		FXML_MEMCPY(mem, str->start, len);
+		mem[len] = 0;
 		return(mem);
 	}
 
-	static char *fxml__AllocStringDecode(fxmlContext *context, const fxmlString *str) {
-		size_t requiredLen = (str->len * 1) + 1;
-		size_t requiredSize = sizeof(char) * requiredLen;
-		char *mem = (char *)fxml__AllocMemory(context, requiredSize, 1);
+	// Decodes the entities into the destination and returns the decoded length.
+	// The destination may be the source itself, because decoding never grows the text.
+	static size_t fxml__DecodeString(fxmlContext *context, const fxmlString *str, char *dstStart) {
 		const char *src = str->start;
 		const char *srcEnd = str->start + str->len;
-		const char *srcPartStart = str->start;
-		char *dst = mem;
+		char *dst = dstStart;
 		while (src < srcEnd) {
+			// Copy everything until the next entity at once
+			const char *run = fxml__ScanUntil(src, srcEnd, '&', '&');
+			if (run > src) {
+				size_t runLen = run - src;
+				if (dst != src) {
+					FXML_MEMMOVE(dst, src, runLen);
+				}
+				dst += runLen;
+				src = run;
+				continue;
+			}
 			if (*src == '&') {
 				++src;
-				if (*src == '#') {
+				if (fxml__CharAt(src, srcEnd) == '#') {
 					++src;
 					uint64_t escapeCode = 0;
-					if (!fxml__IsNumeric(*src)) {
+					if (!fxml__IsNumeric(fxml__CharAt(src, srcEnd))) {
 						context->isError = true;
-						goto done;
+						break;
 					}
-					while (fxml__IsNumeric(*src)) {
+					while (fxml__IsNumeric(fxml__CharAt(src, srcEnd))) {
 						uint32_t v = *src - '0';
 						escapeCode = escapeCode * 10 + v;
 						++src;
@@ -379,13 +1093,13 @@ extern "C" {
 					if (escapeCode > 0 && escapeCode < 256) {
 						*dst++ = (char)escapeCode;
 					}
-				} else if (fxml__IsAlpha(*src)) {
+				} else if (fxml__IsAlpha(fxml__CharAt(src, srcEnd))) {
 					char symbolName[16 + 1];
 					const char *symbolStart = src;
 					size_t symbolLen = 0;
-					while (fxml__IsAlpha(*src)) {
+					while (fxml__IsAlpha(fxml__CharAt(src, srcEnd))) {
 						size_t symbolIndex = src - symbolStart;
-						if (symbolIndex < FXML_ARRAYCOUNT(symbolName)) {
+						if (symbolIndex < (FXML_ARRAYCOUNT(symbolName) - 1)) {
 							symbolName[symbolIndex] = *src;
 							++symbolLen;
 						}
@@ -404,9 +1118,9 @@ extern "C" {
 						*dst++ = '>';
 					}
 				}
-				if (*src != ';') {
+				if (fxml__CharAt(src, srcEnd) != ';') {
 					context->isError = true;
-					goto done;
+					break;
 				}
 				++src;
 				continue;
@@ -415,12 +1129,184 @@ extern "C" {
 			}
 			++src;
 		}
+		size_t result = dst - dstStart;
+		return(result);
+	}
 
-	done:
-		*dst = 0;
+	static char *fxml__AllocStringDecode(fxmlContext *context, const fxmlString *str, size_t *outLen) {
+		size_t requiredLen = (str->len * 1) + 1;
+		size_t requiredSize = sizeof(char) * requiredLen;
+		char *mem = (char *)fxml__AllocMemory(context, requiredSize, 1);
+		if (mem == fxml_null) {
+			*outLen = 0;
+			return fxml_null;
+		}
+		size_t len = fxml__DecodeString(context, str, mem);
+		mem[len] = 0;
+		*outLen = len;
 		return(mem);
 	}
 
+	static bool fxml__HasEntities(const fxmlString *str) {
+		const char *end = str->start + str->len;
+		const char *p = fxml__ScanUntil(str->start, end, '&', '&');
+		while (p < end && *p != '&') {
+			++p;
+		}
+		return(p < end);
+	}
+
+	static uint32_t fxml__HashString(const char *str, const size_t len) {
+		// FNV-1a
+		uint32_t result = 2166136261u;
+		for (size_t i = 0; i < len; ++i) {
+			result ^= (uint8_t)str[i];
+			result *= 16777619u;
+		}
+		return(result);
+	}
+
+	static uint32_t fxml__HashZeroString(const char *str) {
+		uint32_t result = 2166136261u;
+		while (*str) {
+			result ^= (uint8_t)*str++;
+			result *= 16777619u;
+		}
+		return(result);
+	}
+
+	static bool fxml__GrowAtomSlots(fxmlContext *context) {
+		uint32_t newSlotCount = (context->atomSlotCount > 0) ? context->atomSlotCount * 2 : FXML__MIN_ATOM_SLOT_COUNT;
+		fxmlAtom **newSlots = (fxmlAtom **)fxml__AllocMemory(context, sizeof(fxmlAtom *) * newSlotCount, sizeof(fxmlAtom *));
+		if (newSlots == fxml_null) {
+			return false;
+		}
+		FXML_MEMSET(newSlots, 0, sizeof(fxmlAtom *) * newSlotCount);
+		uint32_t mask = newSlotCount - 1;
+		for (uint32_t i = 0; i < context->atomSlotCount; ++i) {
+			fxmlAtom *atom = context->atomSlots[i];
+			if (atom != fxml_null) {
+				uint32_t index = atom->hash & mask;
+				while (newSlots[index] != fxml_null) {
+					index = (index + 1) & mask;
+				}
+				newSlots[index] = atom;
+			}
+		}
+		// The old slots are released with the parser memory
+		context->atomSlots = newSlots;
+		context->atomSlotCount = newSlotCount;
+		return(true);
+	}
+
+	// Returns the atom for the name, a new atom is added when the name appears the first time
+	static const fxmlAtom *fxml__InternName(fxmlContext *context, const fxmlString *str) {
+		if ((context->atomCount + 1) * 2 > context->atomSlotCount) {
+			if (!fxml__GrowAtomSlots(context)) {
+				return fxml_null;
+			}
+		}
+		uint32_t hash = fxml__HashString(str->start, str->len);
+		uint32_t mask = context->atomSlotCount - 1;
+		uint32_t index = hash & mask;
+		while (context->atomSlots[index] != fxml_null) {
+			const fxmlAtom *atom = context->atomSlots[index];
+			if (atom->hash == hash && fxml__IsEqualView(atom->name, atom->len, str)) {
+				return(atom);
+			}
+			index = (index + 1) & mask;
+		}
+		fxmlAtom *atom = (fxmlAtom *)fxml__AllocMemory(context, sizeof(fxmlAtom), FXML__TAG_ALIGNMENT);
+		if (atom == fxml_null) {
+			return fxml_null;
+		}
+		if (context->mode == fxmlParseMode_Copy) {
+			// Every name is copied once only
+			atom->name = fxml__AllocString(context, str);
+			if (atom->name == fxml_null) {
+				return fxml_null;
+			}
+		} else {
+			atom->name = str->start;
+		}
+		atom->len = str->len;
+		atom->hash = hash;
+		atom->id = ++context->atomCount;
+		context->atomSlots[index] = atom;
+		return(atom);
+	}
+
+	static void fxml__SetName(fxmlContext *context, fxmlTag *tag, const fxmlString *str) {
+		tag->atom = fxml__InternName(context, str);
+		if (tag->atom == fxml_null) {
+			return;
+		}
+		if (context->mode == fxmlParseMode_Copy) {
+			tag->name = (char *)tag->atom->name;
+		} else {
+			tag->name = (char *)str->start;
+		}
+		tag->nameLen = str->len;
+	}
+
+	static void fxml__SetValue(fxmlContext *context, fxmlTag *tag, const fxmlString *str) {
+		if (context->mode == fxmlParseMode_InSitu) {
+			// The zero terminator is written after parsing, the character after the value is still needed
+			char *start = (char *)str->start;
+			tag->value = start;
+			tag->valueLen = fxml__DecodeString(context, str, start);
+		} else if (context->mode == fxmlParseMode_View && !fxml__HasEntities(str)) {
+			tag->value = (char *)str->start;
+			tag->valueLen = str->len;
+		} else {
+			tag->value = fxml__AllocStringDecode(context, str, &tag->valueLen);
+		}
+	}
+
+	// Writes the zero terminator after a string parsed in place and returns the terminated string.
+	// There is no byte left after a string ending at the end of the source data, so it is copied into the parser memory instead.
+	static char *fxml__TerminateString(fxmlContext *context, char *start, const size_t len, const char *end) {
+		if ((start + len) < end) {
+			start[len] = 0;
+			return(start);
+		}
+		fxmlString str;
+		str.start = start;
+		str.len = len;
+		char *result = fxml__AllocString(context, &str);
+		if (result == fxml_null) {
+			context->isError = true;
+			return(start);
+		}
+		return(result);
+	}
+
+	// Writes the zero terminators for all names and values parsed in place
+	static void fxml__TerminateInSitu(fxmlContext *context) {
+		const char *end = fxml__GetEnd(context);
+		fxmlTag *tag = context->root;
+		while (tag != fxml_null) {
+			fxmlTag *attr = tag;
+			while (attr != fxml_null) {
+				if (attr->name != fxml_null) {
+					attr->name = fxml__TerminateString(context, attr->name, attr->nameLen, end);
+				}
+				if (attr->value != fxml_null) {
+					attr->value = fxml__TerminateString(context, attr->value, attr->valueLen, end);
+				}
+				attr = (attr == tag) ? tag->firstAttribute : attr->nextSibling;
+			}
+			if (tag->firstChild != fxml_null) {
+				tag = tag->firstChild;
+				continue;
+			}
+			while (tag != context->root && tag->nextSibling == fxml_null) {
+				tag = tag->parent;
+			}
+			tag = (tag == context->root) ? fxml_null : tag->nextSibling;
+		}
+	}
+
 	fxml_api bool fxmlInitFromMemory(const void *data, const size_t dataSize, fxmlContext *outContext) {
 		if (data == fxml_null || dataSize == 0) {
 			return false;
@@ -437,12 +1323,51 @@ extern "C" {
 		return(true);
 	}
 
+	fxml_api bool fxmlInitInSitu(void *data, const size_t dataSize, fxmlContext *outContext) {
+		if (!fxmlInitFromMemory(data, dataSize, outContext)) {
+			return false;
+		}
+		outContext->mode = fxmlParseMode_InSitu;
+		return(true);
+	}
+
+	fxml_api bool fxmlInitWithAllocator(const void *data, const size_t dataSize, fxml_allocate_callback *allocate, void *userData, fxmlContext *outContext) {
+		if (allocate == fxml_null) {
+			return false;
+		}
+		if (!fxmlInitFromMemory(data, dataSize, outContext)) {
+			return false;
+		}
+		outContext->allocate = allocate;
+		outContext->allocateUserData = userData;
+		return(true);
+	}
+
+#if defined(FMEM_H)
+	static void *fxml__AllocateFromMemoryBlock(void *userData, const size_t size, const size_t alignment) {
+		fmemMemoryBlock *block = (fmemMemoryBlock *)userData;
+		void *result = fmemPushAligned(block, size, alignment, fmemPushFlags_None);
+		return(result);
+	}
+
+	fxml_api bool fxmlInitFromMemoryBlock(const void *data, const size_t dataSize, fmemMemoryBlock *block, fxmlContext *outContext) {
+		if (block == fxml_null) {
+			return false;
+		}
+		bool result = fxmlInitWithAllocator(data, dataSize, fxml__AllocateFromMemoryBlock, block, outContext);
+		return(result);
+	}
+#endif
+
 	static void fxml__ParseIdent(fxmlContext *context, fxmlString *outIdent) {
 		FXML_ASSERT(fxml__IsAlpha(*context->ptr));
 		const char *start = context->ptr;
 		++context->ptr;
-		while (fxml__IsAlphaNumeric(*context->ptr) || *context->ptr == '_' || *context->ptr == '-') {
+		context->ptr = fxml__ScanIdent(context->ptr, fxml__GetEnd(context));
+		char c = fxml__PeekChar(context, 0);
+		while (fxml__IsAlphaNumeric(c) || c == '_' || c == '-') {
 			++context->ptr;
+			c = fxml__PeekChar(context, 0);
 		}
 		if (outIdent != fxml_null) {
 			outIdent->start = start;
@@ -452,33 +1377,34 @@ extern "C" {
 
 	static bool fxml__ParseAttribute(fxmlContext *context, fxmlString *outName, fxmlString *outValue) {
 		bool result = false;
-		if (fxml__IsAlpha(*context->ptr)) {
+		if (fxml__IsAlpha(fxml__PeekChar(context, 0))) {
 			fxml__ParseIdent(context, outName);
-			if (context->ptr[0] == ':') {
+			if (fxml__PeekChar(context, 0) == ':') {
 				++context->ptr;
 				fxml__ParseIdent(context, fxml_null);
 				outName->len = context->ptr - outName->start;
 			}
 
-			if (*context->ptr != '=') {
+			if (fxml__PeekChar(context, 0) != '=') {
 				context->isError = true;
 				return false;
 			}
 			++context->ptr;
 
-			if (*context->ptr != '\"') {
+			if (fxml__PeekChar(context, 0) != '\"') {
 				context->isError = true;
 				return false;
 			}
 			++context->ptr;
 
 			outValue->start = context->ptr;
-			while (*context->ptr && (*context->ptr != '\"')) {
+			context->ptr = fxml__ScanUntil(context->ptr, fxml__GetEnd(context), '\"', '\"');
+			while (fxml__PeekChar(context, 0) && (fxml__PeekChar(context, 0) != '\"')) {
 				++context->ptr;
 			}
 			outValue->len = context->ptr - outValue->start;
 
-			if (*context->ptr != '\"') {
+			if (fxml__PeekChar(context, 0) != '\"') {
 				context->isError = true;
 				return false;
 			}
@@ -489,7 +1415,8 @@ extern "C" {
 	}
 
 	static void fxml__SkipWhitespaces(fxmlContext *context) {
-		while (!context->isError && fxml__IsWhitespace(*context->ptr)) {
+		context->ptr = fxml__ScanWhitespaces(context->ptr, fxml__GetEnd(context));
+		while (!context->isError && fxml__IsWhitespace(fxml__PeekChar(context, 0))) {
 			++context->ptr;
 		}
 	}
@@ -506,7 +1433,7 @@ extern "C" {
 	}
 
 	static void fxml__ParseAttributes(fxmlContext *context, fxmlTag *parent) {
-		while (!context->isError && *context->ptr) {
+		while (!context->isError && fxml__PeekChar(context, 0)) {
 			fxml__SkipWhitespaces(context);
 			fxmlString attrName = FXML_ZERO_INIT;
 			fxmlString attrValue = FXML_ZERO_INIT;
@@ -514,9 +1441,12 @@ extern "C" {
 				break;
 			} else {
 				fxmlTag *attr = fxml__AllocTag(context);
+				if (attr == fxml_null) {
+					break;
+				}
 				attr->type = fxmlTagType_Attribute;
-				attr->name = fxml__AllocString(context, &attrName);
-				attr->value = fxml__AllocStringDecode(context, &attrValue);
+				fxml__SetName(context, attr, &attrName);
+				fxml__SetValue(context, attr, &attrValue);
 				fxml__AddAttribute(parent, attr);
 			}
 		}
@@ -538,7 +1468,7 @@ extern "C" {
 		FXML_ASSERT(context->ptr[1] == '!');
 		context->ptr += 2;
 
-		if (context->ptr[0] != '-' || context->ptr[1] != '-') {
+		if (fxml__PeekChar(context, 0) != '-' || fxml__PeekChar(context, 1) != '-') {
 			context->isError = true;
 			return;
 		}
@@ -546,10 +1476,14 @@ extern "C" {
 
 		fxmlString comment = FXML_ZERO_INIT;
 		comment.start = context->ptr;
-		while (!context->isError && *context->ptr) {
-			if (context->ptr[0] == '-') {
-				if (context->ptr[1] == '-') {
-					if (context->ptr[2] != '>') {
+		while (!context->isError && fxml__PeekChar(context, 0)) {
+			context->ptr = fxml__ScanUntil(context->ptr, fxml__GetEnd(context), '-', '-');
+			if (!fxml__PeekChar(context, 0)) {
+				break;
+			}
+			if (fxml__PeekChar(context, 0) == '-') {
+				if (fxml__PeekChar(context, 1) == '-') {
+					if (fxml__PeekChar(context, 2) != '>') {
 						context->isError = true;
 						return;
 					} else {
@@ -562,13 +1496,17 @@ extern "C" {
 		comment.len = context->ptr - comment.start;
 
 		fxmlTag *commentTag = fxml__AllocTag(context);
-		commentTag->value = fxml__AllocStringDecode(context, &comment);
+		if (commentTag == fxml_null) {
+			return;
+		}
+		fxml__SetValue(context, commentTag, &comment);
 		commentTag->type = fxmlTagType_Comment;
+		commentTag->parent = context->curParent;
 
 		FXML_ASSERT(context->curParent != fxml_null);
 		fxml__AddChild(context->curParent, commentTag);
 
-		if (context->ptr[0] != '-' || context->ptr[1] != '-' || context->ptr[2] != '>') {
+		if (fxml__PeekChar(context, 0) != '-' || fxml__PeekChar(context, 1) != '-' || fxml__PeekChar(context, 2) != '>') {
 			context->isError = true;
 			return;
 		}
@@ -580,7 +1518,7 @@ extern "C" {
 		FXML_ASSERT(context->ptr[1] == '?');
 		context->ptr += 2;
 
-		if (!fxml__IsAlpha(*context->ptr)) {
+		if (!fxml__IsAlpha(fxml__PeekChar(context, 0))) {
 			context->isError = true;
 			return fxml_null;
 		}
@@ -588,12 +1526,16 @@ extern "C" {
 		fxml__ParseIdent(context, &declName);
 
 		fxmlTag *declTag = fxml__AllocTag(context);
-		declTag->name = fxml__AllocString(context, &declName);
+		if (declTag == fxml_null) {
+			return fxml_null;
+		}
+		fxml__SetName(context, declTag, &declName);
 		declTag->type = fxmlTagType_Declaration;
+		declTag->parent = context->root;
 		fxml__ParseAttributes(context, declTag);
 		fxml__AddChild(context->root, declTag);
 
-		if (context->ptr[0] != '?' || context->ptr[1] != '>') {
+		if (fxml__PeekChar(context, 0) != '?' || fxml__PeekChar(context, 1) != '>') {
 			return fxml_null;
 		}
 		context->ptr += 2;
@@ -611,50 +1553,49 @@ extern "C" {
 	typedef struct fxml__ParseTagResult {
 		fxml__ParseTagMode mode;
 		fxmlTag *tag;
-		char tagName[256];
+		fxmlString tagName;
 	} fxml__ParseTagResult;
 
 	static void fxml__ParseTag(fxmlContext *context, fxml__ParseTagResult *outResult) {
 		outResult->mode = fxml__ParseTagMode_Open;
 		outResult->tag = fxml_null;
-		outResult->tagName[0] = 0;
+		outResult->tagName.start = fxml_null;
+		outResult->tagName.len = 0;
 
 		FXML_ASSERT(context->ptr[0] == '<');
 		context->ptr++;
-		if (context->ptr[0] == '/') {
+		if (fxml__PeekChar(context, 0) == '/') {
 			outResult->mode = fxml__ParseTagMode_Close;
 			context->ptr++;
 		}
-		if (!fxml__IsAlpha(*context->ptr)) {
+		if (!fxml__IsAlpha(fxml__PeekChar(context, 0))) {
 			context->isError = true;
 			return;
 		}
 		fxmlString identStr = FXML_ZERO_INIT;
 		fxml__ParseIdent(context, &identStr);
 
-		FXML_ASSERT(identStr.len < (FXML_ARRAYCOUNT(outResult->tagName) + 1));
-		for (size_t i = 0; i < identStr.len; ++i) {
-			outResult->tagName[i] = *(identStr.start + i);
-		}
-		outResult->tagName[identStr.len] = 0;
-
-		if (context->ptr[0] == ':') {
+		if (fxml__PeekChar(context, 0) == ':') {
 			context->ptr++;
 			fxml__ParseIdent(context, fxml_null);
 			identStr.len = context->ptr - identStr.start;
 		}
+		outResult->tagName = identStr;
 
 		if (outResult->mode != fxml__ParseTagMode_Close) {
 			fxmlTag *tag = fxml__AllocTag(context);
+			if (tag == fxml_null) {
+				return;
+			}
 			tag->type = fxmlTagType_Element;
-			tag->name = fxml__AllocString(context, &identStr);
+			fxml__SetName(context, tag, &identStr);
 			tag->parent = context->curParent;
 			tag->isClosed = false;
 			outResult->tag = tag;
 			fxml__AddChild(context->curParent, tag);
 
 			fxml__ParseAttributes(context, tag);
-			if (context->ptr[0] == '/') {
+			if (fxml__PeekChar(context, 0) == '/') {
 				outResult->mode = fxml__ParseTagMode_OpenAndClose;
 				tag->isClosed = true;
 				++context->ptr;
@@ -663,7 +1604,7 @@ extern "C" {
 			fxml__SkipWhitespaces(context);
 		}
 
-		if (context->ptr[0] != '>') {
+		if (fxml__PeekChar(context, 0) != '>') {
 			context->isError = true;
 			return;
 		}
@@ -672,60 +1613,39 @@ extern "C" {
 
 	static void fxml__ParseInnerText(fxmlContext *context, fxmlTag *tag) {
 		const char *start = context->ptr;
-		while (!context->isError && context->ptr[0] && context->ptr[0] != '<') {
+		context->ptr = fxml__ScanUntil(context->ptr, fxml__GetEnd(context), '<', '<');
+		while (!context->isError && fxml__PeekChar(context, 0) && fxml__PeekChar(context, 0) != '<') {
 			++context->ptr;
 		}
 		fxmlString value = FXML_ZERO_INIT;
 		value.len = context->ptr - start;
 		value.start = start;
-		tag->value = fxml__AllocStringDecode(context, &value);
+		fxml__SetValue(context, tag, &value);
 	}
 
-	fxml_api bool fxmlParse(fxmlContext *context, fxmlTag *outRoot) {
-		// Read unicode BOM
-		bool isUTF8 = false;
-		if (context->size >= 4) {
-			uint8_t *p = (uint8_t *)context->ptr;
-			if (p[0] == 0xFF && p[1] == 0xFE) {
-				// Error: UTF-16LE not supported
-				context->isError = true;
-				return false;
-			} else if (p[0] == 0xFE && p[1] == 0xFF) {
-				// Error: UTF-16BE not supported
-				context->isError = true;
-				return false;
-			}
-			if (p[0] == 0xEF && p[1] == 0xBB && p[2] == 0xBF) {
-				// UTF-8 BOM detected
-				context->ptr += 3;
-				isUTF8 = true;
-			}
-		}
-
-		outRoot->type = fxmlTagType_Root;
-		context->root = outRoot;
-		context->curParent = outRoot;
-		while (!context->isError && *context->ptr) {
+	// Parses until the end or the first error, the current parent is kept between calls
+	static void fxml__ParseContent(fxmlContext *context, const char *end, bool *isUTF8) {
+		while (!context->isError && context->ptr < end && *context->ptr) {
 			char c = context->ptr[0];
 			bool readAhead = true;
 			switch (c) {
 				case '<':
 				{
-					if (context->ptr[1] == '?') {
+					if (fxml__PeekChar(context, 1) == '?') {
 						fxmlTag *declTag = fxml__ParseDeclaration(context);
-						const char *encoding = fxmlGetAttributeValue(declTag, "encoding");
-						if (fxml__IsEqualString(encoding, "UTF-8") || fxml__IsEqualString(encoding, "utf-8")) {
-							isUTF8 = true;
+						fxmlString encoding = fxmlGetAttributeValueString(declTag, "encoding");
+						if (fxml__IsEqualStringLen(encoding.start, encoding.len, "UTF-8") || fxml__IsEqualStringLen(encoding.start, encoding.len, "utf-8")) {
+							*isUTF8 = true;
 						}
 						readAhead = false;
-					} else if (context->ptr[1] == '/' || fxml__IsAlpha(context->ptr[1])) {
+					} else if (fxml__PeekChar(context, 1) == '/' || fxml__IsAlpha(fxml__PeekChar(context, 1))) {
 						fxml__ParseTagResult tagRes = FXML_ZERO_INIT;
 						fxml__ParseTag(context, &tagRes);
-						if (tagRes.mode == fxml__ParseTagMode_Open) {
+						if (tagRes.mode == fxml__ParseTagMode_Open && tagRes.tag != fxml_null) {
 							fxml__ParseInnerText(context, tagRes.tag);
 							context->curParent = tagRes.tag;
 						} else if (tagRes.mode == fxml__ParseTagMode_Close) {
-							if (!fxml__IsEqualString(context->curParent->name, tagRes.tagName)) {
+							if (context->curParent->name == fxml_null || !fxml__IsEqualView(context->curParent->name, context->curParent->nameLen, &tagRes.tagName)) {
 								// Error: Closing tag name does not match
 								context->isError = true;
 								break;
@@ -738,24 +1658,30 @@ extern "C" {
 							}
 						}
 						readAhead = false;
-					} else if (context->ptr[1] == '!') {
+					} else if (fxml__PeekChar(context, 1) == '!') {
 						fxml__ParseComment(context);
 						readAhead = false;
 					} else {
-						return false;
+						context->isError = true;
+						return;
 					}
 				} break;
 
 				default:
 				{
-
+					// Skip text between tags, such as indentations
+					context->ptr = fxml__ScanUntil(context->ptr, fxml__GetEnd(context), '<', '<');
+					readAhead = fxml__PeekChar(context, 0) != '<' && fxml__PeekChar(context, 0) != 0;
 				} break;
 			}
 			if (readAhead) {
 				++context->ptr;
 			}
 		}
+	}
 
+	// Validates the parsed tree and finishes the in situ mode
+	static bool fxml__FinishParse(fxmlContext *context) {
 		if (context->curParent == context->root) {
 			context->curParent->isClosed = true;
 		}
@@ -777,39 +1703,107 @@ extern "C" {
 			context->isError = true;
 		}
 
+		if (context->mode == fxmlParseMode_InSitu) {
+			fxml__TerminateInSitu(context);
+		}
+
 		return(!context->isError);
 	}
 
+	fxml_api bool fxmlParse(fxmlContext *context, fxmlTag *outRoot) {
+		// Read unicode BOM
+		bool isUTF8 = false;
+		if (context->size >= 4) {
+			uint8_t *p = (uint8_t *)context->ptr;
+			if (p[0] == 0xFF && p[1] == 0xFE) {
+				// Error: UTF-16LE not supported
+				context->isError = true;
+				return false;
+			} else if (p[0] == 0xFE && p[1] == 0xFF) {
+				// Error: UTF-16BE not supported
+				context->isError = true;
+				return false;
+			}
+			if (p[0] == 0xEF && p[1] == 0xBB && p[2] == 0xBF) {
+				// UTF-8 BOM detected
+				context->ptr += 3;
+				isUTF8 = true;
+			}
+		}
+
+		outRoot->type = fxmlTagType_Root;
+		context->root = outRoot;
+		context->curParent = outRoot;
+		fxml__ParseContent(context, fxml__GetEnd(context), &isUTF8);
+		return fxml__FinishParse(context);
+	}
+
 	fxml_api void fxmlFree(fxmlContext *context) {
 		fxml__FreeMemory(context);
+		if (context != fxml_null) {
+			context->atomSlots = fxml_null;
+			context->atomSlotCount = context->atomCount = 0;
+		}
+	}
+
+	// Matches the tag against the atom, or against the hash and the name when there is no atom
+	static bool fxml__IsTagName(const fxmlTag *tag, const fxmlAtom *atom, const uint32_t hash, const char *name) {
+		if (atom != fxml_null) {
+			return(tag->atom == atom);
+		}
+		if (tag->atom != fxml_null && tag->atom->hash != hash) {
+			return false;
+		}
+		return fxml__IsEqualStringLen(tag->name, tag->nameLen, name);
+	}
+
+	static fxmlTag *fxml__FindIndexed(fxmlTag **slots, const uint32_t mask, const fxmlAtom *atom, const uint32_t hash, const char *name) {
+		uint32_t index = (atom != fxml_null ? atom->hash : hash) & mask;
+		while (slots[index] != fxml_null) {
+			if (fxml__IsTagName(slots[index], atom, hash, name)) {
+				return(slots[index]);
+			}
+			index = (index + 1) & mask;
+		}
+		return fxml_null;
+	}
+
+	static fxmlTag *fxml__FindChild(fxmlTag *tag, const fxmlAtom *atom, const uint32_t hash, const char *name) {
+		if (tag->index != fxml_null && tag->index->children != fxml_null) {
+			return fxml__FindIndexed(tag->index->children, tag->index->childMask, atom, hash, name);
+		}
+		for (fxmlTag *searchTag = tag->firstChild; searchTag != fxml_null; searchTag = searchTag->nextSibling) {
+			if (searchTag->type == fxmlTagType_Element && fxml__IsTagName(searchTag, atom, hash, name)) {
+				return(searchTag);
+			}
+		}
+		return fxml_null;
+	}
+
+	static fxmlTag *fxml__FindAttribute(fxmlTag *tag, const fxmlAtom *atom, const uint32_t hash, const char *name) {
+		if (tag->index != fxml_null && tag->index->attributes != fxml_null) {
+			return fxml__FindIndexed(tag->index->attributes, tag->index->attributeMask, atom, hash, name);
+		}
+		for (fxmlTag *searchAttr = tag->firstAttribute; searchAttr != fxml_null; searchAttr = searchAttr->nextSibling) {
+			if (searchAttr->type == fxmlTagType_Attribute && fxml__IsTagName(searchAttr, atom, hash, name)) {
+				return(searchAttr);
+			}
+		}
+		return fxml_null;
 	}
 
 	fxml_api fxmlTag *fxmlFindTagByName(fxmlTag *tag, const char *name) {
 		fxmlTag *result = fxml_null;
-		if (tag != fxml_null) {
-			fxmlTag *searchTag = tag->firstChild;
-			while (searchTag != fxml_null) {
-				if (searchTag->type == fxmlTagType_Element && fxml__IsEqualString(searchTag->name, name)) {
-					result = searchTag;
-					break;
-				}
-				searchTag = searchTag->nextSibling;
-			}
+		if (tag != fxml_null && name != fxml_null) {
+			result = fxml__FindChild(tag, fxml_null, fxml__HashZeroString(name), name);
 		}
 		return(result);
 	}
 
 	fxml_api fxmlTag *fxmlFindAttributeByName(fxmlTag *tag, const char *name) {
 		fxmlTag *result = fxml_null;
-		if (tag != fxml_null) {
-			fxmlTag *searchAttr = tag->firstAttribute;
-			while (searchAttr != fxml_null) {
-				if (searchAttr->type == fxmlTagType_Attribute && fxml__IsEqualString(searchAttr->name, name)) {
-					result = searchAttr;
-					break;
-				}
-				searchAttr = searchAttr->nextSibling;
-			}
+		if (tag != fxml_null && name != fxml_null) {
+			result = fxml__FindAttribute(tag, fxml_null, fxml__HashZeroString(name), name);
 		}
 		return(result);
 	}
@@ -830,6 +1824,1865 @@ extern "C" {
 		return fxml_null;
 	}
 
+	fxml_api fxmlString fxmlGetAttributeValueString(fxmlTag *tag, const char *attrName) {
+		fxmlString result = FXML_ZERO_INIT;
+		fxmlTag *foundAttr = fxmlFindAttributeByName(tag, attrName);
+		if (foundAttr != fxml_null) {
+			result.start = foundAttr->value;
+			result.len = foundAttr->valueLen;
+		}
+		return(result);
+	}
+
+	fxml_api fxmlString fxmlGetTagValueString(fxmlTag *tag, const char *tagName) {
+		fxmlString result = FXML_ZERO_INIT;
+		fxmlTag *foundTag = fxmlFindTagByName(tag, tagName);
+		if (foundTag != fxml_null) {
+			result.start = foundTag->value;
+			result.len = foundTag->valueLen;
+		}
+		return(result);
+	}
+
+	fxml_api const fxmlAtom *fxmlFindAtom(const fxmlContext *context, const char *name) {
+		if (context == fxml_null || name == fxml_null || context->atomSlotCount == 0) {
+			return fxml_null;
+		}
+		uint32_t hash = fxml__HashZeroString(name);
+		uint32_t mask = context->atomSlotCount - 1;
+		uint32_t index = hash & mask;
+		while (context->atomSlots[index] != fxml_null) {
+			const fxmlAtom *atom = context->atomSlots[index];
+			if (atom->hash == hash && fxml__IsEqualStringLen(atom->name, atom->len, name)) {
+				return(atom);
+			}
+			index = (index + 1) & mask;
+		}
+		return fxml_null;
+	}
+
+	fxml_api fxmlTag *fxmlFindTagByAtom(fxmlTag *tag, const fxmlAtom *atom) {
+		fxmlTag *result = fxml_null;
+		if (tag != fxml_null && atom != fxml_null) {
+			result = fxml__FindChild(tag, atom, 0, fxml_null);
+		}
+		return(result);
+	}
+
+	fxml_api fxmlTag *fxmlFindAttributeByAtom(fxmlTag *tag, const fxmlAtom *atom) {
+		fxmlTag *result = fxml_null;
+		if (tag != fxml_null && atom != fxml_null) {
+			result = fxml__FindAttribute(tag, atom, 0, fxml_null);
+		}
+		return(result);
+	}
+
+	fxml_api const char *fxmlGetAttributeValueByAtom(fxmlTag *tag, const fxmlAtom *atom) {
+		fxmlTag *foundAttr = fxmlFindAttributeByAtom(tag, atom);
+		if (foundAttr != fxml_null) {
+			return foundAttr->value;
+		}
+		return fxml_null;
+	}
+
+	fxml_api const char *fxmlGetTagValueByAtom(fxmlTag *tag, const fxmlAtom *atom) {
+		fxmlTag *foundTag = fxmlFindTagByAtom(tag, atom);
+		if (foundTag != fxml_null) {
+			return foundTag->value;
+		}
+		return fxml_null;
+	}
+
+	// Allocates the slots for the tags of the list, keeping the first tag for each atom
+	static fxmlTag **fxml__BuildIndexSlots(fxmlContext *context, fxmlTag *first, const fxmlTagType type, const size_t count, uint32_t *outMask) {
+		uint32_t slotCount = FXML__MIN_ATOM_SLOT_COUNT;
+		while (slotCount < count * 2) {
+			slotCount *= 2;
+		}
+		fxmlTag **slots = (fxmlTag **)fxml__AllocMemory(context, sizeof(fxmlTag *) * slotCount, sizeof(fxmlTag *));
+		if (slots == fxml_null) {
+			return fxml_null;
+		}
+		FXML_MEMSET(slots, 0, sizeof(fxmlTag *) * slotCount);
+		uint32_t mask = slotCount - 1;
+		for (fxmlTag *tag = first; tag != fxml_null; tag = tag->nextSibling) {
+			if (tag->type != type || tag->atom == fxml_null) {
+				continue;
+			}
+			uint32_t index = tag->atom->hash & mask;
+			while (slots[index] != fxml_null && slots[index]->atom != tag->atom) {
+				index = (index + 1) & mask;
+			}
+			if (slots[index] == fxml_null) {
+				slots[index] = tag;
+			}
+		}
+		*outMask = mask;
+		return(slots);
+	}
+
+	static bool fxml__BuildTagIndex(fxmlContext *context, fxmlTag *tag, const size_t minCount) {
+		size_t childCount = 0;
+		size_t attributeCount = 0;
+		for (fxmlTag *child = tag->firstChild; child != fxml_null; child = child->nextSibling) {
+			++childCount;
+		}
+		for (fxmlTag *attr = tag->firstAttribute; attr != fxml_null; attr = attr->nextSibling) {
+			++attributeCount;
+		}
+		if (childCount < minCount && attributeCount < minCount) {
+			return true;
+		}
+		fxmlTagIndex *index = tag->index;
+		if (index == fxml_null) {
+			index = (fxmlTagIndex *)fxml__AllocMemory(context, sizeof(fxmlTagIndex), FXML__TAG_ALIGNMENT);
+			if (index == fxml_null) {
+				return false;
+			}
+			FXML_MEMSET(index, 0, sizeof(*index));
+		}
+		if (childCount >= minCount && index->children == fxml_null) {
+			index->children = fxml__BuildIndexSlots(context, tag->firstChild, fxmlTagType_Element, childCount, &index->childMask);
+			if (index->children == fxml_null) {
+				return false;
+			}
+		}
+		if (attributeCount >= minCount && index->attributes == fxml_null) {
+			index->attributes = fxml__BuildIndexSlots(context, tag->firstAttribute, fxmlTagType_Attribute, attributeCount, &index->attributeMask);
+			if (index->attributes == fxml_null) {
+				return false;
+			}
+		}
+		tag->index = index;
+		return(true);
+	}
+
+	fxml_api bool fxmlBuildIndex(fxmlContext *context, fxmlTag *tag, const size_t minCount) {
+		if (context == fxml_null || tag == fxml_null) {
+			return false;
+		}
+		// Same traversal as fxml__TerminateInSitu(), without recursion
+		fxmlTag *rootTag = tag;
+		while (tag != fxml_null) {
+			if (!fxml__BuildTagIndex(context, tag, minCount)) {
+				return false;
+			}
+			if (tag->firstChild != fxml_null) {
+				tag = tag->firstChild;
+				continue;
+			}
+			while (tag != rootTag && tag->nextSibling == fxml_null) {
+				tag = tag->parent;
+			}
+			tag = (tag == rootTag) ? fxml_null : tag->nextSibling;
+		}
+		return(true);
+	}
+
+	//
+	// Parallel parsing
+	//
+	// Returns the next element in the same order as fxml__TerminateInSitu()
+	static const fxmlTag *fxml__NextElement(const fxmlTag *tag, const fxmlTag *root) {
+		if (tag->firstChild != fxml_null) {
+			return tag->firstChild;
+		}
+		while (tag != root && tag->nextSibling == fxml_null) {
+			tag = tag->parent;
+		}
+		return (tag == root) ? fxml_null : tag->nextSibling;
+	}
+	static const char *fxml__FindTerminator(const char *ptr, const char *end, const char *terminator, const size_t terminatorLen) {
+		while ((size_t)(end - ptr) >= terminatorLen) {
+			ptr = fxml__FindChar(ptr, end, terminator[0]);
+			if ((size_t)(end - ptr) < terminatorLen) {
+				break;
+			}
+			size_t matchLen = 0;
+			while (matchLen < terminatorLen && ptr[matchLen] == terminator[matchLen]) {
+				++matchLen;
+			}
+			if (matchLen == terminatorLen) {
+				return(ptr + terminatorLen);
+			}
+			++ptr;
+		}
+		return fxml_null;
+	}
+
+	// Finds the head, the split positions between the children of the root element and the closing tag of the root element.
+	// Only the structure is scanned, nothing is allocated or decoded. Returns the number of ranges, or zero when the document is not splittable.
+	static size_t fxml__ScanParallelRanges(const char *start, const char *end, const size_t maxRanges, const char **outRangeStarts, const char **outTail) {
+		const char *p = start;
+		size_t depth = 0;
+		size_t rangeCount = 0;
+		size_t targetSize = 0;
+		while (p < end) {
+			p = fxml__FindChar(p, end, '<');
+			if ((end - p) < 2) {
+				return 0;
+			}
+			if (depth == 1 && rangeCount == 0) {
+				// First markup after the root start tag, everything before is the head
+				outRangeStarts[rangeCount++] = p;
+				targetSize = (size_t)(end - p) / maxRanges;
+			}
+			char c = p[1];
+			if (c == '!' || c == '?') {
+				p = (c == '!') ? fxml__FindTerminator(p + 2, end, "-->", 3) : fxml__FindTerminator(p + 2, end, "?>", 2);
+				if (p == fxml_null) {
+					return 0;
+				}
+				continue;
+			}
+			if (c == '/') {
+				if (depth == 0) {
+					return 0;
+				}
+				if (depth == 1) {
+					*outTail = p;
+					return(rangeCount);
+				}
+				--depth;
+				p = fxml__FindChar(p, end, '>');
+			} else {
+				if (depth == 1 && rangeCount < maxRanges && (size_t)(p - outRangeStarts[rangeCount - 1]) >= targetSize) {
+					outRangeStarts[rangeCount++] = p;
+				}
+				// Find the end of the start tag, ignoring '>' inside of attribute values
+				const char *tagEnd = p + 1;
+				while (tagEnd < end) {
+					tagEnd = fxml__ScanUntil(tagEnd, end, '>', '\"');
+					while (tagEnd < end && *tagEnd != '>' && *tagEnd != '\"') {
+						++tagEnd;
+					}
+					if (tagEnd == end || *tagEnd == '>') {
+						break;
+					}
+					tagEnd = fxml__FindChar(tagEnd + 1, end, '\"');
+					if (tagEnd == end) {
+						break;
+					}
+					++tagEnd;
+				}
+				if (tagEnd == end) {
+					return 0;
+				}
+				if (*(tagEnd - 1) != '/') {
+					++depth;
+				} else if (depth == 0) {
+					// Root element without children
+					return 0;
+				}
+				p = tagEnd;
+			}
+			if (p == end) {
+				return 0;
+			}
+			++p;
+		}
+		return 0;
+	}
+
+	fxml_api size_t fxmlPrepareParallel(fxmlContext *context, fxmlTag *outRoot, fxmlParallelJob *jobs, const size_t maxJobs) {
+		if (context == fxml_null || outRoot == fxml_null || jobs == fxml_null || maxJobs == 0) {
+			return 0;
+		}
+		const char *end = fxml__GetEnd(context);
+		if (context->size >= 2) {
+			const uint8_t *p = (const uint8_t *)context->ptr;
+			if ((p[0] == 0xFF && p[1] == 0xFE) || (p[0] == 0xFE && p[1] == 0xFF)) {
+				// Error: UTF-16 not supported
+				context->isError = true;
+				return 0;
+			}
+		}
+		if (context->size >= 3) {
+			const uint8_t *p = (const uint8_t *)context->ptr;
+			if (p[0] == 0xEF && p[1] == 0xBB && p[2] == 0xBF) {
+				context->ptr += 3;
+			}
+		}
+
+		const char *rangeStarts[FXML_MAX_PARALLEL_JOBS];
+		const char *tail = end;
+		size_t jobCount = fxml__ScanParallelRanges(context->ptr, end, maxJobs < FXML_MAX_PARALLEL_JOBS ? maxJobs : FXML_MAX_PARALLEL_JOBS, rangeStarts, &tail);
+		if (jobCount == 0) {
+			// Not splittable, the head is the entire document and the single job is empty
+			rangeStarts[0] = end;
+			tail = end;
+			jobCount = 1;
+		}
+
+		for (size_t jobIndex = 0; jobIndex < jobCount; ++jobIndex) {
+			fxmlParallelJob *job = &jobs[jobIndex];
+			const char *rangeStart = rangeStarts[jobIndex];
+			const char *rangeEnd = (jobIndex < jobCount - 1) ? rangeStarts[jobIndex + 1] : tail;
+			FXML_MEMSET(job, 0, sizeof(*job));
+			job->context.data = rangeStart;
+			job->context.ptr = rangeStart;
+			job->context.size = rangeEnd - rangeStart;
+			job->context.mode = context->mode;
+			job->context.allocate = context->allocate;
+			job->context.allocateUserData = context->allocateUserData;
+		}
+
+		// The head is parsed here, up to the first child of the root element
+		bool isUTF8 = false;
+		outRoot->type = fxmlTagType_Root;
+		context->root = outRoot;
+		context->curParent = outRoot;
+		fxml__ParseContent(context, rangeStarts[0], &isUTF8);
+		if (context->isError) {
+			return 0;
+		}
+		context->ptr = tail;
+		return(jobCount);
+	}
+
+	fxml_api bool fxmlParseParallelJob(fxmlParallelJob *job) {
+		if (job == fxml_null) {
+			return false;
+		}
+		fxmlContext *context = &job->context;
+		job->root.type = fxmlTagType_Root;
+		context->root = &job->root;
+		context->curParent = &job->root;
+		bool isUTF8 = false;
+		fxml__ParseContent(context, fxml__GetEnd(context), &isUTF8);
+		if (context->curParent != context->root) {
+			// Elements are not closed inside of the range
+			context->isError = true;
+		}
+		return(!context->isError);
+	}
+
+	// Moves the memory, the atoms and the children of the job into the context
+	static void fxml__MergeParallelJob(fxmlContext *context, fxmlParallelJob *job) {
+		fxmlContext *jobContext = &job->context;
+		if (jobContext->firstMem != fxml_null) {
+			if (context->lastMem == fxml_null) {
+				context->firstMem = jobContext->firstMem;
+			} else {
+				context->lastMem->next = jobContext->firstMem;
+			}
+			context->lastMem = jobContext->lastMem;
+			jobContext->firstMem = jobContext->lastMem = fxml_null;
+		}
+		if (jobContext->isError || context->isError || job->root.firstChild == fxml_null) {
+			context->isError |= jobContext->isError;
+			return;
+		}
+
+		// The job atoms are interned again in the order of their ids, so the ids are the same as for a single threaded parse
+		const fxmlAtom **remap = (const fxmlAtom **)fxml__AllocMemory(context, sizeof(fxmlAtom *) * (jobContext->atomCount + 1), sizeof(fxmlAtom *));
+		if (remap == fxml_null) {
+			return;
+		}
+		for (uint32_t i = 0; i < jobContext->atomSlotCount; ++i) {
+			const fxmlAtom *atom = jobContext->atomSlots[i];
+			if (atom != fxml_null) {
+				remap[atom->id] = atom;
+			}
+		}
+		for (uint32_t id = 1; id <= jobContext->atomCount; ++id) {
+			fxmlString name;
+			name.start = remap[id]->name;
+			name.len = remap[id]->len;
+			remap[id] = fxml__InternName(context, &name);
+			if (remap[id] == fxml_null) {
+				return;
+			}
+		}
+		fxmlTag *jobRoot = &job->root;
+		for (fxmlTag *tag = jobRoot->firstChild; tag != fxml_null; tag = (fxmlTag *)fxml__NextElement(tag, jobRoot)) {
+			fxmlTag *attr = tag;
+			while (attr != fxml_null) {
+				if (attr->atom != fxml_null) {
+					attr->atom = remap[attr->atom->id];
+					if (context->mode == fxmlParseMode_Copy) {
+						attr->name = (char *)attr->atom->name;
+					}
+				}
+				attr = (attr == tag) ? tag->firstAttribute : attr->nextSibling;
+			}
+		}
+
+		fxmlTag *parent = context->curParent;
+		for (fxmlTag *child = jobRoot->firstChild; child != fxml_null; child = child->nextSibling) {
+			child->parent = parent;
+		}
+		if (parent->lastChild == fxml_null) {
+			parent->firstChild = jobRoot->firstChild;
+		} else {
+			jobRoot->firstChild->prevSibling = parent->lastChild;
+			parent->lastChild->nextSibling = jobRoot->firstChild;
+		}
+		parent->lastChild = jobRoot->lastChild;
+		jobRoot->firstChild = jobRoot->lastChild = fxml_null;
+	}
+
+	fxml_api bool fxmlFinishParallel(fxmlContext *context, fxmlTag *outRoot, fxmlParallelJob *jobs, const size_t jobCount) {
+		if (context == fxml_null || outRoot == fxml_null || jobs == fxml_null || context->root != outRoot) {
+			return false;
+		}
+		// Merge all jobs, even after a error, so that fxmlFree() releases all memory
+		for (size_t jobIndex = 0; jobIndex < jobCount; ++jobIndex) {
+			fxml__MergeParallelJob(context, &jobs[jobIndex]);
+		}
+		if (context->isError) {
+			return false;
+		}
+		bool isUTF8 = false;
+		fxml__ParseContent(context, fxml__GetEnd(context), &isUTF8);
+		return fxml__FinishParse(context);
+	}
+
+#if defined(FPL_HEADER_H)
+	static void fxml__ParallelJobThreadProc(const fplThreadHandle *thread, void *data) {
+		(void)thread;
+		fxmlParseParallelJob((fxmlParallelJob *)data);
+	}
+
+	fxml_api bool fxmlParseParallel(fxmlContext *context, fxmlTag *outRoot, const size_t threadCount) {
+		size_t maxJobs = threadCount > 0 ? threadCount : fplGetProcessorCoreCount();
+		maxJobs = fplMax(fplMin(maxJobs, FXML_MAX_PARALLEL_JOBS), 1);
+		fxmlParallelJob jobs[FXML_MAX_PARALLEL_JOBS];
+		size_t jobCount = fxmlPrepareParallel(context, outRoot, jobs, maxJobs);
+		if (jobCount == 0) {
+			return false;
+		}
+
+		// The calling thread parses the first job
+		fplThreadHandle *threads[FXML_MAX_PARALLEL_JOBS];
+		size_t startedThreadCount = 0;
+		for (size_t jobIndex = 1; jobIndex < jobCount; ++jobIndex) {
+			fplThreadHandle *thread = fplThreadCreate(fxml__ParallelJobThreadProc, &jobs[jobIndex]);
+			if (thread == fxml_null) {
+				fxmlParseParallelJob(&jobs[jobIndex]);
+			} else {
+				threads[startedThreadCount++] = thread;
+			}
+		}
+		fxmlParseParallelJob(&jobs[0]);
+		if (startedThreadCount > 0) {
+			fplThreadWaitForAll(threads, startedThreadCount, sizeof(fplThreadHandle *), FPL_TIMEOUT_INFINITE);
+		}
+		return fxmlFinishParallel(context, outRoot, jobs, jobCount);
+	}
+#endif // FPL_HEADER_H
+
+	//
+	// Binary cache
+	//
+#define FXML__BINARY_MAGIC 0x424D5846 // FXMB
+#define FXML__BINARY_VERSION 1
+#define FXML__BINARY_ALIGNMENT 8
+
+	typedef struct fxml__BinaryHeader {
+		uint32_t magic;
+		uint32_t version;
+		uint32_t pointerSize;
+		uint32_t tagSize;
+		uint64_t sourceHash;
+		// Address the pointers are relative to, zero when the pointers are still offsets
+		uint64_t base;
+		uint64_t totalSize;
+		uint64_t tagOffset;
+		uint64_t tagCount;
+		uint64_t atomOffset;
+		uint64_t atomCount;
+		uint64_t slotOffset;
+		uint64_t slotCount;
+		uint64_t stringOffset;
+		uint64_t stringSize;
+	} fxml__BinaryHeader;
+
+	// Maps the tags of the source tree to their index in the binary
+	typedef struct fxml__TagMap {
+		const fxmlTag **keys;
+		size_t *values;
+		size_t mask;
+	} fxml__TagMap;
+
+	static size_t fxml__AlignSize(const size_t size, const size_t alignment) {
+		size_t result = (size + (alignment - 1)) & ~(alignment - 1);
+		return(result);
+	}
+
+	static size_t fxml__TagMapSlot(const fxml__TagMap *map, const fxmlTag *tag) {
+		size_t index = (size_t)(((uintptr_t)tag >> 3) * 2654435761u) & map->mask;
+		while (map->keys[index] != fxml_null && map->keys[index] != tag) {
+			index = (index + 1) & map->mask;
+		}
+		return(index);
+	}
+
+	static uint64_t fxml__TagMapOffset(const fxml__TagMap *map, const fxmlTag *tag, const uint64_t tagOffset) {
+		if (tag == fxml_null) {
+			return 0;
+		}
+		size_t slot = fxml__TagMapSlot(map, tag);
+		if (map->keys[slot] == fxml_null) {
+			// Tag outside of the saved tree
+			return 0;
+		}
+		uint64_t result = tagOffset + map->values[slot] * sizeof(fxmlTag);
+		return(result);
+	}
+
+	static void fxml__StorePointer(void *field, const uint64_t offset) {
+		uintptr_t value = (uintptr_t)offset;
+		FXML_MEMCPY(field, &value, sizeof(value));
+	}
+
+	fxml_api uint64_t fxmlComputeSourceHash(const void *data, const size_t dataSize) {
+		// FNV-1a 64-bit
+		uint64_t result = 14695981039346656037ull;
+		const uint8_t *p = (const uint8_t *)data;
+		for (size_t i = 0; i < dataSize; ++i) {
+			result ^= p[i];
+			result *= 1099511628211ull;
+		}
+		return(result);
+	}
+
+	fxml_api size_t fxmlSaveBinary(const fxmlContext *context, const fxmlTag *root, const uint64_t sourceHash, void *buffer, const size_t bufferSize) {
+		if (context == fxml_null || root == fxml_null) {
+			return 0;
+		}
+
+		// Count the tags and the strings
+		size_t tagCount = 0;
+		size_t stringSize = 0;
+		for (const fxmlTag *tag = root; tag != fxml_null; tag = fxml__NextElement(tag, root)) {
+			const fxmlTag *attr = tag;
+			while (attr != fxml_null) {
+				++tagCount;
+				if (attr->value != fxml_null) {
+					stringSize += attr->valueLen + 1;
+				}
+				if (attr->atom == fxml_null && attr->name != fxml_null) {
+					stringSize += attr->nameLen + 1;
+				}
+				attr = (attr == tag) ? tag->firstAttribute : attr->nextSibling;
+			}
+		}
+		size_t atomCount = context->atomCount;
+		for (uint32_t i = 0; i < context->atomSlotCount; ++i) {
+			if (context->atomSlots[i] != fxml_null) {
+				stringSize += context->atomSlots[i]->len + 1;
+			}
+		}
+
+		size_t tagOffset = fxml__AlignSize(sizeof(fxml__BinaryHeader), FXML__BINARY_ALIGNMENT);
+		size_t atomOffset = fxml__AlignSize(tagOffset + sizeof(fxmlTag) * tagCount, FXML__BINARY_ALIGNMENT);
+		size_t slotOffset = fxml__AlignSize(atomOffset + sizeof(fxmlAtom) * atomCount, FXML__BINARY_ALIGNMENT);
+		size_t stringOffset = fxml__AlignSize(slotOffset + sizeof(fxmlAtom *) * context->atomSlotCount, FXML__BINARY_ALIGNMENT);
+		size_t totalSize = fxml__AlignSize(stringOffset + stringSize, FXML__BINARY_ALIGNMENT);
+		if (buffer == fxml_null || bufferSize < totalSize) {
+			return(totalSize);
+		}
+
+		fxml__TagMap map = FXML_ZERO_INIT;
+		size_t mapSize = 16;
+		while (mapSize < tagCount * 2) {
+			mapSize *= 2;
+		}
+		map.keys = (const fxmlTag **)FXML_MALLOC(sizeof(*map.keys) * mapSize);
+		map.values = (size_t *)FXML_MALLOC(sizeof(*map.values) * mapSize);
+		if (map.keys == fxml_null || map.values == fxml_null) {
+			FXML_FREE(map.values);
+			FXML_FREE(map.keys);
+			return 0;
+		}
+		map.mask = mapSize - 1;
+		FXML_MEMSET(map.keys, 0, sizeof(*map.keys) * mapSize);
+		size_t tagIndex = 0;
+		for (const fxmlTag *tag = root; tag != fxml_null; tag = fxml__NextElement(tag, root)) {
+			const fxmlTag *attr = tag;
+			while (attr != fxml_null) {
+				size_t slot = fxml__TagMapSlot(&map, attr);
+				map.keys[slot] = attr;
+				map.values[slot] = tagIndex++;
+				attr = (attr == tag) ? tag->firstAttribute : attr->nextSibling;
+			}
+		}
+
+		uint8_t *base = (uint8_t *)buffer;
+		FXML_MEMSET(base, 0, totalSize);
+		fxml__BinaryHeader *header = (fxml__BinaryHeader *)base;
+		header->magic = FXML__BINARY_MAGIC;
+		header->version = FXML__BINARY_VERSION;
+		header->pointerSize = sizeof(void *);
+		header->tagSize = sizeof(fxmlTag);
+		header->sourceHash = sourceHash;
+		header->totalSize = totalSize;
+		header->tagOffset = tagOffset;
+		header->tagCount = tagCount;
+		header->atomOffset = atomOffset;
+		header->atomCount = atomCount;
+		header->slotOffset = slotOffset;
+		header->slotCount = context->atomSlotCount;
+		header->stringOffset = stringOffset;
+		header->stringSize = stringSize;
+
+		// Atoms are stored by id, the slots keep the same hash layout
+		size_t stringPos = stringOffset;
+		fxmlAtom *atoms = (fxmlAtom *)(base + atomOffset);
+		fxmlAtom **slots = (fxmlAtom **)(base + slotOffset);
+		for (uint32_t i = 0; i < context->atomSlotCount; ++i) {
+			const fxmlAtom *source = context->atomSlots[i];
+			if (source == fxml_null) {
+				continue;
+			}
+			FXML_ASSERT(source->id > 0 && source->id <= atomCount);
+			fxmlAtom *target = &atoms[source->id - 1];
+			*target = *source;
+			FXML_MEMCPY(base + stringPos, source->name, source->len);
+			fxml__StorePointer(&target->name, stringPos);
+			stringPos += source->len + 1;
+			fxml__StorePointer(&slots[i], atomOffset + (source->id - 1) * sizeof(fxmlAtom));
+		}
+
+		fxmlTag *tags = (fxmlTag *)(base + tagOffset);
+		tagIndex = 0;
+		for (const fxmlTag *tag = root; tag != fxml_null; tag = fxml__NextElement(tag, root)) {
+			const fxmlTag *attr = tag;
+			while (attr != fxml_null) {
+				fxmlTag *target = &tags[tagIndex++];
+				target->type = attr->type;
+				target->isClosed = attr->isClosed;
+				target->nameLen = attr->nameLen;
+				target->valueLen = attr->valueLen;
+				if (attr->atom != fxml_null) {
+					uint64_t atomPos = atomOffset + (attr->atom->id - 1) * sizeof(fxmlAtom);
+					fxml__StorePointer(&target->atom, atomPos);
+					fxml__StorePointer(&target->name, (uint64_t)(uintptr_t)atoms[attr->atom->id - 1].name);
+				} else if (attr->name != fxml_null) {
+					FXML_MEMCPY(base + stringPos, attr->name, attr->nameLen);
+					fxml__StorePointer(&target->name, stringPos);
+					stringPos += attr->nameLen + 1;
+				}
+				if (attr->value != fxml_null) {
+					FXML_MEMCPY(base + stringPos, attr->value, attr->valueLen);
+					fxml__StorePointer(&target->value, stringPos);
+					stringPos += attr->valueLen + 1;
+				}
+				if (attr != root) {
+					fxml__StorePointer(&target->parent, fxml__TagMapOffset(&map, attr->parent, tagOffset));
+					fxml__StorePointer(&target->nextSibling, fxml__TagMapOffset(&map, attr->nextSibling, tagOffset));
+					fxml__StorePointer(&target->prevSibling, fxml__TagMapOffset(&map, attr->prevSibling, tagOffset));
+				}
+				fxml__StorePointer(&target->firstAttribute, fxml__TagMapOffset(&map, attr->firstAttribute, tagOffset));
+				fxml__StorePointer(&target->lastAttribute, fxml__TagMapOffset(&map, attr->lastAttribute, tagOffset));
+				fxml__StorePointer(&target->firstChild, fxml__TagMapOffset(&map, attr->firstChild, tagOffset));
+				fxml__StorePointer(&target->lastChild, fxml__TagMapOffset(&map, attr->lastChild, tagOffset));
+				attr = (attr == tag) ? tag->firstAttribute : attr->nextSibling;
+			}
+		}
+		FXML_ASSERT(stringPos == stringOffset + stringSize);
+
+		FXML_FREE(map.values);
+		FXML_FREE(map.keys);
+		return(totalSize);
+	}
+
+	// Rebases a pointer from the old base to the new base, null stays null. Without apply the pointer is only validated.
+	static bool fxml__RelocatePointer(void *field, const uint64_t oldBase, uint8_t *newBase, const uint64_t totalSize, const bool apply) {
+		uintptr_t value;
+		FXML_MEMCPY(&value, field, sizeof(value));
+		if (value == 0) {
+			return true;
+		}
+		uint64_t offset = (uint64_t)value - oldBase;
+		if (offset >= totalSize) {
+			return false;
+		}
+		if (apply) {
+			value = (uintptr_t)(newBase + offset);
+			FXML_MEMCPY(field, &value, sizeof(value));
+		}
+		return(true);
+	}
+
+	// Rebases all pointers of the binary, stops at the first invalid pointer
+	static bool fxml__RelocateBinary(uint8_t *base, const fxml__BinaryHeader *header, const uint64_t oldBase, const bool apply) {
+		uint64_t totalSize = header->totalSize;
+		fxmlTag *tags = (fxmlTag *)(base + header->tagOffset);
+		for (uint64_t i = 0; i < header->tagCount; ++i) {
+			fxmlTag *tag = &tags[i];
+			bool isValid = fxml__RelocatePointer(&tag->name, oldBase, base, totalSize, apply) &&
+				fxml__RelocatePointer(&tag->value, oldBase, base, totalSize, apply) &&
+				fxml__RelocatePointer(&tag->atom, oldBase, base, totalSize, apply) &&
+				fxml__RelocatePointer(&tag->parent, oldBase, base, totalSize, apply) &&
+				fxml__RelocatePointer(&tag->nextSibling, oldBase, base, totalSize, apply) &&
+				fxml__RelocatePointer(&tag->prevSibling, oldBase, base, totalSize, apply) &&
+				fxml__RelocatePointer(&tag->firstAttribute, oldBase, base, totalSize, apply) &&
+				fxml__RelocatePointer(&tag->lastAttribute, oldBase, base, totalSize, apply) &&
+				fxml__RelocatePointer(&tag->firstChild, oldBase, base, totalSize, apply) &&
+				fxml__RelocatePointer(&tag->lastChild, oldBase, base, totalSize, apply);
+			if (!isValid) {
+				return false;
+			}
+			if (apply) {
+				tag->index = fxml_null;
+			}
+		}
+		fxmlAtom *atoms = (fxmlAtom *)(base + header->atomOffset);
+		for (uint64_t i = 0; i < header->atomCount; ++i) {
+			if (!fxml__RelocatePointer(&atoms[i].name, oldBase, base, totalSize, apply)) {
+				return false;
+			}
+		}
+		fxmlAtom **slots = (fxmlAtom **)(base + header->slotOffset);
+		for (uint64_t i = 0; i < header->slotCount; ++i) {
+			if (!fxml__RelocatePointer(&slots[i], oldBase, base, totalSize, apply)) {
+				return false;
+			}
+		}
+		return(true);
+	}
+
+	// Checks that count elements starting at offset are inside of the total size, without overflowing
+	static bool fxml__IsBinaryRange(const uint64_t offset, const uint64_t count, const uint64_t elementSize, const uint64_t totalSize) {
+		if (offset > totalSize) {
+			return false;
+		}
+		bool result = count <= (totalSize - offset) / elementSize;
+		return(result);
+	}
+
+	fxml_api fxmlTag *fxmlLoadBinary(void *data, const size_t dataSize, const uint64_t sourceHash, fxmlContext *outContext) {
+		if (data == fxml_null || outContext == fxml_null || dataSize < sizeof(fxml__BinaryHeader)) {
+			return fxml_null;
+		}
+		uint8_t *base = (uint8_t *)data;
+		fxml__BinaryHeader *header = (fxml__BinaryHeader *)base;
+		if (header->magic != FXML__BINARY_MAGIC || header->version != FXML__BINARY_VERSION) {
+			return fxml_null;
+		}
+		if (header->pointerSize != sizeof(void *) || header->tagSize != sizeof(fxmlTag)) {
+			// Written by a different architecture
+			return fxml_null;
+		}
+		if (header->sourceHash != sourceHash || header->totalSize > dataSize || header->tagCount == 0) {
+			return fxml_null;
+		}
+		uint64_t totalSize = header->totalSize;
+		if (!fxml__IsBinaryRange(header->tagOffset, header->tagCount, sizeof(fxmlTag), totalSize) ||
+			!fxml__IsBinaryRange(header->atomOffset, header->atomCount, sizeof(fxmlAtom), totalSize) ||
+			!fxml__IsBinaryRange(header->slotOffset, header->slotCount, sizeof(fxmlAtom *), totalSize) ||
+			!fxml__IsBinaryRange(header->stringOffset, header->stringSize, 1, totalSize) ||
+			(header->slotCount & (header->slotCount - 1)) != 0) {
+			return fxml_null;
+		}
+
+		// Pointers are offsets after saving, or absolute addresses from the last load.
+		// All pointers are validated first, so a invalid binary is never left half relocated.
+		uint64_t oldBase = header->base;
+		if (oldBase != (uint64_t)(uintptr_t)base) {
+			if (!fxml__RelocateBinary(base, header, oldBase, false)) {
+				return fxml_null;
+			}
+			fxml__RelocateBinary(base, header, oldBase, true);
+			header->base = (uint64_t)(uintptr_t)base;
+		}
+
+		FXML_MEMSET(outContext, 0, sizeof(*outContext));
+		outContext->data = data;
+		outContext->ptr = (const char *)data;
+		outContext->size = dataSize;
+		outContext->root = (fxmlTag *)(base + header->tagOffset);
+		outContext->atomSlots = (fxmlAtom **)(base + header->slotOffset);
+		outContext->atomSlotCount = (uint32_t)header->slotCount;
+		outContext->atomCount = (uint32_t)header->atomCount;
+		return(outContext->root);
+	}
+
+	//
+	// Streaming reader
+	//
+	static bool fxml__IsWhitespaceOnly(const char *ptr, const char *end) {
+		ptr = fxml__ScanWhitespaces(ptr, end);
+		while (ptr < end && fxml__IsWhitespace(*ptr)) {
+			++ptr;
+		}
+		return(ptr == end);
+	}
+
+	// Moves the data starting at keepFrom to the start of the buffer and reads more data after it.
+	// Returns false when nothing was read, because the stream has ended or the buffer is full.
+	static bool fxml__ReaderFill(fxmlReader *reader, const size_t keepFrom) {
+		if (reader->isEndOfStream) {
+			return false;
+		}
+		FXML_ASSERT(keepFrom <= reader->pos && reader->pos <= reader->end);
+		if (keepFrom > 0) {
+			size_t remaining = reader->end - keepFrom;
+			FXML_MEMMOVE(reader->buffer, reader->buffer + keepFrom, remaining);
+			reader->pos -= keepFrom;
+			reader->end = remaining;
+		}
+		if (reader->end == reader->capacity) {
+			return false;
+		}
+		size_t bytesRead = reader->read(reader->readUserData, reader->buffer + reader->end, reader->capacity - reader->end);
+		if (bytesRead == 0) {
+			reader->isEndOfStream = true;
+			return false;
+		}
+		FXML_ASSERT(bytesRead <= (reader->capacity - reader->end));
+		reader->end += bytesRead;
+		return(true);
+	}
+
+	static bool fxml__ReaderRequire(fxmlReader *reader, const size_t count) {
+		while ((reader->end - reader->pos) < count) {
+			if (!fxml__ReaderFill(reader, reader->pos)) {
+				return false;
+			}
+		}
+		return(true);
+	}
+
+	// Skips everything until after the terminator, reading more data when needed
+	static bool fxml__ReaderSkipPast(fxmlReader *reader, const char *terminator, const size_t terminatorLen) {
+		while (true) {
+			const char *end = reader->buffer + reader->end;
+			const char *p = reader->buffer + reader->pos;
+			while ((size_t)(end - p) >= terminatorLen) {
+				p = fxml__FindChar(p, end, terminator[0]);
+				if ((size_t)(end - p) < terminatorLen) {
+					break;
+				}
+				size_t matchLen = 0;
+				while (matchLen < terminatorLen && p[matchLen] == terminator[matchLen]) {
+					++matchLen;
+				}
+				if (matchLen == terminatorLen) {
+					reader->pos = (p - reader->buffer) + terminatorLen;
+					return true;
+				}
+				++p;
+			}
+			// The terminator may start in the remaining characters
+			reader->pos = p - reader->buffer;
+			if (!fxml__ReaderFill(reader, reader->pos)) {
+				return false;
+			}
+		}
+	}
+
+	// Finds the closing '>' of the tag at the read position, ignoring '>' inside of attribute values
+	static bool fxml__ReaderFindTagEnd(fxmlReader *reader, size_t *outTagEnd) {
+		while (true) {
+			const char *end = reader->buffer + reader->end;
+			const char *p = reader->buffer + reader->pos;
+			while (p < end) {
+				p = fxml__ScanUntil(p, end, '>', '\"');
+				while (p < end && *p != '>' && *p != '\"') {
+					++p;
+				}
+				if (p == end) {
+					break;
+				}
+				if (*p == '>') {
+					*outTagEnd = p - reader->buffer;
+					return true;
+				}
+				p = fxml__FindChar(p + 1, end, '\"');
+				if (p == end) {
+					break;
+				}
+				++p;
+			}
+			// Tag is incomplete, the entire tag must fit into the buffer
+			if (!fxml__ReaderFill(reader, reader->pos)) {
+				return false;
+			}
+		}
+	}
+
+	static const char *fxml__ReaderParseName(const char *p, const char *end) {
+		while (p < end && (fxml__IsAlphaNumeric(*p) || *p == '_' || *p == '-' || *p == ':' || *p == '.')) {
+			++p;
+		}
+		return(p);
+	}
+
+	static void fxml__ReaderDecode(fxmlReader *reader, fxmlString *str) {
+		if (reader->isSkipping) {
+			return;
+		}
+		// Decoding never grows the text, so it is decoded in place
+		fxmlContext decodeContext = FXML_ZERO_INIT;
+		str->len = fxml__DecodeString(&decodeContext, str, (char *)str->start);
+		if (decodeContext.isError) {
+			reader->isError = true;
+		}
+	}
+
+	// Emits the next attribute or the end of a self closing element, returns false when the tag is finished without a event
+	static bool fxml__ReaderNextInTag(fxmlReader *reader, fxmlEvent *outEvent) {
+		const char *tagEnd = reader->buffer + reader->tagEnd;
+		const char *p = reader->buffer + reader->pos;
+		while (p < tagEnd && fxml__IsWhitespace(*p)) {
+			++p;
+		}
+		if (p == tagEnd) {
+			reader->pos = reader->tagEnd + 1;
+			reader->isInTag = false;
+			return false;
+		}
+		if (*p == '/' && (p + 1) == tagEnd) {
+			reader->pos = reader->tagEnd + 1;
+			reader->isInTag = false;
+			--reader->depth;
+			reader->namesUsed = reader->nameOffsets[reader->depth];
+			outEvent->type = fxmlEventType_EndElement;
+			outEvent->name = reader->tagName;
+			outEvent->depth = reader->depth;
+			return true;
+		}
+		if (!fxml__IsAlpha(*p)) {
+			reader->isError = true;
+			return false;
+		}
+		const char *nameStart = p;
+		p = fxml__ReaderParseName(p, tagEnd);
+		const char *nameEnd = p;
+		if ((tagEnd - p) < 2 || p[0] != '=' || p[1] != '\"') {
+			reader->isError = true;
+			return false;
+		}
+		p += 2;
+		const char *valueStart = p;
+		p = fxml__FindChar(p, tagEnd, '\"');
+		if (p == tagEnd) {
+			reader->isError = true;
+			return false;
+		}
+		outEvent->type = fxmlEventType_Attribute;
+		outEvent->name.start = nameStart;
+		outEvent->name.len = nameEnd - nameStart;
+		outEvent->value.start = valueStart;
+		outEvent->value.len = p - valueStart;
+		outEvent->depth = reader->depth - 1;
+		fxml__ReaderDecode(reader, &outEvent->value);
+		reader->pos = (p + 1) - reader->buffer;
+		return(!reader->isError);
+	}
+
+	// Emits the start or the end of a element or skips a comment or declaration, returns false when there was no event
+	static bool fxml__ReaderNextTag(fxmlReader *reader, fxmlEvent *outEvent) {
+		if (!fxml__ReaderRequire(reader, 2)) {
+			reader->isError = true;
+			return false;
+		}
+		char c = reader->buffer[reader->pos + 1];
+		if (c == '?') {
+			reader->pos += 2;
+			if (!fxml__ReaderSkipPast(reader, "?>", 2)) {
+				reader->isError = true;
+			}
+			return false;
+		}
+		if (c == '!') {
+			if (!fxml__ReaderRequire(reader, 4) || reader->buffer[reader->pos + 2] != '-' || reader->buffer[reader->pos + 3] != '-') {
+				reader->isError = true;
+				return false;
+			}
+			reader->pos += 4;
+			if (!fxml__ReaderSkipPast(reader, "-->", 3)) {
+				reader->isError = true;
+			}
+			return false;
+		}
+
+		size_t tagEndOffset;
+		if (!fxml__ReaderFindTagEnd(reader, &tagEndOffset)) {
+			reader->isError = true;
+			return false;
+		}
+		const char *tagEnd = reader->buffer + tagEndOffset;
+		const char *nameStart = reader->buffer + reader->pos + ((c == '/') ? 2 : 1);
+		if (nameStart >= tagEnd || !fxml__IsAlpha(*nameStart)) {
+			reader->isError = true;
+			return false;
+		}
+		const char *nameEnd = fxml__ReaderParseName(nameStart, tagEnd);
+		size_t nameLen = nameEnd - nameStart;
+
+		if (c == '/') {
+			if (!fxml__IsWhitespaceOnly(nameEnd, tagEnd) || reader->depth == 0) {
+				reader->isError = true;
+				return false;
+			}
+			uint32_t openOffset = reader->nameOffsets[reader->depth - 1];
+			fxmlString closeName;
+			closeName.start = nameStart;
+			closeName.len = nameLen;
+			if (!fxml__IsEqualView(reader->names + openOffset, reader->namesUsed - openOffset, &closeName)) {
+				// Closing tag name does not match
+				reader->isError = true;
+				return false;
+			}
+			reader->namesUsed = openOffset;
+			--reader->depth;
+			reader->pos = tagEndOffset + 1;
+			outEvent->type = fxmlEventType_EndElement;
+		} else {
+			if (reader->depth == FXML_READER_MAX_DEPTH || nameLen > (FXML_READER_NAME_BUFFER_SIZE - reader->namesUsed)) {
+				reader->isError = true;
+				return false;
+			}
+			reader->nameOffsets[reader->depth++] = reader->namesUsed;
+			FXML_MEMCPY(reader->names + reader->namesUsed, nameStart, nameLen);
+			reader->namesUsed += (uint32_t)nameLen;
+			reader->pos = nameEnd - reader->buffer;
+			reader->tagEnd = tagEndOffset;
+			reader->isInTag = true;
+			outEvent->type = fxmlEventType_StartElement;
+		}
+		outEvent->name.start = nameStart;
+		outEvent->name.len = nameLen;
+		outEvent->depth = (c == '/') ? reader->depth : (reader->depth - 1);
+		reader->tagName = outEvent->name;
+		return true;
+	}
+
+	// Emits the text until the next tag, returns false when there was no event
+	static bool fxml__ReaderNextText(fxmlReader *reader, fxmlEvent *outEvent) {
+		const char *start = reader->buffer + reader->pos;
+		const char *end = reader->buffer + reader->end;
+		const char *textEnd = fxml__FindChar(start, end, '<');
+		bool isPartial = false;
+		if (textEnd == end) {
+			if (fxml__ReaderFill(reader, reader->pos)) {
+				// Try again with more data
+				return false;
+			}
+			if (reader->isEndOfStream || reader->depth == 0) {
+				// Text after the last tag is ignored
+				reader->pos = reader->end;
+				return false;
+			}
+			// The buffer is full of text, so the text is split but never inside of a entity
+			start = reader->buffer + reader->pos;
+			end = reader->buffer + reader->end;
+			textEnd = end;
+			const char *entity = end;
+			while (entity > start && *(entity - 1) != '&' && *(entity - 1) != ';') {
+				--entity;
+			}
+			if (entity > start && *(entity - 1) == '&') {
+				textEnd = entity - 1;
+			}
+			if (textEnd == start) {
+				reader->isError = true;
+				return false;
+			}
+			isPartial = true;
+		}
+		reader->pos = textEnd - reader->buffer;
+		if (reader->depth == 0 || fxml__IsWhitespaceOnly(start, textEnd)) {
+			return false;
+		}
+		outEvent->type = fxmlEventType_Text;
+		outEvent->value.start = start;
+		outEvent->value.len = textEnd - start;
+		outEvent->depth = reader->depth - 1;
+		outEvent->isPartial = isPartial;
+		fxml__ReaderDecode(reader, &outEvent->value);
+		return(!reader->isError);
+	}
+
+	fxml_api bool fxmlReaderInit(fxmlReader *reader, void *buffer, const size_t bufferSize, fxml_read_callback *read, void *userData) {
+		if (reader == fxml_null || buffer == fxml_null || read == fxml_null) {
+			return false;
+		}
+		if (bufferSize < FXML__MIN_READER_BUFFER_SIZE) {
+			return false;
+		}
+		FXML_MEMSET(reader, 0, sizeof(*reader));
+		reader->buffer = (char *)buffer;
+		reader->capacity = bufferSize;
+		reader->read = read;
+		reader->readUserData = userData;
+		return(true);
+	}
+
+	fxml_api bool fxmlReaderInitFromMemory(fxmlReader *reader, void *data, const size_t dataSize) {
+		if (reader == fxml_null || data == fxml_null || dataSize == 0) {
+			return false;
+		}
+		FXML_MEMSET(reader, 0, sizeof(*reader));
+		reader->buffer = (char *)data;
+		reader->capacity = dataSize;
+		reader->end = dataSize;
+		reader->isEndOfStream = true;
+		return(true);
+	}
+
+	fxml_api bool fxmlNextEvent(fxmlReader *reader, fxmlEvent *outEvent) {
+		if (reader == fxml_null || outEvent == fxml_null) {
+			return false;
+		}
+		FXML_MEMSET(outEvent, 0, sizeof(*outEvent));
+		if (!reader->isStarted) {
+			reader->isStarted = true;
+			if (fxml__ReaderRequire(reader, 3)) {
+				uint8_t *p = (uint8_t *)reader->buffer + reader->pos;
+				if (p[0] == 0xEF && p[1] == 0xBB && p[2] == 0xBF) {
+					// UTF-8 BOM
+					reader->pos += 3;
+				}
+			}
+		}
+		while (!reader->isError) {
+			bool hasEvent;
+			if (reader->isInTag) {
+				hasEvent = fxml__ReaderNextInTag(reader, outEvent);
+			} else if (reader->pos == reader->end) {
+				if (!fxml__ReaderFill(reader, reader->pos)) {
+					if (reader->depth > 0) {
+						// Elements not closed
+						reader->isError = true;
+					}
+					return false;
+				}
+				hasEvent = false;
+			} else if (reader->buffer[reader->pos] == '<') {
+				hasEvent = fxml__ReaderNextTag(reader, outEvent);
+			} else {
+				hasEvent = fxml__ReaderNextText(reader, outEvent);
+			}
+			if (hasEvent) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	fxml_api bool fxmlSkipElement(fxmlReader *reader) {
+		if (reader == fxml_null || reader->depth == 0) {
+			return false;
+		}
+		uint32_t elementDepth = reader->depth - 1;
+		bool result = false;
+		reader->isSkipping = true;
+		fxmlEvent event;
+		while (fxmlNextEvent(reader, &event)) {
+			if (event.type == fxmlEventType_EndElement && event.depth == elementDepth) {
+				result = true;
+				break;
+			}
+		}
+		reader->isSkipping = false;
+		return(result);
+	}
+
+	//
+	// Writer
+	//
+	static bool fxml__WriterFlush(fxmlWriter *writer) {
+		if (writer->write != fxml_null && writer->used > 0) {
+			size_t written = writer->write(writer->writeUserData, writer->buffer, writer->used);
+			if (written != writer->used) {
+				writer->isError = true;
+				return false;
+			}
+			writer->flushedSize += writer->used;
+			writer->used = 0;
+		}
+		return(true);
+	}
+
+	static bool fxml__WriterGrow(fxmlWriter *writer, const size_t minCapacity) {
+		size_t newCapacity = writer->capacity > 0 ? writer->capacity : FXML__MIN_ALLOC_SIZE;
+		while (newCapacity < minCapacity) {
+			newCapacity *= 2;
+		}
+		char *newBuffer = (char *)FXML_MALLOC(newCapacity);
+		if (newBuffer == fxml_null) {
+			writer->isError = true;
+			return false;
+		}
+		if (writer->buffer != fxml_null) {
+			FXML_MEMCPY(newBuffer, writer->buffer, writer->used);
+			FXML_FREE(writer->buffer);
+		}
+		writer->buffer = newBuffer;
+		writer->capacity = newCapacity;
+		return(true);
+	}
+
+	static void fxml__WriterPut(fxmlWriter *writer, const char *data, const size_t len) {
+		if (writer->isError || len == 0) {
+			return;
+		}
+		if ((writer->capacity - writer->used) < len) {
+			if (writer->write != fxml_null) {
+				if (!fxml__WriterFlush(writer)) {
+					return;
+				}
+				if (len > writer->capacity) {
+					// Larger than the buffer, written directly
+					if (writer->write(writer->writeUserData, data, len) != len) {
+						writer->isError = true;
+					} else {
+						writer->flushedSize += len;
+					}
+					return;
+				}
+			} else if (!fxml__WriterGrow(writer, writer->used + len)) {
+				return;
+			}
+		}
+		FXML_MEMCPY(writer->buffer + writer->used, data, len);
+		writer->used += len;
+	}
+
+	static size_t fxml__StringLength(const char *str) {
+		size_t result = 0;
+		if (str != fxml_null) {
+			while (str[result]) {
+				++result;
+			}
+		}
+		return(result);
+	}
+
+	// Writes the text with the special characters as entities, quotes are escaped for attribute values only
+	static void fxml__WriterPutEscaped(fxmlWriter *writer, const char *text, const size_t len, const bool isAttribute) {
+		const char *end = text + len;
+		const char *run = text;
+		for (const char *p = text; p < end; ++p) {
+			const char *entity;
+			size_t entityLen;
+			switch (*p) {
+				case '&':
+					entity = "&amp;";
+					entityLen = 5;
+					break;
+				case '<':
+					entity = "&lt;";
+					entityLen = 4;
+					break;
+				case '>':
+					entity = "&gt;";
+					entityLen = 4;
+					break;
+				case '\"':
+					if (!isAttribute) {
+						continue;
+					}
+					entity = "&quot;";
+					entityLen = 6;
+					break;
+				default:
+					continue;
+			}
+			fxml__WriterPut(writer, run, p - run);
+			fxml__WriterPut(writer, entity, entityLen);
+			run = p + 1;
+		}
+		fxml__WriterPut(writer, run, end - run);
+	}
+
+	static void fxml__WriterIndent(fxmlWriter *writer, const uint32_t depth) {
+		if (writer->indent == fxml_null) {
+			return;
+		}
+		if (writer->used > 0 || writer->flushedSize > 0) {
+			fxml__WriterPut(writer, "\n", 1);
+		}
+		size_t indentLen = fxml__StringLength(writer->indent);
+		for (uint32_t i = 0; i < depth; ++i) {
+			fxml__WriterPut(writer, writer->indent, indentLen);
+		}
+	}
+
+	// Closes the pending start tag, because the element gets content
+	static void fxml__WriterBeginContent(fxmlWriter *writer, const bool isText) {
+		if (writer->isInStartTag) {
+			fxml__WriterPut(writer, ">", 1);
+			writer->isInStartTag = false;
+		}
+		if (writer->depth > 0) {
+			uint8_t *flags = &writer->elementFlags[writer->depth - 1];
+			*flags |= isText ? FXML__WRITER_FLAG_TEXT : FXML__WRITER_FLAG_CHILDREN;
+		}
+	}
+
+	// Indentation is only added when the parent element has no text, otherwise the text would change
+	static void fxml__WriterIndentChild(fxmlWriter *writer) {
+		if (writer->depth == 0 || !(writer->elementFlags[writer->depth - 1] & FXML__WRITER_FLAG_TEXT)) {
+			fxml__WriterIndent(writer, writer->depth);
+		}
+	}
+
+	static bool fxml__WriteStartElement(fxmlWriter *writer, const char *name, const size_t nameLen) {
+		if (writer->isError) {
+			return false;
+		}
+		if (name == fxml_null || nameLen == 0 || writer->depth == FXML_WRITER_MAX_DEPTH) {
+			writer->isError = true;
+			return false;
+		}
+		fxml__WriterBeginContent(writer, false);
+		fxml__WriterIndentChild(writer);
+		fxml__WriterPut(writer, "<", 1);
+		fxml__WriterPut(writer, name, nameLen);
+		writer->elementNames[writer->depth].start = name;
+		writer->elementNames[writer->depth].len = nameLen;
+		writer->elementFlags[writer->depth] = 0;
+		++writer->depth;
+		writer->isInStartTag = true;
+		return(!writer->isError);
+	}
+
+	static bool fxml__WriteAttribute(fxmlWriter *writer, const char *name, const size_t nameLen, const char *value, const size_t valueLen) {
+		if (writer->isError) {
+			return false;
+		}
+		if (!writer->isInStartTag || name == fxml_null || nameLen == 0) {
+			// Attributes must be written directly after the start of the element
+			writer->isError = true;
+			return false;
+		}
+		fxml__WriterPut(writer, " ", 1);
+		fxml__WriterPut(writer, name, nameLen);
+		fxml__WriterPut(writer, "=\"", 2);
+		fxml__WriterPutEscaped(writer, value, valueLen, true);
+		fxml__WriterPut(writer, "\"", 1);
+		return(!writer->isError);
+	}
+
+	static bool fxml__WriteText(fxmlWriter *writer, const char *text, const size_t textLen) {
+		if (writer->isError) {
+			return false;
+		}
+		if (writer->depth == 0) {
+			// Text outside of the root element
+			writer->isError = true;
+			return false;
+		}
+		fxml__WriterBeginContent(writer, true);
+		fxml__WriterPutEscaped(writer, text, textLen, false);
+		return(!writer->isError);
+	}
+
+	static bool fxml__WriteComment(fxmlWriter *writer, const char *text, const size_t textLen) {
+		if (writer->isError) {
+			return false;
+		}
+		for (size_t i = 1; i < textLen; ++i) {
+			if (text[i - 1] == '-' && text[i] == '-') {
+				// Comments can not contain a double dash
+				writer->isError = true;
+				return false;
+			}
+		}
+		fxml__WriterBeginContent(writer, false);
+		fxml__WriterIndentChild(writer);
+		fxml__WriterPut(writer, "<!--", 4);
+		fxml__WriterPut(writer, text, textLen);
+		fxml__WriterPut(writer, "-->", 3);
+		return(!writer->isError);
+	}
+
+	static void fxml__WriterInit(fxmlWriter *writer, const char *indent) {
+		FXML_MEMSET(writer, 0, sizeof(*writer));
+		writer->indent = indent;
+	}
+
+	fxml_api bool fxmlWriterInit(fxmlWriter *writer, const char *indent) {
+		if (writer == fxml_null) {
+			return false;
+		}
+		fxml__WriterInit(writer, indent);
+		writer->isOwnBuffer = true;
+		return(true);
+	}
+
+	fxml_api bool fxmlWriterInitWithCallback(fxmlWriter *writer, void *buffer, const size_t bufferSize, fxml_write_callback *write, void *userData, const char *indent) {
+		if (writer == fxml_null || buffer == fxml_null || bufferSize == 0 || write == fxml_null) {
+			return false;
+		}
+		fxml__WriterInit(writer, indent);
+		writer->buffer = (char *)buffer;
+		writer->capacity = bufferSize;
+		writer->write = write;
+		writer->writeUserData = userData;
+		return(true);
+	}
+
+	fxml_api bool fxmlWriteDeclaration(fxmlWriter *writer) {
+		if (writer == fxml_null || writer->isError) {
+			return false;
+		}
+		if (writer->depth > 0 || writer->used > 0 || writer->flushedSize > 0) {
+			// Declaration must be first
+			writer->isError = true;
+			return false;
+		}
+		const char declaration[] = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>";
+		fxml__WriterPut(writer, declaration, sizeof(declaration) - 1);
+		return(!writer->isError);
+	}
+
+	fxml_api bool fxmlWriteStartElement(fxmlWriter *writer, const char *name) {
+		if (writer == fxml_null) {
+			return false;
+		}
+		return fxml__WriteStartElement(writer, name, fxml__StringLength(name));
+	}
+
+	fxml_api bool fxmlWriteAttribute(fxmlWriter *writer, const char *name, const char *value) {
+		if (writer == fxml_null) {
+			return false;
+		}
+		return fxml__WriteAttribute(writer, name, fxml__StringLength(name), value, fxml__StringLength(value));
+	}
+
+	fxml_api bool fxmlWriteText(fxmlWriter *writer, const char *text) {
+		if (writer == fxml_null) {
+			return false;
+		}
+		return fxml__WriteText(writer, text, fxml__StringLength(text));
+	}
+
+	fxml_api bool fxmlWriteComment(fxmlWriter *writer, const char *text) {
+		if (writer == fxml_null) {
+			return false;
+		}
+		return fxml__WriteComment(writer, text, fxml__StringLength(text));
+	}
+
+	fxml_api bool fxmlWriteEndElement(fxmlWriter *writer) {
+		if (writer == fxml_null || writer->isError) {
+			return false;
+		}
+		if (writer->depth == 0) {
+			writer->isError = true;
+			return false;
+		}
+		--writer->depth;
+		if (writer->isInStartTag) {
+			fxml__WriterPut(writer, "/>", 2);
+			writer->isInStartTag = false;
+		} else {
+			uint8_t flags = writer->elementFlags[writer->depth];
+			if ((flags & FXML__WRITER_FLAG_CHILDREN) && !(flags & FXML__WRITER_FLAG_TEXT)) {
+				fxml__WriterIndent(writer, writer->depth);
+			}
+			const fxmlString *name = &writer->elementNames[writer->depth];
+			fxml__WriterPut(writer, "</", 2);
+			fxml__WriterPut(writer, name->start, name->len);
+			fxml__WriterPut(writer, ">", 1);
+		}
+		return(!writer->isError);
+	}
+
+	fxml_api bool fxmlWriteTag(fxmlWriter *writer, const fxmlTag *tag) {
+		if (writer == fxml_null || tag == fxml_null || writer->isError) {
+			return false;
+		}
+		// Same traversal as fxml__TerminateInSitu(), the end tags are written when going up
+		const fxmlTag *root = tag;
+		while (tag != fxml_null) {
+			bool hasChildren = false;
+			switch (tag->type) {
+				case fxmlTagType_Root:
+					hasChildren = tag->firstChild != fxml_null;
+					break;
+
+				case fxmlTagType_Declaration:
+				{
+					if (writer->indent != fxml_null && (writer->used > 0 || writer->flushedSize > 0)) {
+						fxml__WriterPut(writer, "\n", 1);
+					}
+					fxml__WriterPut(writer, "<?", 2);
+					fxml__WriterPut(writer, tag->name, tag->nameLen);
+					for (const fxmlTag *attr = tag->firstAttribute; attr != fxml_null; attr = attr->nextSibling) {
+						fxml__WriterPut(writer, " ", 1);
+						fxml__WriterPut(writer, attr->name, attr->nameLen);
+						fxml__WriterPut(writer, "=\"", 2);
+						fxml__WriterPutEscaped(writer, attr->value, attr->valueLen, true);
+						fxml__WriterPut(writer, "\"", 1);
+					}
+					fxml__WriterPut(writer, "?>", 2);
+				} break;
+
+				case fxmlTagType_Comment:
+					fxml__WriteComment(writer, tag->value, tag->valueLen);
+					break;
+
+				case fxmlTagType_Element:
+				{
+					fxml__WriteStartElement(writer, tag->name, tag->nameLen);
+					for (const fxmlTag *attr = tag->firstAttribute; attr != fxml_null; attr = attr->nextSibling) {
+						fxml__WriteAttribute(writer, attr->name, attr->nameLen, attr->value, attr->valueLen);
+					}
+					// Whitespaces only are indentations of the source
+					if (tag->valueLen > 0 && !fxml__IsWhitespaceOnly(tag->value, tag->value + tag->valueLen)) {
+						fxml__WriteText(writer, tag->value, tag->valueLen);
+					}
+					hasChildren = tag->firstChild != fxml_null;
+					if (!hasChildren) {
+						fxmlWriteEndElement(writer);
+					}
+				} break;
+
+				default:
+					break;
+			}
+			if (writer->isError) {
+				return false;
+			}
+			if (hasChildren) {
+				tag = tag->firstChild;
+				continue;
+			}
+			while (tag != root && tag->nextSibling == fxml_null) {
+				tag = tag->parent;
+				if (tag->type == fxmlTagType_Element) {
+					fxmlWriteEndElement(writer);
+				}
+			}
+			tag = (tag == root) ? fxml_null : tag->nextSibling;
+		}
+		return(!writer->isError);
+	}
+
+	fxml_api bool fxmlWriterFlush(fxmlWriter *writer) {
+		if (writer == fxml_null || writer->isError) {
+			return false;
+		}
+		return fxml__WriterFlush(writer);
+	}
+
+	fxml_api void fxmlWriterFree(fxmlWriter *writer) {
+		if (writer != fxml_null) {
+			if (writer->isOwnBuffer && writer->buffer != fxml_null) {
+				FXML_FREE(writer->buffer);
+			}
+			FXML_MEMSET(writer, 0, sizeof(*writer));
+		}
+	}
+
+	//
+	// Query
+	//
+	static bool fxml__IsNameChar(const char c) {
+		bool result = fxml__IsAlphaNumeric(c) || c == '_' || c == '-' || c == '.' || c == ':';
+		return(result);
+	}
+
+	static const char *fxml__QueryParseName(const char *p, fxmlString *outName) {
+		outName->start = p;
+		while (fxml__IsNameChar(*p)) {
+			++p;
+		}
+		outName->len = p - outName->start;
+		return(p);
+	}
+
+	static const char *fxml__QueryParsePredicate(fxmlQuery *query, const char *p) {
+		FXML_ASSERT(*p == '[');
+		++p;
+		if (query->predicateCount == FXML_QUERY_MAX_PREDICATES) {
+			return fxml_null;
+		}
+		fxmlQueryPredicate *predicate = &query->predicates[query->predicateCount++];
+		if (*p == '@') {
+			p = fxml__QueryParseName(p + 1, &predicate->name);
+			if (predicate->name.len == 0) {
+				return fxml_null;
+			}
+			predicate->nameHash = fxml__HashString(predicate->name.start, predicate->name.len);
+			predicate->type = fxmlQueryPredicateType_HasAttribute;
+			if (*p == '=' || (p[0] == '!' && p[1] == '=')) {
+				predicate->type = (*p == '=') ? fxmlQueryPredicateType_AttributeEquals : fxmlQueryPredicateType_AttributeNotEquals;
+				p += (*p == '=') ? 1 : 2;
+				char quote = *p;
+				if (quote != '\'' && quote != '\"') {
+					return fxml_null;
+				}
+				++p;
+				predicate->value.start = p;
+				while (*p && *p != quote) {
+					++p;
+				}
+				if (*p != quote) {
+					return fxml_null;
+				}
+				predicate->value.len = p - predicate->value.start;
+				++p;
+			}
+		} else if (fxml__IsNumeric(*p)) {
+			uint32_t position = 0;
+			while (fxml__IsNumeric(*p)) {
+				position = position * 10 + (uint32_t)(*p - '0');
+				++p;
+			}
+			if (position == 0) {
+				// Positions start at one
+				return fxml_null;
+			}
+			predicate->type = fxmlQueryPredicateType_Position;
+			predicate->position = position;
+		} else {
+			return fxml_null;
+		}
+		if (*p != ']') {
+			return fxml_null;
+		}
+		return(p + 1);
+	}
+
+	fxml_api bool fxmlQueryCompile(fxmlQuery *query, const char *expression) {
+		if (query == fxml_null) {
+			return false;
+		}
+		FXML_MEMSET(query, 0, sizeof(*query));
+		if (expression == fxml_null || !*expression) {
+			return false;
+		}
+		const char *p = expression;
+		bool isDescendant = false;
+		if (*p == '/') {
+			query->isAbsolute = true;
+			++p;
+			if (*p == '/') {
+				isDescendant = true;
+				++p;
+			}
+		}
+		while (true) {
+			if (query->stepCount == FXML_QUERY_MAX_STEPS) {
+				return false;
+			}
+			fxmlQueryStep *step = &query->steps[query->stepCount++];
+			step->isDescendant = isDescendant;
+			step->predicateStart = query->predicateCount;
+			if (*p == '@') {
+				step->isAttribute = true;
+				++p;
+			}
+			if (*p == '*' && !step->isAttribute) {
+				step->isAnyName = true;
+				++p;
+			} else {
+				p = fxml__QueryParseName(p, &step->name);
+				if (step->name.len == 0) {
+					return false;
+				}
+				step->nameHash = fxml__HashString(step->name.start, step->name.len);
+			}
+			while (*p == '[' && !step->isAttribute) {
+				p = fxml__QueryParsePredicate(query, p);
+				if (p == fxml_null) {
+					return false;
+				}
+			}
+			step->predicateCount = query->predicateCount - step->predicateStart;
+			if (!*p) {
+				break;
+			}
+			if (*p != '/' || step->isAttribute) {
+				// Attributes must be the last step
+				return false;
+			}
+			++p;
+			isDescendant = false;
+			if (*p == '/') {
+				isDescendant = true;
+				++p;
+			}
+		}
+		fxmlQueryStep *lastStep = &query->steps[query->stepCount - 1];
+		if (lastStep->isAttribute && (lastStep->isDescendant || query->stepCount == 1)) {
+			// Attributes are only selected from the elements of the previous step
+			return false;
+		}
+		query->isValid = true;
+		return(true);
+	}
+
+	static bool fxml__QueryIsName(const fxmlTag *tag, const uint32_t hash, const fxmlString *name) {
+		if (tag->atom != fxml_null && tag->atom->hash != hash) {
+			return false;
+		}
+		return fxml__IsEqualView(tag->name, tag->nameLen, name);
+	}
+
+	static const fxmlTag *fxml__QueryFindAttribute(const fxmlTag *tag, const uint32_t hash, const fxmlString *name) {
+		if (tag->index != fxml_null && tag->index->attributes != fxml_null) {
+			uint32_t mask = tag->index->attributeMask;
+			uint32_t index = hash & mask;
+			while (tag->index->attributes[index] != fxml_null) {
+				const fxmlTag *attr = tag->index->attributes[index];
+				if (fxml__QueryIsName(attr, hash, name)) {
+					return(attr);
+				}
+				index = (index + 1) & mask;
+			}
+			return fxml_null;
+		}
+		for (const fxmlTag *attr = tag->firstAttribute; attr != fxml_null; attr = attr->nextSibling) {
+			if (attr->type == fxmlTagType_Attribute && fxml__QueryIsName(attr, hash, name)) {
+				return(attr);
+			}
+		}
+		return fxml_null;
+	}
+
+	// Tests the name and the first predicates of the step, positions count the siblings passing the predicates before
+	static bool fxml__QueryStepMatches(const fxmlQuery *query, const fxmlQueryStep *step, const fxmlTag *tag, const uint32_t predicateCount) {
+		if (tag->type != fxmlTagType_Element) {
+			return false;
+		}
+		if (!step->isAnyName && !fxml__QueryIsName(tag, step->nameHash, &step->name)) {
+			return false;
+		}
+		for (uint32_t predicateIndex = 0; predicateIndex < predicateCount; ++predicateIndex) {
+			const fxmlQueryPredicate *predicate = &query->predicates[step->predicateStart + predicateIndex];
+			if (predicate->type == fxmlQueryPredicateType_Position) {
+				uint32_t position = 1;
+				const fxmlTag *sibling = (tag->parent != fxml_null) ? tag->parent->firstChild : tag;
+				for (; sibling != tag && sibling != fxml_null; sibling = sibling->nextSibling) {
+					if (fxml__QueryStepMatches(query, step, sibling, predicateIndex)) {
+						++position;
+					}
+				}
+				if (position != predicate->position) {
+					return false;
+				}
+				continue;
+			}
+			const fxmlTag *attr = fxml__QueryFindAttribute(tag, predicate->nameHash, &predicate->name);
+			if (attr == fxml_null) {
+				return false;
+			}
+			if (predicate->type != fxmlQueryPredicateType_HasAttribute) {
+				bool isEqual = fxml__IsEqualView(attr->value, attr->valueLen, &predicate->value);
+				if (isEqual != (predicate->type == fxmlQueryPredicateType_AttributeEquals)) {
+					return false;
+				}
+			}
+		}
+		return(true);
+	}
+
+	typedef struct fxml__QueryResult {
+		fxmlTag **tags;
+		size_t maxTags;
+		size_t count;
+		bool isFirstOnly;
+	} fxml__QueryResult;
+
+	// Adds the element or its selected attribute to the result, returns false when the query is done
+	static bool fxml__QueryEmit(const fxmlQuery *query, fxmlTag *tag, fxml__QueryResult *result) {
+		const fxmlQueryStep *lastStep = &query->steps[query->stepCount - 1];
+		if (lastStep->isAttribute) {
+			tag = (fxmlTag *)fxml__QueryFindAttribute(tag, lastStep->nameHash, &lastStep->name);
+			if (tag == fxml_null) {
+				return true;
+			}
+		}
+		if (result->tags != fxml_null && result->count < result->maxTags) {
+			result->tags[result->count] = tag;
+		}
+		++result->count;
+		return(!result->isFirstOnly);
+	}
+
+	// Matches the steps from the last to the first descendant step, the first descendant step may be at any depth below the context
+	static bool fxml__QueryMatchBackwards(const fxmlQuery *query, const uint32_t stepIndex, const uint32_t firstStepIndex, const fxmlTag *tag, const fxmlTag *context) {
+		const fxmlQueryStep *step = &query->steps[stepIndex];
+		if (!fxml__QueryStepMatches(query, step, tag, step->predicateCount)) {
+			return false;
+		}
+		if (stepIndex == firstStepIndex) {
+			return true;
+		}
+		if (!step->isDescendant) {
+			const fxmlTag *parent = tag->parent;
+			if (parent == fxml_null || parent == context) {
+				return false;
+			}
+			return fxml__QueryMatchBackwards(query, stepIndex - 1, firstStepIndex, parent, context);
+		}
+		for (const fxmlTag *ancestor = tag->parent; ancestor != fxml_null && ancestor != context; ancestor = ancestor->parent) {
+			if (fxml__QueryMatchBackwards(query, stepIndex - 1, firstStepIndex, ancestor, context)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Child steps are matched from the top, because each context has distinct children.
+	// From the first descendant step, every element below the context is matched backwards once, so there are no duplicates.
+	static bool fxml__QueryRun(const fxmlQuery *query, const uint32_t stepIndex, fxmlTag *context, fxml__QueryResult *result) {
+		uint32_t elementStepCount = query->steps[query->stepCount - 1].isAttribute ? query->stepCount - 1 : query->stepCount;
+		if (stepIndex == elementStepCount) {
+			return fxml__QueryEmit(query, context, result);
+		}
+		const fxmlQueryStep *step = &query->steps[stepIndex];
+		if (!step->isDescendant) {
+			for (fxmlTag *child = context->firstChild; child != fxml_null; child = child->nextSibling) {
+				if (fxml__QueryStepMatches(query, step, child, step->predicateCount)) {
+					if (!fxml__QueryRun(query, stepIndex + 1, child, result)) {
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+		for (fxmlTag *tag = (fxmlTag *)fxml__NextElement(context, context); tag != fxml_null; tag = (fxmlTag *)fxml__NextElement(tag, context)) {
+			if (fxml__QueryMatchBackwards(query, elementStepCount - 1, stepIndex, tag, context)) {
+				if (!fxml__QueryEmit(query, tag, result)) {
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	static size_t fxml__QueryExecute(const fxmlQuery *query, fxmlTag *tag, fxml__QueryResult *result) {
+		if (query == fxml_null || !query->isValid || tag == fxml_null) {
+			return 0;
+		}
+		if (query->isAbsolute) {
+			while (tag->parent != fxml_null) {
+				tag = tag->parent;
+			}
+		}
+		fxml__QueryRun(query, 0, tag, result);
+		return(result->count);
+	}
+
+	fxml_api fxmlTag *fxmlQueryFirst(const fxmlQuery *query, fxmlTag *tag) {
+		fxmlTag *found = fxml_null;
+		fxml__QueryResult result = FXML_ZERO_INIT;
+		result.tags = &found;
+		result.maxTags = 1;
+		result.isFirstOnly = true;
+		fxml__QueryExecute(query, tag, &result);
+		return(found);
+	}
+
+	fxml_api size_t fxmlQueryAll(const fxmlQuery *query, fxmlTag *tag, fxmlTag **outTags, const size_t maxTags) {
+		fxml__QueryResult result = FXML_ZERO_INIT;
+		result.tags = outTags;
+		result.maxTags = maxTags;
+		size_t count = fxml__QueryExecute(query, tag, &result);
+		return(count);
+	}
+
 #ifdef __cplusplus
 	}
 #endif // __cplusplus